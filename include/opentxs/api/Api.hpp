@@ -39,6 +39,8 @@
 #ifndef OPENTXS_CORE_API_API_HPP
 #define OPENTXS_CORE_API_API_HPP
 
+#include "opentxs/core/util/RecursiveMutex.hpp"
+
 #include <memory>
 #include <mutex>
 #include <string>
@@ -77,7 +79,7 @@ private:
     std::unique_ptr<OT_ME> ot_me_;
     std::unique_ptr<OTME_too> otme_too_;
 
-    mutable std::recursive_mutex lock_;
+    mutable RecursiveMutex lock_;
 
     void Cleanup();
     void Init();
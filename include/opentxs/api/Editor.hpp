@@ -107,6 +107,9 @@ public:
 
     ~Editor()
     {
+        // Moved from
+        if (nullptr == object_) { return; }
+
         if (locked_) {
             auto& callback = *locked_save_callback_;
             callback(object_, *object_lock_);
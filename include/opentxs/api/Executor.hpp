@@ -0,0 +1,191 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_API_EXECUTOR_HPP
+#define OPENTXS_API_EXECUTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace opentxs
+{
+
+class OT;
+
+/** \brief Shared pool of worker threads for background work.
+ *
+ *  Tasks are queued by priority and run first-in, first-out within a
+ *  priority. The number of workers is fixed when the pool starts, so a burst
+ *  of tasks grows the queue instead of the number of threads. Tasks which
+ *  have not started when the pool shuts down are discarded.
+ *
+ *  Long running work (storage garbage collection, DHT publishing, server
+ *  refreshes) is submitted as Priority::BACKGROUND. Those tasks wait in a
+ *  lane of their own and only run on up to half of the workers, so they can
+ *  not hold every worker while shorter tasks queue behind them.
+ */
+class Executor
+{
+public:
+    typedef std::function<void()> Task;
+
+    enum class Priority : std::uint8_t {
+        BACKGROUND = 0,
+        LOW = 1,
+        NORMAL = 2,
+        HIGH = 3
+    };
+
+    /** Cancels the tasks it was submitted with. Copies share one flag.
+     *
+     *  A task which has not started when Cancel() is called is discarded
+     *  instead of run. A task which is already running is not interrupted,
+     *  but may check Cancelled() to stop early. */
+    class Cancellation
+    {
+    public:
+        void Cancel() const { flag_->store(true); }
+        bool Cancelled() const { return flag_->load(); }
+
+        Cancellation()
+            : flag_(std::make_shared<std::atomic<bool>>(false))
+        {
+        }
+
+    private:
+        friend class Executor;
+
+        std::shared_ptr<std::atomic<bool>> flag_;
+    };
+
+    struct Metrics {
+        std::size_t workers_{0};
+        std::size_t queued_{0};
+        std::size_t running_{0};
+        std::uint64_t submitted_{0};
+        std::uint64_t completed_{0};
+        std::uint64_t cancelled_{0};
+        /** Time between submission and start, averaged over every task which
+         *  has started */
+        std::chrono::microseconds average_wait_{0};
+        std::chrono::microseconds max_wait_{0};
+        /** Time spent running, averaged over every completed task */
+        std::chrono::microseconds average_run_{0};
+    };
+
+private:
+    friend class OT;
+
+    typedef std::chrono::steady_clock Clock;
+
+    struct Item {
+        Priority priority_{Priority::NORMAL};
+        std::uint64_t sequence_{0};
+        Clock::time_point queued_;
+        Task task_;
+        std::shared_ptr<const std::atomic<bool>> cancelled_;
+
+        bool operator<(const Item& rhs) const;
+    };
+
+    mutable std::mutex lock_;
+    std::condition_variable signal_;
+    std::priority_queue<Item> queue_;
+    std::queue<Item> background_;
+    std::vector<std::thread> workers_;
+    std::atomic<bool> shutdown_;
+    std::size_t background_limit_{1};
+    std::size_t running_{0};
+    std::size_t running_background_{0};
+    std::uint64_t submitted_{0};
+    std::uint64_t completed_{0};
+    std::uint64_t cancelled_{0};
+    std::uint64_t started_{0};
+    Clock::duration total_wait_{0};
+    Clock::duration max_wait_{0};
+    Clock::duration total_run_{0};
+
+    bool ready() const;
+    void run();
+    bool submit(
+        const Task& task,
+        const Priority priority,
+        const std::shared_ptr<const std::atomic<bool>>& cancelled);
+
+    void Shutdown();
+
+    explicit Executor(const std::size_t workers);
+    Executor() = delete;
+    Executor(const Executor&) = delete;
+    Executor(Executor&&) = delete;
+    Executor& operator=(const Executor&) = delete;
+    Executor& operator=(Executor&&) = delete;
+
+public:
+    /** Calls task(0) through task(count - 1) and returns once every call
+     *  has finished. The calling thread takes part, helped by queued tasks,
+     *  so that at most threads calls run at once. A helper which only
+     *  starts after the caller ran out of work does nothing, so the caller
+     *  never waits for the queue and may itself be running on a worker. */
+    void Parallel(
+        const std::size_t count,
+        const std::function<void(const std::size_t)>& task,
+        const std::size_t threads,
+        const Priority priority = Priority::NORMAL);
+    /** Queues a task. Returns false if the pool has shut down. */
+    bool Submit(const Task& task, const Priority priority = Priority::NORMAL);
+    /** Queues a task which is discarded if cancel is cancelled before the
+     *  task starts. */
+    bool Submit(
+        const Task& task,
+        const Cancellation& cancel,
+        const Priority priority = Priority::NORMAL);
+    Metrics Stats() const;
+
+    ~Executor();
+};
+}  // namespace opentxs
+#endif  // OPENTXS_API_EXECUTOR_HPP
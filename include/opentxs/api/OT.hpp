@@ -61,6 +61,7 @@ class Api;
 class AppLoader;
 class CryptoEngine;
 class Dht;
+class Executor;
 class Identity;
 class OTAPI_Wrap;
 class ServerLoader;
@@ -94,6 +95,7 @@ private:
     std::unique_ptr<Settings> config_;
     std::unique_ptr<CryptoEngine> crypto_;
     std::unique_ptr<Dht> dht_;
+    std::unique_ptr<class Executor> executor_;
     std::unique_ptr<Storage> storage_;
     std::unique_ptr<Wallet> contract_manager_;
     std::unique_ptr<class Identity> identity_;
@@ -127,6 +129,7 @@ private:
     void Init_Contracts();
     void Init_Crypto();
     void Init_Dht();
+    void Init_Executor();
     void Init_Identity();
     void Init_Periodic();
     void Init_Storage();
@@ -147,6 +150,7 @@ public:
     CryptoEngine& Crypto() const;
     Storage& DB() const;
     Dht& DHT() const;
+    class Executor& Executor() const;
     class Identity& Identity() const;
     class ZMQ& ZMQ() const;
 
@@ -48,7 +48,9 @@
 #include "opentxs/storage/Storage.hpp"
 
 #include <chrono>
+#include <cstdint>
 #include <ctime>
+#include <future>
 #include <list>
 #include <map>
 #include <mutex>
@@ -81,8 +83,13 @@ typedef std::shared_ptr<const class UnitDefinition> ConstUnitDefinition;
 class Wallet
 {
 private:
-    typedef std::pair<std::mutex, std::shared_ptr<class Nym>> NymLock;
-    typedef std::map<std::string, NymLock> NymMap;
+    // Resolves to the loaded and verified nym, or to nullptr if the nym
+    // could not be loaded or did not verify.
+    typedef std::shared_future<std::shared_ptr<class Nym>> NymFuture;
+    typedef std::map<std::string, NymFuture> NymMap;
+    // Hash and revision of the credential index which was last verified
+    typedef std::pair<std::string, std::uint64_t> NymVersion;
+    typedef std::map<std::string, NymVersion> VerifiedNymMap;
     typedef
         std::map<std::string, std::shared_ptr<class ServerContract>> ServerMap;
     typedef
@@ -93,6 +100,7 @@ private:
     friend OT;
 
     NymMap nym_map_;
+    VerifiedNymMap verified_nyms_;
     ServerMap server_map_;
     UnitMap unit_map_;
     ContextMap context_map_;
@@ -106,8 +114,17 @@ private:
     std::shared_ptr<class Context> context(
         const Identifier& localNymID,
         const Identifier& remoteNymID);
+    /** Removes id from nym_map_ if it resolved to nullptr */
+    void forget_nym(const std::string& id);
+    std::shared_ptr<class Nym> load_nym(
+        const Identifier& id,
+        bool& loaded);
     std::mutex& peer_lock(const std::string& nymID) const;
     Identifier ServerToNym(Identifier& serverID);
+    bool verify_nym(
+        const std::string& id,
+        const proto::CredentialIndex& serialized,
+        const class Nym& nym);
 
     /**   Save an instantiated unit definition to storage and add to internal
      *    map.
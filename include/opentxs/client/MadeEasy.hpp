@@ -39,9 +39,13 @@
 #ifndef OPENTXS_CLIENT_MADEEASY_HPP
 #define OPENTXS_CLIENT_MADEEASY_HPP
 
+#include "opentxs/core/util/RecursiveMutex.hpp"
+
 #include <cstdint>
+#include <map>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace opentxs
@@ -54,9 +58,27 @@ class MadeEasy
 private:
     friend class Api;
 
-    std::recursive_mutex& lock_;
+    typedef std::pair<std::string, std::string> ContextID;
+
+    RecursiveMutex& lock_;
+    mutable std::mutex context_map_lock_;
+    mutable std::map<ContextID, std::recursive_mutex> context_locks_;
+
+    std::recursive_mutex& context_lock(
+        const std::string& notaryID,
+        const std::string& nymID) const;
+    /** Locks a (notary, nym) context for a whole multi-message sequence.
+     *
+     *  The context lock is always taken before the API lock, since every
+     *  step of a sequence locks lock_ for itself. A caller that already holds
+     *  lock_ (OT_ME, commands) releases every level of it while it waits for
+     *  the context, then takes it back at the same depth, so two sequences
+     *  never wait on each other in opposite order. */
+    std::unique_lock<std::recursive_mutex> lock_context(
+        const std::string& notaryID,
+        const std::string& nymID) const;
 
-    MadeEasy(std::recursive_mutex& lock);
+    MadeEasy(RecursiveMutex& lock);
     MadeEasy() = delete;
     MadeEasy(const MadeEasy&) = delete;
     MadeEasy(const MadeEasy&&) = delete;
@@ -43,6 +43,7 @@
 #include "opentxs/core/Proto.hpp"
 #include "opentxs/core/Types.hpp"
 #include "opentxs/core/util/Common.hpp"
+#include "opentxs/core/util/RecursiveMutex.hpp"
 
 #include <mutex>
 #include <stdint.h>
@@ -71,7 +72,7 @@ private:
     Wallet& wallet_;
     ZMQ& zeromq_;
     OT_API& ot_api_;
-    std::recursive_mutex& lock_;
+    RecursiveMutex& lock_;
 
     OTAPI_Exec(
         Settings& config,
@@ -80,7 +81,7 @@ private:
         Wallet& wallet,
         ZMQ& zeromq,
         OT_API& otapi,
-        std::recursive_mutex& lock);
+        RecursiveMutex& lock);
     OTAPI_Exec() = delete;
     OTAPI_Exec(const OTAPI_Exec&) = delete;
     OTAPI_Exec(OTAPI_Exec&&) = delete;
@@ -3816,6 +3817,18 @@ public:
         const int32_t& nBoxType,       // 0/nymbox, 1/inbox, 2/outbox
         const int64_t& TRANSACTION_NUMBER) const;
 
+    /** Same as getBoxReceipt, but for a NumList of TRANSACTION_NUMBERS from
+    // the same box. The server may answer with only some of them; call
+    // DoesBoxReceiptExist afterwards and request whatever is still missing.
+    // Return value is the same as for getBoxReceipt.
+    */
+    EXPORT int32_t getBoxReceipts(
+        const std::string& NOTARY_ID, const std::string& NYM_ID,
+        const std::string& ACCOUNT_ID, // If for Nymbox (vs inbox/outbox) then
+                                       // pass NYM_ID in this field also.
+        const int32_t& nBoxType,       // 0/nymbox, 1/inbox, 2/outbox
+        const std::string& TRANSACTION_NUMBERS) const;
+
     EXPORT bool DoesBoxReceiptExist(
         const std::string& NOTARY_ID,
         const std::string& NYM_ID,     // Unused here for now, but still
@@ -4160,6 +4173,10 @@ public:
 
     EXPORT void FlushMessageBuffer() const;
 
+    // Only flushes the replies for NYM_ID on NOTARY_ID.
+    EXPORT void FlushMessageBuffer(const std::string& NOTARY_ID,
+                                   const std::string& NYM_ID) const;
+
     // Outgoing:
 
     EXPORT std::string GetSentMessage(const int64_t& REQUEST_NUMBER,
@@ -3620,6 +3620,14 @@ public:
         const int32_t& nBoxType,       // 0/nymbox, 1/inbox, 2/outbox
         const int64_t& TRANSACTION_NUMBER);
 
+    // Same as getBoxReceipt, for a NumList of TRANSACTION_NUMBERS.
+    EXPORT static int32_t getBoxReceipts(
+        const std::string& NOTARY_ID, const std::string& NYM_ID,
+        const std::string& ACCOUNT_ID, // If for Nymbox (vs inbox/outbox) then
+                                       // pass NYM_ID in this field also.
+        const int32_t& nBoxType,       // 0/nymbox, 1/inbox, 2/outbox
+        const std::string& TRANSACTION_NUMBERS);
+
     //
     EXPORT static bool DoesBoxReceiptExist(
         const std::string& NOTARY_ID,
@@ -3960,6 +3968,9 @@ public:
 
     EXPORT static void FlushMessageBuffer();
 
+    EXPORT static void FlushMessageBuffer(const std::string& NOTARY_ID,
+                                          const std::string& NYM_ID);
+
     // Outgoing:
 
     EXPORT static std::string GetSentMessage(const int64_t& REQUEST_NUMBER,
@@ -115,6 +115,14 @@ private:
         const Message& theReply,
         Ledger* pNymbox,
         ProcessServerReplyArgs& args);
+    bool processServerReplyGetBoxReceipts(
+        const Message& theReply,
+        ProcessServerReplyArgs& args);
+    void processBoxReceipt(
+        const String& strTransType,
+        const int64_t lBoxType,
+        const int64_t lTransactionNum,
+        ProcessServerReplyArgs& args);
     bool processServerReplyProcessInbox(
         const Message& theReply,
         Ledger* pNymbox,
@@ -39,9 +39,11 @@
 #ifndef OPENTXS_CLIENT_OTME_TOO_HPP
 #define OPENTXS_CLIENT_OTME_TOO_HPP
 
+#include "opentxs/api/Executor.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Proto.hpp"
 #include "opentxs/core/Types.hpp"
+#include "opentxs/core/util/RecursiveMutex.hpp"
 
 #include <atomic>
 #include <cstdint>
@@ -119,7 +121,7 @@ private:
         > ContactMetadata;
     typedef std::map<std::uint64_t, ContactMetadata> ContactMap;
 
-    std::recursive_mutex& api_lock_;
+    RecursiveMutex& api_lock_;
     Settings& config_;
     OT_API& ot_api_;
     OTAPI_Exec& exec_;
@@ -140,6 +142,8 @@ private:
     mutable std::mutex contact_lock_;
     mutable std::unique_ptr<std::thread> pairing_thread_;
     mutable std::unique_ptr<std::thread> refresh_thread_;
+    // Discards queued server refreshes once shutdown begins
+    Executor::Cancellation refresh_cancel_;
     std::map<Identifier, Thread> threads_;
     MessagabilityMap messagability_map_;
     PairedNodes paired_nodes_;
@@ -274,6 +278,9 @@ private:
         const std::string& server,
         const bool forcePrimary) const;
     void refresh_contacts(nymAccountMap& nymsToCheck);
+    void refresh_server(
+        const std::string& serverID,
+        const serverTaskMap::mapped_type& tasks);
     void refresh_thread();
     bool request_connection(
         const std::string& nym,
@@ -325,7 +332,7 @@ private:
     bool write_contact_data(const Lock& lock);
 
     OTME_too(
-        std::recursive_mutex& lock,
+        RecursiveMutex& lock,
         Settings& config,
         OT_API& otapi,
         OTAPI_Exec& exec,
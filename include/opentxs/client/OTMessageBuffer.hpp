@@ -59,6 +59,9 @@ public:
     EXPORT ~OTMessageBuffer();
 
     EXPORT void Clear();
+    // Discards only the replies for one Nym on one server, leaving any
+    // replies that other callers are still waiting on.
+    EXPORT void Clear(const String& notaryID, const String& nymID);
     // message must be heap-allocated. Takes ownership.
     EXPORT void Push(std::shared_ptr<Message> message);
     // Caller IS responsible to delete.
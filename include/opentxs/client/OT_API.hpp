@@ -43,6 +43,7 @@
 #include "opentxs/core/contract/peer/PeerObject.hpp"
 #include "opentxs/core/crypto/NymParameters.hpp"
 #include "opentxs/core/util/Common.hpp"
+#include "opentxs/core/util/RecursiveMutex.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/Types.hpp"
 
@@ -109,7 +110,7 @@ private:
     OTWallet* m_pWallet{nullptr};
     OTClient* m_pClient{nullptr};
 
-    std::recursive_mutex& lock_;
+    RecursiveMutex& lock_;
 
     bool Init();
     bool Cleanup();
@@ -126,7 +127,7 @@ private:
         Storage& storage,
         Wallet& wallet,
         ZMQ& zmq,
-        std::recursive_mutex& lock);
+        RecursiveMutex& lock);
     OT_API() = delete;
     OT_API(const OT_API&) = delete;
     OT_API(OT_API&&) = delete;
@@ -645,6 +646,8 @@ public:
         const int64_t& lRequestNumber, const Identifier& NOTARY_ID,
         const Identifier& NYM_ID) const;
     void FlushMessageBuffer();
+    void FlushMessageBuffer(const Identifier& NOTARY_ID,
+                            const Identifier& NYM_ID);
     // Outgoing
     EXPORT Message* GetSentMessage(const int64_t& lRequestNumber,
                                    const Identifier& NOTARY_ID,
@@ -730,6 +733,15 @@ public:
                       int32_t nBoxType, // 0/nymbox, 1/inbox, 2/outbox
                       const int64_t& lTransactionNum) const;
 
+    // Requests several box receipts from the same box in one message.
+    EXPORT int32_t
+        getBoxReceipts(const Identifier& NOTARY_ID, const Identifier& NYM_ID,
+                       const Identifier& ACCOUNT_ID, // If for Nymbox (vs
+                                                     // inbox/outbox) then pass
+                       // NYM_ID in this field also.
+                       int32_t nBoxType, // 0/nymbox, 1/inbox, 2/outbox
+                       const NumList& transactionNums) const;
+
     EXPORT int32_t
         queryInstrumentDefinitions(const Identifier& NOTARY_ID,
                                    const Identifier& NYM_ID,
@@ -39,6 +39,8 @@
 #ifndef OPENTXS_CLIENT_OT_ME_HPP
 #define OPENTXS_CLIENT_OT_ME_HPP
 
+#include "opentxs/core/util/RecursiveMutex.hpp"
+
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -56,10 +58,10 @@ class OT_ME
 private:
     friend class Api;
 
-    std::recursive_mutex& lock_;
+    RecursiveMutex& lock_;
     const MadeEasy& made_easy_;
 
-    OT_ME(std::recursive_mutex& lock, MadeEasy& madeEasy);
+    OT_ME(RecursiveMutex& lock, MadeEasy& madeEasy);
     OT_ME() = delete;
     OT_ME(const OT_ME&) = delete;
     OT_ME(const OT_ME&&) = delete;
@@ -136,6 +136,7 @@
 #include "opentxs/core/util/Common.hpp"
 
 #include <array>
+#include <set>
 
 #define OT_UTILITY_OT
 
@@ -200,6 +201,14 @@ public:
         const std::string& notaryID, const std::string& nymID,
         const std::string& accountID, int32_t nBoxType,
         int64_t strTransactionNum);
+    EXPORT OT_UTILITY_OT bool getBoxReceiptsLowLevel(
+        const std::string& notaryID, const std::string& nymID,
+        const std::string& accountID, int32_t nBoxType,
+        const std::set<int64_t>& transactionNums, bool& bWasSent);
+    EXPORT OT_UTILITY_OT bool getBoxReceiptsWithErrorCorrection(
+        const std::string& notaryID, const std::string& nymID,
+        const std::string& accountID, int32_t nBoxType,
+        const std::set<int64_t>& transactionNums);
     EXPORT OT_UTILITY_OT int32_t
         getInboxAccount(const std::string& notaryID, const std::string& nymID,
                         const std::string& accountID, bool& bWasSentInbox,
@@ -41,6 +41,7 @@
 
 #include "opentxs/core/contract/Signable.hpp"
 #include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/NumberSet.hpp"
 #include "opentxs/core/Proto.hpp"
 #include "opentxs/core/Types.hpp"
 
@@ -68,7 +69,7 @@ private:
     Identifier local_nymbox_hash_;
     Identifier remote_nymbox_hash_;
     std::atomic<RequestNumber> request_number_;
-    std::set<RequestNumber> acknowledged_request_numbers_;
+    NumberSet acknowledged_request_numbers_;
 
     proto::Context contract(const Lock& lock) const;
     proto::Context IDVersion(const Lock& lock) const;
@@ -94,8 +95,8 @@ protected:
     typedef std::unique_lock<std::mutex> Lock;
 
     std::shared_ptr<const class Nym> remote_nym_;
-    std::set<TransactionNumber> available_transaction_numbers_;
-    std::set<TransactionNumber> issued_transaction_numbers_;
+    NumberSet available_transaction_numbers_;
+    NumberSet issued_transaction_numbers_;
 
     Identifier GetID(const Lock& lock) const override;
 
@@ -39,10 +39,10 @@
 #ifndef OPENTXS_CONSENSUS_TRANSACTIONSTATEMENT_HPP
 #define OPENTXS_CONSENSUS_TRANSACTIONSTATEMENT_HPP
 
+#include "opentxs/core/NumberSet.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/Types.hpp"
 
-#include <set>
 #include <string>
 
 namespace opentxs
@@ -54,8 +54,8 @@ private:
     std::string version_;
     std::string nym_id_;
     std::string notary_;
-    std::set<TransactionNumber> available_;
-    std::set<TransactionNumber> issued_;
+    NumberSet available_;
+    NumberSet issued_;
 
     TransactionStatement() = delete;
     TransactionStatement(const TransactionStatement& rhs) = delete;
@@ -65,14 +65,14 @@ private:
 public:
     TransactionStatement(
         const std::string& notary,
-        const std::set<TransactionNumber>& issued,
-        const std::set<TransactionNumber>& available);
+        const NumberSet& issued,
+        const NumberSet& available);
     TransactionStatement(const String& serialized);
     TransactionStatement(TransactionStatement&& rhs) = default;
 
     explicit operator String() const;
 
-    const std::set<TransactionNumber>& Issued() const;
+    const NumberSet& Issued() const;
     const std::string& Notary() const;
 
     void Remove(const TransactionNumber& number);
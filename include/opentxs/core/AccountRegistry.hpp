@@ -0,0 +1,110 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_ACCOUNTREGISTRY_HPP
+#define OPENTXS_CORE_ACCOUNTREGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+
+/** The list of "user" accounts for one instrument definition, split into
+ *  pages.
+ *
+ *  Each account is assigned to a page by a hash of its ID, so registering or
+ *  removing an account rewrites one page and the small index instead of the
+ *  whole list. Visit() loads one page at a time.
+ *
+ *  The index, "<unitID>.a.idx", holds the number of pages and the number of
+ *  accounts on each. Page n is stored as "<unitID>.a.<n>". The flat
+ *  "<unitID>.a" file written by older versions is split into pages the first
+ *  time the registry is opened.
+ *
+ *  Not thread safe. UnitDefinition serializes access under its own lock.
+ */
+class AccountRegistry
+{
+public:
+    /** Receives the account IDs stored on one page */
+    typedef std::function<bool(const std::vector<std::string>&)> PageVisitor;
+
+    EXPORT explicit AccountRegistry(const std::string& unitID);
+
+    /** Registers an account. Succeeds if it was already registered. */
+    EXPORT bool Add(const std::string& accountID);
+    EXPORT std::size_t Count() const;
+    /** Removes an account. Succeeds if it was not registered. */
+    EXPORT bool Remove(const std::string& accountID);
+    /** Calls visitor once per non-empty page. Stops if visitor returns false. */
+    EXPORT bool Visit(const PageVisitor& visitor) const;
+
+private:
+    typedef std::map<std::string, std::string> Page;
+
+    static const std::size_t DEFAULT_PAGES;
+
+    const std::string unit_id_;
+    const std::string legacy_file_;
+    const std::string index_file_;
+    bool valid_{false};
+    std::vector<std::int64_t> page_counts_;
+
+    std::string page_file(const std::size_t page) const;
+    std::size_t page_for(const std::string& accountID) const;
+
+    bool load_index();
+    bool load_page(const std::size_t page, Page& output) const;
+    bool migrate();
+    bool save_index() const;
+    bool save_page(const std::size_t page, const Page& input) const;
+
+    AccountRegistry() = delete;
+    AccountRegistry(const AccountRegistry&) = delete;
+    AccountRegistry(AccountRegistry&&) = delete;
+    AccountRegistry& operator=(const AccountRegistry&) = delete;
+    AccountRegistry& operator=(AccountRegistry&&) = delete;
+};
+}  // namespace opentxs
+
+#endif  // OPENTXS_CORE_ACCOUNTREGISTRY_HPP
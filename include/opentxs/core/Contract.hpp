@@ -39,6 +39,7 @@
 #ifndef OPENTXS_CORE_CONTRACT_HPP
 #define OPENTXS_CORE_CONTRACT_HPP
 
+#include "opentxs/core/crypto/CryptoAsymmetric.hpp"
 #include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Nym.hpp"
@@ -52,6 +53,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace irr
 {
@@ -71,6 +73,7 @@ namespace opentxs
 
 class OTASCIIArmor;
 class OTAsymmetricKey;
+class OTData;
 class OTPasswordData;
 class OTSignature;
 class Tag;
@@ -81,6 +84,26 @@ String trim(const String& str);
 
 class Contract
 {
+private:
+    /** The bytes covered by the signatures (m_xmlUnsigned) */
+    OTData signed_plaintext() const;
+    /** cKeyType is 'S' for the signing key or 'A' for the authentication
+     * key. The digest of plaintext is calculated on first use and reused by
+     * subsequent calls with the same plaintext. */
+    bool verify_signature(
+        const Nym& theNym,
+        const OTSignature& theSignature,
+        const char cKeyType,
+        const OTData& plaintext,
+        OTData& digest,
+        const OTPasswordData* pPWData) const;
+    bool verify_signature(
+        const OTAsymmetricKey& theKey,
+        const OTSignature& theSignature,
+        const proto::HashType hashType,
+        const OTData& plaintext,
+        OTData& digest,
+        const OTPasswordData* pPWData) const;
 
 protected:
     /** Contract name as shown in the wallet. */
@@ -387,6 +410,13 @@ public:
     EXPORT virtual bool VerifyWithKey(
         const OTAsymmetricKey& theKey,
         const OTPasswordData* pPWData = nullptr) const;
+    /** Adds theNym's signature on this contract to batch, for checking with
+     *  CryptoAsymmetric::VerifyBatches(). Returns false without adding
+     *  anything if the signature can not be matched to exactly one of
+     *  theNym's signing keys, in which case use VerifySignature() instead. */
+    EXPORT bool BatchSignature(
+        const Nym& theNym,
+        std::vector<CryptoAsymmetric::BatchItem>& batch) const;
     EXPORT bool VerifySignature(
         const Nym& theNym,
         const OTSignature& theSignature,
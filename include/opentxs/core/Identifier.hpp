@@ -43,6 +43,8 @@
 #include "opentxs/core/Proto.hpp"
 #include "opentxs/core/Types.hpp"
 
+#include <cstddef>
+#include <functional>
 #include <iosfwd>
 #include <string>
 
@@ -67,6 +69,10 @@ private:
 
     ID type_{DefaultType};
 
+    /** Orders identifiers by type, then by digest bytes. Empty identifiers
+     *  are equal to each other regardless of type, and sort first. */
+    int compare(const Identifier& rhs) const;
+
 public:
     EXPORT friend std::ostream& operator<<(std::ostream& os, const String& obj);
     EXPORT static bool validateID(const std::string& strPurportedID);
@@ -74,6 +80,7 @@ public:
     EXPORT Identifier();
 
     EXPORT Identifier(const Identifier& theID);
+    EXPORT Identifier(Identifier&& theID);
     EXPORT explicit Identifier(const std::string& szStr);
     EXPORT explicit Identifier(const String& theStr);
     EXPORT explicit Identifier(const Nym& theNym);
@@ -104,8 +111,21 @@ public:
     /** theStr will contain pretty hex string after call. */
     EXPORT void GetString(String& theStr) const;
     EXPORT const ID& Type() const { return type_; }
+    /** Hash of the type and digest bytes, for use in unordered containers. */
+    EXPORT std::size_t Hash() const;
 
     EXPORT virtual ~Identifier() = default;
 };
 }  // namespace opentxs
+
+namespace std
+{
+template <>
+struct hash<opentxs::Identifier> {
+    std::size_t operator()(const opentxs::Identifier& id) const
+    {
+        return id.Hash();
+    }
+};
+}  // namespace std
 #endif  // OPENTXS_CORE_OTIDENTIFIER_HPP
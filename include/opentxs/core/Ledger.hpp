@@ -46,6 +46,8 @@
 #include <cstdint>
 #include <map>
 #include <set>
+#include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -79,9 +81,39 @@ private: // Private prevents erroneous use by other classes.
         String strInput);
 
 private:
+    typedef std::vector<std::pair<int64_t, OTTransaction*>> vecOfTransactions;
+    typedef std::multimap<int64_t, OTTransaction*> multimapOfTransactions;
+
     mapOfTransactions m_mapTransactions; // a ledger contains a map of
                                          // transactions.
 
+    // Secondary indexes over m_mapTransactions. They are built the first time
+    // they are needed and then kept up to date as transactions are added or
+    // removed. Loading a ledger discards them. The receipt indexes require
+    // parsing each receipt's reference string, so they are built separately
+    // from the others. Where several transactions share a key, they are kept
+    // in transaction number order.
+    mutable bool m_bIndexed{false};
+    mutable bool m_bReceiptsIndexed{false};
+    mutable vecOfTransactions m_vecByPosition;
+    mutable multimapOfTransactions m_mapByReferenceNum;
+    mutable multimapOfTransactions m_mapReplyNoticeByRequestNum;
+    mutable multimapOfTransactions m_mapTransferReceiptByOrigin;
+    mutable multimapOfTransactions m_mapChequeReceiptByChequeNum;
+    // Transaction number to the key it was given in a receipt index.
+    mutable std::map<int64_t, int64_t> m_mapReceiptKeys;
+
+    void BuildIndex() const;
+    void BuildReceiptIndex() const;
+    void IndexTransaction(
+        int64_t lTransactionNum,
+        OTTransaction& theTransaction) const;
+    void IndexReceipt(OTTransaction& theTransaction) const;
+    void InvalidateIndex();
+    void UnindexTransaction(
+        int64_t lTransactionNum,
+        OTTransaction& theTransaction);
+
 protected:
     // return -1 if error, 0 if nothing, and 1 if the node was processed.
     int32_t ProcessXMLNode(irr::io::IrrXMLReader*& xml) override;
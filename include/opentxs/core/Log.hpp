@@ -42,11 +42,17 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/util/Assert.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <deque>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #if defined(unix) || defined(__unix__) || defined(__unix) ||                   \
     defined(__APPLE__) || defined(linux) || defined(__linux) ||                \
@@ -62,6 +68,7 @@ namespace opentxs
 {
 
 typedef std::deque<String*> dequeOfStrings;
+typedef std::vector<std::pair<std::string, std::string>> LogFields;
 
 class OTLogStream;
 
@@ -90,13 +97,55 @@ class OTLogStream : public std::ostream, std::streambuf
 {
 private:
     int logLevel{0};
-    int next{0};
-    char* pBuffer{nullptr};
+    const std::size_t index_;
+    std::atomic<bool> enabled_{true};
+
+    /** The stream this thread formats into. It is never shared, so neither
+     *  its formatting state nor its pending line needs a lock. */
+    std::ostream& thread_stream();
+    /** Logs every complete line waiting in stream. */
+    void write_lines(std::ostream& stream);
 
 public:
     explicit OTLogStream(int _logLevel);
     ~OTLogStream();
 
+    /** Disabled streams skip formatting entirely. Called by Log whenever the
+     *  log level changes, possibly while other threads are writing. */
+    void Enable(const int32_t nLogLevel);
+
+    template <typename T>
+    OTLogStream& operator<<(const T& value)
+    {
+        if (enabled_.load(std::memory_order_relaxed)) {
+            std::ostream& stream = thread_stream();
+            stream << value;
+            write_lines(stream);
+        }
+
+        return *this;
+    }
+
+    OTLogStream& operator<<(std::ostream& (*manipulator)(std::ostream&))
+    {
+        if (enabled_.load(std::memory_order_relaxed)) {
+            std::ostream& stream = thread_stream();
+            manipulator(stream);
+            write_lines(stream);
+        }
+
+        return *this;
+    }
+
+    OTLogStream& operator<<(std::ios_base& (*manipulator)(std::ios_base&))
+    {
+        manipulator(thread_stream());
+
+        return *this;
+    }
+
+    /** Characters written through the std::ostream base go to the same
+     *  per-thread line as operator<<. */
     virtual int overflow(int c) override;
 };
 
@@ -104,12 +153,20 @@ public:
 class Log
 {
 private:
+    /** Owns the queue, the background thread and the log file. */
+    class Writer;
+
     static Log* pLogger;
 
     static const String m_strVersion;
     static const String m_strPathSeparator;
 
     dequeOfStrings logDeque;
+    std::mutex m_memlogLock;
+
+    // Lines are queued by the logging threads and written to stderr, the log
+    // file and the memlog by a single background thread.
+    std::unique_ptr<Writer> m_pWriter;
 
     String m_strThreadContext;
     String m_strLogFileName;
@@ -125,6 +182,11 @@ private:
     static Assert::fpt_Assert_sz_n_sz(logAssert);
 
     static bool CheckLogger(Log* pLogger);
+    static void UpdateStreams();
+    static bool Write(const char* szText, bool bMemlog);
+
+    Log();
+    ~Log();
 
 public:
     /** now the logger checks the global config file itself for the
@@ -162,6 +224,8 @@ public:
     //
 
     EXPORT static bool LogToFile(const String& strOutput);
+    /** Blocks until every line logged so far has been written out. */
+    EXPORT static void Flush();
 
     /** We keep 1024 logs in memory, to make them available via the API. */
     EXPORT static int32_t GetMemlogSize();
@@ -189,6 +253,13 @@ public:
         const char* szOutput);  // stdout
     EXPORT static void vOutput(int32_t nVerbosity, const char* szOutput, ...)
         ATTR_PRINTF(2, 3);
+    /** Logs an event name followed by key=value pairs on a single line, for
+     *  output which is meant to be parsed by log processing tools. Nothing is
+     *  formatted if nVerbosity is above the current log level. */
+    EXPORT static void Structured(
+        int32_t nVerbosity,
+        const char* szEvent,
+        const LogFields& fields);
 
     /** This logs an error condition, which usually means bad input from the
      * user, or a file wouldn't open, or something like that. This contrasted
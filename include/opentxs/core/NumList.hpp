@@ -39,6 +39,8 @@
 #ifndef OPENTXS_CORE_OTNUMLIST_HPP
 #define OPENTXS_CORE_OTNUMLIST_HPP
 
+#include "opentxs/core/NumberSet.hpp"
+
 #include <cstdint>
 #include <set>
 #include <string>
@@ -50,14 +52,15 @@ class OTAsymmetricKey;
 class OTPasswordData;
 class String;
 
-/** Useful for storing a std::set of longs, serializing to/from comma-separated
+/** Useful for storing a set of longs, serializing to/from comma-separated
  * string, And easily being able to add/remove/verify the individual transaction
  * numbers that are there. (Used by OTTransaction::blank and
  * OTTransaction::successNotice.) Also used in OTMessage, for storing lists of
- * acknowledged request numbers. */
+ * acknowledged request numbers. Runs of consecutive numbers may be written
+ * as ranges: "1-5,9" is 1,2,3,4,5,9. */
 class NumList
 {
-    std::set<int64_t> m_setData;
+    NumberSet m_setData;
 
     /** private for security reasons, used internally only by a function that
      * knows the string length already. if false, means the numbers were already
@@ -66,6 +69,7 @@ class NumList
 
 public:
     explicit EXPORT NumList(const std::set<int64_t>& theNumbers);
+    explicit EXPORT NumList(const NumberSet& theNumbers);
     explicit EXPORT NumList(const String& strNumbers);
     explicit EXPORT NumList(const std::string& strNumbers);
     explicit EXPORT NumList(int64_t lInput);
@@ -122,9 +126,15 @@ public:
      * then iterate the output.) returns false if the numlist was empty.*/
     EXPORT bool Output(std::set<int64_t>& theOutput) const;
 
+    /** Outputs the numlist as a NumberSet. returns false if the numlist was
+     * empty.*/
+    EXPORT bool Output(NumberSet& theOutput) const;
+
     /** Outputs the numlist as a comma-separated string (for serialization,
-     * usually.) returns false if the numlist was empty. */
-    EXPORT bool Output(String& strOutput) const;
+     * usually.) If bRanges is set, runs of consecutive numbers are written as
+     * ranges. Older versions can't parse those, so only set it when the reader
+     * is known to understand them. returns false if the numlist was empty. */
+    EXPORT bool Output(String& strOutput, const bool bRanges = false) const;
     EXPORT void Release();
 };
 
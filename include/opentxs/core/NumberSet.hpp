@@ -0,0 +1,142 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_NUMBERSET_HPP
+#define OPENTXS_CORE_NUMBERSET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <set>
+
+namespace opentxs
+{
+
+/** A set of integers stored as a sorted map of disjoint, non-adjacent ranges.
+ *
+ *  Transaction and request numbers are issued in contiguous runs, so a set of
+ *  thousands of numbers usually collapses to a handful of ranges. Lookups,
+ *  insertions and removals are logarithmic in the number of ranges.
+ *
+ *  The interface mirrors the parts of std::set used for numbers, so most
+ *  callers read the same. Iteration visits individual values in ascending
+ *  order.
+ */
+class NumberSet
+{
+public:
+    typedef std::int64_t value_type;
+    /** first value -> last value, inclusive */
+    typedef std::map<value_type, value_type> Ranges;
+
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef NumberSet::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type* pointer;
+        typedef const value_type& reference;
+
+        const_iterator() = default;
+
+        reference operator*() const { return value_; }
+        pointer operator->() const { return &value_; }
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& rhs) const;
+        bool operator!=(const const_iterator& rhs) const;
+
+    private:
+        friend class NumberSet;
+
+        Ranges::const_iterator range_;
+        Ranges::const_iterator end_;
+        value_type value_{0};
+
+        const_iterator(
+            const Ranges::const_iterator& range,
+            const Ranges::const_iterator& end);
+    };
+
+private:
+    Ranges ranges_;
+    std::size_t size_{0};
+
+    Ranges::const_iterator find(const value_type value) const;
+
+public:
+    NumberSet() = default;
+    explicit NumberSet(const std::set<value_type>& numbers);
+    NumberSet(const NumberSet&) = default;
+    NumberSet(NumberSet&&) = default;
+    NumberSet& operator=(const NumberSet&) = default;
+    NumberSet& operator=(NumberSet&&) = default;
+
+    bool operator==(const NumberSet& rhs) const;
+    bool operator!=(const NumberSet& rhs) const;
+
+    const_iterator begin() const;
+    std::size_t count(const value_type value) const;
+    /** The numbers in *this which are not in rhs */
+    NumberSet difference(const NumberSet& rhs) const;
+    bool empty() const;
+    const_iterator end() const;
+    /** The smallest number. The set must not be empty. */
+    value_type front() const;
+    /** True if every number in rhs is also in *this */
+    bool includes(const NumberSet& rhs) const;
+    /** True if any number in rhs is also in *this */
+    bool intersects(const NumberSet& rhs) const;
+    const Ranges& ranges() const;
+    std::size_t size() const;
+
+    void clear();
+    /** Returns 1 if the value was removed, 0 if it was not present */
+    std::size_t erase(const value_type value);
+    /** Returns true if the value was not already present */
+    bool insert(const value_type value);
+    /** Adds every value from first to last inclusive. Returns how many of
+     *  them were not already present. */
+    std::size_t insert(const value_type first, const value_type last);
+
+    ~NumberSet() = default;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_CORE_NUMBERSET_HPP
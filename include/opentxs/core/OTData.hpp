@@ -88,6 +88,11 @@ public:
     EXPORT void Concatenate(const void* data, uint32_t size);
     EXPORT bool Randomize(uint32_t size);
     EXPORT void zeroMemory() const;
+    /** Data is wiped whenever it is released. Only data which can never
+     * hold a secret may be marked plain with SetSecure(false), and copies
+     * of it are secure again. */
+    EXPORT void SetSecure(bool secure = true);
+    EXPORT bool IsSecure() const;
     EXPORT uint32_t OTfread(uint8_t* data, uint32_t size);
 
     inline void reset()
@@ -104,9 +109,17 @@ protected:
     }
 
 private:
+    /** Up to this many bytes (a digest, a small key) are stored inline. */
+    static const uint32_t INLINE_CAPACITY = 32;
+
     void* data_=nullptr;
     uint32_t position_=0;
     uint32_t size_=0; // TODO: MAX_SIZE ?? security.
+    bool secure_=true;
+    uint8_t inline_[INLINE_CAPACITY];
+
+    void* Allocate(uint32_t size);
+    void Free(void* data, uint32_t size) const;
 };
 
 } // namespace opentxs
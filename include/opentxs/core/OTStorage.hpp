@@ -483,6 +483,23 @@ protected:
         const std::string& twoStr = "",
         const std::string& threeStr = "") = 0;
 
+    // Optional. The defaults go through onQueryPlainString() and
+    // onStorePlainString(), which works but guarantees nothing if the process
+    // stops part way through.
+    virtual bool onAppendPlainString(
+        const std::string& theBuffer,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "");
+
+    virtual bool onReplacePlainString(
+        const std::string& theBuffer,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "");
+
 public:
     // Use GetPacker() to access the Packer, throughout duration of this Storage
     // object.
@@ -551,6 +568,23 @@ public:
         const std::string& twoStr = "",
         const std::string& threeStr = "");
 
+    // Add strContents to the end of a plain string.
+    EXPORT bool AppendPlainString(
+        const std::string& strContents,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "");
+
+    // Same as StorePlainString, except that if the process stops part way
+    // through, the old contents are left instead of a partial write.
+    EXPORT bool ReplacePlainString(
+        const std::string& strContents,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "");
+
     // Store/Retrieve an object. (Storable.)
 
     EXPORT bool StoreObject(
@@ -675,6 +709,20 @@ EXPORT std::string QueryPlainString(
     const std::string& twoStr = "",
     const std::string& threeStr = "");
 
+EXPORT bool AppendPlainString(
+    const std::string& strContents,
+    const std::string& strFolder,
+    const std::string& oneStr = "",
+    const std::string& twoStr = "",
+    const std::string& threeStr = "");
+
+EXPORT bool ReplacePlainString(
+    const std::string& strContents,
+    const std::string& strFolder,
+    const std::string& oneStr = "",
+    const std::string& twoStr = "",
+    const std::string& threeStr = "");
+
 // Store/Retrieve an object. (Storable.)
 //
 EXPORT bool StoreObject(
@@ -1728,6 +1776,20 @@ protected:
         const std::string& twoStr = "",
         const std::string& threeStr = "") override;
 
+    bool onAppendPlainString(
+        const std::string& theBuffer,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") override;
+
+    bool onReplacePlainString(
+        const std::string& theBuffer,
+        const std::string& strFolder,
+        const std::string& oneStr = "",
+        const std::string& twoStr = "",
+        const std::string& threeStr = "") override;
+
 public:
     bool Exists(
         const std::string& strFolder,
@@ -86,6 +86,7 @@ public:
 
     EXPORT String();
     EXPORT String(const String& value);
+    EXPORT String(String&& value);
     EXPORT explicit String(const OTASCIIArmor& value);
     EXPORT explicit String(const OTSignature& value);
     EXPORT explicit String(const Contract& value);
@@ -102,6 +103,12 @@ public:
 
     EXPORT String& operator=(String rhs);
 
+    /** Strings are wiped whenever their contents are released. Only a
+    string which can never hold a secret may be marked plain with
+    SetSecure(false), and copies of it are secure again. */
+    EXPORT void SetSecure(bool secure = true);
+    EXPORT bool IsSecure() const;
+
     static bool vformat(const char* fmt, std::va_list* pvl, std::string& s)
         ATTR_PRINTF(1, 0);
 
@@ -193,10 +200,22 @@ private:
      * function ASSUMES the new_string pointer is good. */
     void LowLevelSet(const char* data, uint32_t enforcedMaxLength);
 
+    /** Returns room for length characters plus the null terminator, using
+     * the inline buffer when it fits. */
+    char* Allocate(uint32_t length);
+
 protected:
     uint32_t length_;
     uint32_t position_;
     char* data_;
+
+private:
+    /** Strings shorter than this are stored inline. It holds a 36 character
+    Nym, notary or account ID, and keeps a String at 64 bytes. */
+    static const uint32_t INLINE_CAPACITY = 39;
+
+    bool secure_{true};
+    char inline_[INLINE_CAPACITY];
 };
 }  // namespace opentxs
 #endif  // OPENTXS_CORE_OTSTRING_HPP
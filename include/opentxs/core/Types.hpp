@@ -81,6 +81,7 @@ typedef std::function<bool(
     const std::uint32_t, const std::string&, std::string&)> Digest;
 typedef std::function<std::string()> Random;
 typedef std::function<bool(const bool)> EmptyBucket;
+typedef std::function<bool()> FlushStorage;
 
 
 /** C++11 representation of a claim. This version is more useful than the
@@ -47,6 +47,7 @@
 #include "opentxs/core/contract/Signable.hpp"
 
 #include <stdint.h>
+#include <cstddef>
 #include <string>
 
 namespace opentxs
@@ -135,7 +136,12 @@ public:
     // removes the account from the list. (When account is deleted.)
     EXPORT bool EraseAccountRecord(const Identifier& theAcctID) const;
 
-    EXPORT bool VisitAccountRecords(AccountVisitor& visitor) const;
+    // Triggers the visitor on every account in the list. With more than one
+    // thread, each page of the list is visited on up to that many threads of
+    // the shared executor and visitor.Trigger() must be thread safe.
+    EXPORT bool VisitAccountRecords(
+        AccountVisitor& visitor,
+        const std::size_t threads = 1) const;
 
     EXPORT static std::string formatLongAmount(
         int64_t lValue, int32_t nFactor = 100, int32_t nPower = 2,
@@ -40,10 +40,14 @@
 #define OPENTXS_CORE_CRON_OTCRON_HPP
 
 #include "opentxs/core/Contract.hpp"
+#include "opentxs/core/cron/OTCronJournal.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/StringUtils.hpp"
 #include "opentxs/core/util/Timer.hpp"
 
+#include <atomic>
+#include <memory>
+
 namespace opentxs
 {
 
@@ -55,6 +59,9 @@ class Nym;
 typedef std::map<int64_t, OTCronItem*> mapOfCronItems;
 /** multimapOfCronItems: Mapped to date the item was added to Cron. */
 typedef std::multimap<time64_t, OTCronItem*> multimapOfCronItems;
+/** multimapOfCronSchedule: Transaction numbers mapped to the date the item is
+ * next due for processing. */
+typedef std::multimap<time64_t, int64_t> multimapOfCronSchedule;
 /** Mapped (uniquely) to market ID. */
 typedef std::map<std::string, OTMarket*> mapOfMarkets;
 /** Cron stores a bunch of these on this list, which the server refreshes from
@@ -68,12 +75,32 @@ class OTCron : public Contract
 private:
     typedef Contract ot_super;
 
+    /** Where a cron item sits on the multimap and on the schedule. */
+    struct ScheduleEntry {
+        multimapOfCronItems::iterator m_itAdded;
+        multimapOfCronSchedule::iterator m_itDue;
+        bool m_bScheduled{false};
+    };
+    /** Mapped (uniquely) to transaction number. */
+    typedef std::map<int64_t, ScheduleEntry> mapOfScheduleEntries;
+
 private:
     // A list of all valid markets.
     mapOfMarkets m_mapMarkets;
     // Cron Items are found on both lists.
     mapOfCronItems m_mapCronItems;
     multimapOfCronItems m_multimapCronItems;
+    // Only the items which are due get processed on each round, so they are
+    // also kept in order of the date they are next due.
+    multimapOfCronSchedule m_multimapSchedule;
+    mapOfScheduleEntries m_mapScheduleEntries;
+    // The date the first item on the schedule is due, or -1 if nothing is
+    // scheduled. computeTimeout() runs without the notary lock, so it reads
+    // this instead of the schedule.
+    std::atomic<int64_t> m_lFirstDue{-1};
+    // Set when a round was skipped for lack of transaction numbers, so cron
+    // waits for the next regular round instead of retrying immediately.
+    bool m_bThrottled{false};
     // Always store this in any object that's associated with a specific server.
     Identifier m_NOTARY_ID;
     // I can't put receipts in people's inboxes without a supply of these.
@@ -83,6 +110,10 @@ private:
     bool m_bIsActivated{false};
     // I'll need this for later.
     Nym* m_pServerNym{nullptr};
+    // Changes made since the cron file was last saved whole.
+    std::unique_ptr<OTCronJournal> m_pJournal;
+    int64_t m_lJournalGeneration{0};
+    bool m_bNumbersChanged{false};
     // Number of transaction numbers Cron  will grab for itself, when it gets
     // low, before each round.
     static int32_t __trans_refill_amount;
@@ -91,9 +122,23 @@ private:
     // Int. The maximum number of cron items any given Nym can have
     // active at the same time.
     static int32_t __cron_max_items_per_nym;
+    // The number of journal records after which the cron file (or a market
+    // file) is saved whole again. 0 saves it whole on every change.
+    static int32_t __cron_journal_compaction;
 
     static Timer tCron;
 
+    void ScheduleCronItem(OTCronItem& theItem, const time64_t& tNotBefore);
+    void UnscheduleCronItem(int64_t lTransactionNum);
+    bool CronItemsAreDue(const time64_t& tNow) const;
+    void PublishFirstDue();
+
+    OTCronJournal& GetJournal();
+    bool Journal(const OTCronJournal::Record& theRecord);
+    bool ReplayJournal();
+    bool LoadCronItem(const String& strData, const time64_t& tDateAdded);
+    void EraseCronItem(int64_t lTransactionNum);
+
 public:
     static int32_t GetCronMsBetweenProcess()
     {
@@ -114,6 +159,14 @@ public:
     {
         __cron_max_items_per_nym = nMax;
     }
+    static int32_t GetCronJournalCompaction()
+    {
+        return __cron_journal_compaction;
+    }
+    static void SetCronJournalCompaction(int32_t nRecords)
+    {
+        __cron_journal_compaction = nRecords;
+    }
     inline bool IsActivated() const { return m_bIsActivated; }
     inline bool ActivateCron()
     {
@@ -135,6 +188,9 @@ public:
     EXPORT mapOfCronItems::iterator FindItemOnMap(int64_t lTransactionNum);
     EXPORT multimapOfCronItems::iterator FindItemOnMultimap(
         int64_t lTransactionNum);
+    /** Cron items call this when something changed the date they are next
+     * due, other than being processed by cron. */
+    void RescheduleCronItem(int64_t lTransactionNum);
     // MARKETS
     bool AddMarket(OTMarket& theMarket, bool bSaveMarketFile = true);
     bool RemoveMarket(const Identifier& MARKET_ID);  // if returns false,
@@ -171,6 +227,10 @@ public:
      * finished.) */
     EXPORT void ProcessCronItems();
 
+    /** Milliseconds until ProcessCronItems() has something to do: either an
+     * item is due, or it is time for the regular round. Safe to call from the
+     * thread which runs ProcessCronItems() while other threads change the
+     * schedule. */
     int64_t computeTimeout();
 
     inline void SetNotaryID(const Identifier& NOTARY_ID)
@@ -187,7 +247,12 @@ public:
     inline Nym* GetServerNym() const { return m_pServerNym; }
 
     EXPORT bool LoadCron();
+    /** Saves the whole cron file, and empties the journal. */
     EXPORT bool SaveCron();
+    /** Journals the current state of theItem, which must be on cron. */
+    EXPORT bool SaveCronItem(OTCronItem& theItem);
+    /** Journals the list of transaction numbers available to cron. */
+    EXPORT bool SaveTransactionNumbers();
 
     EXPORT OTCron();
     explicit OTCron(const Identifier& NOTARY_ID);
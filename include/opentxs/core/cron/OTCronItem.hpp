@@ -236,6 +236,11 @@ public:
     virtual bool ProcessCron(); // OTCron calls this regularly, which is my
                                 // chance to expire, etc.
                                 // From OTTrackable (parent class of this)
+    // The earliest date on which ProcessCron() could have something to do.
+    // OTCron does not process the item again before then. (Returning too
+    // early a date only costs a wasted call; too late a date delays the
+    // item.)
+    virtual time64_t GetCronDueDate() const;
     virtual ~OTCronItem();
 
     void InitCronItem();
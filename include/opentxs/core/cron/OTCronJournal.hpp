@@ -0,0 +1,106 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_CRON_OTCRONJOURNAL_HPP
+#define OPENTXS_CORE_CRON_OTCRONJOURNAL_HPP
+
+#include "opentxs/core/String.hpp"
+#include "opentxs/core/util/Common.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+
+class Nym;
+
+/** An append-only log of the changes made to a file which is otherwise saved
+ * whole, such as the cron file or a market file. Each change is signed by the
+ * server Nym and appended by itself, so saving one change costs the same no
+ * matter how big the file is. Loading replays the changes on top of the last
+ * full save (the snapshot), and saving a new snapshot empties the log.
+ *
+ * Every record carries the generation of the snapshot it applies to. Records
+ * left over from an older snapshot (if the server stopped between saving a
+ * snapshot and emptying the log) are skipped. */
+class OTCronJournal
+{
+public:
+    /** One change: a value stored, or erased, under a key. */
+    struct Record {
+        String m_strType;
+        int64_t m_lKey{0};
+        /** A number saved with the record, such as a market's last sale
+         * price. */
+        int64_t m_lValue{0};
+        bool m_bErase{false};
+        time64_t m_tDateAdded{0};
+        String m_strPayload;
+    };
+
+    OTCronJournal(const std::string& strFolder, const std::string& strFilename);
+
+    inline int64_t GetGeneration() const { return m_lGeneration; }
+    /** The number of records appended since the snapshot. */
+    inline int64_t GetCount() const { return m_lCount; }
+
+    /** Signs theRecord and appends it to the log. */
+    bool Append(const Record& theRecord, const Nym& theSigner);
+    /** Reads back the records of lGeneration in the order they were appended.
+     * A record cut short at the end of the log (by a crash in the middle of
+     * an append) ends the replay, and is trimmed off. Returns false if any
+     * record fails to verify. */
+    bool Load(
+        const int64_t& lGeneration,
+        const Nym& theSigner,
+        std::vector<Record>& output);
+    /** Empties the log, once the snapshot for lGeneration has been saved. */
+    bool Reset(const int64_t& lGeneration);
+
+private:
+    std::string m_strFolder;
+    std::string m_strFilename;
+    int64_t m_lGeneration{0};
+    int64_t m_lCount{0};
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CORE_CRON_OTCRONJOURNAL_HPP
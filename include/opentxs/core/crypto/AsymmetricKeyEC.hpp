@@ -42,6 +42,7 @@
 #include "opentxs/core/crypto/OTAsymmetricKey.hpp"
 
 #include <memory>
+#include <mutex>
 
 namespace opentxs
 {
@@ -49,6 +50,7 @@ namespace opentxs
 class Ecdsa;
 class OTData;
 class OTPassword;
+class SigningSession;
 class String;
 
 class AsymmetricKeyEC : public OTAsymmetricKey
@@ -63,6 +65,12 @@ protected:
     std::unique_ptr<proto::Ciphertext> encrypted_key_;
     std::shared_ptr<proto::HDPath> path_;
     std::unique_ptr<proto::Ciphertext> chain_code_;
+    // Engine specific form of key_, kept by the engine so that the public key
+    // is only parsed once
+    mutable std::mutex parsed_key_lock_;
+    mutable std::unique_ptr<OTData> parsed_key_;
+    mutable std::mutex signing_session_lock_;
+    mutable std::shared_ptr<SigningSession> signing_session_;
 
     AsymmetricKeyEC() = delete;
     explicit AsymmetricKeyEC(
@@ -80,6 +88,7 @@ public:
     virtual Ecdsa& ECDSA() const = 0;
     bool GetKey(OTData& key) const;
     bool GetKey(proto::Ciphertext& key) const;
+    bool GetParsedKey(OTData& parsed) const;
     bool GetPublicKey(String& strKey) const override;
     const std::string Path() const override;
     bool ReEncryptPrivateKey(
@@ -89,6 +98,12 @@ public:
     void Release() override;
     bool SetKey(std::unique_ptr<OTData>& key);
     bool SetKey(std::unique_ptr<proto::Ciphertext>& key);
+    void SetParsedKey(const OTData& parsed) const;
+    /** Keep the decrypted private key in session while it lasts, instead of
+     *  decrypting it for every signature. nullptr ends the session. */
+    void SetSigningSession(
+        const std::shared_ptr<SigningSession>& session) const;
+    std::shared_ptr<SigningSession> GetSigningSession() const;
     serializedAsymmetricKey Serialize() const override;
     bool TransportKey(OTData& publicKey, OTPassword& privateKey) const override;
 
@@ -39,17 +39,24 @@
 #ifndef OPENTXS_CORE_CRYPTO_CRYPTOASYMMETRIC_HPP
 #define OPENTXS_CORE_CRYPTO_CRYPTOASYMMETRIC_HPP
 
+#include "opentxs/core/OTData.hpp"
 #include "opentxs/core/Proto.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/Types.hpp"
 
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
 #include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace opentxs
 {
 
 class OTAsymmetricKey;
-class OTData;
 class OTPassword;
 class OTPasswordData;
 class OTSignature;
@@ -58,11 +65,57 @@ typedef std::multimap<std::string, OTAsymmetricKey*> mapOfAsymmetricKeys;
 
 class CryptoAsymmetric
 {
+private:
+    // Number of successful verifications remembered by VerifyWithDigest()
+    static const std::size_t VerificationCacheSize = 4096;
+    // VerifyAll() doesn't use another thread for fewer checks than this
+    static const std::size_t ChecksPerThread = 8;
+
+    typedef std::list<std::string> VerificationList;
+    typedef std::unordered_map<std::string, VerificationList::iterator>
+        VerificationIndex;
+
+    mutable std::mutex verified_lock_;
+    // Most recently used first
+    mutable VerificationList verified_;
+    mutable VerificationIndex verified_index_;
+
+    bool check_verified(const std::string& id) const;
+    void set_verified(const std::string& id) const;
+
+protected:
+    /** Verify a signature over plaintext, of which the caller already
+     *  calculated the hashType digest. Engines which sign the digest can
+     *  override this to avoid hashing the plaintext again. */
+    virtual bool verify_digest(
+        const OTData& plaintext,
+        const OTData& digest,
+        const OTAsymmetricKey& theKey,
+        const OTData& signature,
+        const proto::HashType hashType,
+        const OTPasswordData* pPWData) const;
 
 public:
+    /** One signature to be checked by VerifyBatch() */
+    struct BatchItem {
+        OTData plaintext_;
+        const OTAsymmetricKey* key_{nullptr};
+        OTData signature_;
+        proto::HashType hash_type_{proto::HASHTYPE_ERROR};
+    };
 
     static proto::AsymmetricKeyType CurveToKeyType(const EcdsaCurve& curve);
     static EcdsaCurve KeyTypeToCurve(const proto::AsymmetricKeyType& type);
+    /** Calls verify(0) through verify(count - 1), spread over the shared
+     *  executor, and returns true if every call returned true. Stops at the
+     *  first failure. verify must be safe to call from several threads, and
+     *  should not log: leave that to the caller once VerifyAll returns. */
+    static bool VerifyAll(
+        const std::size_t count,
+        const std::function<bool(const std::size_t)>& verify);
+    /** Passes each item to the VerifyBatch() of its key's engine, so the
+     *  keys in batch need not all use the same engine. */
+    static bool VerifyBatches(const std::vector<BatchItem>& batch);
 
     bool SignContract(
         const String& strContractUnsigned,
@@ -90,6 +143,30 @@ public:
         const OTData& signature,
         const proto::HashType hashType,
         const OTPasswordData* pPWData = nullptr) const = 0;
+    /** Verify many signatures at once. Returns true only if all of them
+     *  verify. Every key in batch must use this engine. The default
+     *  implementation spreads the items over the shared executor. Engines
+     *  override it to do the work common to many items only once. */
+    virtual bool VerifyBatch(
+        const std::vector<BatchItem>& batch,
+        const OTPasswordData* pPWData = nullptr) const;
+    /** Same as Verify(), except that recent successful verifications of the
+     *  same key, digest and signature are remembered and not repeated.
+     *
+     *  \param[in,out] digest The hashType digest of plaintext. If empty, it
+     *                        will be calculated, so that callers which try
+     *                        several keys against the same plaintext only
+     *                        hash it once.
+     */
+    bool VerifyWithDigest(
+        const OTData& plaintext,
+        OTData& digest,
+        const OTAsymmetricKey& theKey,
+        const OTData& signature,
+        const proto::HashType hashType,
+        const OTPasswordData* pPWData = nullptr) const;
+
+    virtual ~CryptoAsymmetric() = default;
 };
 
 } // namespace opentxs
@@ -42,10 +42,12 @@
 #include "opentxs/core/Proto.hpp"
 #include "opentxs/core/Types.hpp"
 #include "opentxs/core/crypto/Credential.hpp"
+#include "opentxs/core/crypto/CryptoAsymmetric.hpp"
 #include "opentxs/core/crypto/OTKeypair.hpp"
 #include "opentxs/core/crypto/NymParameters.hpp"
 
 #include <memory>
+#include <vector>
 
 // A nym contains a list of credential sets.
 // The whole purpose of a Nym is to be an identity, which can have
@@ -92,6 +94,12 @@ class KeyCredential : public Credential
 private:
     typedef Credential ot_super;
     friend class CredentialSet;
+
+    /** While not null, Verify() adds each signature it is asked to check to
+     *  this batch and returns true, leaving the check to whoever set it.
+     *  Only CredentialSet::VerifyInternally() sets it, for its own thread. */
+    static thread_local std::vector<CryptoAsymmetric::BatchItem>* deferred_;
+
     KeyCredential() = delete;
 
     bool addKeytoSerializedKeyCredential(
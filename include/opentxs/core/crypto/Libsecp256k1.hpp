@@ -75,6 +75,11 @@ private:
     CryptoUtil& ssl_;
 
     bool ParsePublicKey(const OTData& input, secp256k1_pubkey& output) const;
+    /** Parses theKey, or copies it from the key's parsed form if it was
+     *  parsed before, and stores the parsed form on the key. */
+    bool parsed_key(
+        const OTAsymmetricKey& theKey,
+        secp256k1_pubkey& output) const;
     void Init_Override() const override;
     void Cleanup_Override() const override {};
     bool ECDH(
@@ -87,6 +92,13 @@ private:
     bool ScalarBaseMultiply(
         const OTPassword& privateKey,
         OTData& publicKey) const override;
+    bool verify_digest(
+        const OTData& plaintext,
+        const OTData& digest,
+        const OTAsymmetricKey& theKey,
+        const OTData& signature,
+        const proto::HashType hashType,
+        const OTPasswordData* pPWData) const override;
 
     Libsecp256k1() = delete;
     explicit Libsecp256k1(CryptoUtil& ssl, Ecdsa& ecdsa);
@@ -108,6 +120,12 @@ public:
         const OTData& signature,
         const proto::HashType hashType,
         const OTPasswordData* pPWData = nullptr) const override;
+    /** libsecp256k1 has no batch verification, so this parses every key
+     *  once on the calling thread and rejects malformed signatures before
+     *  the items are spread over the executor. */
+    bool VerifyBatch(
+        const std::vector<BatchItem>& batch,
+        const OTPasswordData* pPWData = nullptr) const override;
 
     virtual ~Libsecp256k1();
 };
@@ -47,6 +47,7 @@
 #include "opentxs/core/Proto.hpp"
 
 #include <cstddef>
+#include <vector>
 
 namespace opentxs
 {
@@ -144,6 +145,13 @@ public:
         const OTData& signature,
         const proto::HashType hashType,
         const OTPasswordData* pPWData = nullptr) const override;
+    /** libsodium has no batch verification, so this extracts every public
+     *  key once on the calling thread and leaves only the signature checks
+     *  to the executor. Ed25519 signs the plaintext itself, so the digest
+     *  which VerifyWithDigest() would calculate for its cache is skipped. */
+    bool VerifyBatch(
+        const std::vector<BatchItem>& batch,
+        const OTPasswordData* pPWData = nullptr) const override;
 
     virtual ~Libsodium() = default;
 };
@@ -0,0 +1,90 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_CRYPTO_SIGNINGSESSION_HPP
+#define OPENTXS_CORE_CRYPTO_SIGNINGSESSION_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace opentxs
+{
+
+class OTPassword;
+
+/** Keeps the decrypted private key of one key in page-locked memory for a
+ *  limited time, so that signing with it doesn't decrypt it every time.
+ *
+ *  Attach a session to a key with AsymmetricKeyEC::SetSigningSession(). The
+ *  first time the private key is needed after the session opens or expires,
+ *  it is decrypted as usual and kept here. Until the lifetime runs out, the
+ *  key is taken from here instead.
+ *
+ *  A negative lifetime keeps the key until Close() is called. A lifetime of
+ *  zero keeps nothing. */
+class SigningSession
+{
+private:
+    const std::chrono::seconds lifetime_;
+    mutable std::mutex lock_;
+    mutable std::unique_ptr<OTPassword> key_;
+    std::chrono::steady_clock::time_point expires_;
+
+    SigningSession() = delete;
+    SigningSession(const SigningSession&) = delete;
+    SigningSession(SigningSession&&) = delete;
+    SigningSession& operator=(const SigningSession&) = delete;
+    SigningSession& operator=(SigningSession&&) = delete;
+
+public:
+    explicit SigningSession(const std::chrono::seconds& lifetime);
+
+    /** Copies the decrypted key into privkey. Returns false if the session
+     *  holds no key, or if the key expired (it is wiped in that case). */
+    bool Get(OTPassword& privkey) const;
+    /** Keeps a copy of privkey for the lifetime of the session */
+    void Set(const OTPassword& privkey);
+    /** Wipes the decrypted key */
+    void Close();
+
+    ~SigningSession();
+};
+}  // namespace opentxs
+
+#endif  // OPENTXS_CORE_CRYPTO_SIGNINGSESSION_HPP
@@ -355,11 +355,20 @@ private: // These are NOT stored as part of the payment plan. They are merely
     bool m_bProcessingInitialPayment{false};
     bool m_bProcessingPaymentPlan{false};
 
+    // The earliest dates at which ProcessCron() makes the initial payment,
+    // makes the next regular payment, or ends the plan for reaching its
+    // length. Each returns false if there is no such date.
+    bool GetInitialPaymentDueDate(time64_t& tDue) const;
+    bool GetNextPaymentDueDate(time64_t& tDue) const;
+    bool GetPaymentPlanEndDate(time64_t& tEnd) const;
+
 public:
     // Return True if should stay on OTCron's list for more processing.
     // Return False if expired or otherwise should be removed.
     bool ProcessCron() override; // OTCron calls this regularly, which is my
                                 // chance to expire, etc.
+    time64_t GetCronDueDate() const override;
+
 protected:
 //  virtual void onFinalReceipt();        // Now handled in the parent class.
 //  virtual void onRemovalFromCron();     // Now handled in the parent class.
@@ -102,6 +102,8 @@ public:
 
     virtual ~OTScript();
 
+    EXPORT void Release();
+
     EXPORT void SetScript(const String& strValue);
     EXPORT void SetScript(const char* new_string);
     EXPORT void SetScript(const char* new_string, size_t sizeLength);
@@ -41,6 +41,8 @@
 
 #include "opentxs/core/script/OTScript.hpp"
 
+#include <memory>
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4702) // warning C4702: unreachable code
@@ -62,6 +64,12 @@ class ChaiScript;
 namespace opentxs
 {
 
+// An OTScriptChai can be executed repeatedly with different scripts and
+// resources (see OTScriptable::GetInterpreter). The interpreter state after the
+// native calls are registered is saved on the first execution and restored
+// before each later one. Each distinct script is compiled once into a function
+// definition, so later executions of the same code only call that function.
+//
 class OTScriptChai : public OTScript
 {
 public:
@@ -75,6 +83,14 @@ public:
 
     bool ExecuteScript(OTVariable* pReturnVar = nullptr) override;
     chaiscript::ChaiScript* const chai{nullptr};
+
+private:
+    class Cache;
+
+    std::unique_ptr<Cache> cache_;
+
+    std::string compile();
+    void restore();
 };
 
 
@@ -45,6 +45,7 @@
 
 #include <stdint.h>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -86,6 +87,14 @@ protected:
     mapOfParties m_mapParties; // The parties to the contract. Could be Nyms, or
                                // other entities. May be rep'd by an Agent.
     mapOfBylaws m_mapBylaws;   // The Bylaws for this contract.
+    // One interpreter per script language, with the native calls already
+    // registered. Reused by every clause and callback. (Not serialized.)
+    std::map<std::string, std::shared_ptr<OTScript>> m_mapInterpreters;
+
+    // Returns the interpreter for str_language, cleared of any parties and
+    // variables from its last execution and loaded with str_code.
+    std::shared_ptr<OTScript> GetInterpreter(const std::string& str_language,
+                                             const std::string& str_code);
 
     // While calculating the ID of smart contracts (and presumably other
     // scriptables)
@@ -147,10 +147,7 @@ protected:
     //
     void ReleaseLastSenderRecipientIDs();
     // (These two are lower level, and used by SetNextProcessTime).
-    void SetNextProcessDate(const time64_t& tNEXT_DATE)
-    {
-        m_tNextProcessDate = tNEXT_DATE;
-    }
+    void SetNextProcessDate(const time64_t& tNEXT_DATE);
     const time64_t& GetNextProcessDate() const
     {
         return m_tNextProcessDate;
@@ -240,6 +237,7 @@ public:
     // Return False if expired or otherwise should be removed.
     bool ProcessCron() override; // OTCron calls this regularly, which is my
                                 // chance to expire, etc.
+    time64_t GetCronDueDate() const override;
 
     bool HasTransactionNum(const int64_t& lInput) const override;
     void GetAllTransactionNumbers(NumList& numlistOutput) const override;
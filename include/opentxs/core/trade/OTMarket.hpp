@@ -49,10 +49,12 @@
 #include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/cron/OTCron.hpp"
 #include "opentxs/core/trade/OTOffer.hpp"
+#include "opentxs/core/trade/OTOrderBook.hpp"
 #include "opentxs/core/util/Common.hpp"
 
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 
 namespace opentxs
@@ -72,12 +74,7 @@ class TradeListMarket;
 #define MAX_MARKET_QUERY_DEPTH                                                 \
     50 // todo add this to the ini file. (Now that we actually have one.)
 
-// Multiple offers, mapped by price limit.
-// Using multi-map since there will be more than one offer for each single
-// price.
-// (Map would only allow a single item on the map for each price.)
-typedef std::multimap<int64_t, OTOffer*> mapOfOffers;
-
+// The offers are kept on an OTOrderBook for each side, by price level.
 // The same offers are also mapped (uniquely) to transaction number.
 typedef std::map<int64_t, OTOffer*> mapOfOffersTrnsNum;
 
@@ -91,8 +88,8 @@ private:
 
     OTDB::TradeListMarket* m_pTradeList{nullptr};
 
-    mapOfOffers m_mapBids; // The buyers, ordered by price limit
-    mapOfOffers m_mapAsks; // The sellers, ordered by price limit
+    OTOrderBook m_bookBids{true};  // The buyers, highest price first
+    OTOrderBook m_bookAsks{false}; // The sellers, lowest price first
 
     mapOfOffersTrnsNum m_mapOffers; // All of the offers on a single list,
                                     // ordered by transaction number.
@@ -118,6 +115,10 @@ private:
     int64_t m_lLastSalePrice{0};
     std::string m_strLastSaleDate;
 
+    // Changes made since the market file was last saved whole.
+    std::unique_ptr<OTCronJournal> m_pJournal;
+    int64_t m_lJournalGeneration{0};
+
     // The server stores a map of markets, one for each unique combination of
     // instrument definitions.
     // That's what this market class represents: one instrument definition being
@@ -138,6 +139,13 @@ private:
     // two are technically
     // interchangeable.
 
+    OTCronJournal& GetJournal();
+    bool Journal(const OTCronJournal::Record& theRecord);
+    bool ReplayJournal();
+    bool EraseOffer(const int64_t& lTransactionNum);
+    bool ReplaceOffer(OTOffer& theOffer, time64_t tDateAddedToMarket);
+    bool SaveRecentTrades();
+
     void cleanup_four_accounts(Account* p1, Account* p2, Account* p3,
                                Account* p4);
     void rollback_four_accounts(Account& p1, bool b1, const int64_t& a1,
@@ -152,6 +160,8 @@ public:
     bool AddOffer(OTTrade* pTrade, OTOffer& theOffer, bool bSaveFile = true,
                   time64_t tDateAddedToMarket = OT_TIME_ZERO);
     bool RemoveOffer(const int64_t& lTransactionNum);
+    // Journals the current state of theOffer, which must be on the market.
+    bool SaveOffer(OTOffer& theOffer);
     // returns general information about offers on the market
     EXPORT bool GetOfferList(OTASCIIArmor& ascOutput, int64_t lDepth,
                              int32_t& nOfferCount);
@@ -176,13 +186,13 @@ public:
     int64_t GetHighestBidPrice();
     int64_t GetLowestAskPrice();
 
-    mapOfOffers::size_type GetBidCount()
+    OTOrderBook::size_type GetBidCount()
     {
-        return m_mapBids.size();
+        return m_bookBids.size();
     }
-    mapOfOffers::size_type GetAskCount()
+    OTOrderBook::size_type GetAskCount()
     {
-        return m_mapAsks.size();
+        return m_bookAsks.size();
     }
     void SetInstrumentDefinitionID(const Identifier& INSTRUMENT_DEFINITION_ID)
     {
@@ -255,6 +265,7 @@ public:
         return m_pCron;
     }
     bool LoadMarket();
+    // Saves the whole market file, and empties the journal.
     bool SaveMarket();
 
     void InitMarket();
@@ -0,0 +1,185 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_TRADE_OTORDERBOOK_HPP
+#define OPENTXS_CORE_TRADE_OTORDERBOOK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <map>
+#include <unordered_map>
+
+namespace opentxs
+{
+
+class OTOffer;
+
+// One side of a market (the bids, or the asks) grouped into price levels.
+//
+// Levels are ordered best price first: highest first for bids, lowest first
+// for asks. Within a level, offers stay in the order they were added. So
+// iterating the book visits the offers in the order they should be matched.
+//
+// Every offer on the book has a handle, found by transaction number, so
+// removing an offer never searches the book. The best offer is always the
+// front of the first level.
+//
+// The book does not own the offers. (The market does.)
+class OTOrderBook
+{
+public:
+    typedef std::list<OTOffer*> listOfOffers; // One price level.
+
+private:
+    struct PriceOrder {
+        bool m_bDescending{false};
+
+        explicit PriceOrder(bool bDescending = false)
+            : m_bDescending(bDescending)
+        {
+        }
+
+        bool operator()(const int64_t& lhs, const int64_t& rhs) const
+        {
+            return m_bDescending ? (rhs < lhs) : (lhs < rhs);
+        }
+    };
+
+public:
+    typedef std::map<int64_t, listOfOffers, PriceOrder> mapOfLevels;
+    typedef std::size_t size_type;
+
+    // Visits every offer on the book, best price first.
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef OTOffer* value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef OTOffer* const* pointer;
+        typedef OTOffer* const& reference;
+
+        reference operator*() const
+        {
+            return *m_itOffer;
+        }
+        pointer operator->() const
+        {
+            return &(*m_itOffer);
+        }
+        // The price of the level the current offer is on.
+        const int64_t& Price() const
+        {
+            return m_itLevel->first;
+        }
+
+        EXPORT const_iterator& operator++();
+        EXPORT const_iterator operator++(int);
+        EXPORT bool operator==(const const_iterator& rhs) const;
+        bool operator!=(const const_iterator& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+    private:
+        friend class OTOrderBook;
+
+        mapOfLevels::const_iterator m_itLevel;
+        mapOfLevels::const_iterator m_itEnd;
+        listOfOffers::const_iterator m_itOffer;
+
+        const_iterator(mapOfLevels::const_iterator itLevel,
+                       mapOfLevels::const_iterator itEnd);
+    };
+
+private:
+    struct Handle {
+        mapOfLevels::iterator m_itLevel;
+        listOfOffers::iterator m_itOffer;
+    };
+
+    typedef std::unordered_map<int64_t, Handle> mapOfHandles;
+
+    mapOfLevels m_mapLevels;
+    mapOfHandles m_mapHandles; // By transaction number.
+
+public:
+    // bDescending is true for bids (highest price first) and false for asks.
+    EXPORT explicit OTOrderBook(bool bDescending);
+
+    // Adds theOffer at the back of the line for its price. Fails if an offer
+    // with the same transaction number is already on the book.
+    EXPORT bool Insert(OTOffer& theOffer);
+    // Returns the offer removed from the book, or nullptr if not found.
+    EXPORT OTOffer* Erase(const int64_t& lTransactionNum);
+    // Puts theOffer in the place of the offer with the same transaction number
+    // and price, and returns the offer it replaced (or nullptr if there isn't
+    // one, in which case the book is unchanged.)
+    EXPORT OTOffer* Replace(OTOffer& theOffer);
+    EXPORT OTOffer* Find(const int64_t& lTransactionNum) const;
+
+    // The first offer in line at the best price, or nullptr if empty.
+    EXPORT OTOffer* Best() const;
+    // The best price on the book, or 0 if empty.
+    EXPORT int64_t BestPrice() const;
+
+    const mapOfLevels& Levels() const
+    {
+        return m_mapLevels;
+    }
+    size_type size() const
+    {
+        return m_mapHandles.size();
+    }
+    bool empty() const
+    {
+        return m_mapHandles.empty();
+    }
+
+    EXPORT const_iterator begin() const;
+    EXPORT const_iterator end() const;
+
+    // Forgets every offer. (It doesn't delete them.)
+    EXPORT void clear();
+};
+
+} // namespace opentxs
+
+#endif // OPENTXS_CORE_TRADE_OTORDERBOOK_HPP
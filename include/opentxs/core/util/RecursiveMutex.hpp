@@ -0,0 +1,117 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_UTIL_RECURSIVEMUTEX_HPP
+#define OPENTXS_CORE_UTIL_RECURSIVEMUTEX_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+namespace opentxs
+{
+
+/** A recursive mutex whose owner can give up every level it holds at once.
+ *
+ *  Used for the client API lock, which a thread may hold several calls deep.
+ *  Release() lets that thread wait on something slow, such as a server
+ *  reply or another lock, without blocking every other API call, and
+ *  Reacquire() restores the same depth afterwards. */
+class RecursiveMutex
+{
+private:
+    std::recursive_mutex mutex_;
+    std::atomic<std::thread::id> owner_;
+    // Only read or written by the thread which holds mutex_.
+    std::size_t depth_{0};
+
+    RecursiveMutex(const RecursiveMutex&) = delete;
+    RecursiveMutex(RecursiveMutex&&) = delete;
+    RecursiveMutex& operator=(const RecursiveMutex&) = delete;
+    RecursiveMutex& operator=(RecursiveMutex&&) = delete;
+
+public:
+    RecursiveMutex() = default;
+
+    void lock()
+    {
+        mutex_.lock();
+
+        if (0 == depth_++) { owner_.store(std::this_thread::get_id()); }
+    }
+
+    bool try_lock()
+    {
+        if (!mutex_.try_lock()) { return false; }
+
+        if (0 == depth_++) { owner_.store(std::this_thread::get_id()); }
+
+        return true;
+    }
+
+    void unlock()
+    {
+        if (0 == --depth_) { owner_.store(std::thread::id()); }
+
+        mutex_.unlock();
+    }
+
+    /** Unlocks every level held by the calling thread, which may hold none.
+     *  Returns the depth to pass to Reacquire(). */
+    std::size_t Release()
+    {
+        if (std::this_thread::get_id() != owner_.load()) { return 0; }
+
+        const std::size_t depth = depth_;
+        depth_ = 0;
+        owner_.store(std::thread::id());
+
+        for (std::size_t i = 0; i < depth; ++i) { mutex_.unlock(); }
+
+        return depth;
+    }
+
+    void Reacquire(const std::size_t depth)
+    {
+        for (std::size_t i = 0; i < depth; ++i) { lock(); }
+    }
+};
+} // namespace opentxs
+
+#endif // OPENTXS_CORE_UTIL_RECURSIVEMUTEX_HPP
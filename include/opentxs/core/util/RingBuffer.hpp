@@ -0,0 +1,161 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_UTIL_RINGBUFFER_HPP
+#define OPENTXS_CORE_UTIL_RINGBUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace opentxs
+{
+
+/** Bounded, lock-free multi-producer multi-consumer queue.
+ *
+ *  Each slot carries a sequence number which tells producers and consumers
+ *  whether it is free, full, or still being written, so neither side ever
+ *  takes a lock. Capacity is rounded up to a power of two. Push() and Pop()
+ *  return false instead of blocking when the queue is full or empty. */
+template <typename T>
+class RingBuffer
+{
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence_;
+        T data_;
+    };
+
+    static std::size_t RoundUp(std::size_t value)
+    {
+        std::size_t output = 2;
+
+        while (output < value) { output <<= 1; }
+
+        return output;
+    }
+
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> buffer_;
+    std::atomic<std::size_t> enqueue_;
+    std::atomic<std::size_t> dequeue_;
+
+    RingBuffer() = delete;
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer(RingBuffer&&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+    RingBuffer& operator=(RingBuffer&&) = delete;
+
+public:
+    explicit RingBuffer(std::size_t capacity)
+        : mask_(RoundUp(capacity) - 1)
+        , buffer_(new Cell[mask_ + 1])
+        , enqueue_(0)
+        , dequeue_(0)
+    {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            buffer_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t Capacity() const { return mask_ + 1; }
+
+    bool Push(T&& item)
+    {
+        Cell* cell = nullptr;
+        std::size_t position = enqueue_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            cell = &buffer_[position & mask_];
+            const std::size_t sequence =
+                cell->sequence_.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) -
+                                    static_cast<std::ptrdiff_t>(position);
+
+            if (0 == difference) {
+                if (enqueue_.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (0 > difference) {
+                return false;
+            } else {
+                position = enqueue_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data_ = std::move(item);
+        cell->sequence_.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool Pop(T& item)
+    {
+        Cell* cell = nullptr;
+        std::size_t position = dequeue_.load(std::memory_order_relaxed);
+
+        for (;;) {
+            cell = &buffer_[position & mask_];
+            const std::size_t sequence =
+                cell->sequence_.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) -
+                                    static_cast<std::ptrdiff_t>(position + 1);
+
+            if (0 == difference) {
+                if (dequeue_.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (0 > difference) {
+                return false;
+            } else {
+                position = dequeue_.load(std::memory_order_relaxed);
+            }
+        }
+
+        item = std::move(cell->data_);
+        cell->sequence_.store(position + mask_ + 1, std::memory_order_release);
+
+        return true;
+    }
+};
+} // namespace opentxs
+
+#endif // OPENTXS_CORE_UTIL_RINGBUFFER_HPP
@@ -65,6 +65,16 @@ public:
     virtual bool Store(
         const std::string& value,
         std::string& key) const = 0;
+    /** Stores a serialized storage tree node
+     *
+     *  The write may be held back until the next flush, and a later version of
+     *  the same node replaces one which has not been written yet. The object
+     *  can be loaded by its key in the meantime.
+     */
+    virtual bool StoreNode(
+        const std::string& value,
+        std::string& key,
+        const void* node) const = 0;
 
     virtual bool Migrate(const std::string& key) const = 0;
 
@@ -91,6 +101,9 @@ public:
     template <class T>
     bool StoreProto(const T& data) const;
 
+    template <class T>
+    bool StoreNode(const T& data, std::string& key, const void* node) const;
+
 protected:
     StorageDriver() = default;
 
@@ -41,6 +41,7 @@
 
 #include "opentxs/interface/storage/StorageDriver.hpp"
 
+#include <cstddef>
 #include <string>
 
 namespace opentxs
@@ -55,6 +56,23 @@ public:
 
     virtual bool StoreRoot(const std::string& hash) const = 0;
 
+    /** Groups the writes which follow into one transaction
+     *
+     *  Every call must be matched by a call to Commit() from the same thread.
+     *  Calls may be nested, in which case only the outermost Commit() writes
+     *  the transaction. Drivers without transactions write immediately.
+     */
+    virtual bool Begin() const = 0;
+    virtual bool Commit() const = 0;
+
+    /** Writes the tree nodes held back by StoreNode()
+     *
+     *  Call before storing a root hash which refers to them.
+     */
+    virtual bool FlushNodes() const = 0;
+    /** Number of tree nodes held back by StoreNode() */
+    virtual std::size_t PendingNodes() const = 0;
+
     virtual ~StoragePlugin() = default;
 
 protected:
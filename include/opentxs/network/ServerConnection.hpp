@@ -69,15 +69,23 @@ private:
     std::atomic<bool>& shutdown_;
     std::atomic<bool> status_;
     std::atomic<std::chrono::seconds>& keep_alive_;
+    const bool binary_enabled_{false};
+    bool binary_negotiated_{false};
+    bool binary_{false};
 
+    static bool BinaryFramesEnabled();
     static std::string GetRemoteEndpoint(
         const std::string& server,
         std::shared_ptr<const ServerContract>& contract);
 
+    /** Negotiates binary frames with the notary the first time it is
+     *  called. Sets timeout if the notary did not answer the probe. */
+    bool BinaryFrames(bool& timeout);
     void Init();
     bool Receive(std::string& reply);
     void ResetSocket();
     void ResetTimer();
+    NetworkReplyString SendBinary(const String& message);
     void SetRemoteKey();
     void SetProxy();
     void SetTimeouts();
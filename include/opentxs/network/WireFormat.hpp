@@ -0,0 +1,102 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_NETWORK_WIREFORMAT_HPP
+#define OPENTXS_NETWORK_WIREFORMAT_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace opentxs
+{
+
+class String;
+
+/** Binary framing for client/notary messages.
+ *
+ *  The armored format compresses every message at Z_BEST_COMPRESSION and
+ *  base64 encodes it before it is sent as a single string frame. The binary
+ *  format instead sends two frames: a header frame beginning with TAG
+ *  followed by one byte describing the payload encoding, and the raw payload
+ *  itself. Small payloads are sent uncompressed and large ones are deflated
+ *  at Z_BEST_SPEED. Messages longer than MAX_MESSAGE_SIZE are rejected on
+ *  both encode and decode, and compressed payloads stop inflating once they
+ *  reach it.
+ *
+ *  Support is negotiated by sending TAG as a single frame. A notary which
+ *  understands binary frames echoes it back, while an older notary fails to
+ *  parse it as an armored message and returns an empty reply. */
+class WireFormat
+{
+private:
+    static const char ENCODING_RAW = 'r';
+    static const char ENCODING_ZLIB = 'z';
+    static const std::size_t COMPRESSION_THRESHOLD = 1024;
+
+    static bool Deflate(const std::string& input, std::string& output);
+    static bool Inflate(const std::string& input, std::string& output);
+
+    WireFormat() = delete;
+
+public:
+    static const std::string TAG;
+    /** Just below MAX_STRING_LENGTH, which String refuses to approach. */
+    static const std::size_t MAX_MESSAGE_SIZE = 8000000;
+
+    /** Split a plain text message into binary header and payload frames. */
+    static bool Encode(
+        const String& message,
+        std::string& header,
+        std::string& payload);
+
+    /** Recover a plain text message from binary header and payload frames.
+     */
+    static bool Decode(
+        const std::string& header,
+        const std::string& payload,
+        String& message);
+
+    /** True if the frame is the header of a binary message. */
+    static bool IsHeader(const std::string& frame);
+
+    /** True if the frame is a binary framing negotiation request. */
+    static bool IsProbe(const std::string& frame);
+};
+} // namespace opentxs
+
+#endif // OPENTXS_NETWORK_WIREFORMAT_HPP
@@ -41,15 +41,36 @@
 
 #include "opentxs/network/ZMQ.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace opentxs
 {
 
+class Message;
 class ServerLoader;
 class OTServer;
+class String;
 
+/** Accepts client requests on a ROUTER socket and hands them to a pool of
+ *  worker threads.
+ *
+ *  Decoding the request and encoding the reply run fully in parallel.
+ *  Most commands hold the notary lock in shared mode plus a lock for every
+ *  Nym and asset account they may modify, as reported by
+ *  UserCommandProcessor::LockKeys. Commands which touch state shared by the
+ *  whole notary, and cron, take the notary lock exclusively. Replies are
+ *  routed back to the requesting peer, so existing REQ clients see exactly
+ *  the same request/reply semantics as before. */
 class MessageProcessor
 {
 public:
@@ -58,15 +79,118 @@ public:
     EXPORT void run();
 
 private:
+    /** Reader/writer lock protecting the notary's shared state. Writers are
+     *  preferred so cron can not be starved by a stream of read commands. */
+    class NotaryLock
+    {
+    public:
+        void lock();
+        void unlock();
+        void lock_shared();
+        void unlock_shared();
+
+        /** Holds the lock in shared mode for its lifetime */
+        class SharedGuard
+        {
+        public:
+            explicit SharedGuard(NotaryLock& lock);
+            ~SharedGuard();
+
+        private:
+            NotaryLock& lock_;
+
+            SharedGuard(const SharedGuard&) = delete;
+            SharedGuard& operator=(const SharedGuard&) = delete;
+        };
+
+    private:
+        std::mutex lock_;
+        std::condition_variable cv_;
+        std::size_t readers_{0};
+        std::size_t waiting_writers_{0};
+        bool writer_{false};
+    };
+
+    /** Hands out one mutex per key (Nym or account ID). Entries are removed
+     *  once the last user releases them. */
+    class KeyedLock
+    {
+    public:
+        void lock(const std::string& key);
+        void unlock(const std::string& key);
+
+        /** Holds the mutex for one key for its lifetime */
+        class Guard
+        {
+        public:
+            Guard(KeyedLock& lock, const std::string& key);
+            ~Guard();
+
+        private:
+            KeyedLock& lock_;
+            const std::string key_;
+
+            Guard(const Guard&) = delete;
+            Guard& operator=(const Guard&) = delete;
+        };
+
+    private:
+        struct Entry {
+            std::mutex mutex_;
+            std::size_t users_{0};
+        };
+
+        std::mutex map_lock_;
+        std::map<std::string, std::unique_ptr<Entry>> map_;
+    };
+
+    /** A request received on the ROUTER socket. The envelope holds the
+     *  routing frames which must prefix the reply. Binary requests also
+     *  carry the header frame describing the payload encoding. */
+    struct Job {
+        zmsg_t* envelope_{nullptr};
+        bool binary_{false};
+        std::string header_;
+        std::string request_;
+    };
+
+    typedef std::vector<std::unique_ptr<KeyedLock::Guard>> KeyedGuards;
+
+    static void lockKeys(
+        KeyedLock& lock,
+        const std::set<std::string>& keys,
+        KeyedGuards& guards);
+
     void init(int port, zcert_t* transportKey);
-    bool processMessage(const std::string& messageString, std::string& reply);
+    bool processArmored(const std::string& messageString, std::string& reply);
+    bool processBinary(
+        const std::string& header,
+        const std::string& payload,
+        std::string& replyHeader,
+        std::string& replyPayload);
+    bool processMessage(const String& messageContents, String& reply);
+    void processReply();
     void processSocket();
+    void worker();
 
 private:
+    static const std::string REPLY_ENDPOINT;
+
     OTServer* server_;
     zsock_t* zmqSocket_;
+    zsock_t* zmqReplySocket_;
     zactor_t* zmqAuth_;
     zpoller_t* zmqPoller_;
+
+    std::atomic<bool> shutdown_;
+    std::mutex queue_lock_;
+    std::condition_variable queue_cv_;
+    std::deque<Job> queue_;
+    std::vector<std::unique_ptr<std::thread>> workers_;
+
+    NotaryLock notary_lock_;
+    KeyedLock nym_lock_;
+    KeyedLock account_lock_;
 };
 
 } // namespace opentxs
@@ -107,6 +107,9 @@ private:
     void CreateMainFile(
         bool& mainFileExists,
         std::map<std::string, std::string>& args);
+    // Keeps the server nym's decrypted private keys in a SigningSession, so
+    // that signing replies and notary files doesn't decrypt them every time.
+    void OpenSigningSession();
     bool SendInstrumentToNym(const Identifier& notaryID,
                              const Identifier& senderNymID,
                              const Identifier& recipientNymID,
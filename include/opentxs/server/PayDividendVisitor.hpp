@@ -41,7 +41,12 @@
 
 #include "opentxs/core/AccountVisitor.hpp"
 
+#include <atomic>
 #include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 
 namespace opentxs
 {
@@ -61,6 +66,8 @@ class String;
 // be defined
 // here in otserver (so it can see the methods that it needs...)
 //
+// Trigger() is thread safe, so the accounts can be visited in parallel.
+//
 class PayDividendVisitor : public AccountVisitor
 {
     Identifier* m_pNymID{nullptr};
@@ -71,10 +78,20 @@ class PayDividendVisitor : public AccountVisitor
                          // memo field for each voucher.)
     OTServer* m_pServer{nullptr}; // no need to cleanup. It's here for convenience only.
     int64_t m_lPayoutPerShare{0};
-    int64_t m_lAmountPaidOut{0};  // as we pay each voucher out, we keep a running
-                               // count.
-    int64_t m_lAmountReturned{0}; // as we pay each voucher out, we keep a running
-                               // count.
+    std::atomic<int64_t> m_lAmountPaidOut{0};  // as we pay each voucher out,
+                                               // we keep a running count.
+    std::atomic<int64_t> m_lAmountReturned{0}; // as we pay each voucher out,
+                                               // we keep a running count.
+    // Transaction numbers come from the server's counter, one at a time.
+    std::mutex number_lock_;
+    // Vouchers for the same nym are dropped into its nymbox one at a time.
+    std::mutex nym_lock_;
+    std::map<std::string, std::unique_ptr<std::mutex>> nym_locks_;
+    // Trigger() runs on several threads at once, so it logs one message at a
+    // time.
+    std::mutex log_lock_;
+
+    std::mutex& nym_lock(const Identifier& nymID);
 
 public:
     PayDividendVisitor(const Identifier& theNotaryID,
@@ -112,11 +129,11 @@ public:
     }
     int64_t GetAmountPaidOut()
     {
-        return m_lAmountPaidOut;
+        return m_lAmountPaidOut.load();
     }
     int64_t GetAmountReturned()
     {
-        return m_lAmountReturned;
+        return m_lAmountReturned.load();
     }
 
     bool Trigger(Account& theAccount) override;
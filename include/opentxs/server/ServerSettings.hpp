@@ -77,6 +77,56 @@ struct ServerSettings
         __heartbeat_ms_between_beats = value;
     }
 
+    static int32_t GetWorkerThreads()
+    {
+        return __worker_threads;
+    }
+
+    static void SetWorkerThreads(int32_t value)
+    {
+        __worker_threads = value;
+    }
+
+    static int32_t GetDividendThreads()
+    {
+        return __dividend_threads;
+    }
+
+    static void SetDividendThreads(int32_t value)
+    {
+        __dividend_threads = value;
+    }
+
+    static int64_t GetTransactionNumberBlock()
+    {
+        return __transaction_number_block;
+    }
+
+    static void SetTransactionNumberBlock(int64_t value)
+    {
+        __transaction_number_block = value;
+    }
+
+    static int32_t GetBoxReceiptsPerReply()
+    {
+        return __box_receipts_per_reply;
+    }
+
+    static void SetBoxReceiptsPerReply(int32_t value)
+    {
+        __box_receipts_per_reply = value;
+    }
+
+    static int64_t GetSigningSessionTimeout()
+    {
+        return __signing_session_timeout;
+    }
+
+    static void SetSigningSessionTimeout(int64_t value)
+    {
+        __signing_session_timeout = value;
+    }
+
     static const std::string& GetOverrideNymID()
     {
         return __override_nym_id;
@@ -88,9 +138,19 @@ struct ServerSettings
     }
 
     static int64_t __min_market_scale;
+    // How many transaction numbers are reserved per save of the main file.
+    static int64_t __transaction_number_block;
 
     static int32_t __heartbeat_no_requests;
     static int32_t __heartbeat_ms_between_beats;
+    // Number of threads processing client requests. (0 means one per core.)
+    static int32_t __worker_threads;
+    // Number of threads paying out a dividend. (0 means one per core.)
+    static int32_t __dividend_threads;
+    // Most box receipts returned by one getBoxReceipts reply.
+    static int32_t __box_receipts_per_reply;
+    // Seconds the server's decrypted private keys are kept for signing.
+    static int64_t __signing_session_timeout;
 
     // The Nym who's allowed to do certain commands even if they are turned off.
     static std::string __override_nym_id;
@@ -45,6 +45,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace opentxs
@@ -76,9 +77,20 @@ public:
         return transactionNumber_;
     }
 
+    /** Numbers up to and including this one may already have been issued.
+     *  This is the value persisted in the main file. */
+    TransactionNumber reservedTransactionNumber() const
+    {
+        return reservedTransactionNumber_;
+    }
+
+    /** Set when loading the main file. Every number up to the persisted high
+     *  water mark is treated as issued, so a crash can skip the unused part
+     *  of a reserved block but never issues the same number twice. */
     void transactionNumber(TransactionNumber value)
     {
         transactionNumber_ = value;
+        reservedTransactionNumber_ = value;
     }
 
     bool addBasketAccountID(const Identifier& basketId,
@@ -110,6 +122,8 @@ public:
         const Identifier& instrumentDefinitionID);
 
     // Each asset contract has its own series of Mints
+    //
+    // Vouchers and mints are only used while the notary is locked exclusively
     Mint* getMint(const Identifier& instrumentDefinitionID,
                   int32_t seriesCount);
 
@@ -132,8 +146,16 @@ private:
     typedef std::map<std::string, std::string> BasketsMap;
 
 private:
+    bool issue_next_number(TransactionNumber& txNumber);
+
+    // Requests from different Nyms are processed concurrently, so numbers are
+    // issued under this lock.
+    std::mutex number_lock_;
     // This stores the last VALID AND ISSUED transaction number.
     int64_t transactionNumber_;
+    // The highest transaction number saved to the main file. Numbers are
+    // reserved in blocks so the main file is only rewritten once per block.
+    int64_t reservedTransactionNumber_;
     // maps basketId with basketAccountId
     BasketsMap idToBasketMap_;
     // basket issuer account ID, which is *different* on each server, using the
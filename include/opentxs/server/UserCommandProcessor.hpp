@@ -40,6 +40,9 @@
 #define OPENTXS_SERVER_USERCOMMANDPROCESSOR_HPP
 
 #include <cstdint>
+#include <map>
+#include <set>
+#include <string>
 
 namespace opentxs
 {
@@ -47,6 +50,7 @@ namespace opentxs
 class ClientConnection;
 class ClientContext;
 class Identifier;
+class Ledger;
 class OTServer;
 class Message;
 class Nym;
@@ -62,9 +66,39 @@ public:
         Message& msgOut,
         ClientConnection* connection);
 
+    /** Collects the Nyms and asset accounts a request may modify, using only
+     *  the request itself. Returns false if the request touches state shared
+     *  by the whole notary (cron, mints, baskets, vouchers, contracts or the
+     *  server Nym) and must run with the notary locked exclusively. */
+    bool LockKeys(
+        const Message& msgIn,
+        std::set<std::string>& nyms,
+        std::set<std::string>& accounts) const;
+
+    /** Adds the accounts which can only be found by reading the sender's
+     *  inbox, such as the source of a pending transfer being accepted. Must
+     *  be called while holding the locks named by LockKeys. Returns false if
+     *  the request must run with the notary locked exclusively. */
+    bool InboxLockKeys(
+        const Message& msgIn,
+        std::set<std::string>& accounts) const;
+
 private:
+    /** Which locks a command needs, beyond the sending Nym's own. */
+    enum class LockScope : std::int8_t {
+        NYM,     // Only the sender's Nym, context and Nymbox
+        NYMS,    // Also the Nym in m_strNymID2
+        ACCOUNT, // Also the account in m_strAcctID
+        LEDGER,  // Also the accounts named by the attached ledger
+        NOTARY,  // Shared notary state, so nothing else may run
+    };
+
+    static const std::map<std::string, LockScope> lock_scope_;
+
     OTServer* server_{nullptr};
 
+    bool load_request_ledger(const Message& msgIn, Ledger& ledger) const;
+
     bool SendMessageToNym(
         const Identifier& notaryID,
         const Identifier& senderNymID,
@@ -100,6 +134,7 @@ private:
         Message& msgOut);
     void UserCmdIssueBasket(Nym& nym, Message& msgIn, Message& msgOut);
     void UserCmdGetBoxReceipt(Message& msgIn, Message& msgOut);
+    void UserCmdGetBoxReceipts(Message& msgIn, Message& msgOut);
     void UserCmdDeleteUser(
         Nym& nym,
         ClientContext& context,
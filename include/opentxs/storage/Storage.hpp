@@ -113,10 +113,13 @@ private:
 
     std::uint32_t version_{0};
     std::int64_t gc_interval_{std::numeric_limits<int64_t>::max()};
+    mutable std::int64_t last_commit_{0};
     mutable std::unique_ptr<storage::Root> meta_;
     std::unique_ptr<StoragePlugin> primary_plugin_;
     mutable std::atomic<bool> primary_bucket_;
 
+    bool commit(const bool force) const;
+    bool flush(const Lock& lock) const;
     void save(storage::Root* in, const Lock& lock);
     bool verify_write_lock(const std::unique_lock<std::mutex>& lock) const;
 
@@ -233,6 +236,7 @@ public:
         const std::string& itemID);
     bool RemoveServer(const std::string& id);
     bool RemoveUnitDefinition(const std::string& id);
+    void RunCommit(const bool force = false);
     void RunGC();
     std::string ServerAlias(const std::string& id);
     ObjectList ServerList() const;
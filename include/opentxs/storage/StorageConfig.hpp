@@ -39,13 +39,17 @@
 #ifndef OPENTXS_STORAGE_STORAGECONFIG_HPP
 #define OPENTXS_STORAGE_STORAGECONFIG_HPP
 
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <thread>
 
 namespace opentxs
 {
 
 typedef std::function<void(const std::string&, const std::string&)>  InsertCB;
+typedef std::function<void()> StorageTask;
+typedef std::function<void(const StorageTask&)> ExecuteCB;
 
 class StorageConfig
 {
@@ -54,13 +58,36 @@ public:
     bool auto_publish_servers_ = true;
     bool auto_publish_units_ = true;
     int64_t gc_interval_ = 60 * 60 * 1;
+    // Seconds between writes of the root hash. Tree nodes saved in the
+    // meantime are held in memory and only their latest versions are
+    // written. 0 writes everything as soon as it is saved.
+    int64_t commit_interval_ = 0;
     std::string path_;
     InsertCB dht_callback_;
+    // Runs background work (garbage collection, map operations, bucket
+    // purges). Without it, each task gets a detached thread of its own.
+    ExecuteCB executor_callback_;
+
+    void Execute(const StorageTask& task) const
+    {
+        if (executor_callback_) {
+            executor_callback_(task);
+        } else {
+            std::thread(task).detach();
+        }
+    }
 
 #ifdef OT_STORAGE_FS
     std::string fs_primary_bucket_ = "a";
     std::string fs_secondary_bucket_ = "b";
     std::string fs_root_file_ = "root";
+    // Objects are stored in nested subdirectories named after the first
+    // characters of their key, two characters per level. 0 keeps every
+    // object of a bucket in one directory.
+    int64_t fs_shard_depth_ = 0;
+    // Flush every object to disk before the root which refers to it is
+    // updated.
+    bool fs_sync_ = false;
 #endif
 
 #ifdef OT_STORAGE_SQLITE
@@ -70,6 +97,12 @@ public:
     std::string sqlite3_root_key_ = "a";
     std::string sqlite3_db_file_ = "opentxs.sqlite3";
 #endif
+
+#ifdef OT_STORAGE_PACK
+    std::string pack_primary_bucket_ = "a";
+    std::string pack_secondary_bucket_ = "b";
+    std::string pack_root_file_ = "root";
+#endif
 };
 
 }  // namespace opentxs
@@ -44,7 +44,11 @@
 #include "opentxs/core/Types.hpp"
 
 #include <atomic>
+#include <cstddef>
+#include <map>
+#include <mutex>
 #include <string>
+#include <utility>
 
 namespace opentxs
 {
@@ -71,12 +75,21 @@ public:
     bool Store(
         const std::string& value,
         std::string& key) const override;
+    bool StoreNode(
+        const std::string& value,
+        std::string& key,
+        const void* node) const override;
 
     bool Migrate(const std::string& key) const override;
 
     std::string LoadRoot() const override = 0;
     bool StoreRoot(const std::string& hash) const override = 0;
 
+    bool Begin() const override;
+    bool Commit() const override;
+    bool FlushNodes() const override;
+    std::size_t PendingNodes() const override;
+
     virtual void Cleanup() = 0;
 
     virtual ~StoragePlugin_impl() = default;
@@ -93,9 +106,20 @@ protected:
     StoragePlugin_impl() = delete;
 
 private:
+    /** Serialized node, and how many nodes have it as their latest version */
+    typedef std::pair<std::string, std::size_t> PendingNode;
+
     const Digest& digest_;
     std::atomic<bool>& current_bucket_;
 
+    mutable std::mutex node_lock_;
+    /** key -> node which has not been written yet */
+    mutable std::map<std::string, PendingNode> pending_nodes_;
+    /** node -> key of its latest pending version */
+    mutable std::map<const void*, std::string> node_versions_;
+
+    bool find_pending(const std::string& key, std::string& value) const;
+
     StoragePlugin_impl(const StoragePlugin_impl&) = delete;
     StoragePlugin_impl(StoragePlugin_impl&&) = delete;
     StoragePlugin_impl& operator=(const StoragePlugin_impl&) = delete;
@@ -170,5 +194,21 @@ bool StorageDriver::StoreProto(const T& data) const
 
     return StoreProto<T>(data, notUsed);
 }
+
+template <class T>
+bool StorageDriver::StoreNode(
+    const T& data,
+    std::string& key,
+    const void* node) const
+{
+    const auto version = data.version();
+
+    if (!proto::Check<T>(data, version, version)) {
+
+        return false;
+    }
+
+    return StoreNode(proto::ProtoAsString<T>(data), key, node);
+}
 }  // namespace opentxs
 #endif  // OPENTXS_STORAGE_STORAGEDRIVERIMPLEMTNATION_HPP
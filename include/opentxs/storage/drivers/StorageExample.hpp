@@ -225,8 +225,9 @@ public:
      *
      *    * The filesystem driver uses directories to implement buckets.
      *      Emptying a bucket consists of renaming the directory to a random
-     *      name, spawing a detached thread to delete it in the background,
-     *      and creating a new empty directory with the correct name.
+     *      name, deleting it in the background via
+     *      StorageConfig::Execute(), and creating a new empty directory with
+     *      the correct name.
      *    * SQL-based backends can use tables to implement buckets. Emptying a
      *      bucket can be implemented with a DROP TABLE command followed by a
      *      CREATE TABLE command.
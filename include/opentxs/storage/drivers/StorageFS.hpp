@@ -41,6 +41,14 @@
 
 #include "opentxs/storage/StoragePlugin.hpp"
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace opentxs
 {
 
@@ -59,7 +67,37 @@ private:
 
     std::string folder_;
 
+    // Subdirectories known to exist, so they aren't created on every write.
+    mutable std::mutex directory_lock_;
+    mutable std::set<std::string> directories_;
+
+    // Between Begin() and Commit(), writes made by the thread which called
+    // Begin() are flushed to disk together when the batch is committed, and
+    // the root file is only written after them.
+    mutable std::recursive_mutex batch_lock_;
+    mutable std::mutex pending_lock_;
+    mutable std::uint32_t batch_depth_{0};
+    mutable std::thread::id batch_owner_;
+    mutable std::vector<std::string> pending_files_;
+    mutable std::set<std::string> pending_directories_;
+    mutable std::string pending_root_;
+    mutable bool root_pending_{false};
+
+    mutable std::atomic<std::uint64_t> temp_counter_{0};
+
     std::string GetBucketName(const bool bucket) const;
+    std::string GetDirectory(const std::string& key, const bool bucket) const;
+    bool InBatch() const;
+    bool PrepareDirectory(const std::string& directory) const;
+    bool ReadFile(const std::string& filename, std::string& value) const;
+    bool Sync(
+        const std::vector<std::string>& files,
+        const std::set<std::string>& directories) const;
+    bool WriteFile(
+        const std::string& directory,
+        const std::string& filename,
+        const std::string& value,
+        const bool sync) const;
 
     void Init_StorageFS();
     void Purge(const std::string& path) const;
@@ -94,6 +132,9 @@ public:
 
     bool EmptyBucket(const bool bucket) const override;
 
+    bool Begin() const override;
+    bool Commit() const override;
+
     void Cleanup() override;
     ~StorageFS();
 };
@@ -0,0 +1,176 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_STORAGE_STORAGEPACK_HPP
+#define OPENTXS_STORAGE_STORAGEPACK_HPP
+
+#include "opentxs/storage/StoragePlugin.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace opentxs
+{
+
+class Storage;
+class StorageConfig;
+
+// Log structured implementation of opentxs::storage
+//
+// Each bucket is a single pack file. Objects are only ever appended to it,
+// as a record holding the key, the value and a checksum, and are found
+// through an index of the pack which is kept in memory and rebuilt by
+// scanning the pack on startup. A record whose checksum doesn't match is
+// skipped. The scan only stops, and discards the rest of the pack, at a
+// record which was never completely written.
+//
+// Appends are written without being flushed to disk. Before the root file is
+// replaced, both packs are flushed, so an object is always on disk before any
+// root which can refer to it. Between Begin() and Commit(), appends made by
+// the thread which called Begin() are also buffered in memory and written
+// together.
+//
+// Garbage collection copies the live objects into the other pack (see
+// StoragePlugin_impl::Migrate), after which emptying the old bucket deletes
+// its pack file.
+class StoragePack
+    : public virtual StoragePlugin_impl
+    , public virtual StorageDriver
+{
+private:
+    typedef StoragePlugin_impl ot_super;
+
+    friend class Storage;
+
+    struct Location {
+        std::uint64_t offset_{0}; // Of the record.
+        std::uint32_t key_size_{0};
+        std::uint32_t value_size_{0};
+    };
+
+    // Closed once the pack and every Load() reading from it are done with it,
+    // so that reads don't need to hold the pack lock.
+    struct File {
+        const int fd_;
+
+        explicit File(const int fd)
+            : fd_(fd)
+        {
+        }
+        ~File();
+    };
+
+    struct Pack {
+        mutable std::mutex lock_;
+        std::string filename_;
+        std::shared_ptr<File> file_;
+        // Bytes written to the file. Buffered records follow from here.
+        std::uint64_t size_{0};
+        std::string buffer_;
+        std::unordered_map<std::string, Location> index_;
+    };
+
+    std::string folder_;
+    mutable Pack packs_[2];
+
+    // Held from Begin() until the matching Commit(), so only one thread has
+    // a batch open at a time.
+    mutable std::recursive_mutex batch_lock_;
+    mutable std::mutex batch_state_lock_;
+    mutable std::uint32_t batch_depth_{0};
+    mutable std::thread::id batch_owner_;
+
+    Pack& GetPack(const bool bucket) const;
+    bool InBatch() const;
+
+    bool Flush(Pack& pack, const std::unique_lock<std::mutex>& lock) const;
+    bool Open(Pack& pack) const;
+    bool Read(
+        const File& file,
+        const Location& location,
+        std::string& prefix,
+        std::string& output) const;
+    bool Sync(const bool bucket) const;
+
+    void Init_StoragePack();
+
+    StoragePack() = delete;
+    StoragePack(const StoragePack&) = delete;
+    StoragePack(StoragePack&&) = delete;
+    StoragePack& operator=(const StoragePack&) = delete;
+    StoragePack& operator=(StoragePack&&) = delete;
+
+protected:
+    StoragePack(
+        const StorageConfig& config,
+        const Digest& hash,
+        const Random& random,
+        std::atomic<bool>& bucket);
+
+public:
+    std::string LoadRoot() const override;
+    bool StoreRoot(const std::string& hash) const override;
+
+    using ot_super::Load;
+    bool Load(
+        const std::string& key,
+        std::string& value,
+        const bool bucket) const override;
+    using ot_super::Store;
+    bool Store(
+        const std::string& key,
+        const std::string& value,
+        const bool bucket) const override;
+
+    bool EmptyBucket(const bool bucket) const override;
+
+    bool Begin() const override;
+    bool Commit() const override;
+
+    void Cleanup_StoragePack();
+    void Cleanup() override;
+    ~StoragePack();
+};
+
+}  // namespace opentxs
+#endif // OPENTXS_STORAGE_STORAGEPACK_HPP
@@ -41,6 +41,13 @@
 
 #include "opentxs/storage/StoragePlugin.hpp"
 
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
 extern "C"
 {
     #include <sqlite3.h>
@@ -65,8 +72,35 @@ private:
     std::string folder_;
     sqlite3* db_{nullptr};
 
+    // Prepared statements, by table name. Statements are reset after each
+    // use and only finalized when the table is purged or on cleanup.
+    mutable std::mutex statement_lock_;
+    mutable std::map<std::string, sqlite3_stmt*> select_statements_;
+    mutable std::map<std::string, sqlite3_stmt*> upsert_statements_;
+
+    // Writes made by a thread between Begin() and the matching Commit() are
+    // held in that thread's batch and written in one transaction by the
+    // outermost Commit(). Writes from other threads (garbage collection) are
+    // never part of that transaction.
+    struct Batch {
+        std::uint32_t depth_{0};
+        std::map<std::pair<std::string, std::string>, std::string> values_;
+    };
+
+    mutable std::mutex batch_lock_;
+    mutable std::map<std::thread::id, Batch> batches_;
+
+    // Held for every write to the connection, so that an open transaction
+    // only ever contains the writes of the Commit() which opened it.
+    mutable std::mutex transaction_lock_;
+
     std::string GetTableName(const bool bucket) const;
 
+    sqlite3_stmt* GetStatement(
+        const std::string& tablename,
+        const bool upsert) const;
+    void FinalizeStatements(const std::string& tablename) const;
+
     bool Select(
         const std::string& key,
         const std::string& tablename,
@@ -75,6 +109,10 @@ private:
         const std::string& key,
         const std::string& tablename,
         const std::string& value) const;
+    bool Write(
+        const std::string& key,
+        const std::string& tablename,
+        const std::string& value) const;
     bool Create(const std::string& tablename) const;
     bool Purge(const std::string& tablename) const;
 
@@ -106,6 +144,9 @@ public:
         const bool bucket) const override;
     bool EmptyBucket(const bool bucket) const override;
 
+    bool Begin() const override;
+    bool Commit() const override;
+
     void Cleanup_StorageSqlite3();
     void Cleanup() override;
     ~StorageSqlite3();
@@ -42,12 +42,13 @@
 #include "opentxs/api/Editor.hpp"
 #include "opentxs/core/Types.hpp"
 #include "opentxs/storage/tree/Node.hpp"
+#include "opentxs/storage/StorageConfig.hpp"
 
 #include <atomic>
 #include <cstdint>
+#include <future>
 #include <limits>
 #include <string>
-#include <thread>
 
 namespace opentxs
 {
@@ -67,6 +68,9 @@ private:
 
     const std::uint64_t gc_interval_{std::numeric_limits<int64_t>::max()};
     const EmptyBucket empty_bucket_;
+    // Writes the pending tree nodes and the root hash
+    const FlushStorage flush_;
+    const ExecuteCB execute_;
 
     mutable std::string gc_root_;
     std::atomic<bool>& current_bucket_;
@@ -75,7 +79,8 @@ private:
     mutable std::atomic<std::uint64_t> last_gc_;
     mutable std::atomic<std::uint64_t> sequence_;
     mutable std::mutex gc_lock_;
-    mutable std::unique_ptr<std::thread> gc_thread_;
+    // Ready once the most recently started garbage collection has finished
+    mutable std::shared_future<void> gc_done_;
 
     std::string tree_root_;
     mutable std::mutex tree_lock_;
@@ -95,6 +100,8 @@ private:
         const std::string& hash,
         const std::int64_t interval,
         const EmptyBucket& empty,
+        const FlushStorage& flush,
+        const ExecuteCB& execute,
         std::atomic<bool>& bucket);
     Root() = delete;
     Root(const Root&) = delete;
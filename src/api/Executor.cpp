@@ -0,0 +1,302 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/api/Executor.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace opentxs
+{
+
+bool Executor::Item::operator<(const Item& rhs) const
+{
+    // std::priority_queue pops the largest item: higher priority first, then
+    // the earliest submission.
+    if (priority_ != rhs.priority_) { return priority_ < rhs.priority_; }
+
+    return sequence_ > rhs.sequence_;
+}
+
+Executor::Executor(const std::size_t workers)
+{
+    shutdown_.store(false);
+    const std::size_t count = std::max<std::size_t>(workers, 1);
+    background_limit_ = std::max<std::size_t>(count / 2, 1);
+    workers_.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        workers_.emplace_back(&Executor::run, this);
+    }
+}
+
+bool Executor::ready() const
+{
+    return !queue_.empty() ||
+           (!background_.empty() && (running_background_ < background_limit_));
+}
+
+void Executor::run()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    while (true) {
+        signal_.wait(lock, [this]() -> bool { return shutdown_ || ready(); });
+
+        if (shutdown_) { return; }
+
+        // Background tasks only start while no other task is waiting.
+        const bool background = queue_.empty();
+        Item item;
+
+        if (background) {
+            item = std::move(background_.front());
+            background_.pop();
+        } else {
+            item = queue_.top();
+            queue_.pop();
+        }
+
+        if (item.cancelled_ && item.cancelled_->load()) {
+            ++cancelled_;
+            lock.unlock();
+            item = Item();
+            lock.lock();
+
+            continue;
+        }
+
+        const auto start = Clock::now();
+        const auto wait = start - item.queued_;
+        ++started_;
+        ++running_;
+
+        if (background) { ++running_background_; }
+
+        total_wait_ += wait;
+        max_wait_ = std::max(max_wait_, wait);
+        lock.unlock();
+
+        try {
+            item.task_();
+        } catch (const std::exception& e) {
+            otErr << "Executor::" << __FUNCTION__
+                  << ": Background task failed: " << e.what() << std::endl;
+        } catch (...) {
+            otErr << "Executor::" << __FUNCTION__
+                  << ": Background task failed with an unknown exception."
+                  << std::endl;
+        }
+
+        // Release whatever the task captured before taking the lock again.
+        item.task_ = Task();
+        item.cancelled_.reset();
+        const auto finish = Clock::now();
+        lock.lock();
+        --running_;
+        ++completed_;
+        total_run_ += finish - start;
+
+        if (background) {
+            --running_background_;
+
+            // Another worker may be idle only because the background limit
+            // was reached.
+            if (!background_.empty()) { signal_.notify_one(); }
+        }
+    }
+}
+
+Executor::Metrics Executor::Stats() const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    Metrics output;
+    output.workers_ = workers_.size();
+    output.queued_ = queue_.size() + background_.size();
+    output.running_ = running_;
+    output.submitted_ = submitted_;
+    output.completed_ = completed_;
+    output.cancelled_ = cancelled_;
+    output.max_wait_ =
+        std::chrono::duration_cast<std::chrono::microseconds>(max_wait_);
+
+    if (0 < started_) {
+        output.average_wait_ =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                total_wait_ / started_);
+    }
+
+    if (0 < completed_) {
+        output.average_run_ =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                total_run_ / completed_);
+    }
+
+    return output;
+}
+
+void Executor::Parallel(
+    const std::size_t count,
+    const std::function<void(const std::size_t)>& task,
+    const std::size_t threads,
+    const Priority priority)
+{
+    const std::size_t participants =
+        std::min(std::min(threads, workers_.size()), count);
+
+    if (2 > participants) {
+        for (std::size_t i = 0; i < count; ++i) { task(i); }
+
+        return;
+    }
+
+    // Shared with the helper tasks, which may not get to run until after this
+    // call has returned.
+    struct State {
+        std::mutex lock_;
+        std::condition_variable done_;
+        bool closed_{false};
+        std::size_t active_{0};
+        std::atomic<std::size_t> next_{0};
+        const std::function<void(const std::size_t)>* task_{nullptr};
+        std::size_t count_{0};
+
+        void Run()
+        {
+            for (auto i = next_++; i < count_; i = next_++) { (*task_)(i); }
+        }
+    };
+
+    auto state = std::make_shared<State>();
+    state->task_ = &task;
+    state->count_ = count;
+
+    for (std::size_t i = 1; i < participants; ++i) {
+        Submit(
+            [state]() -> void {
+                {
+                    std::lock_guard<std::mutex> lock(state->lock_);
+
+                    if (state->closed_) { return; }
+
+                    ++state->active_;
+                }
+
+                state->Run();
+                std::lock_guard<std::mutex> lock(state->lock_);
+                --state->active_;
+                state->done_.notify_all();
+            },
+            priority);
+    }
+
+    state->Run();
+    std::unique_lock<std::mutex> lock(state->lock_);
+    state->closed_ = true;
+    state->done_.wait(lock, [&]() -> bool { return 0 == state->active_; });
+}
+
+bool Executor::Submit(const Task& task, const Priority priority)
+{
+    return submit(task, priority, nullptr);
+}
+
+bool Executor::Submit(
+    const Task& task,
+    const Cancellation& cancel,
+    const Priority priority)
+{
+    return submit(task, priority, cancel.flag_);
+}
+
+bool Executor::submit(
+    const Task& task,
+    const Priority priority,
+    const std::shared_ptr<const std::atomic<bool>>& cancelled)
+{
+    if (!task) { return false; }
+
+    std::unique_lock<std::mutex> lock(lock_);
+
+    if (shutdown_) { return false; }
+
+    Item item;
+    item.priority_ = priority;
+    item.sequence_ = submitted_++;
+    item.queued_ = Clock::now();
+    item.task_ = task;
+    item.cancelled_ = cancelled;
+
+    if (Priority::BACKGROUND == priority) {
+        background_.push(std::move(item));
+    } else {
+        queue_.push(std::move(item));
+    }
+
+    lock.unlock();
+    signal_.notify_one();
+
+    return true;
+}
+
+void Executor::Shutdown()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    if (shutdown_.exchange(true)) { return; }
+
+    // Tasks which have not started are discarded without running.
+    cancelled_ += queue_.size() + background_.size();
+    std::priority_queue<Item> discarded;
+    std::queue<Item> discardedBackground;
+    std::swap(discarded, queue_);
+    std::swap(discardedBackground, background_);
+    lock.unlock();
+    signal_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+}
+
+Executor::~Executor() { Shutdown(); }
+}  // namespace opentxs
@@ -40,6 +40,7 @@
 
 #include "opentxs/api/Api.hpp"
 #include "opentxs/api/Dht.hpp"
+#include "opentxs/api/Executor.hpp"
 #include "opentxs/api/Identity.hpp"
 #include "opentxs/api/Settings.hpp"
 #include "opentxs/api/Wallet.hpp"
@@ -59,8 +60,10 @@
 #include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/String.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <ctime>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -93,15 +96,16 @@ void OT::Factory(const bool serverMode)
 void OT::Init()
 {
     Init_Config();
+    Init_Executor(); // requires Init_Config()
     Init_Crypto();
-    Init_Storage(); // requires Init_Config()
+    Init_Storage(); // requires Init_Config(), Init_Executor()
     Init_Dht();  // requires Init_Config()
     Init_ZMQ(); // requires Init_Config()
     Init_Contracts();
     Init_Identity();
     Init_Api(); // requires Init_Config(), Init_Crypto(), Init_Contracts(),
                 // Init_Identity(), Init_Storage(), Init_ZMQ()
-    Init_Periodic();  // requires Init_Dht(), Init_Storage()
+    Init_Periodic();  // requires Init_Dht(), Init_Executor(), Init_Storage()
 }
 
 void OT::Init_Api()
@@ -138,6 +142,25 @@ void OT::Init_Config()
 
 void OT::Init_Contracts() { contract_manager_.reset(new class Wallet); }
 
+void OT::Init_Executor()
+{
+    std::int64_t threads = 0;
+    bool notUsed;
+    Config().CheckSet_long(
+        "executor",
+        "threads",
+        threads,
+        threads,
+        notUsed,
+        "; Number of threads for background tasks. (0 means one per core.)");
+
+    if (0 >= threads) {
+        threads = std::max<std::int64_t>(2, std::thread::hardware_concurrency());
+    }
+
+    executor_.reset(new class Executor(threads));
+}
+
 void OT::Init_Crypto() { crypto_.reset(&CryptoEngine::It()); }
 
 void OT::Init_Identity() { identity_.reset(new class Identity); }
@@ -195,6 +218,12 @@ void OT::Init_Storage()
         config.gc_interval_,
         config.gc_interval_,
         notUsed);
+    Config().CheckSet_long(
+        "storage",
+        "commit_interval",
+        config.commit_interval_,
+        config.commit_interval_,
+        notUsed);
     Config().CheckSet_str(
         "storage", "path", String(config.path_), config.path_, notUsed);
 #if OT_STORAGE_FS
@@ -216,6 +245,18 @@ void OT::Init_Storage()
         String(config.fs_root_file_),
         config.fs_root_file_,
         notUsed);
+    Config().CheckSet_long(
+        "storage",
+        "fs_shard_depth",
+        config.fs_shard_depth_,
+        config.fs_shard_depth_,
+        notUsed);
+    Config().CheckSet_bool(
+        "storage",
+        "fs_sync",
+        config.fs_sync_,
+        config.fs_sync_,
+        notUsed);
 #endif
 #if OT_STORAGE_SQLITE
     Config().CheckSet_str(
@@ -249,6 +290,26 @@ void OT::Init_Storage()
         config.sqlite3_db_file_,
         notUsed);
 #endif
+#if OT_STORAGE_PACK
+    Config().CheckSet_str(
+        "storage",
+        "pack_primary",
+        String(config.pack_primary_bucket_),
+        config.pack_primary_bucket_,
+        notUsed);
+    Config().CheckSet_str(
+        "storage",
+        "pack_secondary",
+        String(config.pack_secondary_bucket_),
+        config.pack_secondary_bucket_,
+        notUsed);
+    Config().CheckSet_str(
+        "storage",
+        "pack_root_file",
+        String(config.pack_root_file_),
+        config.pack_root_file_,
+        notUsed);
+#endif
 
     if (dht_) {
         config.dht_callback_ = std::bind(
@@ -259,6 +320,13 @@ void OT::Init_Storage()
             std::placeholders::_2);
     }
 
+    OT_ASSERT(executor_);
+
+    auto executor = executor_.get();
+    config.executor_callback_ = [executor](const StorageTask& task) -> void {
+        executor->Submit(task, Executor::Priority::BACKGROUND);
+    };
+
     storage_.reset(new Storage(config, hash, random));
 }
 
@@ -424,18 +492,19 @@ void OT::Periodic()
             if ((now - std::get<0>(task)) > std::get<1>(task)) {
                 // set "last performed"
                 std::get<0>(task) = now;
-                // run the task in an independent thread
-                auto taskThread = std::thread(std::get<2>(task));
-                taskThread.detach();
+                // run the task on the shared executor
+                executor_->Submit(
+                    std::get<2>(task), Executor::Priority::BACKGROUND);
             }
         }
 
         listLock.unlock();
 
         // This method has its own interval checking. Run here to avoid
-        // spawning unnecessary threads.
+        // queueing unnecessary tasks.
         if (storage_) {
             storage_->RunGC();
+            storage_->RunCommit();
         }
 
         if (!shutdown_.load()) {
@@ -495,6 +564,13 @@ Dht& OT::DHT() const
     return *dht_;
 }
 
+class Executor& OT::Executor() const
+{
+    OT_ASSERT(executor_)
+
+    return *executor_;
+}
+
 class Identity& OT::Identity() const
 {
     OT_ASSERT(identity_)
@@ -532,6 +608,10 @@ void OT::Shutdown()
         api_->Cleanup();
     }
 
+    // Discards queued tasks and waits for running ones, which may still use
+    // any of the objects below.
+    executor_.reset();
+
     api_.reset();
     identity_.reset();
     contract_manager_.reset();
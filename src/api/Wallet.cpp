@@ -317,6 +317,47 @@ void Wallet::save(class Context* context) const
     OT::App().DB().Store(context->contract(lock));
 }
 
+void Wallet::forget_nym(const std::string& id)
+{
+    // Don't remember the failure, so that the nym will be loaded again if it
+    // shows up later. Another thread may have stored a good nym meanwhile.
+    std::lock_guard<std::mutex> mapLock(nym_map_lock_);
+    auto it = nym_map_.find(id);
+
+    if (nym_map_.end() == it) { return; }
+
+    const bool ready = (std::future_status::ready ==
+                        it->second.wait_for(std::chrono::seconds(0)));
+
+    if (ready && !it->second.get()) { nym_map_.erase(it); }
+}
+
+std::shared_ptr<class Nym> Wallet::load_nym(
+    const Identifier& id,
+    bool& loaded)
+{
+    std::shared_ptr<proto::CredentialIndex> serialized;
+    std::string alias;
+    loaded = OT::App().DB().Load(String(id).Get(), serialized, alias, true);
+
+    if (!loaded) { return nullptr; }
+
+    std::shared_ptr<class Nym> output(new class Nym(id));
+
+    if (!output) { return nullptr; }
+
+    if (!output->LoadCredentialIndex(*serialized)) { return nullptr; }
+
+    if (!verify_nym(String(id).Get(), *serialized, *output)) {
+
+        return nullptr;
+    }
+
+    output->alias_ = alias;
+
+    return output;
+}
+
 std::unique_ptr<Message> Wallet::Mail(
     const Identifier& nym,
     const Identifier& id,
@@ -398,57 +439,78 @@ ConstNym Wallet::Nym(
 {
     const std::string nym = String(id).Get();
     std::unique_lock<std::mutex> mapLock(nym_map_lock_);
-    bool inMap = (nym_map_.find(nym) != nym_map_.end());
-    bool valid = false;
+    auto it = nym_map_.find(nym);
 
-    if (!inMap) {
-        std::shared_ptr<proto::CredentialIndex> serialized;
+    if (nym_map_.end() != it) {
+        // Another thread may still be loading this nym
+        NymFuture future = it->second;
+        mapLock.unlock();
+        const auto& pNym = future.get();
 
-        std::string alias;
-        bool loaded = OT::App().DB().Load(nym, serialized, alias, true);
+        if (!pNym) { return nullptr; }
 
-        if (loaded) {
-            auto& pNym = nym_map_[nym].second;
-            pNym.reset(new class Nym(id));
+        // The nym was verified when it was added to the map. Only check it
+        // again if it has changed since, and then remember the new revision.
+        mapLock.lock();
+        const auto verified = verified_nyms_.find(nym);
+        const bool current = (verified_nyms_.end() != verified) &&
+                             (verified->second.second == pNym->Revision());
+        mapLock.unlock();
 
-            if (pNym) {
-                if (pNym->LoadCredentialIndex(*serialized)) {
-                    valid = pNym->VerifyPseudonym();
-                    pNym->alias_ = alias;
-                }
-            }
-        } else {
-            OT::App().DHT().GetPublicNym(nym);
+        if (current || verify_nym(nym, pNym->asPublicNym(), *pNym)) {
 
-            if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
+            return pNym;
+        }
 
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found = (nym_map_.find(nym) != nym_map_.end());
-                    mapLock.unlock();
+        return nullptr;
+    }
 
-                    if (found) {
-                        break;
-                    }
-                }
+    std::promise<std::shared_ptr<class Nym>> promise;
+    nym_map_[nym] = promise.get_future().share();
+    mapLock.unlock();
+
+    // Loading and verifying happens without holding the map lock, so lookups
+    // of other nyms are not delayed by it. The promise must be satisfied on
+    // every path, or everyone waiting on it would wait forever.
+    bool loaded = false;
+    std::shared_ptr<class Nym> output;
+
+    try {
+        output = load_nym(id, loaded);
+    } catch (...) {
+        promise.set_value(nullptr);
+        forget_nym(nym);
+
+        throw;
+    }
+
+    promise.set_value(output);
+
+    if (output) { return output; }
+
+    forget_nym(nym);
+
+    if (loaded) { return nullptr; }
+
+    OT::App().DHT().GetPublicNym(nym);
+
+    if (timeout > std::chrono::milliseconds(0)) {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto end = start + timeout;
+        const auto interval = std::chrono::milliseconds(100);
+
+        while (std::chrono::high_resolution_clock::now() < end) {
+            std::this_thread::sleep_for(interval);
+            mapLock.lock();
+            bool found = (nym_map_.find(nym) != nym_map_.end());
+            mapLock.unlock();
 
-                return Nym(id);  // timeout of zero prevents infinite recursion
+            if (found) {
+                break;
             }
         }
-    } else {
-        auto& pNym = nym_map_[nym].second;
-        if (pNym) {
-            valid = pNym->VerifyPseudonym();
-        }
-    }
 
-    if (valid) {
-        return nym_map_[nym].second;
+        return Nym(id);  // timeout of zero prevents infinite recursion
     }
 
     return nullptr;
@@ -458,6 +520,7 @@ ConstNym Wallet::Nym(const proto::CredentialIndex& publicNym)
 {
     const auto& id = publicNym.nymid();
     Identifier nym(id);
+    std::string alias;
 
     auto existing = Nym(Identifier(nym));
 
@@ -466,19 +529,27 @@ ConstNym Wallet::Nym(const proto::CredentialIndex& publicNym)
 
             return existing;
         }
+
+        alias = existing->alias_;
     }
     existing.reset();
 
-    std::unique_ptr<class Nym> candidate(new class Nym(nym));
+    std::shared_ptr<class Nym> candidate(new class Nym(nym));
 
     if (candidate) {
-        candidate->LoadCredentialIndex(publicNym);
-
-        if (candidate->VerifyPseudonym()) {
+        if (candidate->LoadCredentialIndex(publicNym) &&
+            verify_nym(id, publicNym, *candidate)) {
             candidate->WriteCredentials();
+            candidate->alias_ = alias;
+            // The candidate has just been verified, so it replaces the cached
+            // nym as it is instead of being loaded and verified again.
+            std::promise<std::shared_ptr<class Nym>> promise;
+            promise.set_value(candidate);
             std::unique_lock<std::mutex> mapLock(nym_map_lock_);
-            nym_map_.erase(id);
+            nym_map_[id] = promise.get_future().share();
             mapLock.unlock();
+
+            return candidate;
         }
     }
 
@@ -1412,4 +1483,30 @@ ConstUnitDefinition Wallet::UnitDefinition(
     return UnitDefinition(Identifier(unit));
 }
 
+bool Wallet::verify_nym(
+    const std::string& id,
+    const proto::CredentialIndex& serialized,
+    const class Nym& nym)
+{
+    Identifier hash;
+    hash.CalculateDigest(proto::ProtoAsData(serialized));
+    const NymVersion version{String(hash).Get(), nym.Revision()};
+    std::unique_lock<std::mutex> mapLock(nym_map_lock_);
+    const auto it = verified_nyms_.find(id);
+
+    // These exact credentials have already been verified
+    if ((verified_nyms_.end() != it) && (version == it->second)) {
+
+        return true;
+    }
+
+    mapLock.unlock();
+
+    if (!nym.VerifyPseudonym()) { return false; }
+
+    mapLock.lock();
+    verified_nyms_[id] = version;
+
+    return true;
+}
 }  // namespace opentxs
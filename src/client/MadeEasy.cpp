@@ -51,11 +51,37 @@
 
 namespace opentxs
 {
-MadeEasy::MadeEasy(std::recursive_mutex& lock)
+MadeEasy::MadeEasy(RecursiveMutex& lock)
     : lock_(lock)
 {
 }
 
+std::recursive_mutex& MadeEasy::context_lock(
+    const std::string& notaryID,
+    const std::string& nymID) const
+{
+    std::lock_guard<std::mutex> lock(context_map_lock_);
+
+    return context_locks_[ContextID(notaryID, nymID)];
+}
+
+std::unique_lock<std::recursive_mutex> MadeEasy::lock_context(
+    const std::string& notaryID,
+    const std::string& nymID) const
+{
+    auto& contextLock = context_lock(notaryID, nymID);
+    std::unique_lock<std::recursive_mutex> output(
+        contextLock, std::try_to_lock);
+
+    if (!output.owns_lock()) {
+        const auto depth = lock_.Release();
+        output.lock();
+        lock_.Reacquire(depth);
+    }
+
+    return output;
+}
+
 // RETRIEVE NYM INTERMEDIARY FILES
 // Returns:
 //  True if I have enough numbers, or if there was success getting more
@@ -69,8 +95,9 @@ std::int32_t MadeEasy::retrieve_nym(
     bool& bWasMsgSent,
     bool bForceDownload) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
-
+    // Only the context is locked across the sequence, so that refreshes of
+    // different servers can interleave. See lock_context.
+    const auto contextLock = lock_context(strNotaryID, strMyNymID);
     Utility MsgUtil;
 
     if (1 != MsgUtil.getRequestNumber(strNotaryID, strMyNymID)) {
@@ -94,7 +121,7 @@ std::string MadeEasy::ping_notary(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -110,7 +137,8 @@ std::string MadeEasy::check_nym(
     const std::string& NYM_ID,
     const std::string& TARGET_NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    // See retrieve_nym regarding locking.
+    const auto contextLock = lock_context(NOTARY_ID, NYM_ID);
 
     OTAPI_Func ot_Msg;
 
@@ -126,7 +154,7 @@ std::string MadeEasy::issue_asset_type(
     const std::string& NYM_ID,
     const std::string& THE_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -143,7 +171,7 @@ std::string MadeEasy::issue_basket_currency(
     const std::string& NYM_ID,
     const std::string& THE_BASKET) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -163,7 +191,7 @@ std::string MadeEasy::exchange_basket_currency(
     const std::string& ACCT_ID,
     bool IN_OR_OUT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -191,7 +219,7 @@ std::string MadeEasy::retrieve_contract(
     const std::string& NYM_ID,
     const std::string& CONTRACT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -208,7 +236,7 @@ std::string MadeEasy::load_or_retrieve_contract(
     const std::string& NYM_ID,
     const std::string& CONTRACT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -232,7 +260,7 @@ std::string MadeEasy::create_asset_acct(
     const std::string& NYM_ID,
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -250,7 +278,7 @@ std::string MadeEasy::unregister_account(
     const std::string& NYM_ID,
     const std::string& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -266,7 +294,7 @@ std::string MadeEasy::unregister_nym(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -278,7 +306,7 @@ std::string MadeEasy::unregister_nym(
 
 std::string MadeEasy::stat_asset_account(const std::string& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string strNymID = OTAPI_Wrap::GetAccountWallet_NymID(ACCOUNT_ID);
     if (!VerifyStringVal(strNymID)) {
@@ -321,8 +349,8 @@ bool MadeEasy::retrieve_account(
     const std::string& ACCOUNT_ID,
     bool bForceDownload) const  // bForceDownload=false
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
-
+    // See retrieve_nym regarding locking.
+    const auto contextLock = lock_context(NOTARY_ID, NYM_ID);
     Utility MsgUtil;
 
     bool bResponse = MsgUtil.getIntermediaryFiles(
@@ -340,7 +368,7 @@ std::string MadeEasy::send_transfer(
     std::int64_t AMOUNT,
     const std::string& NOTE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -359,7 +387,7 @@ std::string MadeEasy::process_inbox(
     const std::string& ACCOUNT_ID,
     const std::string& RESPONSE_LEDGER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -381,7 +409,7 @@ std::string MadeEasy::process_inbox(
 std::string MadeEasy::load_public_encryption_key(
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -411,7 +439,7 @@ std::string MadeEasy::load_public_encryption_key(
 // Load a public key from local storage, and return it (or null).
 std::string MadeEasy::load_public_signing_key(const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -436,7 +464,7 @@ std::string MadeEasy::load_or_retrieve_encrypt_key(
     const std::string& NYM_ID,
     const std::string& TARGET_NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -460,7 +488,7 @@ std::string MadeEasy::send_user_msg_pubkey(
     const std::string& RECIPIENT_PUBKEY,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -485,7 +513,7 @@ std::string MadeEasy::send_user_pmnt_pubkey(
     const std::string& RECIPIENT_PUBKEY,
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -511,7 +539,7 @@ std::string MadeEasy::send_user_cash_pubkey(
     const std::string& THE_INSTRUMENT,
     const std::string& INSTRUMENT_FOR_SENDER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -537,7 +565,7 @@ std::string MadeEasy::send_user_msg(
     const std::string& RECIPIENT_NYM_ID,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -563,7 +591,7 @@ std::string MadeEasy::retrieve_mint(
     const std::string& NYM_ID,
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -590,7 +618,7 @@ std::string MadeEasy::load_or_retrieve_mint(
     const std::string& NYM_ID,
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string response = check_nym(NOTARY_ID, NYM_ID, NYM_ID);
     if (1 != VerifyMessageSuccess(response)) {
@@ -662,7 +690,7 @@ std::string MadeEasy::deposit_payment_plan(
     const std::string& NYM_ID,
     const std::string& THE_PAYMENT_PLAN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -699,7 +727,7 @@ bool MadeEasy::importCashPurse(
     std::string& userInput,
     bool isPurse) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     //  otOut << "OT_ME_importCashPurse, notaryID:" << notaryID << "
     // nymID:" << nymID << " instrumentDefinitionID:" <<
@@ -809,7 +837,7 @@ bool MadeEasy::processCashPurse(
     bool bPWProtectOldPurse,
     bool bPWProtectNewPurse) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     // By this point, we know that "selected tokens" has a size of 0, or MORE
     // THAN ONE. (But NOT 1 exactly.)
@@ -1322,7 +1350,7 @@ std::string MadeEasy::exportCashPurse(
     bool bPasswordProtected,
     std::string& strRetainedCopy) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     //  otOut << "OT_ME_exportCashPurse starts, selectedTokens:" <<
     // selectedTokens << "\n";
@@ -1402,7 +1430,7 @@ std::int32_t MadeEasy::depositCashPurse(
                               // internal to begin with.
     std::string* pOptionalOutput /*=nullptr*/) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string recipientNymID = OTAPI_Wrap::GetAccountWallet_NymID(accountID);
     if (!VerifyStringVal(recipientNymID)) {
@@ -1519,7 +1547,7 @@ bool MadeEasy::exchangeCashPurse(
     std::string& oldPurse,
     const std::vector<std::string>& selectedTokens) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     //  Utility.setObj(null);
     //  otOut << " Cash Purse exchange starts, selectedTokens:" +
@@ -1580,7 +1608,7 @@ std::string MadeEasy::deposit_purse(
     const std::string& ACCT_ID,
     const std::string& STR_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func ot_Msg;
 
@@ -120,7 +120,7 @@ OTAPI_Exec::OTAPI_Exec(
     Wallet& wallet,
     ZMQ& zeromq,
     OT_API& otapi,
-    std::recursive_mutex& lock)
+    RecursiveMutex& lock)
     : config_(config)
     , crypto_(crypto)
     , identity_(identity)
@@ -163,7 +163,7 @@ std::string OTAPI_Exec::UlongToString(const uint64_t& lNumber) const
 
 bool OTAPI_Exec::CheckSetConfigSection(const std::string& strSection, const std::string& strComment)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     bool b_isNewSection = false;
 
@@ -184,7 +184,7 @@ bool OTAPI_Exec::CheckSetConfigSection(const std::string& strSection, const std:
 bool OTAPI_Exec::SetConfig_str(const std::string& strSection, const std::string& strKey,
                                const std::string& strValue)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     bool b_isNew = false;
 
@@ -206,7 +206,7 @@ bool OTAPI_Exec::SetConfig_str(const std::string& strSection, const std::string&
 bool OTAPI_Exec::SetConfig_long(const std::string& strSection, const std::string& strKey,
                                 const int64_t& lValue)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     bool b_isNew = false;
 
@@ -229,7 +229,7 @@ bool OTAPI_Exec::SetConfig_long(const std::string& strSection, const std::string
 bool OTAPI_Exec::SetConfig_bool(const std::string& strSection, const std::string& strKey,
                                 const bool bValue)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     bool b_isNew = false;
 
@@ -251,7 +251,7 @@ bool OTAPI_Exec::SetConfig_bool(const std::string& strSection, const std::string
 
 std::string OTAPI_Exec::GetConfig_str(const std::string& strSection, const std::string& strKey) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String strOutput;
     bool bKeyExists = false;
@@ -270,7 +270,7 @@ std::string OTAPI_Exec::GetConfig_str(const std::string& strSection, const std::
 
 int64_t OTAPI_Exec::GetConfig_long(const std::string& strSection, const std::string& strKey) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     int64_t lOutput = 0;
     bool bKeyExists = false;
@@ -287,7 +287,7 @@ int64_t OTAPI_Exec::GetConfig_long(const std::string& strSection, const std::str
 
 bool OTAPI_Exec::GetConfig_bool(const std::string& strSection, const std::string& strKey) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     bool bOutput = false;
     bool bKeyExists = false;
@@ -310,7 +310,7 @@ Log level is 0 (least verbose) to 5 (most verbose.)
 void OTAPI_Exec::Output(const int32_t& nLogLevel, const std::string& strOutput)
     const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const String otstrOutput(!strOutput.empty() ? strOutput : "\n");
 
@@ -319,7 +319,7 @@ void OTAPI_Exec::Output(const int32_t& nLogLevel, const std::string& strOutput)
 
 bool OTAPI_Exec::SetWallet(const std::string& strWalletFilename) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
     String sWalletFilename(strWalletFilename);
 
     if (sWalletFilename.Exists()) {
@@ -347,40 +347,40 @@ bool OTAPI_Exec::LoadWallet() const { return ot_api_.LoadWallet(); }
 bool OTAPI_Exec::SwitchWallet() const { return ot_api_.LoadWallet(); }
 
 int32_t OTAPI_Exec::GetMemlogSize() const {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return Log::GetMemlogSize();
 }
 
 std::string OTAPI_Exec::GetMemlogAtIndex(const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return Log::GetMemlogAtIndex(nIndex).Get();
 }
 
 std::string OTAPI_Exec::PeekMemlogFront() const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return Log::PeekMemlogFront().Get();
 }
 
 std::string OTAPI_Exec::PeekMemlogBack() const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return Log::PeekMemlogBack().Get();
 }
 
 bool OTAPI_Exec::PopMemlogFront() const {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return Log::PopMemlogFront();
 }
 
 bool OTAPI_Exec::PopMemlogBack() const {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return Log::PopMemlogBack();
 }
@@ -553,7 +553,7 @@ std::string OTAPI_Exec::CreateNymLegacy(
     __attribute__((unused))
     const std::string& NYM_ID_SOURCE) const  // Can be empty.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (0 >= nKeySize) {
         otErr << __FUNCTION__
@@ -667,7 +667,7 @@ std::string OTAPI_Exec::GetNym_ActiveCronItemIDs(
     const std::string& NYM_ID,
     const std::string& NOTARY_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -694,7 +694,7 @@ std::string OTAPI_Exec::GetActiveCronItem(
     const std::string& NOTARY_ID,
     int64_t lTransNum) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NOTARY_ID passed in!\n";
@@ -720,7 +720,7 @@ std::string OTAPI_Exec::GetActiveCronItem(
 
 std::string OTAPI_Exec::GetNym_SourceForID(const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -739,7 +739,7 @@ std::string OTAPI_Exec::GetNym_SourceForID(const std::string& NYM_ID) const
 
 std::string OTAPI_Exec::GetNym_Description(const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -759,7 +759,7 @@ std::string OTAPI_Exec::GetNym_Description(const std::string& NYM_ID) const
 int32_t OTAPI_Exec::GetNym_MasterCredentialCount(
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -781,7 +781,7 @@ std::string OTAPI_Exec::GetNym_MasterCredentialID(
     const std::string& NYM_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -806,7 +806,7 @@ std::string OTAPI_Exec::GetNym_MasterCredentialContents(
     const std::string& NYM_ID,
     const std::string& CREDENTIAL_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -831,7 +831,7 @@ std::string OTAPI_Exec::GetNym_MasterCredentialContents(
 
 int32_t OTAPI_Exec::GetNym_RevokedCredCount(const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -853,7 +853,7 @@ std::string OTAPI_Exec::GetNym_RevokedCredID(
     const std::string& NYM_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -880,7 +880,7 @@ std::string OTAPI_Exec::GetNym_RevokedCredContents(
     const std::string& NYM_ID,
     const std::string& CREDENTIAL_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -909,7 +909,7 @@ int32_t OTAPI_Exec::GetNym_ChildCredentialCount(
     const std::string& NYM_ID,
     const std::string& MASTER_CRED_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -935,7 +935,7 @@ std::string OTAPI_Exec::GetNym_ChildCredentialID(
     const std::string& MASTER_CRED_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -961,7 +961,7 @@ std::string OTAPI_Exec::GetNym_ChildCredentialContents(
     const std::string& MASTER_CRED_ID,
     const std::string& SUB_CRED_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -998,7 +998,7 @@ bool OTAPI_Exec::RevokeChildCredential(
     const std::string& MASTER_CRED_ID,
     const std::string& SUB_CRED_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -1119,7 +1119,7 @@ bool OTAPI_Exec::SetContactData_Base64(
     const std::string& NYM_ID,
     const std::string& THE_DATA) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_DATA.empty())
     {
@@ -1138,7 +1138,7 @@ bool OTAPI_Exec::SetContactData(
     const std::string& NYM_ID,
     const std::string& THE_DATA) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": nullptr NYM_ID passed in!\n";
@@ -1171,7 +1171,7 @@ bool OTAPI_Exec::SetClaim_Base64(
     const std::uint32_t& section,
     const std::string& claim) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (claim.empty())
     {
@@ -1189,7 +1189,7 @@ bool OTAPI_Exec::SetClaim(
     const std::uint32_t& section,
     const std::string& claim) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (nymID.empty()) {
         otErr << __FUNCTION__ << ": nullptr nymID passed in!\n";
@@ -1224,7 +1224,7 @@ bool OTAPI_Exec::DeleteClaim(
     const std::string& nymID,
     const std::string& claimID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (nymID.empty()) {
         otErr << __FUNCTION__ << ": nullptr nymID passed in!\n";
@@ -1242,7 +1242,7 @@ bool OTAPI_Exec::DeleteClaim(
 /// base64-encoded data.
 std::string OTAPI_Exec::GetVerificationSet_Base64(const std::string& nymID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string str_result = GetVerificationSet(nymID);
 
@@ -1279,7 +1279,7 @@ std::string OTAPI_Exec::SetVerification_Base64(
     const int64_t start,
     const int64_t end) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string str_result = SetVerification(changed, onNym, claimantNymID,
                                              claimID, polarity, start, end);
@@ -1298,7 +1298,7 @@ std::string OTAPI_Exec::SetVerification(
     const int64_t start,
     const int64_t end) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (onNym.empty()) {
         otErr << __FUNCTION__ << ": empty onNym passed in!\n";
@@ -1624,7 +1624,7 @@ std::string OTAPI_Exec::FormatAmountWithoutSymbol(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const int64_t& THE_AMOUNT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const std::string str_thousand(OT_THOUSANDS_SEP);
     const std::string str_decimal(OT_DECIMAL_POINT);
@@ -1741,7 +1741,7 @@ int32_t OTAPI_Exec::GetAccountCount(void) const
 //
 bool OTAPI_Exec::Wallet_CanRemoveServer(const std::string& NOTARY_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -1797,7 +1797,7 @@ bool OTAPI_Exec::Wallet_CanRemoveServer(const std::string& NOTARY_ID) const
 //
 bool OTAPI_Exec::Wallet_RemoveServer(const std::string& NOTARY_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -1842,7 +1842,7 @@ bool OTAPI_Exec::Wallet_RemoveServer(const std::string& NOTARY_ID) const
 bool OTAPI_Exec::Wallet_CanRemoveAssetType(
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (INSTRUMENT_DEFINITION_ID.empty()) {
         otErr << __FUNCTION__
@@ -1883,7 +1883,7 @@ bool OTAPI_Exec::Wallet_CanRemoveAssetType(
 bool OTAPI_Exec::Wallet_RemoveAssetType(
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (INSTRUMENT_DEFINITION_ID.empty()) {
         otErr << __FUNCTION__
@@ -1920,7 +1920,7 @@ bool OTAPI_Exec::Wallet_CanRemoveNym(const std::string& NYM_ID) const
 //
 bool OTAPI_Exec::Wallet_RemoveNym(const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -1976,7 +1976,7 @@ bool OTAPI_Exec::Wallet_RemoveNym(const std::string& NYM_ID) const
 //
 bool OTAPI_Exec::Wallet_CanRemoveAccount(const std::string& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (ACCOUNT_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: ACCOUNT_ID passed in!\n";
@@ -2037,7 +2037,7 @@ bool OTAPI_Exec::DoesBoxReceiptExist(
     const int32_t& nBoxType,        // 0/nymbox, 1/inbox, 2/outbox
     const int64_t& TRANSACTION_NUMBER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -2084,6 +2084,54 @@ bool OTAPI_Exec::DoesBoxReceiptExist(
         static_cast<int64_t>(lTransactionNum));
 }
 
+// Returns int32_t, same as getBoxReceipt.
+//
+int32_t OTAPI_Exec::getBoxReceipts(
+    const std::string& NOTARY_ID,
+    const std::string& NYM_ID,
+    const std::string& ACCOUNT_ID,  // If for Nymbox (vs inbox/outbox) then pass
+                                    // NYM_ID in this field also.
+    const int32_t& nBoxType,        // 0/nymbox, 1/inbox, 2/outbox
+    const std::string& TRANSACTION_NUMBERS) const
+{
+    std::lock_guard<RecursiveMutex> lock(lock_);
+
+    if (NOTARY_ID.empty()) {
+        otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
+        return OT_ERROR;
+    }
+    if (NYM_ID.empty()) {
+        otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
+        return OT_ERROR;
+    }
+    if (ACCOUNT_ID.empty()) {
+        otErr << __FUNCTION__ << ": Null: ACCOUNT_ID passed in!\n";
+        return OT_ERROR;
+    }
+    if (!((0 == nBoxType) || (1 == nBoxType) || (2 == nBoxType))) {
+        otErr << __FUNCTION__
+              << ": nBoxType is of wrong type: value: " << nBoxType << "\n";
+        return OT_ERROR;
+    }
+    if (TRANSACTION_NUMBERS.empty()) {
+        otErr << __FUNCTION__ << ": Null: TRANSACTION_NUMBERS passed in!\n";
+        return OT_ERROR;
+    }
+
+    const Identifier theNotaryID(NOTARY_ID), theNymID(NYM_ID),
+        theAccountID(ACCOUNT_ID);
+    NumList theNumList;
+
+    if (!theNumList.Add(TRANSACTION_NUMBERS)) {
+        otErr << __FUNCTION__ << ": Bad TRANSACTION_NUMBERS passed in: "
+              << TRANSACTION_NUMBERS << "\n";
+        return OT_ERROR;
+    }
+
+    return ot_api_.getBoxReceipts(
+        theNotaryID, theNymID, theAccountID, nBoxType, theNumList);
+}
+
 // Returns int32_t:
 // -1 means error; no message was sent.
 //  0 means NO error, but also: no message was sent.
@@ -2100,7 +2148,7 @@ int32_t OTAPI_Exec::getBoxReceipt(
     const int32_t& nBoxType,        // 0/nymbox, 1/inbox, 2/outbox
     const int64_t& TRANSACTION_NUMBER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -2161,7 +2209,7 @@ int32_t OTAPI_Exec::deleteAssetAccount(
     const std::string& NYM_ID,
     const std::string& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -2191,7 +2239,7 @@ int32_t OTAPI_Exec::deleteAssetAccount(
 //
 std::string OTAPI_Exec::Wallet_ExportNym(const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -2234,7 +2282,7 @@ std::string OTAPI_Exec::Wallet_ExportNym(const std::string& NYM_ID) const
 //
 std::string OTAPI_Exec::Wallet_ImportNym(const std::string& FILE_CONTENTS) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (FILE_CONTENTS.empty()) {
         otErr << __FUNCTION__ << ": Null: FILE_CONTENTS passed in!\n";
@@ -2323,7 +2371,7 @@ bool OTAPI_Exec::Wallet_ChangePassphrase() const
 std::string OTAPI_Exec::Wallet_GetNymIDFromPartial(
     const std::string& PARTIAL_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (PARTIAL_ID.empty()) {
         otErr << __FUNCTION__ << ": Empty PARTIAL_ID passed in!\n";
@@ -2377,7 +2425,7 @@ std::string OTAPI_Exec::Wallet_GetNymIDFromPartial(
 std::string OTAPI_Exec::Wallet_GetNotaryIDFromPartial(
     const std::string& PARTIAL_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (PARTIAL_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: PARTIAL_ID passed in!\n";
@@ -2414,7 +2462,7 @@ std::string OTAPI_Exec::Wallet_GetNotaryIDFromPartial(
 std::string OTAPI_Exec::Wallet_GetInstrumentDefinitionIDFromPartial(
     const std::string& PARTIAL_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (PARTIAL_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: PARTIAL_ID passed in!\n";
@@ -2475,7 +2523,7 @@ std::string OTAPI_Exec::Wallet_GetInstrumentDefinitionIDFromPartial(
 std::string OTAPI_Exec::Wallet_GetAccountIDFromPartial(
     const std::string& PARTIAL_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (PARTIAL_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: PARTIAL_ID passed in!\n";
@@ -2518,7 +2566,7 @@ std::string OTAPI_Exec::Wallet_GetAccountIDFromPartial(
 /// based on Index this returns the Nym's ID
 std::string OTAPI_Exec::GetNym_ID(const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (0 > nIndex) {
         otErr << __FUNCTION__
@@ -2556,7 +2604,7 @@ bool OTAPI_Exec::IsNym_RegisteredAtServer(
     const std::string& NYM_ID,
     const std::string& NOTARY_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -2578,7 +2626,7 @@ bool OTAPI_Exec::IsNym_RegisteredAtServer(
 //
 std::string OTAPI_Exec::GetNym_Stats(const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -2607,7 +2655,7 @@ std::string OTAPI_Exec::GetNym_NymboxHash(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const  // Returns NymboxHash (based on NotaryID)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -2670,7 +2718,7 @@ std::string OTAPI_Exec::GetNym_InboxHash(
                                       // DOWNLOADED" Inbox
                                       // (by AccountID)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (ACCOUNT_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: ACOUNT_ID passed in!\n";
@@ -2723,7 +2771,7 @@ std::string OTAPI_Exec::GetNym_OutboxHash(
                                       // DOWNLOADED"
                                       // Outbox (by AccountID)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (ACCOUNT_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: ACCOUNT_ID passed in!\n";
@@ -2936,7 +2984,7 @@ bool OTAPI_Exec::Nym_VerifyOutmailByIndex(
 
 int32_t OTAPI_Exec::GetNym_OutpaymentsCount(const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -2954,7 +3002,7 @@ std::string OTAPI_Exec::GetNym_OutpaymentsContentsByIndex(
     const std::string& NYM_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -2997,7 +3045,7 @@ std::string OTAPI_Exec::GetNym_OutpaymentsRecipientIDByIndex(
     const std::string& NYM_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -3030,7 +3078,7 @@ std::string OTAPI_Exec::GetNym_OutpaymentsNotaryIDByIndex(
     const std::string& NYM_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -3068,7 +3116,7 @@ bool OTAPI_Exec::Nym_RemoveOutpaymentsByIndex(
     const std::string& NYM_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -3120,7 +3168,7 @@ bool OTAPI_Exec::Nym_VerifyOutpaymentsByIndex(
     const std::string& NYM_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -3168,7 +3216,7 @@ bool OTAPI_Exec::Nym_VerifyOutpaymentsByIndex(
 
 int64_t OTAPI_Exec::Instrmnt_GetAmount(const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3200,7 +3248,7 @@ int64_t OTAPI_Exec::Instrmnt_GetAmount(const std::string& THE_INSTRUMENT) const
 int64_t OTAPI_Exec::Instrmnt_GetTransNum(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3234,7 +3282,7 @@ int64_t OTAPI_Exec::Instrmnt_GetTransNum(
 time64_t OTAPI_Exec::Instrmnt_GetValidFrom(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3270,7 +3318,7 @@ time64_t OTAPI_Exec::Instrmnt_GetValidFrom(
 time64_t OTAPI_Exec::Instrmnt_GetValidTo(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3306,7 +3354,7 @@ time64_t OTAPI_Exec::Instrmnt_GetValidTo(
 std::string OTAPI_Exec::Instrmnt_GetType(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3345,7 +3393,7 @@ std::string OTAPI_Exec::Instrmnt_GetType(
 std::string OTAPI_Exec::Instrmnt_GetMemo(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3385,7 +3433,7 @@ std::string OTAPI_Exec::Instrmnt_GetMemo(
 std::string OTAPI_Exec::Instrmnt_GetNotaryID(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3426,7 +3474,7 @@ std::string OTAPI_Exec::Instrmnt_GetNotaryID(
 std::string OTAPI_Exec::Instrmnt_GetInstrumentDefinitionID(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3468,7 +3516,7 @@ std::string OTAPI_Exec::Instrmnt_GetInstrumentDefinitionID(
 std::string OTAPI_Exec::Instrmnt_GetRemitterNymID(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3509,7 +3557,7 @@ std::string OTAPI_Exec::Instrmnt_GetRemitterNymID(
 std::string OTAPI_Exec::Instrmnt_GetRemitterAcctID(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3551,7 +3599,7 @@ std::string OTAPI_Exec::Instrmnt_GetRemitterAcctID(
 std::string OTAPI_Exec::Instrmnt_GetSenderNymID(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3592,7 +3640,7 @@ std::string OTAPI_Exec::Instrmnt_GetSenderNymID(
 std::string OTAPI_Exec::Instrmnt_GetSenderAcctID(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3633,7 +3681,7 @@ std::string OTAPI_Exec::Instrmnt_GetSenderAcctID(
 std::string OTAPI_Exec::Instrmnt_GetRecipientNymID(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3675,7 +3723,7 @@ std::string OTAPI_Exec::Instrmnt_GetRecipientNymID(
 std::string OTAPI_Exec::Instrmnt_GetRecipientAcctID(
     const std::string& THE_INSTRUMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_INSTRUMENT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_INSTRUMENT passed in!\n";
@@ -3785,7 +3833,7 @@ bool OTAPI_Exec::SetServer_Name(
     const std::string& NOTARY_ID,
     const std::string& STR_NEW_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null NOTARY_ID passed in!\n";
@@ -3865,7 +3913,7 @@ int32_t OTAPI_Exec::GetNym_TransactionNumCount(
 // based on Index (above 4 functions) this returns the Server's ID
 std::string OTAPI_Exec::GetServer_ID(const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (0 > nIndex) {
         otErr << __FUNCTION__
@@ -3898,7 +3946,7 @@ std::string OTAPI_Exec::GetServer_Name(const std::string& THE_ID) const
 // returns Instrument Definition ID (based on index from GetAssetTypeCount)
 std::string OTAPI_Exec::GetAssetType_ID(const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (0 > nIndex) {
         otErr << __FUNCTION__
@@ -3941,7 +3989,7 @@ std::string OTAPI_Exec::GetAssetType_TLA(const std::string& THE_ID) const
 // returns a string containing the account ID, based on index.
 std::string OTAPI_Exec::GetAccountWallet_ID(const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (0 > nIndex) {
         otErr << __FUNCTION__
@@ -3967,7 +4015,7 @@ std::string OTAPI_Exec::GetAccountWallet_ID(const int32_t& nIndex) const
 // returns the account name, based on account ID.
 std::string OTAPI_Exec::GetAccountWallet_Name(const std::string& THE_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_ID passed in!\n";
@@ -3992,7 +4040,7 @@ std::string OTAPI_Exec::GetAccountWallet_InboxHash(
 // account file. (Usually more recent than:
 // OTAPI_Exec::GetNym_InboxHash)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (ACCOUNT_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: ACCOUNT_ID passed in!\n";
@@ -4022,7 +4070,7 @@ std::string OTAPI_Exec::GetAccountWallet_OutboxHash(
 // account file. (Usually more recent than:
 // OTAPI_Exec::GetNym_OutboxHash)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (ACCOUNT_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: ACCOUNT_ID passed in!\n";
@@ -4517,7 +4565,7 @@ bool OTAPI_Exec::VerifyAccountReceipt(
     const std::string& NYM_ID,
     const std::string& ACCT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -4548,7 +4596,7 @@ bool OTAPI_Exec::SetAccountWallet_Name(
     const std::string& SIGNER_NYM_ID,
     const std::string& ACCT_NEW_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (ACCT_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: ACCT_ID passed in!\n";
@@ -4572,7 +4620,7 @@ bool OTAPI_Exec::SetAccountWallet_Name(
 // returns the account balance, based on account ID.
 int64_t OTAPI_Exec::GetAccountWallet_Balance(const std::string& THE_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_ID passed in!\n";
@@ -4587,7 +4635,7 @@ int64_t OTAPI_Exec::GetAccountWallet_Balance(const std::string& THE_ID) const
 // returns an account's "account type", (simple, issuer, etc.)
 std::string OTAPI_Exec::GetAccountWallet_Type(const std::string& THE_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_ID passed in!\n";
@@ -4607,7 +4655,7 @@ std::string OTAPI_Exec::GetAccountWallet_Type(const std::string& THE_ID) const
 std::string OTAPI_Exec::GetAccountWallet_InstrumentDefinitionID(
     const std::string& THE_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_ID passed in!\n";
@@ -4634,7 +4682,7 @@ std::string OTAPI_Exec::GetAccountWallet_InstrumentDefinitionID(
 std::string OTAPI_Exec::GetAccountWallet_NotaryID(
     const std::string& THE_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_ID passed in!\n";
@@ -4656,7 +4704,7 @@ std::string OTAPI_Exec::GetAccountWallet_NotaryID(
 // (Which is a hash of the Nym's public key for the owner of this account.)
 std::string OTAPI_Exec::GetAccountWallet_NymID(const std::string& THE_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_ID passed in!\n";
@@ -4865,7 +4913,7 @@ std::string OTAPI_Exec::ProposePaymentPlan(
                                               // maximum payments.)
     ) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -5009,7 +5057,7 @@ std::string OTAPI_Exec::EasyProposePlan(
     // unlimited.
     ) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -5153,7 +5201,7 @@ std::string OTAPI_Exec::ConfirmPaymentPlan(
     const std::string& RECIPIENT_NYM_ID,
     const std::string& PAYMENT_PLAN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -5223,7 +5271,7 @@ std::string OTAPI_Exec::Create_SmartContract(
                                // party.
     ) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (SIGNER_NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: SIGNER_NYM_ID passed in!\n";
@@ -5260,7 +5308,7 @@ std::string OTAPI_Exec::Create_SmartContract(
 bool OTAPI_Exec::Smart_ArePartiesSpecified(
     const std::string& THE_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5274,7 +5322,7 @@ bool OTAPI_Exec::Smart_ArePartiesSpecified(
 bool OTAPI_Exec::Smart_AreAssetTypesSpecified(
     const std::string& THE_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5298,7 +5346,7 @@ std::string OTAPI_Exec::SmartContract_SetDates(
                                        // cancel
                                        // anytime.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5353,7 +5401,7 @@ std::string OTAPI_Exec::SmartContract_AddBylaw(
                                           // the
 // smart contract. (And the scripts...)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5396,7 +5444,7 @@ std::string OTAPI_Exec::SmartContract_RemoveBylaw(
                                           // the
 // smart contract. (And the scripts...)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5442,7 +5490,7 @@ std::string OTAPI_Exec::SmartContract_AddClause(
     const std::string& SOURCE_CODE) const  // The actual source code for the
                                            // clause.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5498,7 +5546,7 @@ std::string OTAPI_Exec::SmartContract_UpdateClause(
     const std::string& SOURCE_CODE) const  // The actual source code for the
                                            // clause.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5555,7 +5603,7 @@ std::string OTAPI_Exec::SmartContract_RemoveClause(
                                     // way we can find it.)
     const std::string& CLAUSE_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5616,7 +5664,7 @@ std::string OTAPI_Exec::SmartContract_AddVariable(
 // strings "true" or "false" are expected here
 // in order to convert to a bool.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5687,7 +5735,7 @@ std::string OTAPI_Exec::SmartContract_RemoveVariable(
                                     // smart contract. (And the scripts...)
     ) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5744,7 +5792,7 @@ std::string OTAPI_Exec::SmartContract_AddCallback(
                                            // triggered
                                            // by the callback. (Must exist.)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5805,7 +5853,7 @@ std::string OTAPI_Exec::SmartContract_RemoveCallback(
                                       // scripts...)
     ) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5862,7 +5910,7 @@ std::string OTAPI_Exec::SmartContract_AddHook(
 // times, and have multiple clauses trigger
 // on the same hook.)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5926,7 +5974,7 @@ std::string OTAPI_Exec::SmartContract_RemoveHook(
 // times, and have multiple clauses trigger
 // on the same hook.)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -5993,7 +6041,7 @@ std::string OTAPI_Exec::SmartContract_AddParty(
 // a Nym, with himself as the agent representing that same party. Nym ID is
 // supplied on ConfirmParty() below.)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6044,7 +6092,7 @@ std::string OTAPI_Exec::SmartContract_RemoveParty(
                                        // smart contract. (And the scripts...)
     ) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6094,7 +6142,7 @@ std::string OTAPI_Exec::SmartContract_AddAccount(
     const std::string& INSTRUMENT_DEFINITION_ID) const  // Instrument Definition
 // ID for the Account. (Optional.)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6152,7 +6200,7 @@ std::string OTAPI_Exec::SmartContract_RemoveAccount(
                                   // smart contract
     ) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6211,7 +6259,7 @@ int32_t OTAPI_Exec::SmartContract_CountNumsNeeded(
                                       // by this function.
     const std::string& AGENT_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6240,7 +6288,7 @@ std::string OTAPI_Exec::SmartContract_ConfirmAccount(
     const std::string& ACCT_ID) const  // AcctID for the asset account. (For
                                        // acct_name).
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6299,7 +6347,7 @@ std::string OTAPI_Exec::SmartContract_ConfirmParty(
     const std::string& NYM_ID,
     const std::string& NOTARY_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6334,7 +6382,7 @@ std::string OTAPI_Exec::SmartContract_ConfirmParty(
 bool OTAPI_Exec::Smart_AreAllPartiesConfirmed(
     const std::string& THE_CONTRACT) const  // true or false?
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6391,7 +6439,7 @@ bool OTAPI_Exec::Smart_IsPartyConfirmed(
                                           // or
                                           // false?
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6473,7 +6521,7 @@ bool OTAPI_Exec::Smart_IsPartyConfirmed(
 
 int32_t OTAPI_Exec::Smart_GetPartyCount(const std::string& THE_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6494,7 +6542,7 @@ int32_t OTAPI_Exec::Smart_GetPartyCount(const std::string& THE_CONTRACT) const
 
 int32_t OTAPI_Exec::Smart_GetBylawCount(const std::string& THE_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6518,7 +6566,7 @@ std::string OTAPI_Exec::Smart_GetPartyByIndex(
     const std::string& THE_CONTRACT,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6553,7 +6601,7 @@ std::string OTAPI_Exec::Smart_GetBylawByIndex(
     const std::string& THE_CONTRACT,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6588,7 +6636,7 @@ std::string OTAPI_Exec::Bylaw_GetLanguage(
     const std::string& THE_CONTRACT,
     const std::string& BYLAW_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6625,7 +6673,7 @@ int32_t OTAPI_Exec::Bylaw_GetClauseCount(
     const std::string& THE_CONTRACT,
     const std::string& BYLAW_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6661,7 +6709,7 @@ int32_t OTAPI_Exec::Bylaw_GetVariableCount(
     const std::string& THE_CONTRACT,
     const std::string& BYLAW_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6697,7 +6745,7 @@ int32_t OTAPI_Exec::Bylaw_GetHookCount(
     const std::string& THE_CONTRACT,
     const std::string& BYLAW_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6733,7 +6781,7 @@ int32_t OTAPI_Exec::Bylaw_GetCallbackCount(
     const std::string& THE_CONTRACT,
     const std::string& BYLAW_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6770,7 +6818,7 @@ std::string OTAPI_Exec::Clause_GetNameByIndex(
     const std::string& BYLAW_NAME,
     const int32_t& nIndex) const  // returns the name of the clause.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6819,7 +6867,7 @@ std::string OTAPI_Exec::Clause_GetContents(
     const std::string& CLAUSE_NAME) const  // returns the contents of the
                                            // clause.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6870,7 +6918,7 @@ std::string OTAPI_Exec::Variable_GetNameByIndex(
     const std::string& BYLAW_NAME,
     const int32_t& nIndex) const  // returns the name of the variable.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6918,7 +6966,7 @@ std::string OTAPI_Exec::Variable_GetType(
     const std::string& VARIABLE_NAME) const  // returns the type of the
                                              // variable.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -6972,7 +7020,7 @@ std::string OTAPI_Exec::Variable_GetAccess(
     const std::string& VARIABLE_NAME) const  // returns the access level of the
                                              // variable.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7026,7 +7074,7 @@ std::string OTAPI_Exec::Variable_GetContents(
     const std::string& VARIABLE_NAME) const  // returns the contents of the
                                              // variable.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7087,7 +7135,7 @@ std::string OTAPI_Exec::Hook_GetNameByIndex(
     const std::string& BYLAW_NAME,
     const int32_t& nIndex) const  // returns the name of the hook.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7126,7 +7174,7 @@ int32_t OTAPI_Exec::Hook_GetClauseCount(
     const std::string& BYLAW_NAME,
     const std::string& HOOK_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7177,7 +7225,7 @@ std::string OTAPI_Exec::Hook_GetClauseAtIndex(
     const std::string& HOOK_NAME,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7234,7 +7282,7 @@ std::string OTAPI_Exec::Callback_GetNameByIndex(
     const std::string& BYLAW_NAME,
     const int32_t& nIndex) const  // returns the name of the callback.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7274,7 +7322,7 @@ std::string OTAPI_Exec::Callback_GetClause(
                                              // to
                                              // callback.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7323,7 +7371,7 @@ int32_t OTAPI_Exec::Party_GetAcctCount(
     const std::string& THE_CONTRACT,
     const std::string& PARTY_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7359,7 +7407,7 @@ int32_t OTAPI_Exec::Party_GetAgentCount(
     const std::string& THE_CONTRACT,
     const std::string& PARTY_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7401,7 +7449,7 @@ std::string OTAPI_Exec::Party_GetID(
 // there is one... Contract might not be
 // signed yet.)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7438,7 +7486,7 @@ std::string OTAPI_Exec::Party_GetAcctNameByIndex(
     const std::string& PARTY_NAME,
     const int32_t& nIndex) const  // returns the name of the clause.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7487,7 +7535,7 @@ std::string OTAPI_Exec::Party_GetAcctID(
                                          // account
                                          // name. (If there is one yet...)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7540,7 +7588,7 @@ std::string OTAPI_Exec::Party_GetAcctInstrumentDefinitionID(
                                          // the
                                          // account name.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7595,7 +7643,7 @@ std::string OTAPI_Exec::Party_GetAcctAgentName(
                                          // named
                                          // account.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7648,7 +7696,7 @@ std::string OTAPI_Exec::Party_GetAgentNameByIndex(
     const std::string& PARTY_NAME,
     const int32_t& nIndex) const  // returns the name of the agent.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7700,7 +7748,7 @@ std::string OTAPI_Exec::Party_GetAgentID(
                                           // is
                                           // one...)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_CONTRACT.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_CONTRACT passed in!\n";
@@ -7772,7 +7820,7 @@ int32_t OTAPI_Exec::activateSmartContract(
     const std::string& NYM_ID,
     const std::string& THE_SMART_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -7813,7 +7861,7 @@ int32_t OTAPI_Exec::triggerClause(
     const std::string& CLAUSE_NAME,
     const std::string& STR_PARAM) const  // optional param
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -7916,7 +7964,7 @@ bool OTAPI_Exec::Msg_HarvestTransactionNumbers(
     const bool& bTransactionWasSuccess,
     const bool& bTransactionWasFailure) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -8131,7 +8179,7 @@ bool OTAPI_Exec::Msg_HarvestTransactionNumbers(
 std::string OTAPI_Exec::LoadPubkey_Encryption(
     const std::string& NYM_ID) const  // returns "", or a public key.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -8168,7 +8216,7 @@ std::string OTAPI_Exec::LoadPubkey_Encryption(
 std::string OTAPI_Exec::LoadPubkey_Signing(
     const std::string& NYM_ID) const  // returns "", or a public key.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -8205,7 +8253,7 @@ std::string OTAPI_Exec::LoadPubkey_Signing(
 std::string OTAPI_Exec::LoadUserPubkey_Encryption(
     const std::string& NYM_ID) const  // returns "", or a public key.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -8233,7 +8281,7 @@ std::string OTAPI_Exec::LoadUserPubkey_Encryption(
 std::string OTAPI_Exec::LoadUserPubkey_Signing(
     const std::string& NYM_ID) const  // returns "", or a public key.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -8269,7 +8317,7 @@ bool OTAPI_Exec::VerifyUserPrivateKey(
     const std::string& NYM_ID) const  // returns
                                       // bool
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -8291,7 +8339,7 @@ bool OTAPI_Exec::Mint_IsStillGood(
     const std::string& NOTARY_ID,
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8329,7 +8377,7 @@ std::string OTAPI_Exec::LoadMint(
                                                         // "", or a
                                                         // mint
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8366,7 +8414,7 @@ std::string OTAPI_Exec::LoadMint(
 std::string OTAPI_Exec::LoadServerContract(
     const std::string& NOTARY_ID) const  // returns "", or an asset contract
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null NOTARY_ID passed in!\n";
@@ -8403,7 +8451,7 @@ std::string OTAPI_Exec::LoadAssetAccount(
     const std::string& NYM_ID,
     const std::string& ACCOUNT_ID) const  // Returns "", or an account.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8470,7 +8518,7 @@ std::string OTAPI_Exec::Nymbox_GetReplyNotice(
     const int64_t& REQUEST_NUMBER) const  // returns replyNotice transaction by
                                           // requestNumber.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8611,7 +8659,7 @@ bool OTAPI_Exec::HaveAlreadySeenReply(
     const int64_t& REQUEST_NUMBER) const  // returns
                                           // bool
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8646,7 +8694,7 @@ std::string OTAPI_Exec::LoadNymbox(
                                       // "", or
 // an inbox.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8680,7 +8728,7 @@ std::string OTAPI_Exec::LoadNymboxNoVerify(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const  // Returns "", or an inbox.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8718,7 +8766,7 @@ std::string OTAPI_Exec::LoadInbox(
     const std::string& ACCOUNT_ID) const  // Returns "",
                                           // or an inbox.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8761,7 +8809,7 @@ std::string OTAPI_Exec::LoadInboxNoVerify(
     const std::string& NYM_ID,
     const std::string& ACCOUNT_ID) const  // Returns "", or an inbox.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8804,7 +8852,7 @@ std::string OTAPI_Exec::LoadOutbox(
     const std::string& NYM_ID,
     const std::string& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8847,7 +8895,7 @@ std::string OTAPI_Exec::LoadOutboxNoVerify(
     const std::string& NYM_ID,
     const std::string& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8892,7 +8940,7 @@ std::string OTAPI_Exec::LoadPaymentInbox(
                                       // an
                                       // inbox.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8929,7 +8977,7 @@ std::string OTAPI_Exec::LoadPaymentInboxNoVerify(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const  // Returns "", or a paymentInbox.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -8968,7 +9016,7 @@ std::string OTAPI_Exec::LoadRecordBox(
     const std::string& NYM_ID,
     const std::string& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9008,7 +9056,7 @@ std::string OTAPI_Exec::LoadRecordBoxNoVerify(
     const std::string& NYM_ID,
     const std::string& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9048,7 +9096,7 @@ std::string OTAPI_Exec::LoadExpiredBox(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9082,7 +9130,7 @@ std::string OTAPI_Exec::LoadExpiredBoxNoVerify(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const  // Returns nullptr, or a ExpiredBox.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9122,7 +9170,7 @@ bool OTAPI_Exec::RecordPayment(
     const bool& bSaveCopy) const  // If false, then will NOT save a copy to
                                   // record box.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OT_ASSERT(nIndex >= 0);
     if (NOTARY_ID.empty()) {
@@ -9148,7 +9196,7 @@ bool OTAPI_Exec::ClearRecord(
     const int32_t& nIndex,
     const bool& bClearAll) const  // if true, nIndex is ignored.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OT_ASSERT(nIndex >= 0);
     if (NOTARY_ID.empty()) {
@@ -9179,7 +9227,7 @@ bool OTAPI_Exec::ClearExpired(
     const bool& bClearAll) const  // if true, nIndex is
                                   // ignored.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OT_ASSERT(nIndex >= 0);
     if (NOTARY_ID.empty()) {
@@ -9204,7 +9252,7 @@ int32_t OTAPI_Exec::Ledger_GetCount(
     const std::string& ACCOUNT_ID,
     const std::string& THE_LEDGER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9254,7 +9302,7 @@ std::string OTAPI_Exec::Ledger_CreateResponse(
     const std::string& ACCOUNT_ID,
     const std::string& ORIGINAL_LEDGER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9340,7 +9388,7 @@ std::string OTAPI_Exec::Ledger_GetTransactionByIndex(
     const std::string& THE_LEDGER,
     const int32_t& nIndex) const  // returns transaction by index (from ledger)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9464,7 +9512,7 @@ std::string OTAPI_Exec::Ledger_GetTransactionByID(
     const std::string& THE_LEDGER,
     const int64_t& TRANSACTION_NUMBER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9641,7 +9689,7 @@ std::string OTAPI_Exec::Ledger_GetInstrument(
     const std::string& THE_LEDGER,
     const int32_t& nIndex) const  // returns financial instrument by index.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9757,7 +9805,7 @@ int64_t OTAPI_Exec::Ledger_GetTransactionIDByIndex(
     const std::string& THE_LEDGER,
     const int32_t& nIndex) const  // returns transaction number by index.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9837,7 +9885,7 @@ std::string OTAPI_Exec::Ledger_AddTransaction(
     const std::string& THE_LEDGER,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -9955,7 +10003,7 @@ std::string OTAPI_Exec::Transaction_CreateResponse(
     const std::string& THE_TRANSACTION,  // Responding to...?
     const bool& BOOL_DO_I_ACCEPT) const  // 0 or 1  (true or false.)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -10361,7 +10409,7 @@ std::string OTAPI_Exec::Ledger_FinalizeResponse(
     const std::string& THE_LEDGER) const  // 'Response' ledger be sent to the
                                           // server...
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11006,7 +11054,7 @@ std::string OTAPI_Exec::Transaction_GetVoucher(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11102,7 +11150,7 @@ std::string OTAPI_Exec::Transaction_GetSenderNymID(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11196,7 +11244,7 @@ std::string OTAPI_Exec::Transaction_GetRecipientNymID(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11311,7 +11359,7 @@ std::string OTAPI_Exec::Transaction_GetSenderAcctID(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11407,7 +11455,7 @@ std::string OTAPI_Exec::Transaction_GetRecipientAcctID(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11511,7 +11559,7 @@ std::string OTAPI_Exec::Pending_GetNote(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11630,7 +11678,7 @@ int64_t OTAPI_Exec::Transaction_GetAmount(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11721,7 +11769,7 @@ int64_t OTAPI_Exec::Transaction_GetDisplayReferenceToNum(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11774,7 +11822,7 @@ std::string OTAPI_Exec::Transaction_GetType(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11833,7 +11881,7 @@ int64_t OTAPI_Exec::ReplyNotice_GetRequestNum(
     const std::string& NYM_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11892,7 +11940,7 @@ time64_t OTAPI_Exec::Transaction_GetDateSigned(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -11951,7 +11999,7 @@ int32_t OTAPI_Exec::Transaction_GetSuccess(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12044,7 +12092,7 @@ int32_t OTAPI_Exec::Transaction_IsCanceled(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12151,7 +12199,7 @@ int32_t OTAPI_Exec::Transaction_GetBalanceAgreementSuccess(
     const std::string& ACCOUNT_ID,
     const std::string& THE_TRANSACTION) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12256,7 +12304,7 @@ int32_t OTAPI_Exec::Message_GetBalanceAgreementSuccess(
     const std::string& ACCOUNT_ID,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12416,7 +12464,7 @@ bool OTAPI_Exec::SavePurse(
     const std::string& NYM_ID,
     const std::string& THE_PURSE) const  // returns bool
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12485,7 +12533,7 @@ std::string OTAPI_Exec::LoadPurse(
                                       // "", or
                                       // a purse.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12533,7 +12581,7 @@ int64_t OTAPI_Exec::Purse_GetTotalValue(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12573,7 +12621,7 @@ int32_t OTAPI_Exec::Purse_Count(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12611,7 +12659,7 @@ bool OTAPI_Exec::Purse_HasPassword(
     const std::string& NOTARY_ID,
     const std::string& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12642,7 +12690,7 @@ std::string OTAPI_Exec::CreatePurse(
     const std::string& OWNER_ID,
     const std::string& SIGNER_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12711,7 +12759,7 @@ std::string OTAPI_Exec::CreatePurse_Passphrase(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& SIGNER_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -12773,7 +12821,7 @@ std::string OTAPI_Exec::Purse_Peek(
                                   // decrypt the token.)
     const std::string& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String strOutput;  // for later.
 
@@ -12867,7 +12915,7 @@ std::string OTAPI_Exec::Purse_Pop(
     // use the same Nym for signing...)
     const std::string& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String strOutput;  // for later.
 
@@ -12983,7 +13031,7 @@ std::string OTAPI_Exec::Purse_Empty(
     const std::string& SIGNER_ID,
     const std::string& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String strOutput;  // for later.
 
@@ -13070,7 +13118,7 @@ std::string OTAPI_Exec::Purse_Push(
     const std::string& THE_PURSE,
     const std::string& THE_TOKEN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String strOutput;  // for later.
 
@@ -13172,7 +13220,7 @@ bool OTAPI_Exec::Wallet_ImportPurse(
     const std::string& NYM_ID,
     const std::string& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13246,7 +13294,7 @@ int32_t OTAPI_Exec::exchangePurse(
     const std::string& NYM_ID,
     const std::string& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13312,7 +13360,7 @@ std::string OTAPI_Exec::Token_ChangeOwner(
     const std::string& OLD_OWNER,        // Pass a NymID here, or a purse.
     const std::string& NEW_OWNER) const  // Pass a NymID here, or a purse.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13386,7 +13434,7 @@ std::string OTAPI_Exec::Token_GetID(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& THE_TOKEN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13433,7 +13481,7 @@ int64_t OTAPI_Exec::Token_GetDenomination(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& THE_TOKEN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13474,7 +13522,7 @@ int32_t OTAPI_Exec::Token_GetSeries(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& THE_TOKEN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13513,7 +13561,7 @@ time64_t OTAPI_Exec::Token_GetValidFrom(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& THE_TOKEN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13553,7 +13601,7 @@ time64_t OTAPI_Exec::Token_GetValidTo(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& THE_TOKEN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13588,7 +13636,7 @@ time64_t OTAPI_Exec::Token_GetValidTo(
 std::string OTAPI_Exec::Token_GetInstrumentDefinitionID(
     const std::string& THE_TOKEN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_TOKEN.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_TOKEN passed in!\n";
@@ -13613,7 +13661,7 @@ std::string OTAPI_Exec::Token_GetInstrumentDefinitionID(
 
 std::string OTAPI_Exec::Token_GetNotaryID(const std::string& THE_TOKEN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_TOKEN.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_TOKEN passed in!\n";
@@ -13646,7 +13694,7 @@ std::string OTAPI_Exec::Token_GetNotaryID(const std::string& THE_TOKEN) const
 bool OTAPI_Exec::IsBasketCurrency(
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (INSTRUMENT_DEFINITION_ID.empty()) {
         otErr << __FUNCTION__
@@ -13670,7 +13718,7 @@ bool OTAPI_Exec::IsBasketCurrency(
 int32_t OTAPI_Exec::Basket_GetMemberCount(
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (INSTRUMENT_DEFINITION_ID.empty()) {
         otErr << __FUNCTION__
@@ -13691,7 +13739,7 @@ std::string OTAPI_Exec::Basket_GetMemberType(
     const std::string& BASKET_INSTRUMENT_DEFINITION_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (BASKET_INSTRUMENT_DEFINITION_ID.empty()) {
         otErr << __FUNCTION__
@@ -13735,7 +13783,7 @@ std::string OTAPI_Exec::Basket_GetMemberType(
 int64_t OTAPI_Exec::Basket_GetMinimumTransferAmount(
     const std::string& BASKET_INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (BASKET_INSTRUMENT_DEFINITION_ID.empty()) {
         otErr << __FUNCTION__
@@ -13776,7 +13824,7 @@ int64_t OTAPI_Exec::Basket_GetMemberMinimumTransferAmount(
     const std::string& BASKET_INSTRUMENT_DEFINITION_ID,
     const int32_t& nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (BASKET_INSTRUMENT_DEFINITION_ID.empty()) {
         otErr << __FUNCTION__
@@ -13819,7 +13867,7 @@ int32_t OTAPI_Exec::pingNotary(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13840,7 +13888,7 @@ int32_t OTAPI_Exec::registerContractNym(
     const std::string& NYM_ID,
     const std::string& CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13867,7 +13915,7 @@ int32_t OTAPI_Exec::registerContractServer(
     const std::string& NYM_ID,
     const std::string& CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13894,7 +13942,7 @@ int32_t OTAPI_Exec::registerContractUnit(
     const std::string& NYM_ID,
     const std::string& CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13928,7 +13976,7 @@ int32_t OTAPI_Exec::registerNym(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13956,7 +14004,7 @@ int32_t OTAPI_Exec::unregisterNym(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -13997,7 +14045,7 @@ int32_t OTAPI_Exec::unregisterNym(
 int64_t OTAPI_Exec::Message_GetUsageCredits(
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -14061,7 +14109,7 @@ int32_t OTAPI_Exec::usageCredits(
 // without adjusting
 // it.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -14104,7 +14152,7 @@ int32_t OTAPI_Exec::checkNym(
     const std::string& NYM_ID,
     const std::string& NYM_ID_CHECK) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -14139,7 +14187,7 @@ int32_t OTAPI_Exec::sendNymMessage(
     const std::string& NYM_ID_RECIPIENT,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -14727,7 +14775,7 @@ int32_t OTAPI_Exec::sendNymInstrument(
 // encrypted to the sender's key
 // instead.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -14816,7 +14864,7 @@ int32_t OTAPI_Exec::getRequestNumber(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -14845,7 +14893,7 @@ int32_t OTAPI_Exec::registerInstrumentDefinition(
     const std::string& NYM_ID,
     const std::string& THE_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -14881,7 +14929,7 @@ int32_t OTAPI_Exec::getInstrumentDefinition(
     const std::string& NYM_ID,
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -14917,7 +14965,7 @@ int32_t OTAPI_Exec::getMint(
     const std::string& NYM_ID,
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -14952,7 +15000,7 @@ int32_t OTAPI_Exec::registerAccount(
     const std::string& NYM_ID,
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -14989,7 +15037,7 @@ int32_t OTAPI_Exec::getAccountData(
     const std::string& NYM_ID,
     const std::string& ACCT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15025,7 +15073,7 @@ std::string OTAPI_Exec::GenerateBasketCreation(
     const std::string& terms,
     const uint64_t weight) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     auto serverContract = wallet_.Server(Identifier(serverID));
 
@@ -15057,7 +15105,7 @@ std::string OTAPI_Exec::AddBasketCreationItem(
     const std::string& currencyID,
     const uint64_t& weight) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
 
     if (basketTemplate.empty()) {
@@ -15110,7 +15158,7 @@ int32_t OTAPI_Exec::issueBasket(
     const std::string& NYM_ID,
     const std::string& THE_BASKET) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15151,7 +15199,7 @@ std::string OTAPI_Exec::GenerateBasketExchange(
     const int32_t& TRANSFER_MULTIPLE) const  // 1            2             3
 // 5=2,3,4  OR  10=4,6,8  OR 15=6,9,12
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15213,7 +15261,7 @@ std::string OTAPI_Exec::AddBasketExchangeItem(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& ASSET_ACCT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15304,7 +15352,7 @@ int32_t OTAPI_Exec::exchangeBasket(
                                                 // ==
                                                 // false (0).
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15353,7 +15401,7 @@ int32_t OTAPI_Exec::getTransactionNumbers(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15383,7 +15431,7 @@ int32_t OTAPI_Exec::notarizeWithdrawal(
     const std::string& ACCT_ID,
     const int64_t& AMOUNT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15422,7 +15470,7 @@ int32_t OTAPI_Exec::notarizeDeposit(
     const std::string& ACCT_ID,
     const std::string& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15463,7 +15511,7 @@ int32_t OTAPI_Exec::notarizeTransfer(
     const int64_t& AMOUNT,
     const std::string& NOTE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15509,7 +15557,7 @@ int32_t OTAPI_Exec::getNymbox(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15539,7 +15587,7 @@ int32_t OTAPI_Exec::processInbox(
     const std::string& ACCT_ID,
     const std::string& ACCT_LEDGER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15588,7 +15636,7 @@ int32_t OTAPI_Exec::processNymbox(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15620,7 +15668,7 @@ int32_t OTAPI_Exec::withdrawVoucher(
     const std::string& CHEQUE_MEMO,
     const int64_t& AMOUNT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15676,7 +15724,7 @@ int32_t OTAPI_Exec::payDividend(
 // SHARE (multiplied by total number of
 // shares issued.)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15733,7 +15781,7 @@ int32_t OTAPI_Exec::depositCheque(
     const std::string& ACCT_ID,
     const std::string& THE_CHEQUE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15776,7 +15824,7 @@ int32_t OTAPI_Exec::depositPaymentPlan(
     const std::string& NYM_ID,
     const std::string& THE_PAYMENT_PLAN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15815,7 +15863,7 @@ int32_t OTAPI_Exec::killMarketOffer(
     const std::string& ASSET_ACCT_ID,
     const int64_t& TRANSACTION_NUMBER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15863,7 +15911,7 @@ int32_t OTAPI_Exec::killPaymentPlan(
     const std::string& FROM_ACCT_ID,
     const int64_t& TRANSACTION_NUMBER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -15899,7 +15947,7 @@ int32_t OTAPI_Exec::requestAdmin(
     const std::string& NYM_ID,
     const std::string& PASSWORD) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!" << std::endl;
@@ -15933,7 +15981,7 @@ int32_t OTAPI_Exec::serverAddClaim(
     const std::string& VALUE,
     const bool PRIMARY) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!" << std::endl;
@@ -16007,7 +16055,7 @@ int32_t OTAPI_Exec::issueMarketOffer(
 // set. Determines the price threshold for
 // stop orders.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (ASSET_ACCT_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: ASSET_ACCT_ID passed in!\n";
@@ -16115,7 +16163,7 @@ int32_t OTAPI_Exec::getMarketList(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -16145,7 +16193,7 @@ int32_t OTAPI_Exec::getMarketOffers(
     const std::string& MARKET_ID,
     const int64_t& MAX_DEPTH) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -16187,7 +16235,7 @@ int32_t OTAPI_Exec::getMarketRecentTrades(
     const std::string& NYM_ID,
     const std::string& MARKET_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -16220,7 +16268,7 @@ int32_t OTAPI_Exec::getNymMarketOffers(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -16266,7 +16314,7 @@ std::string OTAPI_Exec::PopMessageBuffer(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (0 > REQUEST_NUMBER) {
         otErr << __FUNCTION__ << ": Negative: REQUEST_NUMBER passed in!\n";
@@ -16305,11 +16353,30 @@ std::string OTAPI_Exec::PopMessageBuffer(
 //
 void OTAPI_Exec::FlushMessageBuffer(void) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     ot_api_.FlushMessageBuffer();
 }
 
+void OTAPI_Exec::FlushMessageBuffer(const std::string& NOTARY_ID,
+                                    const std::string& NYM_ID) const
+{
+    std::lock_guard<RecursiveMutex> lock(lock_);
+
+    if (NOTARY_ID.empty()) {
+        otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
+        return;
+    }
+    if (NYM_ID.empty()) {
+        otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
+        return;
+    }
+
+    const Identifier theNotaryID(NOTARY_ID), theNymID(NYM_ID);
+
+    ot_api_.FlushMessageBuffer(theNotaryID, theNymID);
+}
+
 // Message OUT-BUFFER
 //
 // (for messages I--the client--have sent the server.)
@@ -16337,7 +16404,7 @@ std::string OTAPI_Exec::GetSentMessage(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (0 > REQUEST_NUMBER) {
         otErr << __FUNCTION__ << ": Negative: REQUEST_NUMBER passed in!\n";
@@ -16383,7 +16450,7 @@ bool OTAPI_Exec::RemoveSentMessage(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (0 > REQUEST_NUMBER) {
         otErr << __FUNCTION__ << ": Negative: REQUEST_NUMBER passed in!\n";
@@ -16439,7 +16506,7 @@ void OTAPI_Exec::FlushSentMessages(
     const std::string& NYM_ID,
     const std::string& THE_NYMBOX) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -16478,7 +16545,7 @@ bool OTAPI_Exec::ResyncNymWithServer(
     const std::string& NYM_ID,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -16596,7 +16663,7 @@ int32_t OTAPI_Exec::queryInstrumentDefinitions(
     const std::string& NYM_ID,
     const std::string& ENCODED_MAP) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -16627,7 +16694,7 @@ int32_t OTAPI_Exec::queryInstrumentDefinitions(
 //
 std::string OTAPI_Exec::Message_GetPayload(const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -16655,7 +16722,7 @@ std::string OTAPI_Exec::Message_GetPayload(const std::string& THE_MESSAGE) const
 //
 std::string OTAPI_Exec::Message_GetCommand(const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -16685,7 +16752,7 @@ std::string OTAPI_Exec::Message_GetCommand(const std::string& THE_MESSAGE) const
 //
 std::string OTAPI_Exec::Message_GetLedger(const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -16736,7 +16803,7 @@ std::string OTAPI_Exec::Message_GetLedger(const std::string& THE_MESSAGE) const
 std::string OTAPI_Exec::Message_GetNewInstrumentDefinitionID(
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -16788,7 +16855,7 @@ std::string OTAPI_Exec::Message_GetNewInstrumentDefinitionID(
 std::string OTAPI_Exec::Message_GetNewIssuerAcctID(
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -16841,7 +16908,7 @@ std::string OTAPI_Exec::Message_GetNewIssuerAcctID(
 std::string OTAPI_Exec::Message_GetNewAcctID(
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -16890,7 +16957,7 @@ std::string OTAPI_Exec::Message_GetNewAcctID(
 std::string OTAPI_Exec::Message_GetNymboxHash(
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -16945,7 +17012,7 @@ std::string OTAPI_Exec::Message_GetNymboxHash(
 //
 int32_t OTAPI_Exec::Message_GetSuccess(const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -17013,7 +17080,7 @@ int32_t OTAPI_Exec::Message_GetSuccess(const std::string& THE_MESSAGE) const
 //
 int32_t OTAPI_Exec::Message_GetDepth(const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_MESSAGE.empty()) {
         otErr << __FUNCTION__ << ": Null: THE_MESSAGE passed in!\n";
@@ -17041,7 +17108,7 @@ int32_t OTAPI_Exec::Message_IsTransactionCanceled(
     const std::string& ACCOUNT_ID,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -17142,7 +17209,7 @@ int32_t OTAPI_Exec::Message_GetTransactionSuccess(
     const std::string& ACCOUNT_ID,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.empty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -17248,7 +17315,7 @@ std::string OTAPI_Exec::ContactAttributeName(
     const proto::ContactItemAttribute type,
     std::string lang)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return identity_.ContactAttributeName(type, lang);
 }
@@ -17256,7 +17323,7 @@ std::string OTAPI_Exec::ContactAttributeName(
 std::set<proto::ContactSectionName> OTAPI_Exec::ContactSectionList(
     const std::uint32_t version)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return identity_.ContactSectionList(version);
 }
@@ -17265,7 +17332,7 @@ std::string OTAPI_Exec::ContactSectionName(
     const proto::ContactSectionName section,
     std::string lang)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return identity_.ContactSectionName(section, lang);
 }
@@ -17274,7 +17341,7 @@ std::set<proto::ContactItemType> OTAPI_Exec::ContactSectionTypeList(
     const proto::ContactSectionName section,
     const std::uint32_t version)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return identity_.ContactSectionTypeList(section, version);
 }
@@ -17283,7 +17350,7 @@ std::string OTAPI_Exec::ContactTypeName(
     const proto::ContactItemType type,
     std::string lang)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return identity_.ContactTypeName(type, lang);
 }
@@ -17291,7 +17358,7 @@ std::string OTAPI_Exec::ContactTypeName(
 proto::ContactItemType OTAPI_Exec::ReciprocalRelationship(
     const proto::ContactItemType relationship)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return identity_.ReciprocalRelationship(relationship);
 }
@@ -17332,7 +17399,7 @@ bool OTAPI_Exec::AddClaim(
     const int64_t start,
     const int64_t end) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     auto nym = ot_api_.GetOrLoadPrivateNym(Identifier(nymID), false);
 
@@ -17363,7 +17430,7 @@ std::string OTAPI_Exec::AddChildEd25519Credential(
     const Identifier& nymID,
     const Identifier& masterID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string output;
 #if OT_CRYPTO_SUPPORTED_KEY_ED25519
@@ -17383,7 +17450,7 @@ std::string OTAPI_Exec::AddChildSecp256k1Credential(
     const Identifier& nymID,
     const Identifier& masterID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string output;
 #if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
@@ -17404,7 +17471,7 @@ std::string OTAPI_Exec::AddChildRSACredential(
     const Identifier& masterID,
     const std::uint32_t keysize) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string output;
 #if OT_CRYPTO_SUPPORTED_KEY_RSA
@@ -982,7 +982,7 @@ OT_OTAPI_OT int32_t
     Utility MsgUtil;
     string strLocation = "OTAPI_Func::SendRequestLowLevel: " + IN_FUNCTION;
 
-    OTAPI_Wrap::FlushMessageBuffer();
+    OTAPI_Wrap::FlushMessageBuffer(theFunction.notaryID, theFunction.nymID);
 
     int32_t nRun =
         theFunction.Run(); // <===== ATTEMPT TO SEND THE MESSAGE HERE...;
@@ -585,6 +585,17 @@ int32_t OTAPI_Wrap::getBoxReceipt(
         NOTARY_ID, NYM_ID, ACCOUNT_ID, nBoxType, TRANSACTION_NUMBER);
 }
 
+int32_t OTAPI_Wrap::getBoxReceipts(
+    const std::string& NOTARY_ID,
+    const std::string& NYM_ID,
+    const std::string& ACCOUNT_ID,
+    const int32_t& nBoxType,
+    const std::string& TRANSACTION_NUMBERS)
+{
+    return Exec()->getBoxReceipts(
+        NOTARY_ID, NYM_ID, ACCOUNT_ID, nBoxType, TRANSACTION_NUMBERS);
+}
+
 int32_t OTAPI_Wrap::deleteAssetAccount(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID,
@@ -3042,6 +3053,13 @@ void OTAPI_Wrap::FlushMessageBuffer(void)
     return Exec()->FlushMessageBuffer();
 }
 
+void OTAPI_Wrap::FlushMessageBuffer(
+    const std::string& NOTARY_ID,
+    const std::string& NYM_ID)
+{
+    return Exec()->FlushMessageBuffer(NOTARY_ID, NYM_ID);
+}
+
 std::string OTAPI_Wrap::GetSentMessage(
     const int64_t& REQUEST_NUMBER,
     const std::string& NOTARY_ID,
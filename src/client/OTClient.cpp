@@ -2249,9 +2249,13 @@ bool OTClient::processServerReplyGetNymBox(const Message& theReply,
     return true;
 }
 
-bool OTClient::processServerReplyGetBoxReceipt(const Message& theReply,
-                                               Ledger* pNymbox,
-                                               ProcessServerReplyArgs& args)
+// Verifies one box receipt downloaded from the server and saves it. Used for
+// both getBoxReceiptResponse and getBoxReceiptsResponse.
+void OTClient::processBoxReceipt(
+    const String& strTransType,
+    const int64_t lBoxType,
+    const int64_t lTransactionNum,
+    ProcessServerReplyArgs& args)
 {
     const auto& pNym = args.pNym;
     const auto& NOTARY_ID = args.NOTARY_ID;
@@ -2260,6 +2264,199 @@ bool OTClient::processServerReplyGetBoxReceipt(const Message& theReply,
     const auto& strNymID = args.strNymID;
     const auto& strNotaryID = args.strNotaryID;
 
+    std::unique_ptr<OTTransactionType> pTransType;
+
+    if (strTransType.Exists())
+        pTransType.reset(
+            OTTransactionType::TransactionFactory(strTransType));
+
+    if (nullptr == pTransType)
+        otErr << __FUNCTION__
+              << ": getBoxReceiptResponse: Error instantiating transaction "
+                 "type based on decoded theReply.m_ascPayload:\n\n"
+              << strTransType << "\n";
+    else {
+        OTTransaction* pBoxReceipt =
+            dynamic_cast<OTTransaction*>(pTransType.get());
+
+        if (nullptr == pBoxReceipt)
+            otErr << __FUNCTION__
+                  << ": getBoxReceiptResponse: Error dynamic_cast from "
+                     "transaction type to transaction, based on "
+                     "decoded theReply.m_ascPayload:\n\n" << strTransType
+                  << "\n\n";
+        else if (!pBoxReceipt->VerifyAccount(*pServerNym))
+            otErr << __FUNCTION__
+                  << ": getBoxReceiptResponse: Error: Box Receipt "
+                  << pBoxReceipt->GetTransactionNum() << " in "
+                  << ((lBoxType == 0)
+                          ? "nymbox"
+                          : ((lBoxType == 1) ? "inbox" : "outbox"))
+                  << " fails VerifyAccount().\n"; // outbox is 2.);
+        else if (pBoxReceipt->GetTransactionNum() !=
+                 lTransactionNum)
+            otErr << __FUNCTION__
+                  << ": getBoxReceiptResponse: Error: Transaction Number "
+                     "doesn't match on the box receipt itself ("
+                  << pBoxReceipt->GetTransactionNum()
+                  << "), versus the one listed in the reply message ("
+                  << lTransactionNum << ").\n";
+        // Note: Account ID and Notary ID were already verified, in
+        // VerifyAccount().
+        else if (pBoxReceipt->GetNymID() != NYM_ID) {
+            const String strPurportedNymID(pBoxReceipt->GetNymID());
+            otErr
+                << __FUNCTION__
+                << ": getBoxReceiptResponse: Error: NymID doesn't match on "
+                   "the box receipt itself (" << strPurportedNymID
+                << "), versus the one listed in the reply message ("
+                << strNymID << ").\n";
+        }
+        else // FINALLY we have the Ledger AND the Box Receipt both loaded at the same time.
+        {    // UPDATE: Not loading the ledger at this point. Not necessary. Faster without it.
+
+            // UPDATE: We will ASSUME the abbreviated receipt is in the NYMBOX,
+            // which is WHY we are now downloading the FULL BOX RECEIPT. We will
+            // SAVE it for the Nymbox, which finishes the Nymbox (already in box as
+            // abbreviated, and already saved in full in box receipts folder). Next
+            // we will also add it to the PAYMENT INBOX and RECORD BOX, if it's the
+            // right sort of receipt. We will also save THEIR versions of the FULL
+            // BOX RECEIPT, just as we did for the Nymbox here.
+
+            if ((OTTransaction::instrumentNotice ==
+                 pBoxReceipt->GetType()) ||
+                (OTTransaction::instrumentRejection ==
+                 pBoxReceipt->GetType())) {
+                // Just make sure not to add it if it's already there...
+                if (!strNotaryID.Exists()) {
+                    otErr << __FUNCTION__
+                          << ": strNotaryID doesn't Exist!\n";
+                    OT_FAIL;
+                }
+                if (!strNymID.Exists()) {
+                    otErr << __FUNCTION__ << ": strNymID dosn't Exist!\n";
+                    OT_FAIL;
+                }
+                const bool bExists =
+                    OTDB::Exists(OTFolders::PaymentInbox().Get(),
+                                 strNotaryID.Get(), strNymID.Get());
+                Ledger thePmntInbox(NYM_ID, NYM_ID,
+                                    NOTARY_ID); // payment inbox
+                bool bSuccessLoading =
+                    (bExists && thePmntInbox.LoadPaymentInbox());
+                if (bExists && bSuccessLoading)
+                    bSuccessLoading = (thePmntInbox.VerifyContractID() &&
+                                       thePmntInbox.VerifySignature(*pNym));
+                //                          bSuccessLoading    =
+                // (thePmntInbox.VerifyAccount(*pNym)); // (No need here
+                // to load all the Box Receipts by using VerifyAccount)
+                else if (!bExists)
+                    bSuccessLoading = thePmntInbox.GenerateLedger(
+                        NYM_ID, NOTARY_ID, Ledger::paymentInbox,
+                        true); // bGenerateFile=true
+                // by this point, the nymbox DEFINITELY exists -- or
+                // not. (generation might have failed, or verification.)
+
+                if (!bSuccessLoading) {
+                    String strNymID(NYM_ID), strAcctID(NYM_ID);
+                    otOut << __FUNCTION__
+                          << ": getBoxReceiptResponse: WARNING: Unable to "
+                             "load, verify, or generate paymentInbox, "
+                             "with IDs: " << strNymID << " / " << strAcctID
+                          << "\n";
+                }
+                else // --- ELSE --- Success loading the payment inbox
+                       // and recordBox and verifying their contractID
+                       // and signature, (OR success generating the
+                       // ledger.)
+                {
+                    // The transaction (which we are putting into the payment inbox) will
+                    // not be removed from the nymbox until we receive the server's success
+                    // reply to this "process Nymbox" message. That's why you see me adding
+                    // it here to the payment inbox, while not removing it from the Nymbox
+                    // (because that will happen once the reply is received.) NOTE: Need to
+                    // make sure the associated box receipt doesn't get MARKED FOR DELETION
+                    // when being removed at that time.
+                    //
+                    // void load_str_trans_add_to_ledger(const OTIdentifier& the_nym_id, const OTString& str_trans,
+                    //                                   const OTString str_box_type, const int64_t& lTransNum, OTPseudonym& the_nym, OTLedger& ledger);
+
+                    // Basically we are taking this receipt from the
+                    // Nymbox, and also adding copies of it
+                    // to the paymentInbox and the recordBox.
+                    //
+                    // QUESTION: what if I ERASE it out of my recordBox.
+                    // Won't it pop back up again?
+                    // ANSWER: YES, but not if I do this instead at
+                    // getBoxReceiptResponse which will only happen once.
+                    // UPDATE: which I now AM (see our location here...)
+                    // HOWEVER: Most likely not, because this notice
+                    // will no longer BE in my Nymbox...
+                    //
+                    // QUESTION: What if I ERASE it out of my
+                    // paymentInbox? Won't this pop back there again?
+                    //
+                    // ANSWER: I can't erase it out of there. I can
+                    // either accept it or reject it. Either way,
+                    // it is removed from my paymentInbox at that time
+                    // by OT. Like above, if a copy were still
+                    // in the Nymbox, I would get a duplicate here when
+                    // processing Nymbox again. But MOST TIMES,
+                    // there will be no duplicate, because it will
+                    // already be cleaned out of my Nymbox anyway.
+                    //
+                    //
+                    const int64_t lTransNum =
+                        pBoxReceipt->GetTransactionNum();
+
+                    // If pBoxReceipt->GetType() is instrument notice,
+                    // add to the payments inbox.
+                    // (It will be moved to record box after the
+                    // incoming payment is deposited or discarded.)
+                    //
+                    load_str_trans_add_to_ledger(NYM_ID, strTransType,
+                                                 "paymentInbox", lTransNum,
+                                                 *pNym, thePmntInbox);
+                    //                          load_str_trans_add_to_ledger(NYM_ID,
+                    // strTransType, "recordBox",    lTransNum, *pNym,
+                    // theRecordBox); // No longer here. Moved to
+                    // processDepositResponse
+
+                } // --- ELSE --- Success loading the payment inbox and
+                  // verifying its contractID and signature, OR success
+                  // generating the ledger.
+            }     // if pBoxReceipt is instrumentNotice or
+                  // instrumentRejection...
+
+            //                    pBoxReceipt->ReleaseSignatures();
+
+            // I don't release the server's signature, so later on I can verify
+            // either signature -- the server's or pNym's. Both should be on the
+            // receipt. UPDATE: We're not changing the content of the Box Receipt AT
+            // ALL because we don't want to already its message digest, which will
+            // be compared to the hash stored in the abbreviated version of the same
+            // receipt.
+            //
+//              pBoxReceipt->SignContract(*pNym);
+//              pBoxReceipt->SaveContract();
+
+//              if (!pBoxReceipt->SaveBoxReceipt(*pLedger)) // <===================
+            if (!pBoxReceipt->SaveBoxReceipt(lBoxType)) // <===================
+                otErr << __FUNCTION__
+                      << ": getBoxReceiptResponse(): Failed trying to "
+                         "SaveBoxReceipt. Contents:\n\n" << strTransType
+                      << "\n\n";
+            // lBoxType in this context stores boxType.
+            // Value can be: 0/nymbox,1/inbox,2/outbox
+
+        } // We can save the box receipt.
+    }     // Success loading the boxReceipt from the server reply
+}
+
+bool OTClient::processServerReplyGetBoxReceipt(const Message& theReply,
+                                               Ledger* pNymbox,
+                                               ProcessServerReplyArgs& args)
+{
     otOut << "Received server response to getBoxReceipt request ("
           << (theReply.m_bSuccess ? "success" : "failure") << ")\n";
 
@@ -2305,194 +2502,11 @@ bool OTClient::processServerReplyGetBoxReceipt(const Message& theReply,
 
         // base64-Decode the server reply's payload into strTransaction
         //
-        const String strTransType(theReply.m_ascPayload);
-        std::unique_ptr<OTTransactionType> pTransType;
-
-        if (strTransType.Exists())
-            pTransType.reset(
-                OTTransactionType::TransactionFactory(strTransType));
-
-        if (nullptr == pTransType)
-            otErr << __FUNCTION__
-                  << ": getBoxReceiptResponse: Error instantiating transaction "
-                     "type based on decoded theReply.m_ascPayload:\n\n"
-                  << strTransType << "\n";
-        else {
-            OTTransaction* pBoxReceipt =
-                dynamic_cast<OTTransaction*>(pTransType.get());
-
-            if (nullptr == pBoxReceipt)
-                otErr << __FUNCTION__
-                      << ": getBoxReceiptResponse: Error dynamic_cast from "
-                         "transaction type to transaction, based on "
-                         "decoded theReply.m_ascPayload:\n\n" << strTransType
-                      << "\n\n";
-            else if (!pBoxReceipt->VerifyAccount(*pServerNym))
-                otErr << __FUNCTION__
-                      << ": getBoxReceiptResponse: Error: Box Receipt "
-                      << pBoxReceipt->GetTransactionNum() << " in "
-                      << ((theReply.m_lDepth == 0)
-                              ? "nymbox"
-                              : ((theReply.m_lDepth == 1) ? "inbox" : "outbox"))
-                      << " fails VerifyAccount().\n"; // outbox is 2.);
-            else if (pBoxReceipt->GetTransactionNum() !=
-                     theReply.m_lTransactionNum)
-                otErr << __FUNCTION__
-                      << ": getBoxReceiptResponse: Error: Transaction Number "
-                         "doesn't match on the box receipt itself ("
-                      << pBoxReceipt->GetTransactionNum()
-                      << "), versus the one listed in the reply message ("
-                      << theReply.m_lTransactionNum << ").\n";
-            // Note: Account ID and Notary ID were already verified, in
-            // VerifyAccount().
-            else if (pBoxReceipt->GetNymID() != NYM_ID) {
-                const String strPurportedNymID(pBoxReceipt->GetNymID());
-                otErr
-                    << __FUNCTION__
-                    << ": getBoxReceiptResponse: Error: NymID doesn't match on "
-                       "the box receipt itself (" << strPurportedNymID
-                    << "), versus the one listed in the reply message ("
-                    << theReply.m_strNymID << ").\n";
-            }
-            else // FINALLY we have the Ledger AND the Box Receipt both loaded at the same time.
-            {    // UPDATE: Not loading the ledger at this point. Not necessary. Faster without it.
-
-                // UPDATE: We will ASSUME the abbreviated receipt is in the NYMBOX,
-                // which is WHY we are now downloading the FULL BOX RECEIPT. We will
-                // SAVE it for the Nymbox, which finishes the Nymbox (already in box as
-                // abbreviated, and already saved in full in box receipts folder). Next
-                // we will also add it to the PAYMENT INBOX and RECORD BOX, if it's the
-                // right sort of receipt. We will also save THEIR versions of the FULL
-                // BOX RECEIPT, just as we did for the Nymbox here.
-
-                if ((OTTransaction::instrumentNotice ==
-                     pBoxReceipt->GetType()) ||
-                    (OTTransaction::instrumentRejection ==
-                     pBoxReceipt->GetType())) {
-                    // Just make sure not to add it if it's already there...
-                    if (!strNotaryID.Exists()) {
-                        otErr << __FUNCTION__
-                              << ": strNotaryID doesn't Exist!\n";
-                        OT_FAIL;
-                    }
-                    if (!strNymID.Exists()) {
-                        otErr << __FUNCTION__ << ": strNymID dosn't Exist!\n";
-                        OT_FAIL;
-                    }
-                    const bool bExists =
-                        OTDB::Exists(OTFolders::PaymentInbox().Get(),
-                                     strNotaryID.Get(), strNymID.Get());
-                    Ledger thePmntInbox(NYM_ID, NYM_ID,
-                                        NOTARY_ID); // payment inbox
-                    bool bSuccessLoading =
-                        (bExists && thePmntInbox.LoadPaymentInbox());
-                    if (bExists && bSuccessLoading)
-                        bSuccessLoading = (thePmntInbox.VerifyContractID() &&
-                                           thePmntInbox.VerifySignature(*pNym));
-                    //                          bSuccessLoading    =
-                    // (thePmntInbox.VerifyAccount(*pNym)); // (No need here
-                    // to load all the Box Receipts by using VerifyAccount)
-                    else if (!bExists)
-                        bSuccessLoading = thePmntInbox.GenerateLedger(
-                            NYM_ID, NOTARY_ID, Ledger::paymentInbox,
-                            true); // bGenerateFile=true
-                    // by this point, the nymbox DEFINITELY exists -- or
-                    // not. (generation might have failed, or verification.)
-
-                    if (!bSuccessLoading) {
-                        String strNymID(NYM_ID), strAcctID(NYM_ID);
-                        otOut << __FUNCTION__
-                              << ": getBoxReceiptResponse: WARNING: Unable to "
-                                 "load, verify, or generate paymentInbox, "
-                                 "with IDs: " << strNymID << " / " << strAcctID
-                              << "\n";
-                    }
-                    else // --- ELSE --- Success loading the payment inbox
-                           // and recordBox and verifying their contractID
-                           // and signature, (OR success generating the
-                           // ledger.)
-                    {
-                        // The transaction (which we are putting into the payment inbox) will
-                        // not be removed from the nymbox until we receive the server's success
-                        // reply to this "process Nymbox" message. That's why you see me adding
-                        // it here to the payment inbox, while not removing it from the Nymbox
-                        // (because that will happen once the reply is received.) NOTE: Need to
-                        // make sure the associated box receipt doesn't get MARKED FOR DELETION
-                        // when being removed at that time.
-                        //
-                        // void load_str_trans_add_to_ledger(const OTIdentifier& the_nym_id, const OTString& str_trans,
-                        //                                   const OTString str_box_type, const int64_t& lTransNum, OTPseudonym& the_nym, OTLedger& ledger);
-
-                        // Basically we are taking this receipt from the
-                        // Nymbox, and also adding copies of it
-                        // to the paymentInbox and the recordBox.
-                        //
-                        // QUESTION: what if I ERASE it out of my recordBox.
-                        // Won't it pop back up again?
-                        // ANSWER: YES, but not if I do this instead at
-                        // getBoxReceiptResponse which will only happen once.
-                        // UPDATE: which I now AM (see our location here...)
-                        // HOWEVER: Most likely not, because this notice
-                        // will no longer BE in my Nymbox...
-                        //
-                        // QUESTION: What if I ERASE it out of my
-                        // paymentInbox? Won't this pop back there again?
-                        //
-                        // ANSWER: I can't erase it out of there. I can
-                        // either accept it or reject it. Either way,
-                        // it is removed from my paymentInbox at that time
-                        // by OT. Like above, if a copy were still
-                        // in the Nymbox, I would get a duplicate here when
-                        // processing Nymbox again. But MOST TIMES,
-                        // there will be no duplicate, because it will
-                        // already be cleaned out of my Nymbox anyway.
-                        //
-                        //
-                        const int64_t lTransNum =
-                            pBoxReceipt->GetTransactionNum();
-
-                        // If pBoxReceipt->GetType() is instrument notice,
-                        // add to the payments inbox.
-                        // (It will be moved to record box after the
-                        // incoming payment is deposited or discarded.)
-                        //
-                        load_str_trans_add_to_ledger(NYM_ID, strTransType,
-                                                     "paymentInbox", lTransNum,
-                                                     *pNym, thePmntInbox);
-                        //                          load_str_trans_add_to_ledger(NYM_ID,
-                        // strTransType, "recordBox",    lTransNum, *pNym,
-                        // theRecordBox); // No longer here. Moved to
-                        // processDepositResponse
-
-                    } // --- ELSE --- Success loading the payment inbox and
-                      // verifying its contractID and signature, OR success
-                      // generating the ledger.
-                }     // if pBoxReceipt is instrumentNotice or
-                      // instrumentRejection...
-
-                //                    pBoxReceipt->ReleaseSignatures();
-
-                // I don't release the server's signature, so later on I can verify
-                // either signature -- the server's or pNym's. Both should be on the
-                // receipt. UPDATE: We're not changing the content of the Box Receipt AT
-                // ALL because we don't want to already its message digest, which will
-                // be compared to the hash stored in the abbreviated version of the same
-                // receipt.
-                //
-//              pBoxReceipt->SignContract(*pNym);
-//              pBoxReceipt->SaveContract();
-
-//              if (!pBoxReceipt->SaveBoxReceipt(*pLedger)) // <===================
-                if (!pBoxReceipt->SaveBoxReceipt(theReply.m_lDepth)) // <===================
-                    otErr << __FUNCTION__
-                          << ": getBoxReceiptResponse(): Failed trying to "
-                             "SaveBoxReceipt. Contents:\n\n" << strTransType
-                          << "\n\n";
-                // theReply.m_lDepth in this context stores boxType.
-                // Value can be: 0/nymbox,1/inbox,2/outbox
-
-            } // We can save the box receipt.
-        }     // Success loading the boxReceipt from the server reply
+        processBoxReceipt(
+            String(theReply.m_ascPayload),
+            theReply.m_lDepth,
+            theReply.m_lTransactionNum,
+            args);
     }         // No error condition.
     else {
         otErr
@@ -2505,6 +2519,49 @@ bool OTClient::processServerReplyGetBoxReceipt(const Message& theReply,
     return true;
 }
 
+// The server returns as many of the requested receipts as fit in one reply.
+// Each one is verified and saved exactly as for getBoxReceiptResponse. Any
+// numbers it had no room for are listed in "remaining" so the caller can ask
+// again.
+bool OTClient::processServerReplyGetBoxReceipts(
+    const Message& theReply,
+    ProcessServerReplyArgs& args)
+{
+    otOut << "Received server response to getBoxReceipts request ("
+          << (theReply.m_bSuccess ? "success" : "failure") << ")\n";
+
+    if ((theReply.m_lDepth < 0) || (theReply.m_lDepth > 2)) {
+        otErr << __FUNCTION__ << ": getBoxReceiptsResponse: Unknown box type: "
+              << theReply.m_lDepth << "\n";
+
+        return true;
+    }
+
+    if (!theReply.m_ascPayload.Exists()) return true;
+
+    std::unique_ptr<OTDB::Storable> pStorable(OTDB::DecodeObject(
+        OTDB::STORED_OBJ_STRING_MAP, theReply.m_ascPayload.Get()));
+    OTDB::StringMap* pMap = dynamic_cast<OTDB::StringMap*>(pStorable.get());
+
+    if (nullptr == pMap) {
+        otErr << __FUNCTION__ << ": getBoxReceiptsResponse: Failed decoding "
+                                 "receipts. NymID: "
+              << theReply.m_strNymID << "  AcctID: " << theReply.m_strAcctID
+              << "\n";
+
+        return true;
+    }
+
+    for (auto& it : pMap->the_map) {
+        const int64_t lTransactionNum = String::StringToLong(it.first);
+
+        processBoxReceipt(
+            String(it.second.c_str()), theReply.m_lDepth, lTransactionNum, args);
+    }
+
+    return true;
+}
+
 bool OTClient::processServerReplyProcessInbox(
     const Message& theReply,
     Ledger* pNymbox,
@@ -5419,6 +5476,9 @@ bool OTClient::processServerReply(
     if (theReply.m_strCommand.Compare("getBoxReceiptResponse")) {
         return processServerReplyGetBoxReceipt(theReply, pNymbox, args);
     }
+    if (theReply.m_strCommand.Compare("getBoxReceiptsResponse")) {
+        return processServerReplyGetBoxReceipts(theReply, args);
+    }
     if ((theReply.m_strCommand.Compare("processInboxResponse") ||
          theReply.m_strCommand.Compare("processNymboxResponse"))) {
         return processServerReplyProcessInbox(theReply, pNymbox, args);
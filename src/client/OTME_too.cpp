@@ -39,6 +39,7 @@
 #include "opentxs/client/OTME_too.hpp"
 
 #include "opentxs/api/Api.hpp"
+#include "opentxs/api/Executor.hpp"
 #include "opentxs/api/Identity.hpp"
 #include "opentxs/api/OT.hpp"
 #include "opentxs/api/Settings.hpp"
@@ -59,6 +60,7 @@
 
 #include <chrono>
 #include <functional>
+#include <future>
 
 #define MASTER_SECTION "Master"
 #define PAIRED_NODES_KEY "paired_nodes"
@@ -91,7 +93,7 @@ namespace opentxs
 {
 
 OTME_too::OTME_too(
-    std::recursive_mutex& lock,
+    RecursiveMutex& lock,
     Settings& config,
     OT_API& otapi,
     OTAPI_Exec& exec,
@@ -252,7 +254,7 @@ void OTME_too::build_account_list(serverTaskMap& output) const
 {
     // Make sure no nyms, servers, or accounts are added or removed while
     // creating the list
-    std::unique_lock<std::recursive_mutex> apiLock(api_lock_);
+    std::unique_lock<RecursiveMutex> apiLock(api_lock_);
     const auto serverList = wallet_.ServerList();
     const auto nymCount = exec_.GetNymCount();
     const auto accountCount = exec_.GetAccountCount();
@@ -291,7 +293,7 @@ void OTME_too::build_nym_list(std::list<std::string>& output) const
     output.clear();
 
     // Make sure no nyms are added or removed while creating the list
-    std::unique_lock<std::recursive_mutex> apiLock(api_lock_);
+    std::unique_lock<RecursiveMutex> apiLock(api_lock_);
     const auto nymCount = exec_.GetNymCount();
 
     for (std::int32_t n = 0; n < nymCount; n++ ) {
@@ -407,7 +409,7 @@ bool OTME_too::check_backup(const std::string& bridgeNymID, PairedNode& node)
     String section = PAIRED_SECTION_PREFIX;
     String sectionKey = std::to_string(std::get<0>(node)).c_str();
     section.Concatenate(sectionKey);
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
 
     if (!config_.Set_bool(section, BACKUP_KEY, true, dontCare)) {
 
@@ -479,7 +481,7 @@ bool OTME_too::check_nym_revision(
     const std::string& nymID,
     const std::string& server) const
 {
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
 
     auto nym = wallet_.Nym(Identifier(nymID));
 
@@ -600,7 +602,7 @@ std::uint64_t OTME_too::ContactCount() const
 {
     std::int64_t result = 0;
     bool notUsed = false;
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     config_.Check_long(MASTER_SECTION, CONTACT_COUNT_KEY, result, notUsed);
 
     if (1 > result) {
@@ -890,7 +892,7 @@ void OTME_too::fill_existing_accounts(
     PairedNode& node)
 {
     const auto& notaryID = std::get<3>(node);
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     const auto count = exec_.GetAccountCount();
 
     for (std::int32_t n = 0; n < count; n++ ) {
@@ -1191,7 +1193,7 @@ std::string OTME_too::get_introduction_server() const
 {
     bool keyFound = false;
     String serverID;
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     const bool config = config_.Check_str(
         MASTER_SECTION, INTRODUCTION_SERVER_KEY, serverID, keyFound);
 
@@ -1261,7 +1263,7 @@ bool OTME_too::insert_at_index(
     const std::string& bridgeNym,
     std::string& password) const
 {
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     bool dontCare = false;
 
     if (!config_.Set_long(MASTER_SECTION, PAIRED_NODES_KEY, total, dontCare)) {
@@ -1337,7 +1339,7 @@ void OTME_too::mark_connected(PairedNode& node)
     String section = PAIRED_SECTION_PREFIX;
     String sectionKey = std::to_string(std::get<0>(node)).c_str();
     section.Concatenate(sectionKey);
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     connected = true;
     config_.Set_bool(section, CONNECTED_KEY, connected, dontCare);
     config_.Save();
@@ -1354,7 +1356,7 @@ void OTME_too::mark_finished(const std::string& bridgeNymID)
     String sectionKey = std::to_string(std::get<0>(node)).c_str();
     section.Concatenate(sectionKey);
     done = true;
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     config_.Set_bool(section, DONE_KEY, done, dontCare);
     config_.Save();
 }
@@ -1370,7 +1372,7 @@ void OTME_too::mark_renamed(const std::string& bridgeNymID)
     String sectionKey = std::to_string(std::get<0>(node)).c_str();
     section.Concatenate(sectionKey);
     renamed = true;
-    std::unique_lock<std::recursive_mutex> apiLock(api_lock_);
+    std::unique_lock<RecursiveMutex> apiLock(api_lock_);
     config_.Set_bool(section, RENAME_KEY, renamed, dontCare);
     config_.Save();
     apiLock.unlock();
@@ -1603,7 +1605,7 @@ void OTME_too::pair(const std::string& bridgeNymID)
         yield();
     }
 
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     config_.Save();
 }
 
@@ -1611,7 +1613,7 @@ std::uint64_t OTME_too::PairedNodeCount() const
 {
     std::int64_t result = 0;
     bool notUsed = false;
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     config_.Check_long(MASTER_SECTION, PAIRED_NODES_KEY, result, notUsed);
 
     if (1 > result) {
@@ -1750,7 +1752,7 @@ bool OTME_too::PairNode(
 void OTME_too::parse_contact_section(const Lock& lock, const std::uint64_t index)
 {
     verify_lock(lock, contact_lock_);
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     bool notUsed = false;
     String nymID;
     String name;
@@ -1787,7 +1789,7 @@ void OTME_too::parse_contact_section(const Lock& lock, const std::uint64_t index
 
 void OTME_too::parse_pairing_section(std::uint64_t index)
 {
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     bool notUsed = false;
     String bridgeNym, adminPassword, ownerNym;
     String section = PAIRED_SECTION_PREFIX;
@@ -1860,7 +1862,7 @@ bool OTME_too::publish_server_registration(
     const std::string& server,
     const bool forcePrimary) const
 {
-    std::unique_lock<std::recursive_mutex> apiLock(api_lock_);
+    std::unique_lock<RecursiveMutex> apiLock(api_lock_);
     auto nym = ot_api_.GetOrLoadPrivateNym(Identifier(nymID), false);
 
     OT_ASSERT(nullptr != nym);
@@ -1948,66 +1950,101 @@ void OTME_too::refresh_contacts(nymAccountMap& nymsToCheck)
     }
 }
 
-void OTME_too::refresh_thread()
+void OTME_too::refresh_server(
+    const std::string& serverID,
+    const serverTaskMap::mapped_type& tasks)
 {
-    serverTaskMap accounts;
-    build_account_list(accounts);
-    nymAccountMap nymsToCheck;
-    refresh_contacts(nymsToCheck);
-    add_checknym_tasks(nymsToCheck, accounts);
+    bool updateServerNym = true;
+    const auto& accountList = tasks.first;
+    const auto& checkNym = tasks.second;
+    bool nymsChecked = false;
 
-    for (const auto server : accounts) {
-        bool updateServerNym = true;
-        const auto& serverID = server.first;
-        const auto& tasks = server.second;
-        const auto& accountList = tasks.first;
-        const auto& checkNym = tasks.second;
-        bool nymsChecked = false;
-
-        for (const auto nym : accountList) {
-            const auto& nymID = nym.first;
-
-            if (updateServerNym) {
-                auto contract = wallet_.Server(Identifier(serverID));
-
-                if (contract) {
-                    const auto& serverNymID = contract->Nym()->ID();
-                    const auto result = otme_.check_nym(
-                        serverID, nymID, String(serverNymID).Get());
-                    yield();
-                    // If multiple nyms are registered on this server, we only
-                    // need to successfully download the nym once.
-                    updateServerNym =
-                        !(1 == otme_.VerifyMessageSuccess(result));
-                }
-            }
+    for (const auto nym : accountList) {
+        const auto& nymID = nym.first;
 
-            bool notUsed = false;
-            made_easy_.retrieve_nym(serverID, nymID, notUsed, true);
-            yield();
+        if (updateServerNym) {
+            auto contract = wallet_.Server(Identifier(serverID));
 
-            // If the nym's credentials have been updated since the last time
-            // it was registered on the server, upload the new credentials
-            if (!check_nym_revision(nymID, serverID)) {
-                check_server_registration(nymID, serverID, true, false);
+            if (contract) {
+                const auto& serverNymID = contract->Nym()->ID();
+                const auto result = otme_.check_nym(
+                    serverID, nymID, String(serverNymID).Get());
+                yield();
+                // If multiple nyms are registered on this server, we only
+                // need to successfully download the nym once.
+                updateServerNym =
+                    !(1 == otme_.VerifyMessageSuccess(result));
             }
+        }
+
+        // Not forced: the nymbox, inbox and outbox are only downloaded when
+        // the server reports a hash different from the local copy.
+        bool notUsed = false;
+        made_easy_.retrieve_nym(serverID, nymID, notUsed, false);
+        yield();
+
+        // If the nym's credentials have been updated since the last time
+        // it was registered on the server, upload the new credentials
+        if (!check_nym_revision(nymID, serverID)) {
+            check_server_registration(nymID, serverID, true, false);
+        }
 
-            for (auto& account : nym.second) {
-                made_easy_.retrieve_account(serverID, nymID, account, true);
+        for (auto& account : nym.second) {
+            made_easy_.retrieve_account(serverID, nymID, account, false);
+            yield();
+        }
+
+        if (!nymsChecked) {
+            for (const auto& nym : checkNym) {
+                made_easy_.check_nym(serverID, nymID, nym);
                 yield();
             }
 
-            if (!nymsChecked) {
-                for (const auto& nym : checkNym) {
-                    made_easy_.check_nym(serverID, nymID, nym);
-                    yield();
-                }
+            nymsChecked = true;
+        }
+    }
+}
 
-                nymsChecked = true;
-            }
+void OTME_too::refresh_thread()
+{
+    serverTaskMap accounts;
+    build_account_list(accounts);
+    nymAccountMap nymsToCheck;
+    refresh_contacts(nymsToCheck);
+    add_checknym_tasks(nymsToCheck, accounts);
+
+    // Servers are refreshed in parallel on the shared executor. Each server's
+    // sequences hold only that server's context lock, and the API lock is
+    // given up while waiting for replies, so one slow or unreachable server
+    // does not hold up the others.
+    auto& executor = OT::App().Executor();
+    std::list<std::future<void>> finished;
+
+    for (const auto& server : accounts) {
+        const auto serverID = server.first;
+        const auto tasks = server.second;
+        auto done = std::make_shared<std::promise<void>>();
+        finished.emplace_back(done->get_future());
+        const bool submitted = executor.Submit(
+            [this, serverID, tasks, done]() -> void {
+                refresh_server(serverID, tasks);
+                done->set_value();
+            },
+            refresh_cancel_,
+            Executor::Priority::BACKGROUND);
+
+        if (!submitted) {
+            refresh_server(serverID, tasks);
+            done->set_value();
         }
     }
 
+    // A task which is cancelled or discarded at shutdown breaks its promise,
+    // which also ends the wait.
+    for (auto& it : finished) {
+        it.wait();
+    }
+
     refresh_count_++;
     UpdatePairing();
     resend_peer_requests();
@@ -2206,7 +2243,7 @@ void OTME_too::resend_peer_request(
     const Identifier& nymID,
     const Identifier& requestID) const
 {
-    std::unique_lock<std::recursive_mutex> apiLock(api_lock_);
+    std::unique_lock<RecursiveMutex> apiLock(api_lock_);
     std::time_t notUsed;
 
     auto request = wallet_.PeerRequest(
@@ -2369,7 +2406,7 @@ std::string OTME_too::SetIntroductionServer(const std::string& contract) const
 
     if (!id.empty()) {
         bool dontCare = false;
-        std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+        std::lock_guard<RecursiveMutex> apiLock(api_lock_);
         const bool set = config_.Set_str(
             MASTER_SECTION, INTRODUCTION_SERVER_KEY, String(id), dontCare);
 
@@ -2410,7 +2447,7 @@ std::int64_t OTME_too::scan_incomplete_pairing(const std::string& bridgeNym)
         String section = PAIRED_SECTION_PREFIX;
         const String key = std::to_string(n).c_str();
         section.Concatenate(key);
-        std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+        std::lock_guard<RecursiveMutex> apiLock(api_lock_);
         config_.Check_str(section, BRIDGE_NYM_KEY, existing, notUsed);
         const std::string compareNym(existing.Get());
 
@@ -2438,6 +2475,7 @@ void OTME_too::scan_pairing()
 void OTME_too::Shutdown()
 {
     clean_background_threads();
+    refresh_cancel_.Cancel();
 
     while (refreshing_.load()) {
         Log::Sleep(std::chrono::milliseconds(250));
@@ -2494,7 +2532,7 @@ bool OTME_too::update_accounts(const PairedNode& node)
     String sectionKey = std::to_string(std::get<0>(node)).c_str();
     section.Concatenate(sectionKey);
     const auto& accountMap = std::get<5>(node);
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
 
     for (const auto account : accountMap) {
         const auto& type = account.first;
@@ -2520,7 +2558,7 @@ bool OTME_too::update_assets(PairedNode& node)
     section.Concatenate(sectionKey);
     auto& unitMap = std::get<4>(node);
     const auto count = unitMap.size();
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
 
     if (!config_.Set_long(section, ISSUED_UNITS_KEY, count, dontCare)) {
 
@@ -2561,7 +2599,7 @@ bool OTME_too::update_notary(const std::string& id, PairedNode& node)
     String section = PAIRED_SECTION_PREFIX;
     String key = std::to_string(std::get<0>(node)).c_str();
     section.Concatenate(key);
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
 
     const bool set =
         config_.Set_str(section, NOTARY_ID_KEY, String(id), dontCare);
@@ -2578,7 +2616,7 @@ bool OTME_too::update_nym_revision(
     const std::string& nymID,
     const std::string& server) const
 {
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
 
     auto nym = wallet_.Nym(Identifier(nymID));
 
@@ -2692,7 +2730,7 @@ bool OTME_too::write_contact_data(const Lock& lock)
 {
     OT_ASSERT(verify_lock(lock, contact_lock_));
 
-    std::lock_guard<std::recursive_mutex> apiLock(api_lock_);
+    std::lock_guard<RecursiveMutex> apiLock(api_lock_);
     bool dontCare = false;
 
     if (!config_.Set_long(
@@ -54,6 +54,15 @@ void OTMessageBuffer::Push(std::shared_ptr<Message> theMessage)
     messages_.push_back(theMessage);
 }
 
+void OTMessageBuffer::Clear(const String& strNotaryID, const String& strNymID)
+{
+    messages_.remove_if([&](const std::shared_ptr<Message>& pMsg) {
+        return (nullptr == pMsg) ||
+               (strNotaryID.Compare(pMsg->m_strNotaryID) &&
+                strNymID.Compare(pMsg->m_strNymID));
+    });
+}
+
 // **YOU** are responsible to delete the OTMessage object.
 // once you receive the pointer that comes back from this function.
 //
@@ -522,7 +522,7 @@ OT_API::OT_API(
     Storage& storage,
     Wallet& wallet,
     ZMQ& zmq,
-    std::recursive_mutex& lock)
+    RecursiveMutex& lock)
     : config_(config)
     , identity_(identity)
     , storage_(storage)
@@ -647,7 +647,7 @@ bool OT_API::Cleanup()
 // Get
 bool OT_API::GetWalletFilename(String& strPath) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (m_strWalletFilename.Exists()) {
         strPath = m_strWalletFilename;
@@ -661,7 +661,7 @@ bool OT_API::GetWalletFilename(String& strPath) const
 // Set
 bool OT_API::SetWalletFilename(const String& strPath)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (strPath.Exists()) {
         m_strWalletFilename = strPath;
@@ -674,7 +674,7 @@ bool OT_API::SetWalletFilename(const String& strPath)
 //
 bool OT_API::LoadConfigFile()
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     // LOG LEVEL
     {
@@ -782,7 +782,7 @@ bool OT_API::LoadConfigFile()
 
 bool OT_API::SetWallet(const String& strFilename)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     {
         bool bExists = strFilename.Exists();
@@ -838,14 +838,14 @@ bool OT_API::SetWallet(const String& strFilename)
 
 bool OT_API::WalletExists() const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     return (nullptr != m_pWallet) ? true : false;
 }
 
 bool OT_API::LoadWallet() const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OT_ASSERT_MSG(
         m_bDefaultStore,
@@ -876,7 +876,7 @@ bool OT_API::LoadWallet() const
 
 int32_t OT_API::GetNymCount() const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -887,7 +887,7 @@ int32_t OT_API::GetNymCount() const
 
 int32_t OT_API::GetAccountCount() const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -898,7 +898,7 @@ int32_t OT_API::GetAccountCount() const
 
 bool OT_API::GetNym(int32_t iIndex, Identifier& NYM_ID, String& NYM_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -910,7 +910,7 @@ bool OT_API::GetNym(int32_t iIndex, Identifier& NYM_ID, String& NYM_NAME) const
 bool OT_API::GetAccount(int32_t iIndex, Identifier& THE_ID, String& THE_NAME)
     const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -922,7 +922,7 @@ bool OT_API::GetAccount(int32_t iIndex, Identifier& THE_ID, String& THE_NAME)
 
 OTWallet* OT_API::GetWallet(const char* szFuncName) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const char* szFunc = (nullptr != szFuncName) ? szFuncName : __FUNCTION__;
     OTWallet* pWallet = m_pWallet;  // This is where we "get" the wallet.  :P
@@ -933,7 +933,7 @@ OTWallet* OT_API::GetWallet(const char* szFuncName) const
 
 Nym* OT_API::GetNym(const Identifier& NYM_ID, const char* szFunc) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": NYM_ID is empty!";
@@ -981,7 +981,7 @@ const BasketContract* OT_API::GetBasketContract(
 
 Account* OT_API::GetAccount(const Identifier& THE_ID, const char* szFunc) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet = GetWallet(nullptr != szFunc ? szFunc : __FUNCTION__);
     if (nullptr != pWallet) {
@@ -1003,7 +1003,7 @@ Nym* OT_API::GetNymByIDPartialMatch(
     const std::string PARTIAL_ID,
     const char* szFuncName) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const char* szFunc = (nullptr != szFuncName) ? szFuncName : __FUNCTION__;
     OTWallet* pWallet = GetWallet(szFunc);  // This logs and ASSERTs already.
@@ -1016,7 +1016,7 @@ Account* OT_API::GetAccountPartialMatch(
     const std::string PARTIAL_ID,
     const char* szFuncName) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const char* szFunc = (nullptr != szFuncName) ? szFuncName : __FUNCTION__;
     OTWallet* pWallet = GetWallet(szFunc);  // This logs and ASSERTs already.
@@ -1032,7 +1032,7 @@ Account* OT_API::GetAccountPartialMatch(
 //
 Nym* OT_API::CreateNym(const NymParameters& nymParameters) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -1077,7 +1077,7 @@ bool OT_API::IsNym_RegisteredAtServer(
  */
 bool OT_API::Wallet_ChangePassphrase() const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet = GetWallet(
         __FUNCTION__);  // This logs and ASSERTs already.
@@ -1122,7 +1122,7 @@ bool OT_API::Wallet_ChangePassphrase() const
 
 std::string OT_API::Wallet_GetPhrase()
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
 #if OT_CRYPTO_WITH_BIP32
     OTWallet* pWallet = GetWallet(
@@ -1152,7 +1152,7 @@ std::string OT_API::Wallet_GetPhrase()
 
 std::string OT_API::Wallet_GetSeed()
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
 #if OT_CRYPTO_WITH_BIP32
     OTWallet* pWallet = GetWallet(
@@ -1182,7 +1182,7 @@ std::string OT_API::Wallet_GetSeed()
 
 std::string OT_API::Wallet_GetWords()
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
 #if OT_CRYPTO_WITH_BIP39
     OTWallet* pWallet = GetWallet(
@@ -1214,7 +1214,7 @@ std::string OT_API::Wallet_ImportSeed(
     __attribute__((unused)) const OTPassword& words,
     __attribute__((unused)) const OTPassword& passphrase) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
 std::string output;
 #if OT_CRYPTO_WITH_BIP39
@@ -1232,7 +1232,7 @@ std::string output;
 
 bool OT_API::Wallet_CanRemoveServer(const Identifier& NOTARY_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NOTARY_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": Null: NOTARY_ID passed in!\n";
@@ -1294,7 +1294,7 @@ bool OT_API::Wallet_CanRemoveServer(const Identifier& NOTARY_ID) const
 bool OT_API::Wallet_CanRemoveAssetType(
     const Identifier& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (INSTRUMENT_DEFINITION_ID.IsEmpty()) {
         otErr << __FUNCTION__
@@ -1338,7 +1338,7 @@ bool OT_API::Wallet_CanRemoveAssetType(
 //
 bool OT_API::Wallet_CanRemoveNym(const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": Null: NYM_ID passed in!\n";
@@ -1411,7 +1411,7 @@ bool OT_API::Wallet_CanRemoveNym(const Identifier& NYM_ID) const
 //
 bool OT_API::Wallet_CanRemoveAccount(const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (ACCOUNT_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": Null: ACCOUNT_ID passed in!\n";
@@ -1472,7 +1472,7 @@ bool OT_API::Wallet_CanRemoveAccount(const Identifier& ACCOUNT_ID) const
 //
 bool OT_API::Wallet_RemoveNym(const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": Null: ACCOUNT_ID passed in!\n";
@@ -1521,7 +1521,7 @@ bool OT_API::Wallet_RemoveNym(const Identifier& NYM_ID) const
 // Returns bool on success, and strOutput will contain the exported data.
 bool OT_API::Wallet_ExportNym(const Identifier& NYM_ID, String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": NYM_ID is empty!";
@@ -1671,7 +1671,7 @@ bool OT_API::Wallet_ExportNym(const Identifier& NYM_ID, String& strOutput) const
 bool OT_API::Wallet_ImportNym(const String& FILE_CONTENTS, Identifier* pNymID)
     const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -2066,7 +2066,7 @@ bool OT_API::Encode(
     String& strOutput,
     bool bLineBreaks) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTASCIIArmor ascArmor;
     bool bSuccess = ascArmor.SetString(strPlaintext, bLineBreaks);  // encodes.
@@ -2098,7 +2098,7 @@ bool OT_API::Decode(
     String& strOutput,
     bool bLineBreaks) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTASCIIArmor ascArmor;
     const bool bLoadedArmor = OTASCIIArmor::LoadFromString(
@@ -2137,7 +2137,7 @@ bool OT_API::Encrypt(
     const String& strPlaintext,
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTPasswordData thePWData(OT_PW_DISPLAY);
     const Nym* pRecipientNym = GetOrLoadNym(
@@ -2189,7 +2189,7 @@ bool OT_API::Decrypt(
     const String& strCiphertext,
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pRecipientNym =
         GetOrLoadPrivateNym(theRecipientNymID, false, __FUNCTION__);
@@ -2224,7 +2224,7 @@ bool OT_API::FlatSign(
     const String& strContractType,
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(theSignerNymID, false, __FUNCTION__);
 
@@ -2267,7 +2267,7 @@ bool OT_API::SignContract(
     const String& strContract,
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(theSignerNymID, false, __FUNCTION__);
 
@@ -2326,7 +2326,7 @@ bool OT_API::AddSignature(
     const String& strContract,
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(theSignerNymID, false, __FUNCTION__);
 
@@ -2388,7 +2388,7 @@ bool OT_API::VerifySignature(
                                   // to clean it
                                   // up.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTPasswordData thePWData(OT_PW_DISPLAY);
     const Nym* pNym = GetOrLoadNym(
@@ -2475,7 +2475,7 @@ bool OT_API::VerifyAndRetrieveXMLContents(
     const Identifier& theSignerNymID,
     String& strOutput)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Contract* pContract = nullptr;
     const bool bSuccess =
@@ -2508,7 +2508,7 @@ bool OT_API::VerifyAccountReceipt(
     const Identifier& NYM_ID,
     const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -2533,7 +2533,7 @@ bool OT_API::Create_SmartContract(
                            // party.
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -2573,7 +2573,7 @@ bool OT_API::SmartContract_SetDates(
     time64_t VALID_TO,  // Default (0 or nullptr) == no expiry / cancel anytime.
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(        SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -2616,7 +2616,7 @@ bool OT_API::SmartContract_AddParty(
                                // party. Need Agent NAME.
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -2704,7 +2704,7 @@ bool OT_API::SmartContract_RemoveParty(
                                // contract. (And the scripts...)
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -2748,7 +2748,7 @@ bool OT_API::SmartContract_AddAccount(
                                              // Account.
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -2851,7 +2851,7 @@ bool OT_API::SmartContract_RemoveAccount(
                                // contract
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -2899,7 +2899,7 @@ int32_t OT_API::SmartContract_CountNumsNeeded(
                                      // this
                                      // party. Need Agent NAME.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     int32_t nReturnValue = 0;
     const std::string str_agent_name(AGENT_NAME.Get());
@@ -2932,7 +2932,7 @@ bool OT_API::SmartContract_ConfirmAccount(
     const String& ACCT_ID,
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3098,7 +3098,7 @@ bool OT_API::SmartContract_ConfirmAccount(
 
 bool OT_API::Smart_ArePartiesSpecified(const String& THE_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::unique_ptr<OTScriptable> pContract(
         OTScriptable::InstantiateScriptable(THE_CONTRACT));
@@ -3114,7 +3114,7 @@ bool OT_API::Smart_ArePartiesSpecified(const String& THE_CONTRACT) const
 
 bool OT_API::Smart_AreAssetTypesSpecified(const String& THE_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::unique_ptr<OTScriptable> pContract(
         OTScriptable::InstantiateScriptable(THE_CONTRACT));
@@ -3139,7 +3139,7 @@ bool OT_API::SmartContract_ConfirmParty(
                               // party.
                               // (For now, until I code entities)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -3260,7 +3260,7 @@ bool OT_API::SmartContract_AddBylaw(
                                // contract. (And the scripts...)
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const char* BYLAW_LANGUAGE = "chai";  // todo hardcoding.
     Nym* pNym = GetOrLoadPrivateNym(
@@ -3321,7 +3321,7 @@ bool OT_API::SmartContract_RemoveBylaw(
                                // contract. (And the scripts...)
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3369,7 +3369,7 @@ bool OT_API::SmartContract_AddHook(
                                 // same hook.)
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3430,7 +3430,7 @@ bool OT_API::SmartContract_RemoveHook(
                                 // same hook.)
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3487,7 +3487,7 @@ bool OT_API::SmartContract_AddCallback(
                                   // the callback. (Must exist.)
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3552,7 +3552,7 @@ bool OT_API::SmartContract_RemoveCallback(
                                   // smart contract. (And the scripts...)
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3607,7 +3607,7 @@ bool OT_API::SmartContract_AddClause(
     const String& SOURCE_CODE,  // The actual source code for the clause.
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3674,7 +3674,7 @@ bool OT_API::SmartContract_UpdateClause(
     const String& SOURCE_CODE,  // The actual source code for the clause.
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3729,7 +3729,7 @@ bool OT_API::SmartContract_RemoveClause(
                                 // contract. (And the scripts...)
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3791,7 +3791,7 @@ bool OT_API::SmartContract_AddVariable(
     // bool.
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3900,7 +3900,7 @@ bool OT_API::SmartContract_RemoveVariable(
                                // contract. (And the scripts...)
     String& strOutput) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SIGNER_NYM_ID, false, __FUNCTION__);
 
@@ -3951,7 +3951,7 @@ bool OT_API::SetNym_Alias(
     const Identifier& walletNymID,
     const String& name) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet = GetWallet(__FUNCTION__);
 
@@ -4006,7 +4006,7 @@ bool OT_API::Rename_Nym(
         return false;
     }
 
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet = GetWallet(__FUNCTION__);
 
@@ -4046,7 +4046,7 @@ bool OT_API::SetAccount_Name(
     const Identifier& SIGNER_NYM_ID,
     const String& ACCT_NEW_NAME) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -4088,7 +4088,7 @@ Nym* OT_API::LoadPrivateNym(
     const OTPasswordData* pPWData,
     const OTPassword* pImportPassword) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": NYM_ID is empty!";
@@ -4187,7 +4187,7 @@ bool OT_API::Msg_HarvestTransactionNumbers(
     bool bTransactionWasSuccess,        // false until positively asserted.
     bool bTransactionWasFailure) const  // false until positively asserted.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -4251,7 +4251,7 @@ bool OT_API::HarvestClosingNumbers(
     const Identifier& NYM_ID,
     const String& THE_CRON_ITEM) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -4306,7 +4306,7 @@ bool OT_API::HarvestAllNumbers(
     const Identifier& NYM_ID,
     const String& THE_CRON_ITEM) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -4356,7 +4356,7 @@ Nym* OT_API::GetOrLoadPrivateNym(
     const OTPasswordData* pPWData,
     const OTPassword* pImportPassword) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(szFuncName);  // This logs and ASSERTs already.
@@ -4382,7 +4382,7 @@ const Nym* OT_API::GetOrLoadNym(
     const char* szFuncName,
     const OTPasswordData* pPWData) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": NYM_ID is empty!";
@@ -4423,7 +4423,7 @@ const Nym* OT_API::reloadAndGetNym(
     const char* szFuncName,
     const OTPasswordData* pPWData) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": NYM_ID is empty!";
@@ -4463,7 +4463,7 @@ Nym* OT_API::reloadAndGetPrivateNym(
     const char* szFuncName,
     const OTPasswordData* pPWData) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (NYM_ID.IsEmpty()) {
         otErr << __FUNCTION__ << ": NYM_ID is empty!";
@@ -4514,7 +4514,7 @@ bool OT_API::AddClaim(
     const std::uint64_t end,
     const std::uint32_t) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::set<std::uint32_t> attribute;
 
@@ -4546,7 +4546,7 @@ Account* OT_API::GetOrLoadAccount(
     const Identifier& NOTARY_ID,
     const char* szFuncName) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const char* szFunc = (nullptr != szFuncName) ? szFuncName : __FUNCTION__;
     OTWallet* pWallet = GetWallet(szFunc);  // This logs and ASSERTs already.
@@ -4568,7 +4568,7 @@ Account* OT_API::GetOrLoadAccount(
     const Identifier& NOTARY_ID,
     const char* szFuncName) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const char* szFunc = (nullptr != szFuncName) ? szFuncName : __FUNCTION__;
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, szFunc);
@@ -4598,7 +4598,7 @@ Cheque* OT_API::WriteCheque(
     const String& CHEQUE_MEMO,
     const Identifier* pRECIPIENT_NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SENDER_NYM_ID, false, __FUNCTION__);
 
@@ -4951,7 +4951,7 @@ bool OT_API::ConfirmPaymentPlan(
     const Identifier& RECIPIENT_NYM_ID,
     OTPaymentPlan& thePlan) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(SENDER_NYM_ID, false, __FUNCTION__);
 
@@ -5046,7 +5046,7 @@ Purse* OT_API::LoadPurse(
     const Identifier& NYM_ID,
     const String* pstrDisplay) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const String strReason(
         (nullptr == pstrDisplay) ? "Loading purse from local storage."
@@ -5091,7 +5091,7 @@ bool OT_API::SavePurse(
     const Identifier& NYM_ID,
     Purse& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (THE_PURSE.IsPasswordProtected()) {
         otOut << __FUNCTION__
@@ -5128,7 +5128,7 @@ Purse* OT_API::CreatePurse(
     const Identifier& INSTRUMENT_DEFINITION_ID,
     const Identifier& OWNER_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Purse* pPurse = new Purse(NOTARY_ID, INSTRUMENT_DEFINITION_ID, OWNER_ID);
     OT_ASSERT_MSG(
@@ -5151,7 +5151,7 @@ Purse* OT_API::CreatePurse_Passphrase(
     const Identifier& NOTARY_ID,
     const Identifier& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Purse* pPurse = new Purse(NOTARY_ID, INSTRUMENT_DEFINITION_ID);
     OT_ASSERT_MSG(
@@ -5194,7 +5194,7 @@ OTNym_or_SymmetricKey* OT_API::LoadPurseAndOwnerFromString(
                                        // already
     const String* pstrDisplay2) const  // for password-protected purses
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const bool bDoesOwnerIDExist =
         (nullptr !=
@@ -5349,7 +5349,7 @@ OTNym_or_SymmetricKey* OT_API::LoadPurseAndOwnerForMerge(
                                   // failing.
     const String* pstrDisplay) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTPasswordData thePWData(
         (nullptr == pstrDisplay) ? OT_PW_DISPLAY : pstrDisplay->Get());
@@ -5491,7 +5491,7 @@ Token* OT_API::Purse_Peek(
     // to decrypt the token.)
     const String* pstrDisplay) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const String strReason1(
         (nullptr == pstrDisplay)
@@ -5582,7 +5582,7 @@ Purse* OT_API::Purse_Pop(
     // to decrypt the token.)
     const String* pstrDisplay) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const String strReason1(
         (nullptr == pstrDisplay)
@@ -5658,7 +5658,7 @@ Purse* OT_API::Purse_Empty(
     const String& THE_PURSE,
     const String* pstrDisplay) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const String strReason(
         (nullptr == pstrDisplay) ? "Making an empty copy of a cash purse."
@@ -5704,7 +5704,7 @@ Purse* OT_API::Purse_Push(
     // to encrypt the token.)
     const String* pstrDisplay) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const String strReason1(
         (nullptr == pstrDisplay)
@@ -5801,7 +5801,7 @@ bool OT_API::Wallet_ImportPurse(
     const String& THE_PURSE,
     const String* pstrDisplay)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String strPurseReason(
         (nullptr == pstrDisplay) ? "Enter passphrase for purse being imported."
@@ -5947,7 +5947,7 @@ Token* OT_API::Token_ChangeOwner(
     const String& NEW_OWNER,  // Pass a NymID here, or a purse.
     const String* pstrDisplay) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String strWalletReason(
         (nullptr == pstrDisplay)
@@ -6115,7 +6115,7 @@ Mint* OT_API::LoadMint(
     const Identifier& NOTARY_ID,
     const Identifier& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     const String strNotaryID(NOTARY_ID);
     const String strInstrumentDefinitionID(INSTRUMENT_DEFINITION_ID);
@@ -6164,7 +6164,7 @@ Account* OT_API::LoadAssetAccount(
     const Identifier& NYM_ID,
     const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -6186,7 +6186,7 @@ Ledger* OT_API::LoadNymbox(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6226,7 +6226,7 @@ Ledger* OT_API::LoadNymboxNoVerify(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6261,7 +6261,7 @@ Ledger* OT_API::LoadInbox(
     const Identifier& NYM_ID,
     const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6304,7 +6304,7 @@ Ledger* OT_API::LoadInboxNoVerify(
     const Identifier& NYM_ID,
     const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6340,7 +6340,7 @@ Ledger* OT_API::LoadOutbox(
     const Identifier& NYM_ID,
     const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6387,7 +6387,7 @@ Ledger* OT_API::LoadOutboxNoVerify(
     const Identifier& NYM_ID,
     const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6421,7 +6421,7 @@ Ledger* OT_API::LoadPaymentInbox(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6452,7 +6452,7 @@ Ledger* OT_API::LoadPaymentInboxNoVerify(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6486,7 +6486,7 @@ Ledger* OT_API::LoadRecordBox(
     const Identifier& NYM_ID,
     const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6524,7 +6524,7 @@ Ledger* OT_API::LoadRecordBoxNoVerify(
     const Identifier& NYM_ID,
     const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6558,7 +6558,7 @@ Ledger* OT_API::LoadExpiredBox(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6595,7 +6595,7 @@ Ledger* OT_API::LoadExpiredBoxNoVerify(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6630,7 +6630,7 @@ bool OT_API::ClearExpired(
     bool bClearAll) const  // if true, nIndex is
                            // ignored.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -6894,7 +6894,7 @@ bool OT_API::RecordPayment(
                      // outpayments box) and moves to record box.
     bool bSaveCopy) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -8170,7 +8170,7 @@ bool OT_API::ClearRecord(
     int32_t nIndex,
     bool bClearAll) const  // if true, nIndex is ignored.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -8253,7 +8253,7 @@ bool OT_API::ResyncNymWithServer(
     const Ledger& theNymbox,
     const Nym& theMessageNym) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (Ledger::nymbox != theNymbox.GetType()) {
         otErr << "OT_API::ResyncNymWithServer: Error: Expected a Nymbox, "
@@ -8295,7 +8295,7 @@ std::shared_ptr<Message> OT_API::PopMessageBuffer(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OT_ASSERT_MSG((m_pClient != nullptr),
         "Not initialized; call OT_API::Init first.");
@@ -8313,7 +8313,7 @@ std::shared_ptr<Message> OT_API::PopMessageBuffer(
 
 void OT_API::FlushMessageBuffer()
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OT_ASSERT_MSG((m_pClient != nullptr),
         "Not initialized; call OT_API::Init first.");
@@ -8321,6 +8321,19 @@ void OT_API::FlushMessageBuffer()
     m_pClient->GetMessageBuffer().Clear();
 }
 
+void OT_API::FlushMessageBuffer(const Identifier& NOTARY_ID,
+                                const Identifier& NYM_ID)
+{
+    std::lock_guard<RecursiveMutex> lock(lock_);
+
+    OT_ASSERT_MSG((m_pClient != nullptr),
+        "Not initialized; call OT_API::Init first.");
+
+    const String strNotaryID(NOTARY_ID), strNymID(NYM_ID);
+
+    m_pClient->GetMessageBuffer().Clear(strNotaryID, strNymID);
+}
+
 // OUTOING MESSSAGES
 
 // NOTE: Currently it just stores ALL sent messages, if they were sent (as far
@@ -8340,7 +8353,7 @@ Message* OT_API::GetSentMessage(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OT_ASSERT_MSG((m_pClient != nullptr),
         "Not initialized; call OT_API::Init first.");
@@ -8359,7 +8372,7 @@ bool OT_API::RemoveSentMessage(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OT_ASSERT_MSG(m_pClient != nullptr,
         "Not initialized; call OT_API::Init first.");
@@ -8442,7 +8455,7 @@ void OT_API::FlushSentMessages(
     const Identifier& NYM_ID,
     const Ledger& THE_NYMBOX) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
     Nym* pNym = GetNym(NYM_ID, __FUNCTION__);  // This logs and ASSERTs already.
     if (nullptr == pNym) return;
     // Below this point, pNym is a good ptr, and will be cleaned up
@@ -8544,7 +8557,7 @@ bool OT_API::HaveAlreadySeenReply(
 bool OT_API::IsBasketCurrency(const Identifier& BASKET_INSTRUMENT_DEFINITION_ID)
     const  // returns true or false.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String contractID(BASKET_INSTRUMENT_DEFINITION_ID);
 
@@ -8567,7 +8580,7 @@ bool OT_API::IsBasketCurrency(const Identifier& BASKET_INSTRUMENT_DEFINITION_ID)
 int32_t OT_API::GetBasketMemberCount(
     const Identifier& BASKET_INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String contractID(BASKET_INSTRUMENT_DEFINITION_ID);
     std::shared_ptr<proto::UnitDefinition> serialized;
@@ -8595,7 +8608,7 @@ bool OT_API::GetBasketMemberType(
     int32_t nIndex,
     Identifier& theOutputMemberType) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String contractID(BASKET_INSTRUMENT_DEFINITION_ID);
     std::shared_ptr<proto::UnitDefinition> serialized;
@@ -8632,7 +8645,7 @@ int64_t OT_API::GetBasketMemberMinimumTransferAmount(
     const Identifier& BASKET_INSTRUMENT_DEFINITION_ID,
     int32_t nIndex) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String contractID(BASKET_INSTRUMENT_DEFINITION_ID);
     std::shared_ptr<proto::UnitDefinition> serialized;
@@ -8663,7 +8676,7 @@ int64_t OT_API::GetBasketMemberMinimumTransferAmount(
 int64_t OT_API::GetBasketMinimumTransferAmount(
     const Identifier& BASKET_INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     String contractID(BASKET_INSTRUMENT_DEFINITION_ID);
     std::shared_ptr<proto::UnitDefinition> serialized;
@@ -8688,7 +8701,7 @@ bool OT_API::AddBasketCreationItem(
     const String& currencyID,
     const uint64_t weight) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     auto item = basketTemplate.mutable_basket()->add_item();
 
@@ -8712,7 +8725,7 @@ int32_t OT_API::issueBasket(
     const Identifier& NYM_ID,
     const proto::UnitDefinition& basket) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -8783,7 +8796,7 @@ Basket* OT_API::GenerateBasketExchange(
     const Identifier& BASKET_ASSET_ACCT_ID,
     int32_t TRANSFER_MULTIPLE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -8870,7 +8883,7 @@ bool OT_API::AddBasketExchangeItem(
     const Identifier& INSTRUMENT_DEFINITION_ID,
     const Identifier& ASSET_ACCT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -9059,7 +9072,7 @@ int32_t OT_API::exchangeBasket(
     bool bExchangeInOrOut  // exchanging in == true, out == false.
     ) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -9283,7 +9296,7 @@ int32_t OT_API::getTransactionNumbers(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -9338,7 +9351,7 @@ int32_t OT_API::notarizeWithdrawal(
     const Identifier& ACCT_ID,
     const int64_t& AMOUNT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTWallet* pWallet =
         GetWallet(__FUNCTION__);  // This logs and ASSERTs already.
@@ -9597,7 +9610,7 @@ int32_t OT_API::notarizeDeposit(
     const Identifier& ACCT_ID,
     const String& THE_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     // Request the server to accept some digital cash and
     // deposit it to an asset account.
@@ -9893,7 +9906,7 @@ int32_t OT_API::payDividend(
 // SHARE (multiplied by total number of
 // shares issued.)
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(ISSUER_NYM_ID, false, __FUNCTION__);
 
@@ -10213,7 +10226,7 @@ int32_t OT_API::withdrawVoucher(
     const String& CHEQUE_MEMO,
     const int64_t& AMOUNT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -10455,7 +10468,7 @@ bool OT_API::DiscardCheque(
     const Identifier& ACCT_ID,
     const String& THE_CHEQUE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -10533,7 +10546,7 @@ int32_t OT_API::depositCheque(
     const Identifier& ACCT_ID,
     const String& THE_CHEQUE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -10816,7 +10829,7 @@ int32_t OT_API::depositPaymentPlan(
     const Identifier& NYM_ID,
     const String& THE_PAYMENT_PLAN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -11003,7 +11016,7 @@ int32_t OT_API::triggerClause(
     const String& strClauseName,
     const String* pStrParam) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -11061,7 +11074,7 @@ int32_t OT_API::activateSmartContract(
     const Identifier& NYM_ID,
     const String& THE_SMART_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -11461,7 +11474,7 @@ int32_t OT_API::cancelCronItem(
 // can lookup the
 // offer in Cron.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -11620,7 +11633,7 @@ int32_t OT_API::issueMarketOffer(
     int64_t ACTIVATION_PRICE) const        // For stop orders, this is
                                            // threshhold price.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -11954,7 +11967,7 @@ int32_t OT_API::getMarketList(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12004,7 +12017,7 @@ int32_t OT_API::getMarketOffers(
     const Identifier& MARKET_ID,
     const int64_t& lDepth) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12061,7 +12074,7 @@ int32_t OT_API::getMarketRecentTrades(
     const Identifier& NYM_ID,
     const Identifier& MARKET_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12111,7 +12124,7 @@ int32_t OT_API::getNymMarketOffers(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12158,7 +12171,7 @@ int32_t OT_API::notarizeTransfer(
     const int64_t& AMOUNT,
     const String& NOTE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12349,7 +12362,7 @@ int32_t OT_API::notarizeTransfer(
 int32_t OT_API::getNymbox(const Identifier& NOTARY_ID, const Identifier& NYM_ID)
     const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12396,7 +12409,7 @@ int32_t OT_API::processNymbox(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12500,7 +12513,7 @@ int32_t OT_API::processInbox(
     const Identifier& ACCT_ID,
     const String& ACCT_LEDGER) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12571,7 +12584,7 @@ int32_t OT_API::registerInstrumentDefinition(
     const Identifier& NYM_ID,
     const String& THE_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
 
     // Upload a currency contract to the server and create
@@ -12642,7 +12655,7 @@ int32_t OT_API::getInstrumentDefinition(
     const Identifier& NYM_ID,
     const Identifier& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     // Grab the server's copy of any asset contract. Input is
     // the instrument definition ID.
@@ -12689,7 +12702,7 @@ int32_t OT_API::getMint(
     const Identifier& NYM_ID,
     const Identifier& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     // Grab the server's copy of any mint based on Instrument Definition Id.
     // (For
@@ -12753,7 +12766,7 @@ int32_t OT_API::queryInstrumentDefinitions(
     const Identifier& NYM_ID,
     const OTASCIIArmor& ENCODED_MAP) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12796,7 +12809,7 @@ int32_t OT_API::registerAccount(
     const Identifier& NYM_ID,
     const Identifier& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     // Create an asset account for a certain notaryID,
     // NymID, and Instrument Definition ID.
@@ -12856,7 +12869,7 @@ int32_t OT_API::deleteAssetAccount(
     const Identifier& NYM_ID,
     const Identifier& ACCOUNT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12907,7 +12920,7 @@ bool OT_API::DoesBoxReceiptExist(
     int32_t nBoxType,              // 0/nymbox, 1/inbox, 2/outbox
     const int64_t& lTransactionNum) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     // static
     return VerifyBoxReceiptExists(
@@ -12927,7 +12940,7 @@ int32_t OT_API::getBoxReceipt(
     int32_t nBoxType,              // 0/nymbox, 1/inbox, 2/outbox
     const int64_t& lTransactionNum) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -12982,12 +12995,75 @@ int32_t OT_API::getBoxReceipt(
     return static_cast<int32_t>(lRequestNumber);
 }
 
+int32_t OT_API::getBoxReceipts(
+    const Identifier& NOTARY_ID,
+    const Identifier& NYM_ID,
+    const Identifier& ACCOUNT_ID,  // If for Nymbox (vs inbox/outbox) then pass
+                                   // NYM_ID in this field also.
+    int32_t nBoxType,              // 0/nymbox, 1/inbox, 2/outbox
+    const NumList& transactionNums) const
+{
+    std::lock_guard<RecursiveMutex> lock(lock_);
+
+    Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
+
+    if (nullptr == pNym) { return (-1); }
+
+    if (NYM_ID != ACCOUNT_ID)  // inbox/outbox (if it were nymbox, the NYM_ID
+                               // and ACCOUNT_ID would match)
+    {
+        Account* pAccount =
+            GetOrLoadAccount(*pNym, ACCOUNT_ID, NOTARY_ID, __FUNCTION__);
+        if (nullptr == pAccount) return (-1);
+    }
+
+    String strTransactionNums;
+
+    // Notaries which have this command also parse ranges.
+    if ((0 == transactionNums.Count()) ||
+        !transactionNums.Output(strTransactionNums, true)) {
+        otErr << __FUNCTION__ << ": No transaction numbers to request.\n";
+        return (-1);
+    }
+
+    Message theMessage;
+    const String strNotaryID(NOTARY_ID), strNymID(NYM_ID), strAcctID(ACCOUNT_ID);
+    auto context =
+        OT::App().Contract().mutable_ServerContext(NYM_ID, NOTARY_ID);
+
+    // (0) Set up the REQUEST NUMBER and then INCREMENT IT
+    auto lRequestNumber = context.It().Request();
+    theMessage.m_strRequestNum.Format("%" PRId64, lRequestNumber);
+    context.It().IncrementRequest();
+
+    // (1) set up member variables
+    theMessage.m_strCommand = "getBoxReceipts";
+    theMessage.m_strNymID = strNymID;
+    theMessage.m_strNotaryID = strNotaryID;
+    theMessage.SetAcknowledgments(context.It());
+    theMessage.m_strAcctID = strAcctID;
+    theMessage.m_lDepth = static_cast<int64_t>(nBoxType);
+    theMessage.m_ascPayload.SetString(strTransactionNums);
+
+    // (2) Sign the Message
+    theMessage.SignContract(*pNym);
+
+    // (3) Save the Message (with signatures and all, back to its internal
+    // member m_strRawFile.)
+    theMessage.SaveContract();
+
+    // (Send it)
+    SendMessage(NOTARY_ID, pNym, theMessage);
+
+    return static_cast<int32_t>(lRequestNumber);
+}
+
 int32_t OT_API::getAccountData(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID,
     const Identifier& ACCT_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13018,6 +13094,22 @@ int32_t OT_API::getAccountData(
     theMessage.SetAcknowledgments(context.It());
     theMessage.m_strAcctID = strAcctID;
 
+    // Tell the server which boxes we already have, so it can leave them out
+    // of the reply if they haven't changed.
+    Identifier theHash;
+
+    if (OTDB::Exists(
+            OTFolders::Inbox().Get(), strNotaryID.Get(), strAcctID.Get()) &&
+        pNym->GetInboxHash(strAcctID.Get(), theHash)) {
+        theHash.GetString(theMessage.m_strInboxHash);
+    }
+
+    if (OTDB::Exists(
+            OTFolders::Outbox().Get(), strNotaryID.Get(), strAcctID.Get()) &&
+        pNym->GetOutboxHash(strAcctID.Get(), theHash)) {
+        theHash.GetString(theMessage.m_strOutboxHash);
+    }
+
     // (2) Sign the Message
     theMessage.SignContract(*pNym);
 
@@ -13035,7 +13127,7 @@ int32_t OT_API::getRequestNumber(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13069,7 +13161,7 @@ int32_t OT_API::usageCredits(
     const Identifier& NYM_ID_CHECK,
     int64_t lAdjustment) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13116,7 +13208,7 @@ int32_t OT_API::checkNym(
     const Identifier& NYM_ID,
     const Identifier& NYM_ID_CHECK) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     // Request a user's public key based on Nym ID included with
     // the request.
@@ -13170,7 +13262,7 @@ int32_t OT_API::sendNymMessage(
     const Identifier& NYM_ID_RECIPIENT,
     const String& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     int32_t nReturnValue = -1;
 
@@ -13231,7 +13323,7 @@ int32_t OT_API::registerContract(
     const ContractType TYPE,
     const Identifier& CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13324,7 +13416,7 @@ int32_t OT_API::sendNymObject(
     const PeerObject& OBJECT,
     int64_t& requestNumber) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13422,7 +13514,7 @@ int32_t OT_API::sendNymInstrument(
 // can retrieve those tokens if
 // he needs to.
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13632,7 +13724,7 @@ int32_t OT_API::registerNym(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13665,7 +13757,7 @@ int32_t OT_API::unregisterNym(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13698,7 +13790,7 @@ int32_t OT_API::pingNotary(
     const Identifier& NOTARY_ID,
     const Identifier& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13733,11 +13825,15 @@ SendResult OT_API::SendMessage(
     Nym* nym,
     Message& message) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     m_pClient->QueueOutgoingMessage(message);
     auto& connection = zeromq_.Server(String(server).Get());
+    // The connection serializes its own sockets, so other API calls may run
+    // while this thread waits for the server to reply.
+    const auto depth = lock_.Release();
     auto result = connection.Send(message);
+    lock_.Reacquire(depth);
 
     if (SendResult::HAVE_REPLY == result.first) {
         m_pClient->processServerReply(
@@ -13753,7 +13849,7 @@ int32_t OT_API::initiatePeerRequest(
     const Identifier& server,
     std::unique_ptr<PeerRequest>& request) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     int64_t notUsed = 0;
     int32_t output = -1;
@@ -13804,7 +13900,7 @@ std::int32_t OT_API::initiatePeerReply(
     const Identifier& request,
     std::unique_ptr<PeerReply>& reply) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::int64_t notUsed = 0;
     std::int32_t output = -1;
@@ -13876,7 +13972,7 @@ int32_t OT_API::requestAdmin(
     const Identifier& NYM_ID,
     const std::string& PASSWORD) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(NYM_ID, false, __FUNCTION__);
 
@@ -13920,7 +14016,7 @@ int32_t OT_API::serverAddClaim(
     const std::string& value,
     const bool primary) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Nym* pNym = GetOrLoadPrivateNym(nym, false, __FUNCTION__);
 
@@ -13969,7 +14065,7 @@ std::string OT_API::AddChildKeyCredential(
     const Identifier& masterID,
     const NymParameters& nymParameters) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string output;
     Nym* nym = GetOrLoadPrivateNym(nymID, false, __FUNCTION__);
@@ -13984,7 +14080,7 @@ std::string OT_API::AddChildKeyCredential(
 std::unique_ptr<proto::ContactData> OT_API::GetContactData(
     const Identifier& nymID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::unique_ptr<proto::ContactData> output;
     OTPasswordData thePWData(OT_PW_DISPLAY);
@@ -69,7 +69,7 @@
 namespace opentxs
 {
 
-OT_ME::OT_ME(std::recursive_mutex& lock, MadeEasy& madeEasy)
+OT_ME::OT_ME(RecursiveMutex& lock, MadeEasy& madeEasy)
     : lock_(lock)
     , made_easy_(madeEasy)
 {
@@ -85,7 +85,7 @@ bool OT_ME::make_sure_enough_trans_nums(
     const std::string& strMyNotaryID,
     const std::string& strMyNymID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     Utility MsgUtil;
     bool bReturnVal = true;
@@ -138,7 +138,7 @@ std::string OT_ME::notify_bailment(
     const std::string& INSTRUMENT_DEFINITION_ID,
     const std::string& TXID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         NOTIFY_BAILMENT,
@@ -165,7 +165,7 @@ std::string OT_ME::initiate_bailment(
     const std::string& TARGET_NYM_ID,
     const std::string& INSTRUMENT_DEFINITION_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         INITIATE_BAILMENT,
@@ -193,7 +193,7 @@ std::string OT_ME::initiate_outbailment(
     const std::int64_t& AMOUNT,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         INITIATE_OUTBAILMENT,
@@ -220,7 +220,7 @@ std::string OT_ME::request_connection(
     const std::string& TARGET_NYM_ID,
     const std::int64_t TYPE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         REQUEST_CONNECTION, NOTARY_ID, NYM_ID, TARGET_NYM_ID, TYPE);
@@ -243,7 +243,7 @@ std::string OT_ME::store_secret(
     const std::string& PRIMARY,
     const std::string& SECONDARY) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         STORE_SECRET,
@@ -272,7 +272,7 @@ std::string OT_ME::acknowledge_bailment(
     const std::string& REQUEST_ID,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         ACKNOWLEDGE_BAILMENT,
@@ -302,7 +302,7 @@ std::string OT_ME::acknowledge_outbailment(
     const std::string& REQUEST_ID,
     const std::string& THE_MESSAGE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         ACKNOWLEDGE_OUTBAILMENT,
@@ -332,7 +332,7 @@ std::string OT_ME::acknowledge_notice(
     const std::string& REQUEST_ID,
     const bool ACK) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         ACKNOWLEDGE_NOTICE, NOTARY_ID, NYM_ID, TARGET_NYM_ID, REQUEST_ID, ACK);
@@ -361,7 +361,7 @@ std::string OT_ME::acknowledge_connection(
     const std::string& PASSWORD,
     const std::string& KEY) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         ACKNOWLEDGE_CONNECTION,
@@ -392,7 +392,7 @@ std::string OT_ME::register_contract_nym(
     const std::string& NYM_ID,
     const std::string& CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(REGISTER_CONTRACT_NYM, NOTARY_ID, NYM_ID, CONTRACT);
     std::string strResponse =
@@ -411,7 +411,7 @@ std::string OT_ME::register_contract_server(
     const std::string& NYM_ID,
     const std::string& CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         REGISTER_CONTRACT_SERVER, NOTARY_ID, NYM_ID, CONTRACT);
@@ -431,7 +431,7 @@ std::string OT_ME::register_contract_unit(
     const std::string& NYM_ID,
     const std::string& CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(REGISTER_CONTRACT_UNIT, NOTARY_ID, NYM_ID, CONTRACT);
     std::string strResponse =
@@ -451,7 +451,7 @@ std::string OT_ME::register_nym(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(REGISTER_NYM, NOTARY_ID, NYM_ID);
     std::string strResponse =
@@ -482,7 +482,7 @@ std::string OT_ME::request_admin(
     const std::string& NYM_ID,
     const std::string& PASSWORD) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(REQUEST_ADMIN, NOTARY_ID, NYM_ID, PASSWORD);
     std::string strResponse =
@@ -504,7 +504,7 @@ std::string OT_ME::server_add_claim(
     const std::string& VALUE,
     const bool PRIMARY) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func theRequest(
         SERVER_ADD_CLAIM, NOTARY_ID, NYM_ID, PRIMARY, SECTION, TYPE, VALUE);
@@ -690,7 +690,7 @@ bool OT_ME::accept_inbox_items(
     std::int32_t nItemType,
     const std::string& INDICES) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     switch (nItemType) {
         case 0: {
@@ -721,7 +721,7 @@ bool OT_ME::discard_incoming_payments(
     const std::string& NYM_ID,
     const std::string& INDICES) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     CmdDiscard discard;
     return 1 == discard.run(NOTARY_ID, NYM_ID, INDICES);
@@ -732,7 +732,7 @@ bool OT_ME::cancel_outgoing_payments(
     const std::string& ACCOUNT_ID,
     const std::string& INDICES) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     CmdCancel cancel;
     return 1 == cancel.run(NYM_ID, ACCOUNT_ID, INDICES);
@@ -743,7 +743,7 @@ bool OT_ME::accept_from_paymentbox(
     const std::string& INDICES,
     const std::string& PAYMENT_TYPE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     CmdAcceptPayments cmd;
     return 1 == cmd.acceptFromPaymentbox(ACCOUNT_ID, INDICES, PAYMENT_TYPE);
@@ -755,7 +755,7 @@ bool OT_ME::accept_from_paymentbox_overload(
     const std::string& PAYMENT_TYPE,
     std::string* pOptionalOutput /*=nullptr*/) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     CmdAcceptPayments cmd;
     return 1 ==
@@ -861,7 +861,7 @@ std::string OT_ME::send_user_payment(
     const std::string& RECIPIENT_NYM_ID,
     const std::string& THE_PAYMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string strRecipientPubkey =
         load_or_retrieve_encrypt_key(NOTARY_ID, NYM_ID, RECIPIENT_NYM_ID);
@@ -887,7 +887,7 @@ std::string OT_ME::send_user_cash(
     const std::string& THE_PAYMENT,
     const std::string& SENDERS_COPY) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string strRecipientPubkey =
         load_or_retrieve_encrypt_key(NOTARY_ID, NYM_ID, RECIPIENT_NYM_ID);
@@ -913,7 +913,7 @@ bool OT_ME::withdraw_and_send_cash(
     const std::string& RECIPIENT_NYM_ID,
     std::int64_t AMOUNT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     CmdSendCash sendCash;
     return 1 ==
@@ -936,7 +936,7 @@ std::string OT_ME::get_payment_instrument(
     std::int32_t nIndex,
     const std::string& PRELOADED_INBOX) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string strInstrument;
     std::string strInbox =
@@ -990,7 +990,7 @@ std::string OT_ME::get_box_receipt(
     std::int32_t nBoxType,
     std::int64_t TRANS_NUM) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(
         GET_BOX_RECEIPT,
@@ -1047,7 +1047,7 @@ std::string OT_ME::create_market_offer(
     const std::string& STOP_SIGN,
     std::int64_t ACTIVATION_PRICE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string strNotaryID =
         OTAPI_Wrap::GetAccountWallet_NotaryID(ASSET_ACCT_ID);
@@ -1084,7 +1084,7 @@ std::string OT_ME::kill_market_offer(
     const std::string& ASSET_ACCT_ID,
     std::int64_t TRANS_NUM) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(
         KILL_MARKET_OFFER,
@@ -1103,7 +1103,7 @@ std::string OT_ME::kill_payment_plan(
     const std::string& ACCT_ID,
     std::int64_t TRANS_NUM) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(
         KILL_PAYMENT_PLAN,
@@ -1121,7 +1121,7 @@ std::string OT_ME::cancel_payment_plan(
     const std::string& NYM_ID,
     const std::string& THE_PAYMENT_PLAN) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     // NOTE: We have to include the account ID as well. Even though the API call
     // itself doesn't need it (it retrieves it from the plan itself, as we are
@@ -1163,7 +1163,7 @@ std::string OT_ME::activate_smart_contract(
     const std::string& AGENT_NAME,
     const std::string& THE_SMART_CONTRACT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(
         ACTIVATE_SMART_CONTRACT,
@@ -1184,7 +1184,7 @@ std::string OT_ME::trigger_clause(
     const std::string& CLAUSE_NAME,
     const std::string& STR_PARAM) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(
         TRIGGER_CLAUSE,
@@ -1204,7 +1204,7 @@ std::string OT_ME::withdraw_cash(
     const std::string& ACCT_ID,
     std::int64_t AMOUNT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(WITHDRAW_CASH, NOTARY_ID, NYM_ID, ACCT_ID, AMOUNT);
     return request.SendTransaction(request, "WITHDRAW_CASH");
@@ -1217,7 +1217,7 @@ std::string OT_ME::withdraw_cash(
 bool OT_ME::easy_withdraw_cash(const std::string& ACCT_ID, std::int64_t AMOUNT)
     const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     CmdWithdrawCash cmd;
     return 1 == cmd.withdrawCash(ACCT_ID, AMOUNT);
@@ -1234,7 +1234,7 @@ std::string OT_ME::export_cash(
     bool bPasswordProtected,
     std::string& STR_RETAINED_COPY) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::string to_nym_id = TO_NYM_ID;
     CmdExportCash cmd;
@@ -1258,7 +1258,7 @@ std::string OT_ME::withdraw_voucher(
     const std::string& STR_MEMO,
     std::int64_t AMOUNT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(
         WITHDRAW_VOUCHER,
@@ -1281,7 +1281,7 @@ std::string OT_ME::pay_dividend(
     const std::string& STR_MEMO,
     std::int64_t AMOUNT_PER_SHARE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(
         PAY_DIVIDEND,
@@ -1300,7 +1300,7 @@ std::string OT_ME::deposit_cheque(
     const std::string& ACCT_ID,
     const std::string& STR_CHEQUE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(DEPOSIT_CHEQUE, NOTARY_ID, NYM_ID, ACCT_ID, STR_CHEQUE);
     return request.SendTransaction(request, "DEPOSIT_CHEQUE");
@@ -1312,7 +1312,7 @@ bool OT_ME::deposit_cash(
     const std::string& ACCT_ID,
     const std::string& STR_PURSE) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     CmdDeposit cmd;
     return 1 == cmd.depositPurse(NOTARY_ID, ACCT_ID, NYM_ID, STR_PURSE, "");
@@ -1324,7 +1324,7 @@ bool OT_ME::deposit_local_purse(
     const std::string& ACCT_ID,
     const std::string& STR_INDICES) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     CmdDeposit cmd;
     return 1 == cmd.depositPurse(NOTARY_ID, ACCT_ID, NYM_ID, "", STR_INDICES);
@@ -1334,7 +1334,7 @@ std::string OT_ME::get_market_list(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(GET_MARKET_LIST, NOTARY_ID, NYM_ID);
     return request.SendRequest(request, "GET_MARKET_LIST");
@@ -1346,7 +1346,7 @@ std::string OT_ME::get_market_offers(
     const std::string& MARKET_ID,
     std::int64_t MAX_DEPTH) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(
         GET_MARKET_OFFERS, NOTARY_ID, NYM_ID, MARKET_ID, MAX_DEPTH);
@@ -1357,7 +1357,7 @@ std::string OT_ME::get_nym_market_offers(
     const std::string& NOTARY_ID,
     const std::string& NYM_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(GET_NYM_MARKET_OFFERS, NOTARY_ID, NYM_ID);
     return request.SendRequest(request, "GET_NYM_MARKET_OFFERS");
@@ -1368,7 +1368,7 @@ std::string OT_ME::get_market_recent_trades(
     const std::string& NYM_ID,
     const std::string& MARKET_ID) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(GET_MARKET_RECENT_TRADES, NOTARY_ID, NYM_ID, MARKET_ID);
     return request.SendRequest(request, "GET_MARKET_RECENT_TRADES");
@@ -1380,7 +1380,7 @@ std::string OT_ME::adjust_usage_credits(
     const std::string& TARGET_NYM_ID,
     const std::string& ADJUSTMENT) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     OTAPI_Func request(
         ADJUST_USAGE_CREDITS,
@@ -1393,7 +1393,7 @@ std::string OT_ME::adjust_usage_credits(
 
 int32_t OT_ME::VerifyMessageSuccess(const std::string& str_Message) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (str_Message.size() < 10) {
         otWarn << __FUNCTION__ << ": Error str_Message is: Too Short: \n"
@@ -1435,7 +1435,7 @@ int32_t OT_ME::VerifyMsgBalanceAgrmntSuccess(
     const std::string& ACCOUNT_ID,
     const std::string& str_Message) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (str_Message.size() < 10) {
         otWarn << __FUNCTION__ << ": Error str_Message is: Too Short: \n"
@@ -1478,7 +1478,7 @@ int32_t OT_ME::VerifyMsgTrnxSuccess(
     const std::string& ACCOUNT_ID,
     const std::string& str_Message) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     if (str_Message.size() < 10) {
         otWarn << __FUNCTION__ << ": Error str_Message is: Too Short: \n"
@@ -1526,7 +1526,7 @@ int32_t OT_ME::InterpretTransactionMsgReply(
     const std::string& str_Attempt,
     const std::string& str_Response) const
 {
-    std::lock_guard<std::recursive_mutex> lock(lock_);
+    std::lock_guard<RecursiveMutex> lock(lock_);
 
     std::int32_t nMessageSuccess = VerifyMessageSuccess(str_Response);
 
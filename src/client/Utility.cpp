@@ -44,6 +44,7 @@
 
 #include <stdint.h>
 #include <ostream>
+#include <set>
 #include <string>
 
 namespace opentxs
@@ -360,7 +361,7 @@ OT_UTILITY_OT int32_t Utility::getNymboxLowLevel(const string& notaryID,
 {
     string strLocation = "Utility::getNymboxLowLevel";
 
-    OTAPI_Wrap::FlushMessageBuffer();
+    OTAPI_Wrap::FlushMessageBuffer(notaryID, nymID);
     bWasSent = false;
 
     int32_t nRequestNum = OTAPI_Wrap::getNymbox(
@@ -1582,7 +1583,7 @@ OT_UTILITY_OT int32_t Utility::sendProcessNymboxLowLevel(
     string strLocation = "Utility::sendProcessNymboxLowLevel";
 
     // Send message..
-    OTAPI_Wrap::FlushMessageBuffer();
+    OTAPI_Wrap::FlushMessageBuffer(notaryID, nymID);
 
     int32_t nRequestNum = OTAPI_Wrap::processNymbox(notaryID, nymID);
     if (-1 == nRequestNum) {
@@ -1694,7 +1695,7 @@ OT_UTILITY_OT int32_t
 {
     string strLocation = "Utility::getRequestNumber";
 
-    OTAPI_Wrap::FlushMessageBuffer();
+    OTAPI_Wrap::FlushMessageBuffer(notaryID, nymID);
 
     int32_t nResult = OTAPI_Wrap::getRequestNumber(notaryID, nymID);
 
@@ -1784,7 +1785,7 @@ OT_UTILITY_OT bool Utility::getBoxReceiptLowLevel(
 
     bWasSent = false;
 
-    OTAPI_Wrap::FlushMessageBuffer();
+    OTAPI_Wrap::FlushMessageBuffer(notaryID, nymID);
 
     int32_t nRequestNum = OTAPI_Wrap::getBoxReceipt(
         notaryID, nymID, accountID, nBoxType,
@@ -1901,6 +1902,125 @@ OT_UTILITY_OT bool Utility::getBoxReceiptWithErrorCorrection(
     return false;
 }
 
+// Requests several box receipts from the same box in one message. Returns true
+// if the server replied with success, meaning at least some of them were
+// received and saved.
+OT_UTILITY_OT bool Utility::getBoxReceiptsLowLevel(
+    const string& notaryID, const string& nymID, const string& accountID,
+    int32_t nBoxType, const std::set<int64_t>& transactionNums,
+    bool& bWasSent)
+{
+    string strLocation = "Utility::getBoxReceiptsLowLevel";
+
+    bWasSent = false;
+
+    string strTransactionNums;
+
+    for (const auto& lTransactionNum : transactionNums) {
+        if (!strTransactionNums.empty()) strTransactionNums += ",";
+
+        strTransactionNums += std::to_string(lTransactionNum);
+    }
+
+    OTAPI_Wrap::FlushMessageBuffer(notaryID, nymID);
+
+    int32_t nRequestNum = OTAPI_Wrap::getBoxReceipts(
+        notaryID, nymID, accountID, nBoxType, strTransactionNums);
+
+    if (OTAPI_Wrap::networkFailure()) {
+        otOut << strLocation
+              << ": getBoxReceipts message failed due to network error.\n";
+        return false;
+    }
+    if (0 >= nRequestNum) {
+        otOut << strLocation
+              << ": Failed to send getBoxReceipts message. Request number: "
+              << nRequestNum << "\n";
+        return false;
+    }
+
+    bWasSent = true;
+
+    int32_t nReturn =
+        receiveReplySuccessLowLevel(notaryID, nymID, nRequestNum, strLocation);
+    otWarn << strLocation << ": nRequestNum: " << nRequestNum
+           << " /  nReturn: " << nReturn << "\n";
+
+    if (OTAPI_Wrap::networkFailure()) {
+        otOut << strLocation
+              << ": Failed to receiveReplySuccessLowLevel due to network "
+                 "error.\n";
+        return false;
+    }
+
+    if (nReturn > 0) {
+        return true;
+    }
+
+    otOut << strLocation << ": Failure: Response from server:\n"
+          << getLastReplyReceived() << "\n";
+
+    return false;
+}
+
+// Downloads the box receipts for transactionNums using getBoxReceipts. The
+// server caps how many receipts go into one reply, so this keeps asking for
+// whatever is still missing for as long as each reply makes progress. Any
+// receipts the batches couldn't get (including when the server doesn't
+// support getBoxReceipts) are then downloaded one at a time.
+OT_UTILITY_OT bool Utility::getBoxReceiptsWithErrorCorrection(
+    const string& notaryID, const string& nymID, const string& accountID,
+    int32_t nBoxType, const std::set<int64_t>& transactionNums)
+{
+    string strLocation = "Utility::getBoxReceiptsWithErrorCorrection";
+
+    std::set<int64_t> setMissing(transactionNums);
+
+    // A single receipt is fetched with getBoxReceipt below.
+    while (1 < setMissing.size()) {
+        bool bWasSent = false;
+        bool bWasRequestSent = false;
+
+        if (!getBoxReceiptsLowLevel(notaryID, nymID, accountID, nBoxType,
+                                    setMissing, bWasSent)) {
+            // The request number might be out of sync. Re-sync and re-try.
+            if (!bWasSent ||
+                (1 != getRequestNumber(notaryID, nymID, bWasRequestSent)) ||
+                !bWasRequestSent ||
+                !getBoxReceiptsLowLevel(notaryID, nymID, accountID, nBoxType,
+                                        setMissing, bWasSent)) {
+                break;
+            }
+        }
+
+        std::set<int64_t> setStillMissing;
+
+        for (const auto& lTransactionNum : setMissing) {
+            if (!OTAPI_Wrap::DoesBoxReceiptExist(notaryID, nymID, accountID,
+                                                 nBoxType, lTransactionNum)) {
+                setStillMissing.insert(lTransactionNum);
+            }
+        }
+
+        if (setStillMissing.size() == setMissing.size()) break; // No progress.
+
+        setMissing.swap(setStillMissing);
+    }
+
+    for (const auto& lTransactionNum : setMissing) {
+        if (!getBoxReceiptWithErrorCorrection(notaryID, nymID, accountID,
+                                              nBoxType, lTransactionNum)) {
+            otOut << strLocation << ": Failed downloading box receipt. "
+                                    "(Skipping any others.) Transaction "
+                                    "number: " << lTransactionNum << "\n";
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
 // This function assumes you just downloaded the latest version of the box
 // (inbox, outbox, or nymbox)
 // and its job is to make sure all the related box receipts are downloaded as
@@ -1966,6 +2086,7 @@ OT_UTILITY_OT bool Utility::insureHaveAllBoxReceipts(
     // then we break out of the loop (without continuing on to try the rest.)
     //
     bool bReturnValue = true; // Assuming an empty box, we return success;
+    std::set<int64_t> setMissing;
 
     int32_t nReceiptCount =
         OTAPI_Wrap::Ledger_GetCount(notaryID, nymID, accountID, ledger);
@@ -2036,35 +2157,9 @@ OT_UTILITY_OT bool Utility::insureHaveAllBoxReceipts(
                                     notaryID, nymID, accountID, nBoxType,
                                     lTransactionNum);
                             if (!bHaveBoxReceipt) {
-                                otWarn << strLocation << ": Downloading box "
-                                                         "receipt to add to my "
-                                                         "collection...\n";
-
-                                bool bDownloaded =
-                                    getBoxReceiptWithErrorCorrection(
-                                        notaryID, nymID, accountID, nBoxType,
-                                        lTransactionNum);
-                                if (!bDownloaded) {
-                                    otOut
-                                        << strLocation
-                                        << ": Failed downloading box receipt. "
-                                           "(Skipping any others.) Transaction "
-                                           "number: " << lTransactionNum
-                                        << "\n";
-
-                                    bReturnValue = false;
-                                    break;
-                                    // No point continuing to loop and fail 500
-                                    // times, when
-                                    // getBoxReceiptWithErrorCorrection()
-                                    // already failed
-                                    // even doing the getRequestNumber() trick
-                                    // and
-                                    // everything, and whatever retries are
-                                    // inside OT, before it finally
-                                    // gave up.
-                                }
-                                // else (Download success.)
+                                // Downloaded below, together with the
+                                // others that are missing.
+                                setMissing.insert(lTransactionNum);
                             } // if (!bHaveBoxReceipt)
                         }
 
@@ -2086,6 +2181,18 @@ OT_UTILITY_OT bool Utility::insureHaveAllBoxReceipts(
         } // ************* FOR LOOP ******************
     }     // if (nReceiptCount > 0)
 
+    if (!setMissing.empty()) {
+        otWarn << strLocation << ": Downloading " << setMissing.size()
+               << " box receipts to add to my collection...\n";
+
+        // If this fails, there's no point trying the rest: it already did
+        // the getRequestNumber() trick and retried each receipt on its own.
+        if (!getBoxReceiptsWithErrorCorrection(notaryID, nymID, accountID,
+                                               nBoxType, setMissing)) {
+            bReturnValue = false;
+        }
+    }
+
     //
     // if nRequestSeeking is >0, that means the caller wants to know if there is
     // a receipt present for that request number.
@@ -2284,7 +2391,7 @@ OT_UTILITY_OT int32_t
 {
     string strLocation = "Utility::getTransactionNumLowLevel";
 
-    OTAPI_Wrap::FlushMessageBuffer();
+    OTAPI_Wrap::FlushMessageBuffer(notaryID, nymID);
     bWasSent = false;
 
     int32_t nRequestNum = OTAPI_Wrap::getTransactionNumbers(
@@ -2859,7 +2966,7 @@ OT_UTILITY_OT int32_t
     //
     // GET ACCOUNT
     //
-    OTAPI_Wrap::FlushMessageBuffer();
+    OTAPI_Wrap::FlushMessageBuffer(notaryID, nymID);
 
     int32_t nRequestNum = OTAPI_Wrap::getAccountData(
         notaryID, nymID, accountID); // <===== ATTEMPT TO SEND MESSAGE;
@@ -122,17 +122,7 @@ std::size_t ClientContext::IssuedNumbers(
 {
     Lock lock(lock_);
 
-    std::size_t output = 0;
-
-    for (const auto& number : issued_transaction_numbers_) {
-        const bool excluded = (1 == exclude.count(number));
-
-        if (!excluded) {
-            output++;
-        }
-    }
-
-    return output;
+    return issued_transaction_numbers_.difference(NumberSet(exclude)).size();
 }
 
 bool ClientContext::IssueNumber(const TransactionNumber& number)
@@ -185,10 +175,10 @@ bool ClientContext::Verify(
 {
     Lock lock(lock_);
 
-    std::set<TransactionNumber> effective = issued_transaction_numbers_;
+    NumberSet effective = issued_transaction_numbers_;
 
     for (const auto& number : included) {
-        const bool inserted = effective.insert(number).second;
+        const bool inserted = effective.insert(number);
 
         if (!inserted) {
             otOut << OT_METHOD << __FUNCTION__ << ": New transaction # "
@@ -217,32 +207,27 @@ bool ClientContext::Verify(
                << "the context. " << std::endl;
     }
 
+    if (effective == statement.Issued()) { return true; }
 
-    for (const auto& number : statement.Issued()) {
-        const bool found = (1 == effective.count(number));
+    const auto extra = statement.Issued().difference(effective);
 
-        if (!found) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
-                  << number << " from statement not found on context."
-                  << std::endl;
+    if (!extra.empty()) {
+        otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
+              << extra.front() << " from statement not found on context."
+              << std::endl;
 
-            return false;
-        }
+        return false;
     }
 
-    for (const auto& number : effective) {
-        const bool found = (1 == statement.Issued().count(number));
-
-        if (!found) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
-                  << number << " from context not found on statement."
-                  << std::endl;
+    const auto missing = effective.difference(statement.Issued());
 
-            return false;
-        }
+    if (!missing.empty()) {
+        otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
+              << missing.front() << " from context not found on statement."
+              << std::endl;
     }
 
-    return true;
+    return false;
 }
 
 bool ClientContext::VerifyCronItem(const TransactionNumber number) const
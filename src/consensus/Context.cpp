@@ -92,21 +92,23 @@ std::set<RequestNumber> Context::AcknowledgedNumbers() const
 {
     Lock lock(lock_);
 
-    return acknowledged_request_numbers_;
+    return std::set<RequestNumber>(
+        acknowledged_request_numbers_.begin(),
+        acknowledged_request_numbers_.end());
 }
 
 bool Context::AddAcknowledgedNumber(const RequestNumber req)
 {
     Lock lock(lock_);
 
-    auto output = acknowledged_request_numbers_.insert(req);
+    const bool output = acknowledged_request_numbers_.insert(req);
 
     while (OT_MAX_ACK_NUMS < acknowledged_request_numbers_.size()) {
         acknowledged_request_numbers_.erase(
-            acknowledged_request_numbers_.begin());
+            acknowledged_request_numbers_.front());
     }
 
-    return output.second;
+    return output;
 }
 
 std::size_t Context::AvailableNumbers() const
@@ -154,17 +156,10 @@ void Context::finish_acknowledgements(
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    std::set<RequestNumber> toErase;
-
-    for (const auto& number : acknowledged_request_numbers_) {
-        if (0 == req.count(number)) {
-            toErase.insert(number);
-        }
-    }
-
-    for (const auto& it : toErase) {
-        acknowledged_request_numbers_.erase(it);
-    }
+    // Keep only the numbers which are also in req
+    acknowledged_request_numbers_ =
+        acknowledged_request_numbers_.difference(
+            acknowledged_request_numbers_.difference(NumberSet(req)));
 }
 
 Identifier Context::GetID(const Lock& lock) const
@@ -243,14 +238,14 @@ bool Context::insert_available_number(const TransactionNumber& number)
 {
     Lock lock(lock_);
 
-    return issued_transaction_numbers_.insert(number).second;
+    return issued_transaction_numbers_.insert(number);
 }
 
 bool Context::insert_issued_number(const TransactionNumber& number)
 {
     Lock lock(lock_);
 
-    return issued_transaction_numbers_.insert(number).second;
+    return issued_transaction_numbers_.insert(number);
 }
 
 bool Context::issue_number(
@@ -306,7 +301,7 @@ bool Context::RecoverAvailableNumber(const TransactionNumber& number)
 
     if (!issued) { return false; }
 
-    return available_transaction_numbers_.insert(number).second;
+    return available_transaction_numbers_.insert(number);
 }
 
 const class Nym& Context::RemoteNym() const
@@ -156,25 +156,15 @@ std::unique_ptr<TransactionStatement> ServerContext::generate_statement(
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    std::set<TransactionNumber> issued;
-    std::set<TransactionNumber> available;
-
-    for (const auto& number : issued_transaction_numbers_) {
-        const bool include = (0 == without.count(number));
-
-        if (include) {
-            issued.insert(number);
-            available.insert(number);
-        }
-    }
+    NumberSet issued =
+        issued_transaction_numbers_.difference(NumberSet(without));
 
     for (const auto& number : adding) {
         issued.insert(number);
-        available.insert(number);
     }
 
     std::unique_ptr<TransactionStatement> output(
-        new TransactionStatement(String(server_id_).Get(), issued, available));
+        new TransactionStatement(String(server_id_).Get(), issued, issued));
 
     return output;
 }
@@ -188,11 +178,10 @@ TransactionNumber ServerContext::NextTransactionNumber()
 {
     Lock lock(lock_);
 
-    if (0 == available_transaction_numbers_.size()) { return 0; }
+    if (available_transaction_numbers_.empty()) { return 0; }
 
-    auto first = available_transaction_numbers_.begin();
-    const auto output = *first;
-    available_transaction_numbers_.erase(first);
+    const auto output = available_transaction_numbers_.front();
+    available_transaction_numbers_.erase(output);
 
     return output;
 }
@@ -437,16 +426,15 @@ bool ServerContext::Verify(const TransactionStatement& statement) const
 {
     Lock lock(lock_);
 
-    for (const auto& number : issued_transaction_numbers_) {
-        const bool missing = (1 != statement.Issued().count(number));
+    if (!statement.Issued().includes(issued_transaction_numbers_)) {
+        const auto missing =
+            issued_transaction_numbers_.difference(statement.Issued());
 
-        if (missing) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
-                  << number << " on context not found on statement."
-                  << std::endl;
+        otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
+              << missing.front() << " on context not found on statement."
+              << std::endl;
 
-            return false;
-        }
+        return false;
     }
 
     // Getting here means that, though issued numbers may have been removed from
@@ -51,8 +51,8 @@ namespace opentxs
 {
 TransactionStatement::TransactionStatement(
     const std::string& notary,
-    const std::set<TransactionNumber>& issued,
-    const std::set<TransactionNumber>& available)
+    const NumberSet& issued,
+    const NumberSet& available)
     : version_("1.0")
     , nym_id_("")
     , notary_(notary)
@@ -101,16 +101,10 @@ TransactionStatement::TransactionStatement(const String& serialized)
                         numlist.Add(list);
                     }
 
-                    TransactionNumber number = 0;
-
-                    while (numlist.Peek(number)) {
-                        numlist.Pop();
-
-                        otLog3 << "Transaction Number " << number
-                               << " ready-to-use for NotaryID: " << notary_
-                               << std::endl;
-                        available_.insert(number);
-                    }
+                    numlist.Output(available_);
+                    otLog3 << available_.size() << " transaction numbers "
+                           << "ready-to-use for NotaryID: " << notary_
+                           << std::endl;
                 }
                 else if (nodeName.Compare("issuedNums")) {
                     notary_ = xml->getAttributeValue("notaryID");
@@ -131,16 +125,10 @@ TransactionStatement::TransactionStatement(const String& serialized)
                         numlist.Add(list);
                     }
 
-                    TransactionNumber number = 0;
-
-                    while (numlist.Peek(number)) {
-                        numlist.Pop();
-
-                        otLog3 << "Currently liable for issued trans# "
-                               << number << " at NotaryID: " << notary_
-                               << std::endl;
-                        issued_.insert(number);
-                    }
+                    numlist.Output(issued_);
+                    otLog3 << "Currently liable for " << issued_.size()
+                           << " issued transaction numbers at NotaryID: "
+                           << notary_ << std::endl;
                 }
                 else {
                     otErr << "Unknown element type in " << __FUNCTION__ << ": "
@@ -189,7 +177,7 @@ TransactionStatement::operator String() const {
     return result.c_str();
 }
 
-const std::set<TransactionNumber>& TransactionStatement::Issued() const
+const NumberSet& TransactionStatement::Issued() const
 {
     return issued_;
 }
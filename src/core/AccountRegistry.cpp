@@ -0,0 +1,333 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/core/AccountRegistry.hpp"
+
+#include "opentxs/core/util/Assert.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/core/String.hpp"
+
+#include <memory>
+#include <utility>
+
+#define OT_METHOD "opentxs::AccountRegistry::"
+
+namespace opentxs
+{
+const std::size_t AccountRegistry::DEFAULT_PAGES = 256;
+
+AccountRegistry::AccountRegistry(const std::string& unitID)
+    : unit_id_(unitID)
+    , legacy_file_(unitID + ".a")
+    , index_file_(unitID + ".a.idx")
+    , valid_(false)
+    , page_counts_()
+{
+    if (OTDB::Exists(OTFolders::Contract().Get(), index_file_)) {
+        valid_ = load_index();
+    } else if (OTDB::Exists(OTFolders::Contract().Get(), legacy_file_)) {
+        valid_ = migrate();
+    } else {
+        page_counts_.assign(DEFAULT_PAGES, 0);
+        valid_ = true;
+    }
+
+    if (!valid_) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to open the account registry for instrument "
+              << "definition " << unit_id_ << std::endl;
+    }
+}
+
+bool AccountRegistry::Add(const std::string& accountID)
+{
+    if (!valid_) { return false; }
+
+    const auto page = page_for(accountID);
+    Page accounts;
+
+    if (!load_page(page, accounts)) { return false; }
+
+    auto it = accounts.find(accountID);
+
+    if (accounts.end() != it) {
+        if (unit_id_ != it->second) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Account " << accountID
+                  << " is registered to the wrong instrument definition ("
+                  << it->second << ")" << std::endl;
+
+            return false;
+        }
+
+        return true;
+    }
+
+    accounts.emplace(accountID, unit_id_);
+
+    if (!save_page(page, accounts)) { return false; }
+
+    page_counts_[page] = accounts.size();
+
+    return save_index();
+}
+
+std::size_t AccountRegistry::Count() const
+{
+    std::size_t output = 0;
+
+    for (const auto& count : page_counts_) { output += count; }
+
+    return output;
+}
+
+bool AccountRegistry::load_index()
+{
+    std::unique_ptr<OTDB::Storable> storable(OTDB::QueryObject(
+        OTDB::STORED_OBJ_STRING_MAP,
+        OTFolders::Contract().Get(),
+        index_file_));
+    auto index = dynamic_cast<OTDB::StringMap*>(storable.get());
+
+    if (nullptr == index) { return false; }
+
+    const auto& map = index->the_map;
+    const auto pages = map.find("pages");
+
+    if (map.end() == pages) { return false; }
+
+    const auto count = String::StringToUlong(pages->second);
+
+    if (0 == count) { return false; }
+
+    page_counts_.assign(count, 0);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto it = map.find(std::to_string(i));
+
+        if (map.end() != it) {
+            page_counts_[i] = String::StringToLong(it->second);
+        }
+    }
+
+    return true;
+}
+
+bool AccountRegistry::load_page(const std::size_t page, Page& output) const
+{
+    output.clear();
+    const auto file = page_file(page);
+
+    if (!OTDB::Exists(OTFolders::Contract().Get(), file)) { return true; }
+
+    std::unique_ptr<OTDB::Storable> storable(OTDB::QueryObject(
+        OTDB::STORED_OBJ_STRING_MAP, OTFolders::Contract().Get(), file));
+    auto accounts = dynamic_cast<OTDB::StringMap*>(storable.get());
+
+    if (nullptr == accounts) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to load " << file
+              << std::endl;
+
+        return false;
+    }
+
+    output.swap(accounts->the_map);
+
+    return true;
+}
+
+// Splits the flat account list written by older versions into pages. The flat
+// file is only removed once every page and the index have been saved.
+bool AccountRegistry::migrate()
+{
+    std::unique_ptr<OTDB::Storable> storable(OTDB::QueryObject(
+        OTDB::STORED_OBJ_STRING_MAP,
+        OTFolders::Contract().Get(),
+        legacy_file_));
+    auto legacy = dynamic_cast<OTDB::StringMap*>(storable.get());
+
+    if (nullptr == legacy) { return false; }
+
+    // page_for() needs the number of pages
+    page_counts_.assign(DEFAULT_PAGES, 0);
+    std::vector<Page> pages(DEFAULT_PAGES);
+
+    for (const auto& it : legacy->the_map) {
+        pages[page_for(it.first)].insert(it);
+    }
+
+    for (std::size_t i = 0; i < pages.size(); ++i) {
+        if (pages[i].empty()) { continue; }
+
+        if (!save_page(i, pages[i])) { return false; }
+
+        page_counts_[i] = pages[i].size();
+    }
+
+    if (!save_index()) { return false; }
+
+    OTDB::EraseValueByKey(OTFolders::Contract().Get(), legacy_file_);
+
+    otWarn << OT_METHOD << __FUNCTION__ << ": Moved "
+           << legacy->the_map.size() << " accounts of instrument definition "
+           << unit_id_ << " into " << DEFAULT_PAGES << " pages." << std::endl;
+
+    return true;
+}
+
+std::string AccountRegistry::page_file(const std::size_t page) const
+{
+    return legacy_file_ + "." + std::to_string(page);
+}
+
+// FNV-1a, so an account stays on the same page on every platform
+std::size_t AccountRegistry::page_for(const std::string& accountID) const
+{
+    OT_ASSERT(0 < page_counts_.size());
+
+    std::uint32_t hash = 2166136261u;
+
+    for (const auto& c : accountID) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 16777619u;
+    }
+
+    return hash % page_counts_.size();
+}
+
+bool AccountRegistry::Remove(const std::string& accountID)
+{
+    if (!valid_) { return false; }
+
+    const auto page = page_for(accountID);
+    Page accounts;
+
+    if (!load_page(page, accounts)) { return false; }
+
+    if (0 == accounts.erase(accountID)) { return true; }
+
+    if (!save_page(page, accounts)) { return false; }
+
+    page_counts_[page] = accounts.size();
+
+    return save_index();
+}
+
+bool AccountRegistry::save_index() const
+{
+    std::unique_ptr<OTDB::Storable> storable(
+        OTDB::CreateObject(OTDB::STORED_OBJ_STRING_MAP));
+    auto index = dynamic_cast<OTDB::StringMap*>(storable.get());
+
+    OT_ASSERT(nullptr != index);
+
+    index->the_map["pages"] = std::to_string(page_counts_.size());
+
+    for (std::size_t i = 0; i < page_counts_.size(); ++i) {
+        if (0 < page_counts_[i]) {
+            index->the_map[std::to_string(i)] =
+                std::to_string(page_counts_[i]);
+        }
+    }
+
+    if (!OTDB::StoreObject(*index, OTFolders::Contract().Get(), index_file_)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to save "
+              << index_file_ << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+bool AccountRegistry::save_page(const std::size_t page, const Page& input)
+    const
+{
+    std::unique_ptr<OTDB::Storable> storable(
+        OTDB::CreateObject(OTDB::STORED_OBJ_STRING_MAP));
+    auto accounts = dynamic_cast<OTDB::StringMap*>(storable.get());
+
+    OT_ASSERT(nullptr != accounts);
+
+    accounts->the_map = input;
+    const auto file = page_file(page);
+
+    if (!OTDB::StoreObject(*accounts, OTFolders::Contract().Get(), file)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to save " << file
+              << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+bool AccountRegistry::Visit(const PageVisitor& visitor) const
+{
+    if (!valid_) { return false; }
+
+    for (std::size_t i = 0; i < page_counts_.size(); ++i) {
+        if (0 == page_counts_[i]) { continue; }
+
+        Page accounts;
+
+        if (!load_page(i, accounts)) { return false; }
+
+        std::vector<std::string> ids;
+        ids.reserve(accounts.size());
+
+        for (const auto& it : accounts) {
+            // Just in case someone copied the wrong file here
+            if (unit_id_ != it.second) {
+                otErr << OT_METHOD << __FUNCTION__ << ": Error: wrong "
+                      << "instrument definition ID (" << it.second
+                      << ") when expecting: " << unit_id_ << std::endl;
+
+                continue;
+            }
+
+            ids.push_back(it.first);
+        }
+
+        if (!visitor(ids)) { return false; }
+    }
+
+    return true;
+}
+}  // namespace opentxs
@@ -41,6 +41,7 @@
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Nym.hpp"
+#include "opentxs/core/OTData.hpp"
 #include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/OTStringXML.hpp"
 #include "opentxs/core/Proto.hpp"
@@ -57,6 +58,7 @@
 #include "opentxs/core/util/Tag.hpp"
 
 #include <stdint.h>
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <irrxml/irrXML.hpp>
@@ -544,6 +546,14 @@ bool Contract::SignContract(
     return true;
 }
 
+OTData Contract::signed_plaintext() const
+{
+    const String strContract = trim(m_xmlUnsigned);
+
+    // include null terminator
+    return OTData(strContract.Get(), strContract.GetLength() + 1);
+}
+
 bool Contract::VerifySigAuthent(
     const Nym& theNym,
     const OTPasswordData* pPWData) const
@@ -553,6 +563,8 @@ bool Contract::VerifySigAuthent(
     char cNymID = '0';
     uint32_t uIndex = 3;
     const bool bNymID = strNymID.At(uIndex, cNymID);
+    const OTData plaintext = signed_plaintext();
+    OTData digest;
 
     for (auto& it : m_listSignatures) {
         OTSignature* pSig = it;
@@ -569,7 +581,8 @@ bool Contract::VerifySigAuthent(
             if (pSig->getMetaData().FirstCharNymID() != cNymID) continue;
         }
 
-        if (VerifySigAuthent(theNym, *pSig, pPWData)) return true;
+        if (verify_signature(theNym, *pSig, 'A', plaintext, digest, pPWData))
+            return true;
     }
 
     return false;
@@ -583,6 +596,8 @@ bool Contract::VerifySignature(const Nym& theNym, const OTPasswordData* pPWData)
     char cNymID = '0';
     uint32_t uIndex = 3;
     const bool bNymID = strNymID.At(uIndex, cNymID);
+    const OTData plaintext = signed_plaintext();
+    OTData digest;
 
     for (auto& it : m_listSignatures) {
         OTSignature* pSig = it;
@@ -599,16 +614,76 @@ bool Contract::VerifySignature(const Nym& theNym, const OTPasswordData* pPWData)
             if (pSig->getMetaData().FirstCharNymID() != cNymID) continue;
         }
 
-        if (VerifySignature(theNym, *pSig, pPWData)) return true;
+        if (verify_signature(theNym, *pSig, 'S', plaintext, digest, pPWData))
+            return true;
     }
 
     return false;
 }
 
+bool Contract::BatchSignature(
+    const Nym& theNym,
+    std::vector<CryptoAsymmetric::BatchItem>& batch) const
+{
+    String strNymID;
+    theNym.GetIdentifier(strNymID);
+    char cNymID = '0';
+    uint32_t uIndex = 3;
+    const bool bNymID = strNymID.At(uIndex, cNymID);
+    const OTSignature* signature = nullptr;
+
+    // Same candidates as VerifySignature(), which tries each of them in turn.
+    // A batch can only hold one, so anything ambiguous is left to it.
+    for (auto& it : m_listSignatures) {
+        OTSignature* pSig = it;
+        OT_ASSERT(nullptr != pSig);
+
+        if (bNymID && pSig->getMetaData().HasMetadata()) {
+            if (pSig->getMetaData().FirstCharNymID() != cNymID) continue;
+        }
+
+        if (nullptr != signature) { return false; }
+
+        signature = pSig;
+    }
+
+    if (nullptr == signature) { return false; }
+
+    listOfAsymmetricKeys listOutput;
+    const OTAsymmetricKey* key = nullptr;
+
+    if (0 < theNym.GetPublicKeysBySignature(listOutput, *signature, 'S')) {
+        if (1 != listOutput.size()) { return false; }
+
+        key = listOutput.front();
+    } else {
+        key = &theNym.GetPublicSignKey();
+    }
+
+    OT_ASSERT(nullptr != key);
+
+    if ((nullptr != key->m_pMetadata) && key->m_pMetadata->HasMetadata() &&
+        signature->getMetaData().HasMetadata()) {
+        if (signature->getMetaData() != *(key->m_pMetadata)) { return false; }
+    }
+
+    CryptoAsymmetric::BatchItem item;
+    item.plaintext_ = signed_plaintext();
+    item.key_ = key;
+    signature->GetData(item.signature_);
+    item.hash_type_ = m_strSigHashType;
+    batch.push_back(std::move(item));
+
+    return true;
+}
+
 bool Contract::VerifyWithKey(
     const OTAsymmetricKey& theKey,
     const OTPasswordData* pPWData) const
 {
+    const OTData plaintext = signed_plaintext();
+    OTData digest;
+
     for (auto& it : m_listSignatures) {
         OTSignature* pSig = it;
         OT_ASSERT(nullptr != pSig);
@@ -622,10 +697,12 @@ bool Contract::VerifyWithKey(
         }
 
         OTPasswordData thePWData("Contract::VerifyWithKey");
-        if (VerifySignature(
+        if (verify_signature(
                 theKey,
                 *pSig,
                 m_strSigHashType,
+                plaintext,
+                digest,
                 (nullptr != pPWData) ? pPWData : &thePWData))
             return true;
     }
@@ -644,43 +721,11 @@ bool Contract::VerifySigAuthent(
     const OTSignature& theSignature,
     const OTPasswordData* pPWData) const
 {
+    const OTData plaintext = signed_plaintext();
+    OTData digest;
 
-    OTPasswordData thePWData("Contract::VerifySigAuthent 1");
-    listOfAsymmetricKeys listOutput;
-
-    const int32_t nCount = theNym.GetPublicKeysBySignature(
-        listOutput, theSignature, 'A');  // 'A' for authentication key.
-
-    if (nCount > 0)  // Found some (potentially) matching keys...
-    {
-        for (auto& it : listOutput) {
-            OTAsymmetricKey* pKey = it;
-            OT_ASSERT(nullptr != pKey);
-
-            if (VerifySignature(
-                    *pKey,
-                    theSignature,
-                    m_strSigHashType,
-                    (nullptr != pPWData) ? pPWData : &thePWData))
-                return true;
-        }
-    } else {
-        String strNymID;
-        theNym.GetIdentifier(strNymID);
-        otWarn << __FUNCTION__
-               << ": Tried to grab a list of keys from this Nym (" << strNymID
-               << ") which might match this signature, "
-                  "but recovered none. Therefore, will attempt to verify using "
-                  "the Nym's default public "
-                  "AUTHENTICATION key.\n";
-    }
-    // else found no keys.
-
-    return VerifySignature(
-        theNym.GetPublicAuthKey(),
-        theSignature,
-        m_strSigHashType,
-        (nullptr != pPWData) ? pPWData : &thePWData);
+    return verify_signature(
+        theNym, theSignature, 'A', plaintext, digest, pPWData);
 }
 
 // The only different between calling this with a Nym and calling it with an
@@ -694,12 +739,29 @@ bool Contract::VerifySignature(
     const OTSignature& theSignature,
     const OTPasswordData* pPWData) const
 {
+    const OTData plaintext = signed_plaintext();
+    OTData digest;
 
-    OTPasswordData thePWData("Contract::VerifySignature 1");
+    return verify_signature(
+        theNym, theSignature, 'S', plaintext, digest, pPWData);
+}
+
+bool Contract::verify_signature(
+    const Nym& theNym,
+    const OTSignature& theSignature,
+    const char cKeyType,
+    const OTData& plaintext,
+    OTData& digest,
+    const OTPasswordData* pPWData) const
+{
+    const bool bAuthent = ('A' == cKeyType);
+    OTPasswordData thePWData(
+        bAuthent ? "Contract::VerifySigAuthent 1"
+                 : "Contract::VerifySignature 1");
     listOfAsymmetricKeys listOutput;
 
-    const int32_t nCount = theNym.GetPublicKeysBySignature(
-        listOutput, theSignature, 'S');  // 'S' for signing key.
+    const int32_t nCount =
+        theNym.GetPublicKeysBySignature(listOutput, theSignature, cKeyType);
 
     if (nCount > 0)  // Found some (potentially) matching keys...
     {
@@ -707,10 +769,12 @@ bool Contract::VerifySignature(
             OTAsymmetricKey* pKey = it;
             OT_ASSERT(nullptr != pKey);
 
-            if (VerifySignature(
+            if (verify_signature(
                     *pKey,
                     theSignature,
                     m_strSigHashType,
+                    plaintext,
+                    digest,
                     (nullptr != pPWData) ? pPWData : &thePWData))
                 return true;
         }
@@ -722,14 +786,16 @@ bool Contract::VerifySignature(
                << ") which might match this signature, "
                   "but recovered none. Therefore, will attempt to verify using "
                   "the Nym's default public "
-                  "SIGNING key.\n";
+               << (bAuthent ? "AUTHENTICATION" : "SIGNING") << " key.\n";
     }
     // else found no keys.
 
-    return VerifySignature(
-        theNym.GetPublicSignKey(),
+    return verify_signature(
+        bAuthent ? theNym.GetPublicAuthKey() : theNym.GetPublicSignKey(),
         theSignature,
         m_strSigHashType,
+        plaintext,
+        digest,
         (nullptr != pPWData) ? pPWData : &thePWData);
 }
 
@@ -738,6 +804,21 @@ bool Contract::VerifySignature(
     const OTSignature& theSignature,
     const proto::HashType hashType,
     const OTPasswordData* pPWData) const
+{
+    const OTData plaintext = signed_plaintext();
+    OTData digest;
+
+    return verify_signature(
+        theKey, theSignature, hashType, plaintext, digest, pPWData);
+}
+
+bool Contract::verify_signature(
+    const OTAsymmetricKey& theKey,
+    const OTSignature& theSignature,
+    const proto::HashType hashType,
+    const OTData& plaintext,
+    OTData& digest,
+    const OTPasswordData* pPWData) const
 {
     // See if this key could possibly have even signed this signature.
     // (The metadata may eliminate it as a possibility.)
@@ -750,16 +831,19 @@ bool Contract::VerifySignature(
     OTPasswordData thePWData("Contract::VerifySignature 2");
 
     CryptoAsymmetric& engine = theKey.engine();
+    OTData signature;
+    theSignature.GetData(signature);
 
     if (false ==
-        engine.VerifyContractSignature(
-            trim(m_xmlUnsigned),
+        engine.VerifyWithDigest(
+            plaintext,
+            digest,
             theKey,
-            theSignature,
+            signature,
             hashType,
             (nullptr != pPWData) ? pPWData : &thePWData)) {
         otLog4 << __FUNCTION__
-               << ": engine.VerifyContractSignature returned false.\n";
+               << ": engine.VerifyWithDigest returned false.\n";
         return false;
     }
 
@@ -1176,12 +1260,88 @@ bool Contract::LoadContractFromString(const String& theStr)
     return bSuccess;
 }
 
+namespace
+{
+
+// One line of a raw contract, as a slice of the buffer it was read from.
+struct RawLine {
+    const char* data_{nullptr};
+    std::size_t length_{0};
+
+    char at(std::size_t index) const { return data_[index]; }
+
+    bool Contains(const char* token) const
+    {
+        const char* end = data_ + length_;
+
+        return end != std::search(data_, end, token, token + strlen(token));
+    }
+
+    bool StartsWith(const char* prefix) const
+    {
+        const std::size_t size = strlen(prefix);
+
+        return (length_ >= size) && (0 == memcmp(data_, prefix, size));
+    }
+};
+
+// Walks the lines of a buffer in place, without copying them out.
+class RawLineReader
+{
+public:
+    RawLineReader(const char* data, std::size_t length)
+        : position_(data)
+        , end_(data + length)
+    {
+    }
+
+    bool AtEnd() const { return position_ >= end_; }
+
+    // Returns false if there was nothing left to read.
+    bool Next(RawLine& line)
+    {
+        if (AtEnd()) return false;
+
+        const char* newline = static_cast<const char*>(
+            memchr(position_, '\n', end_ - position_));
+        const char* lineEnd = (nullptr == newline) ? end_ : newline;
+
+        line.data_ = position_;
+        line.length_ = lineEnd - position_;
+        position_ = (nullptr == newline) ? end_ : newline + 1;
+
+        return true;
+    }
+
+    // Skips the line after a header. Fails if the header was the last line,
+    // or if the skipped line is.
+    bool Skip()
+    {
+        RawLine notUsed;
+
+        return !AtEnd() && Next(notUsed) && !AtEnd();
+    }
+
+private:
+    const char* position_{nullptr};
+    const char* end_{nullptr};
+};
+
+bool is_contract_whitespace(char c)
+{
+    return (' ' == c) || ('\t' == c) || ('\f' == c) || ('\v' == c) ||
+           ('\n' == c) || ('\r' == c);
+}
+
+}  // namespace
+
+// Parses m_strRawFile in a single pass. Lines are visited as slices of the
+// raw buffer, and the signed content and each signature are gathered into
+// one std::string apiece before being stored.
 bool Contract::ParseRawFile()
 {
-    char buffer1[2100];  // a bit bigger than 2048, just for safety reasons.
     OTSignature* pSig = nullptr;
-
-    std::string line;
+    std::string strSig;
 
     bool bSignatureMode = false;           // "currently in signature mode"
     bool bContentMode = false;             // "currently in content mode"
@@ -1194,30 +1354,35 @@ bool Contract::ParseRawFile()
         return false;
     }
 
-    // This is redundant (I thought) but the problem hasn't cleared up yet.. so
-    // trying to really nail it now.
-    std::string str_Trim(m_strRawFile.Get());
-    std::string str_Trim2 = String::trim(str_Trim);
-    m_strRawFile.Set(str_Trim2.c_str());
+    // Trim the raw file, but only copy it when there is something to trim.
+    {
+        const char* first = m_strRawFile.Get();
+        const char* last = first + m_strRawFile.GetLength();
 
-    bool bIsEOF = false;
-    m_strRawFile.reset();
+        while ((first < last) && is_contract_whitespace(*first)) ++first;
+        while ((first < last) && is_contract_whitespace(*(last - 1))) --last;
+
+        const bool bAllWhitespace = (first == last);
+        const bool bTrimmed =
+            (first != m_strRawFile.Get()) ||
+            (last != m_strRawFile.Get() + m_strRawFile.GetLength());
 
-    do {
-        // Just a fresh start at the top of the loop block... probably
-        // unnecessary.
-        memset(
-            buffer1, 0, 2100);  // todo remove this in optimization. (might be
-                                // removed already...)
+        if (bTrimmed && !bAllWhitespace) {
+            const std::string strTrimmed(first, last - first);
+            m_strRawFile.Set(strTrimmed.c_str());
+        }
+    }
 
-        // the call returns true if there's more to read, and false if there
-        // isn't.
-        bIsEOF = !(m_strRawFile.sgets(buffer1, 2048));
+    m_strRawFile.reset();
 
-        line = buffer1;
-        const char* pBuf = line.c_str();
+    std::string strXML;
+    strXML.reserve(m_strRawFile.GetLength());
 
-        if (line.length() < 2) {
+    RawLineReader reader(m_strRawFile.Get(), m_strRawFile.GetLength());
+    RawLine line;
+
+    while (reader.Next(line)) {
+        if (line.length_ < 2) {
             if (bSignatureMode) continue;
         }
 
@@ -1225,45 +1390,33 @@ bool Contract::ParseRawFile()
         else if (line.at(0) == '-') {
             if (bSignatureMode) {
                 // we just reached the end of a signature
-                //    otErr << "%s\n", pSig->Get());
+                pSig->Set(strSig.c_str());
+                strSig.clear();
                 pSig = nullptr;
                 bSignatureMode = false;
                 continue;
             }
 
             // if I'm NOT in signature mode, and I just hit a dash, that means
-            // there
-            // are only four options:
+            // there are only four options:
 
             // a. I have not yet even entered content mode, and just now
             // entering it for the first time.
             if (!bHaveEnteredContentMode) {
-                if ((line.length() > 3) &&
-                    (line.find("BEGIN") != std::string::npos) &&
+                if ((line.length_ > 3) && line.Contains("BEGIN") &&
                     line.at(1) == '-' && line.at(2) == '-' &&
                     line.at(3) == '-') {
-                    //                    otErr << "\nProcessing contract...
-                    // \n";
                     bHaveEnteredContentMode = true;
                     bContentMode = true;
-                    continue;
-                } else {
-                    continue;
                 }
 
+                continue;
             }
 
             // b. I am now entering signature mode!
             else if (
-                line.length() > 3 &&
-                line.find("SIGNATURE") != std::string::npos &&
+                line.length_ > 3 && line.Contains("SIGNATURE") &&
                 line.at(1) == '-' && line.at(2) == '-' && line.at(3) == '-') {
-                // if (bContentMode)
-                //    otLog3 << "Finished reading contract.\n\nReading a
-                // signature at the bottom of the contract...\n");
-                // else
-                //    otLog3 << "Reading another signature...\n");
-
                 bSignatureMode = true;
                 bContentMode = false;
 
@@ -1281,7 +1434,7 @@ bool Contract::ParseRawFile()
             }
             // c. There is an error in the file!
             else if (
-                line.length() < 3 || line.at(1) != ' ' || line.at(2) != '-') {
+                line.length_ < 3 || line.at(1) != ' ' || line.at(2) != '-') {
                 otOut
                     << "Error in contract " << m_strFilename
                     << ": a dash at the beginning of the "
@@ -1289,117 +1442,94 @@ bool Contract::ParseRawFile()
                     << m_strRawFile << "\n";
                 return false;
             }
-            // d. It is an escaped dash, and therefore kosher, so I merely
-            // remove the escape and add it.
-            // I've decided not to remove the dashes but to keep them as part of
-            // the signed content.
-            // It's just much easier to deal with that way. The input code will
-            // insert the extra dashes.
-            // pBuf += 2;
+            // d. It is an escaped dash, and therefore kosher. The dashes are
+            // kept as part of the signed content.
         }
 
         // Else we're on a normal line, not a dashed line.
-        else {
-            if (bHaveEnteredContentMode) {
-                if (bSignatureMode) {
-                    if (line.length() < 2) {
-                        otLog3 << "Skipping short line...\n";
-
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
-                            otOut << "Error in signature for contract "
-                                  << m_strFilename
-                                  << ": Unexpected EOF after short line.\n";
-                            return false;
-                        }
-
-                        continue;
-                    } else if (line.compare(0, 8, "Version:") == 0) {
-                        otLog3 << "Skipping version section...\n";
-
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
-                            otOut << "Error in signature for contract "
-                                  << m_strFilename
-                                  << ": Unexpected EOF after \"Version:\"\n";
-                            return false;
-                        }
-
-                        continue;
-                    } else if (line.compare(0, 8, "Comment:") == 0) {
-                        otLog3 << "Skipping comment section...\n";
-
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
-                            otOut << "Error in signature for contract "
-                                  << m_strFilename
-                                  << ": Unexpected EOF after \"Comment:\"\n";
-                            return false;
-                        }
-
-                        continue;
-                    }
-                    if (line.compare(0, 5, "Meta:") == 0) {
-                        otLog3 << "Collecting signature metadata...\n";
-
-                        if (line.length() != 13)  // "Meta:    knms" (It will
-                                                  // always be exactly 13
-                        // characters int64_t.) knms represents the
-                        // first characters of the Key type, NymID,
-                        // Master Cred ID, and ChildCred ID. Key type is
-                        // (A|E|S) and the others are base62.
-                        {
-                            otOut << "Error in signature for contract "
-                                  << m_strFilename << ": Unexpected length for "
-                                                      "\"Meta:\" comment.\n";
-                            return false;
-                        }
-
-                        OT_ASSERT(nullptr != pSig);
-                        if (false ==
-                            pSig->getMetaData().SetMetadata(
-                                line.at(9),
-                                line.at(10),
-                                line.at(11),
-                                line.at(12)))  // "knms" from "Meta:    knms"
-                        {
-                            otOut << "Error in signature for contract "
-                                  << m_strFilename
-                                  << ": Unexpected metadata in the \"Meta:\" "
-                                     "comment.\nLine: "
-                                  << line << "\n";
-                            return false;
-                        }
-
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
-                            otOut << "Error in signature for contract "
-                                  << m_strFilename
-                                  << ": Unexpected EOF after \"Meta:\"\n";
-                            return false;
-                        }
-
-                        continue;
+        else if (bHaveEnteredContentMode) {
+            if (bSignatureMode) {
+                if (line.StartsWith("Version:")) {
+                    otLog3 << "Skipping version section...\n";
+
+                    if (!reader.Skip()) {
+                        otOut << "Error in signature for contract "
+                              << m_strFilename
+                              << ": Unexpected EOF after \"Version:\"\n";
+                        return false;
                     }
-                }
-                if (bContentMode) {
-                    if (line.compare(0, 6, "Hash: ") == 0) {
-                        otLog3 << "Collecting message digest algorithm from "
-                                  "contract header...\n";
 
-                        std::string strTemp = line.substr(6);
-                        String strHashType = strTemp.c_str();
-                        strHashType.ConvertToUpperCase();
+                    continue;
+                } else if (line.StartsWith("Comment:")) {
+                    otLog3 << "Skipping comment section...\n";
+
+                    if (!reader.Skip()) {
+                        otOut << "Error in signature for contract "
+                              << m_strFilename
+                              << ": Unexpected EOF after \"Comment:\"\n";
+                        return false;
+                    }
 
-                        m_strSigHashType =
-                            CryptoHash::StringToHashType(strHashType);
+                    continue;
+                } else if (line.StartsWith("Meta:")) {
+                    otLog3 << "Collecting signature metadata...\n";
+
+                    // "Meta:    knms" (It will always be exactly 13
+                    // characters long.) knms represents the first characters
+                    // of the Key type, NymID, Master Cred ID, and ChildCred
+                    // ID. Key type is (A|E|S) and the others are base62.
+                    if (line.length_ != 13) {
+                        otOut << "Error in signature for contract "
+                              << m_strFilename << ": Unexpected length for "
+                                                  "\"Meta:\" comment.\n";
+                        return false;
+                    }
 
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
-                            otOut << "Error in contract " << m_strFilename
-                                  << ": Unexpected EOF after \"Hash:\"\n";
-                            return false;
-                        }
+                    OT_ASSERT(nullptr != pSig);
+                    if (false ==
+                        pSig->getMetaData().SetMetadata(
+                            line.at(9),
+                            line.at(10),
+                            line.at(11),
+                            line.at(12)))  // "knms" from "Meta:    knms"
+                    {
+                        otOut << "Error in signature for contract "
+                              << m_strFilename
+                              << ": Unexpected metadata in the \"Meta:\" "
+                                 "comment.\nLine: "
+                              << std::string(line.data_, line.length_)
+                              << "\n";
+                        return false;
+                    }
 
-                        continue;
+                    if (!reader.Skip()) {
+                        otOut << "Error in signature for contract "
+                              << m_strFilename
+                              << ": Unexpected EOF after \"Meta:\"\n";
+                        return false;
                     }
+
+                    continue;
                 }
             }
+            if (bContentMode && line.StartsWith("Hash: ")) {
+                otLog3 << "Collecting message digest algorithm from "
+                          "contract header...\n";
+
+                const std::string strTemp(line.data_ + 6, line.length_ - 6);
+                String strHashType = strTemp.c_str();
+                strHashType.ConvertToUpperCase();
+
+                m_strSigHashType = CryptoHash::StringToHashType(strHashType);
+
+                if (!reader.Skip()) {
+                    otOut << "Error in contract " << m_strFilename
+                          << ": Unexpected EOF after \"Hash:\"\n";
+                    return false;
+                }
+
+                continue;
+            }
         }
 
         if (bSignatureMode) {
@@ -1409,10 +1539,23 @@ bool Contract::ParseRawFile()
                 "processing signature, in "
                 "Contract::ParseRawFile");
 
-            pSig->Concatenate("%s\n", pBuf);
-        } else if (bContentMode)
-            m_xmlUnsigned.Concatenate("%s\n", pBuf);
-    } while (!bIsEOF);
+            strSig.append(line.data_, line.length_);
+            strSig.push_back('\n');
+        } else if (bContentMode) {
+            strXML.append(line.data_, line.length_);
+            strXML.push_back('\n');
+        }
+    }
+
+    if (nullptr != pSig) pSig->Set(strSig.c_str());
+
+    if (!strXML.empty()) {
+        if (m_xmlUnsigned.Exists()) {
+            m_xmlUnsigned.Concatenate(String(strXML));
+        } else {
+            m_xmlUnsigned.Set(strXML.c_str());
+        }
+    }
 
     if (!bHaveEnteredContentMode) {
         otErr << "Error in Contract::ParseRawFile: Found no BEGIN for signed "
@@ -52,6 +52,11 @@
 #include "opentxs/core/OTData.hpp"
 #include "opentxs/core/String.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
 namespace opentxs
 {
 
@@ -86,6 +91,12 @@ Identifier::Identifier(const Identifier& theID)
 {
 }
 
+Identifier::Identifier(Identifier&& theID)
+    : OTData(std::move(theID))
+    , type_(theID.Type())
+{
+}
+
 Identifier::Identifier(const std::string& theStr)
     : OTData()
 {
@@ -136,43 +147,81 @@ Identifier::Identifier(const OTCachedKey& theKey)
 Identifier& Identifier::operator=(Identifier rhs)
 {
     swap(rhs);
+    std::swap(type_, rhs.type_);
+
     return *this;
 }
 
+int Identifier::compare(const Identifier& rhs) const
+{
+    const auto size = GetSize();
+    const auto rhsSize = rhs.GetSize();
+
+    if ((0 == size) || (0 == rhsSize)) {
+        return (0 == size) ? ((0 == rhsSize) ? 0 : -1) : 1;
+    }
+
+    if (type_ != rhs.type_) { return (type_ < rhs.type_) ? -1 : 1; }
+
+    const int result =
+        std::memcmp(GetPointer(), rhs.GetPointer(), std::min(size, rhsSize));
+
+    if (0 != result) { return result; }
+
+    if (size == rhsSize) { return 0; }
+
+    return (size < rhsSize) ? -1 : 1;
+}
+
+std::size_t Identifier::Hash() const
+{
+    // FNV-1a over the type byte and the digest.
+    std::uint64_t output = 14695981039346656037ULL;
+    const std::uint64_t prime = 1099511628211ULL;
+
+    if (0 == GetSize()) { return static_cast<std::size_t>(output); }
+
+    output ^= static_cast<std::uint8_t>(type_);
+    output *= prime;
+    const auto* it = static_cast<const std::uint8_t*>(GetPointer());
+    const auto* end = it + GetSize();
+
+    for (; it != end; ++it) {
+        output ^= *it;
+        output *= prime;
+    }
+
+    return static_cast<std::size_t>(output);
+}
+
 bool Identifier::operator==(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.Compare(ots2);
+    return 0 == compare(s2);
 }
 
 bool Identifier::operator!=(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return !(ots1.Compare(ots2));
+    return 0 != compare(s2);
 }
 
 bool Identifier::operator>(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator>(ots2);
+    return 0 < compare(s2);
 }
 
 bool Identifier::operator<(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator<(ots2);
+    return 0 > compare(s2);
 }
 
 bool Identifier::operator<=(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator<=(ots2);
+    return 0 >= compare(s2);
 }
 
 bool Identifier::operator>=(const Identifier& s2) const
 {
-    const String ots1(*this), ots2(s2);
-    return ots1.operator>=(ots2);
+    return 0 <= compare(s2);
 }
 
 bool Identifier::CalculateDigest(const String& strInput, const ID type)
@@ -65,6 +65,8 @@
 #include <sys/types.h>
 #include <cstdint>
 #include <irrxml/irrXML.hpp>
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <ostream>
 #include <set>
@@ -74,6 +76,66 @@
 namespace opentxs
 {
 
+namespace
+{
+typedef std::multimap<int64_t, OTTransaction*> TransactionIndex;
+
+// Transactions which share a key are kept in transaction number order, so the
+// first one for a key is the one the old linear scans used to return.
+void index_insert(
+    TransactionIndex& index,
+    int64_t lKey,
+    OTTransaction* pTransaction)
+{
+    const int64_t lTransactionNum = pTransaction->GetTransactionNum();
+    auto range = index.equal_range(lKey);
+    auto it = range.first;
+
+    while ((range.second != it) &&
+           (it->second->GetTransactionNum() < lTransactionNum)) {
+        ++it;
+    }
+
+    index.insert(it, std::make_pair(lKey, pTransaction));
+}
+
+void index_erase(
+    TransactionIndex& index,
+    int64_t lKey,
+    const OTTransaction* pTransaction)
+{
+    auto range = index.equal_range(lKey);
+
+    for (auto it = range.first; it != range.second; ++it) {
+        if (pTransaction == it->second) {
+            index.erase(it);
+
+            return;
+        }
+    }
+
+    // The key was changed after the transaction was indexed.
+    for (auto it = index.begin(); it != index.end(); ++it) {
+        if (pTransaction == it->second) {
+            index.erase(it);
+
+            return;
+        }
+    }
+}
+
+OTTransaction* index_find(const TransactionIndex& index, int64_t lKey)
+{
+    auto it = index.lower_bound(lKey);
+
+    if ((index.end() == it) || (lKey != it->first)) { return nullptr; }
+
+    OT_ASSERT(nullptr != it->second);
+
+    return it->second;
+}
+}  // namespace
+
 char const* const __TypeStringsLedger[] = {
     "nymbox",  // the nymbox is per user account (versus per asset account) and
                // is used to receive new transaction numbers (and messages.)
@@ -1082,6 +1144,7 @@ bool Ledger::RemoveTransaction(int64_t lTransactionNum, bool bDeleteIt)
         OTTransaction* pTransaction = it->second;
         OT_ASSERT(nullptr != pTransaction);
         m_mapTransactions.erase(it);
+        UnindexTransaction(lTransactionNum, *pTransaction);
 
         if (bDeleteIt) {
             delete pTransaction;
@@ -1101,6 +1164,14 @@ bool Ledger::AddTransaction(OTTransaction& theTransaction)
     if (it == m_mapTransactions.end()) {
         m_mapTransactions[theTransaction.GetTransactionNum()] = &theTransaction;
         theTransaction.SetParent(*this);  // for convenience
+
+        if (m_bIndexed) {
+            IndexTransaction(
+                theTransaction.GetTransactionNum(), theTransaction);
+        }
+
+        if (m_bReceiptsIndexed) { IndexReceipt(theTransaction); }
+
         return true;
     }
     // Otherwise, if it was already there, log an error.
@@ -1127,42 +1198,245 @@ OTTransaction* Ledger::GetTransaction(OTTransaction::transactionType theType)
     return nullptr;
 }
 
-// if not found, returns -1
-int32_t Ledger::GetTransactionIndex(int64_t lTransactionNum)
+void Ledger::InvalidateIndex()
 {
-    // loop through the transactions inside this ledger
-    // If a specific transaction is found, returns its index inside the ledger
-    //
-    int32_t nIndex = -1;
+    m_bIndexed = false;
+    m_bReceiptsIndexed = false;
+    m_vecByPosition.clear();
+    m_mapByReferenceNum.clear();
+    m_mapReplyNoticeByRequestNum.clear();
+    m_mapTransferReceiptByOrigin.clear();
+    m_mapChequeReceiptByChequeNum.clear();
+    m_mapReceiptKeys.clear();
+}
+
+void Ledger::BuildIndex() const
+{
+    if (m_bIndexed) return;
+
+    m_vecByPosition.reserve(m_mapTransactions.size());
 
     for (auto& it : m_mapTransactions) {
         OTTransaction* pTransaction = it.second;
         OT_ASSERT(nullptr != pTransaction);
 
-        ++nIndex;  // 0 on first iteration.
+        IndexTransaction(it.first, *pTransaction);
+    }
+
+    m_bIndexed = true;
+}
+
+void Ledger::IndexTransaction(
+    int64_t lTransactionNum,
+    OTTransaction& theTransaction) const
+{
+    auto position = std::lower_bound(
+        m_vecByPosition.begin(),
+        m_vecByPosition.end(),
+        lTransactionNum,
+        [](const std::pair<int64_t, OTTransaction*>& lhs, int64_t rhs) {
+            return lhs.first < rhs;
+        });
+    m_vecByPosition.insert(
+        position, std::make_pair(lTransactionNum, &theTransaction));
+    index_insert(
+        m_mapByReferenceNum,
+        theTransaction.GetReferenceToNum(),
+        &theTransaction);
+
+    if (OTTransaction::replyNotice == theTransaction.GetType()) {
+        index_insert(
+            m_mapReplyNoticeByRequestNum,
+            theTransaction.GetRequestNum(),
+            &theTransaction);
+    }
+}
 
-        if (pTransaction->GetTransactionNum() == lTransactionNum) {
-            return nIndex;
+void Ledger::UnindexTransaction(
+    int64_t lTransactionNum,
+    OTTransaction& theTransaction)
+{
+    if (m_bIndexed) {
+        auto position = std::lower_bound(
+            m_vecByPosition.begin(),
+            m_vecByPosition.end(),
+            lTransactionNum,
+            [](const std::pair<int64_t, OTTransaction*>& lhs, int64_t rhs) {
+                return lhs.first < rhs;
+            });
+
+        if ((m_vecByPosition.end() != position) &&
+            (position->first == lTransactionNum)) {
+            m_vecByPosition.erase(position);
+        }
+
+        index_erase(
+            m_mapByReferenceNum,
+            theTransaction.GetReferenceToNum(),
+            &theTransaction);
+
+        if (OTTransaction::replyNotice == theTransaction.GetType()) {
+            index_erase(
+                m_mapReplyNoticeByRequestNum,
+                theTransaction.GetRequestNum(),
+                &theTransaction);
+        }
+    }
+
+    if (m_bReceiptsIndexed) {
+        auto key = m_mapReceiptKeys.find(theTransaction.GetTransactionNum());
+
+        if (m_mapReceiptKeys.end() != key) {
+            if (OTTransaction::transferReceipt == theTransaction.GetType()) {
+                index_erase(
+                    m_mapTransferReceiptByOrigin, key->second, &theTransaction);
+            } else {
+                index_erase(
+                    m_mapChequeReceiptByChequeNum,
+                    key->second,
+                    &theTransaction);
+            }
+
+            m_mapReceiptKeys.erase(key);
         }
     }
-    return -1;
 }
 
-// Look up a transaction by transaction number and see if it is in the ledger.
-// If it is, return a pointer to it, otherwise return nullptr.
-OTTransaction* Ledger::GetTransaction(int64_t lTransactionNum) const
+void Ledger::BuildReceiptIndex() const
 {
-    // loop through the transactions inside this ledger
+    if (m_bReceiptsIndexed) return;
 
     for (auto& it : m_mapTransactions) {
         OTTransaction* pTransaction = it.second;
         OT_ASSERT(nullptr != pTransaction);
 
-        if (pTransaction->GetTransactionNum() == lTransactionNum) {
-            return pTransaction;
+        IndexReceipt(*pTransaction);
+    }
+
+    m_bReceiptsIndexed = true;
+}
+
+// Transfer and cheque receipts are matched on data inside the original
+// request they reference, so each one is parsed once here rather than on
+// every lookup.
+void Ledger::IndexReceipt(OTTransaction& theTransaction) const
+{
+    const auto type = theTransaction.GetType();
+
+    if (OTTransaction::transferReceipt == type) {
+        String strReference;
+        theTransaction.GetReferenceString(strReference);
+
+        std::unique_ptr<Item> pOriginalItem(
+            Item::CreateItemFromString(
+                strReference,
+                theTransaction.GetPurportedNotaryID(),
+                theTransaction.GetReferenceToNum()));
+
+        if (nullptr == pOriginalItem) {
+            otErr << "OTLedger::" << __FUNCTION__
+                  << ": Failed loading the item attached to "
+                     "transferReceipt "
+                  << theTransaction.GetTransactionNum() << "\n";
+            return;
+        }
+
+        if (pOriginalItem->GetType() != Item::acceptPending) {
+            otErr << "OTLedger::" << __FUNCTION__
+                  << ": Wrong item type attached to transferReceipt!\n";
+            return;
+        }
+
+        // Note: the acceptPending USED to be "in reference to" whatever
+        // the pending was in reference to. (i.e. the original transfer.)
+        // But since the KacTech bug fix (for accepting multiple transfer
+        // receipts) the acceptPending is now "in reference to" the
+        // pending itself, instead of the original transfer. Therefore the
+        // receipt is found by matching the NumberOfOrigin instead.
+        const int64_t lKey = pOriginalItem->GetNumberOfOrigin();
+        index_insert(m_mapTransferReceiptByOrigin, lKey, &theTransaction);
+        m_mapReceiptKeys[theTransaction.GetTransactionNum()] = lKey;
+    } else if (
+        (OTTransaction::chequeReceipt == type) ||
+        (OTTransaction::voucherReceipt == type)) {
+        String strDepositChequeMsg;
+        theTransaction.GetReferenceString(strDepositChequeMsg);
+
+        std::unique_ptr<Item> pOriginalItem(
+            Item::CreateItemFromString(
+                strDepositChequeMsg,
+                GetPurportedNotaryID(),
+                theTransaction.GetReferenceToNum()));
+
+        if (nullptr == pOriginalItem) {
+            otErr << __FUNCTION__
+                  << ": Expected original depositCheque request item to "
+                     "be inside the chequeReceipt "
+                     "(but failed to load it...)\n";
+            return;
+        }
+
+        if (Item::depositCheque != pOriginalItem->GetType()) {
+            String strItemType;
+            pOriginalItem->GetTypeString(strItemType);
+            otErr << __FUNCTION__
+                  << ": Expected original depositCheque request item to "
+                     "be inside the chequeReceipt, "
+                     "but somehow what we found instead was a "
+                  << strItemType << "...\n";
+            return;
+        }
+
+        String strCheque;
+        pOriginalItem->GetAttachment(strCheque);
+        Cheque theCheque;
+
+        if (!((strCheque.GetLength() > 2) &&
+              theCheque.LoadContractFromString(strCheque))) {
+            otErr << __FUNCTION__ << ": Error loading cheque from string:\n"
+                  << strCheque << "\n";
+            return;
         }
+
+        const int64_t lKey = theCheque.GetTransactionNum();
+        index_insert(m_mapChequeReceiptByChequeNum, lKey, &theTransaction);
+        m_mapReceiptKeys[theTransaction.GetTransactionNum()] = lKey;
     }
-    return nullptr;
+}
+
+// if not found, returns -1
+int32_t Ledger::GetTransactionIndex(int64_t lTransactionNum)
+{
+    // If a specific transaction is found, returns its index inside the ledger
+    //
+    BuildIndex();
+
+    auto it = std::lower_bound(
+        m_vecByPosition.begin(),
+        m_vecByPosition.end(),
+        lTransactionNum,
+        [](const std::pair<int64_t, OTTransaction*>& lhs, int64_t rhs) {
+            return lhs.first < rhs;
+        });
+
+    if ((m_vecByPosition.end() == it) || (it->first != lTransactionNum)) {
+        return -1;
+    }
+
+    return static_cast<int32_t>(std::distance(m_vecByPosition.begin(), it));
+}
+
+// Look up a transaction by transaction number and see if it is in the ledger.
+// If it is, return a pointer to it, otherwise return nullptr.
+OTTransaction* Ledger::GetTransaction(int64_t lTransactionNum) const
+{
+    auto it = m_mapTransactions.find(lTransactionNum);
+
+    if (m_mapTransactions.end() == it) { return nullptr; }
+
+    OT_ASSERT(nullptr != it->second);
+
+    return it->second;
 }
 
 // Return a count of all the transactions in this ledger that are IN REFERENCE
@@ -1172,16 +1446,9 @@ OTTransaction* Ledger::GetTransaction(int64_t lTransactionNum) const
 //
 int32_t Ledger::GetTransactionCountInRefTo(int64_t lReferenceNum) const
 {
-    int32_t nCount = 0;
-
-    for (auto& it : m_mapTransactions) {
-        OTTransaction* pTransaction = it.second;
-        OT_ASSERT(nullptr != pTransaction);
-
-        if (pTransaction->GetReferenceToNum() == lReferenceNum) nCount++;
-    }
+    BuildIndex();
 
-    return nCount;
+    return static_cast<int32_t>(m_mapByReferenceNum.count(lReferenceNum));
 }
 
 // Look up a transaction by transaction number and see if it is in the ledger.
@@ -1191,20 +1458,9 @@ OTTransaction* Ledger::GetTransactionByIndex(int32_t nIndex) const
     // Out of bounds.
     if ((nIndex < 0) || (nIndex >= GetTransactionCount())) return nullptr;
 
-    int32_t nIndexCount = -1;
-
-    for (auto& it : m_mapTransactions) {
-        nIndexCount++;  // On first iteration, this is now 0, same as nIndex.
-        OTTransaction* pTransaction = it.second;
-        OT_ASSERT((nullptr != pTransaction));  // Should always be good.
-
-        // If this transaction is the one at the requested index
-        if (nIndexCount == nIndex) return pTransaction;
-    }
+    BuildIndex();
 
-    return nullptr;  // Should never reach this point, since bounds are checked
-                     // at
-                     // the top.
+    return m_vecByPosition.at(static_cast<std::size_t>(nIndex)).second;
 }
 
 // Nymbox-only.
@@ -1212,75 +1468,16 @@ OTTransaction* Ledger::GetTransactionByIndex(int32_t nIndex) const
 //
 OTTransaction* Ledger::GetReplyNotice(const int64_t& lRequestNum)
 {
-    // loop through the transactions that make up this ledger.
-    for (auto& it : m_mapTransactions) {
-        OTTransaction* pTransaction = it.second;
-        OT_ASSERT(nullptr != pTransaction);
+    BuildIndex();
 
-        if (OTTransaction::replyNotice != pTransaction->GetType())  // <=======
-            continue;
-
-        if (pTransaction->GetRequestNum() == lRequestNum) return pTransaction;
-    }
-
-    return nullptr;
+    return index_find(m_mapReplyNoticeByRequestNum, lRequestNum);
 }
 
 OTTransaction* Ledger::GetTransferReceipt(int64_t lNumberOfOrigin)
 {
-    // loop through the transactions that make up this ledger.
-    for (auto& it : m_mapTransactions) {
-        OTTransaction* pTransaction = it.second;
-        OT_ASSERT(nullptr != pTransaction);
-
-        if (OTTransaction::transferReceipt == pTransaction->GetType()) {
-            String strReference;
-            pTransaction->GetReferenceString(strReference);
-
-            std::unique_ptr<Item> pOriginalItem(
-                Item::CreateItemFromString(
-                    strReference,
-                    pTransaction->GetPurportedNotaryID(),
-                    pTransaction->GetReferenceToNum()));
-            OT_ASSERT(nullptr != pOriginalItem);
-
-            if (pOriginalItem->GetType() != Item::acceptPending) {
-                otErr << "OTLedger::" << __FUNCTION__
-                      << ": Wrong item type attached to transferReceipt!\n";
-                return nullptr;
-            } else {
-                // Note: the acceptPending USED to be "in reference to" whatever
-                // the pending
-                // was in reference to. (i.e. the original transfer.) But since
-                // the KacTech
-                // bug fix (for accepting multiple transfer receipts) the
-                // acceptPending is now
-                // "in reference to" the pending itself, instead of the original
-                // transfer.
-                //
-                // It used to be that a caller of GetTransferReceipt would pass
-                // in the InRefTo
-                // expected from the pending in the outbox, and match it to the
-                // InRefTo found
-                // on the acceptPending (inside the transferReceipt) in the
-                // inbox.
-                // But this is no longer possible, since the acceptPending is no
-                // longer InRefTo
-                // whatever the pending is InRefTo.
-                //
-                // Therefore, in this place, it is now necessary to pass in the
-                // NumberOfOrigin,
-                // and compare it to the NumberOfOrigin, to find the match.
-                //
-                if (pOriginalItem->GetNumberOfOrigin() == lNumberOfOrigin)
-                    //              if (pOriginalItem->GetReferenceToNum() ==
-                    // lTransactionNum)
-                    return pTransaction;  // FOUND IT!
-            }
-        }
-    }
+    BuildReceiptIndex();
 
-    return nullptr;
+    return index_find(m_mapTransferReceiptByOrigin, lNumberOfOrigin);
 }
 
 // This method loops through all the receipts in the ledger (inbox usually),
@@ -1307,90 +1504,45 @@ OTTransaction* Ledger::GetChequeReceipt(
                            // RESPONSIBLE
                            // TO DELETE.
 {
-    for (auto& it : m_mapTransactions) {
-        OTTransaction* pCurrentReceipt = it.second;
-        OT_ASSERT(nullptr != pCurrentReceipt);
+    BuildReceiptIndex();
 
-        if ((pCurrentReceipt->GetType() != OTTransaction::chequeReceipt) &&
-            (pCurrentReceipt->GetType() != OTTransaction::voucherReceipt))
-            continue;
+    OTTransaction* pCurrentReceipt =
+        index_find(m_mapChequeReceiptByChequeNum, lChequeNum);
 
-        String strDepositChequeMsg;
-        pCurrentReceipt->GetReferenceString(strDepositChequeMsg);
+    if (nullptr == pCurrentReceipt) { return nullptr; }
 
-        std::unique_ptr<Item> pOriginalItem(
-            Item::CreateItemFromString(
-                strDepositChequeMsg,
-                GetPurportedNotaryID(),
-                pCurrentReceipt->GetReferenceToNum()));
+    if (nullptr == ppChequeOut) { return pCurrentReceipt; }
 
-        if (nullptr == pOriginalItem) {
-            otErr << __FUNCTION__
-                  << ": Expected original depositCheque request item to be "
-                     "inside the chequeReceipt "
-                     "(but failed to load it...)\n";
-        } else if (Item::depositCheque != pOriginalItem->GetType()) {
-            String strItemType;
-            pOriginalItem->GetTypeString(strItemType);
-            otErr << __FUNCTION__
-                  << ": Expected original depositCheque request item to be "
-                     "inside the chequeReceipt, "
-                     "but somehow what we found instead was a "
-                  << strItemType << "...\n";
-        } else {
-            // Get the cheque from the Item and load it up into a Cheque object.
-            //
-            String strCheque;
-            pOriginalItem->GetAttachment(strCheque);
+    // The caller wants the cheque as well, so load it from this one receipt.
+    // (BuildReceiptIndex already verified that this succeeds.)
+    String strDepositChequeMsg;
+    pCurrentReceipt->GetReferenceString(strDepositChequeMsg);
 
-            Cheque* pCheque = new Cheque;
-            OT_ASSERT(nullptr != pCheque);
-            std::unique_ptr<Cheque> theChequeAngel(pCheque);
+    std::unique_ptr<Item> pOriginalItem(
+        Item::CreateItemFromString(
+            strDepositChequeMsg,
+            GetPurportedNotaryID(),
+            pCurrentReceipt->GetReferenceToNum()));
+    OT_ASSERT(nullptr != pOriginalItem);
 
-            if (!((strCheque.GetLength() > 2) &&
-                  pCheque->LoadContractFromString(strCheque))) {
-                otErr << __FUNCTION__ << ": Error loading cheque from string:\n"
-                      << strCheque << "\n";
-            }
-            // NOTE: Technically we don'T NEED to load up the cheque anymore,
-            // since
-            // we could just check the NumberOfOrigin, which should already
-            // match the
-            // transaction number on the cheque.
-            // However, even that would have to load up the cheque once, if it
-            // wasn't
-            // already set, and this function already must RETURN a copy of the
-            // cheque
-            // (at least optionally), so we might as well just load it up,
-            // verify it,
-            // and return it. (That's why we are still loading the cheque here
-            // instead
-            // of checking the number of origin.)
-            else {
-                // Success loading the cheque.
-                // Let's see if it's the right cheque...
-                if (pCheque->GetTransactionNum() == lChequeNum) {
-                    // We found it! Let's return a pointer to pCurrentReceipt
+    String strCheque;
+    pOriginalItem->GetAttachment(strCheque);
 
-                    // Also return pCheque, if the caller wants it (otherwise
-                    // delete it.)
-                    //
-                    if (nullptr !=
-                        ppChequeOut)  // caller wants us to return the
-                                      // cheque pointer as well.
-                    {
-                        (*ppChequeOut) =
-                            pCheque;  // now caller is responsible to delete.
-                        theChequeAngel.release();
-                    }
+    Cheque* pCheque = new Cheque;
+    OT_ASSERT(nullptr != pCheque);
+    std::unique_ptr<Cheque> theChequeAngel(pCheque);
 
-                    return pCurrentReceipt;
-                }
-            }
-        }
+    if (!pCheque->LoadContractFromString(strCheque)) {
+        otErr << __FUNCTION__ << ": Error loading cheque from string:\n"
+              << strCheque << "\n";
+
+        return nullptr;
     }
 
-    return nullptr;
+    (*ppChequeOut) = pCheque;  // now caller is responsible to delete.
+    theChequeAngel.release();
+
+    return pCurrentReceipt;
 }
 
 // Find the finalReceipt in this Inbox, that has lTransactionNum as its "in
@@ -1409,15 +1561,15 @@ OTTransaction* Ledger::GetChequeReceipt(
 //
 OTTransaction* Ledger::GetFinalReceipt(int64_t lReferenceNum)
 {
-    // loop through the transactions that make up this ledger.
-    for (auto& it : m_mapTransactions) {
-        OTTransaction* pTransaction = it.second;
-        OT_ASSERT(nullptr != pTransaction);
+    BuildIndex();
 
-        if (OTTransaction::finalReceipt != pTransaction->GetType())  // <=======
-            continue;
+    auto range = m_mapByReferenceNum.equal_range(lReferenceNum);
 
-        if (pTransaction->GetReferenceToNum() == lReferenceNum)
+    for (auto it = range.first; it != range.second; ++it) {
+        OTTransaction* pTransaction = it->second;
+        OT_ASSERT(nullptr != pTransaction);
+
+        if (OTTransaction::finalReceipt == pTransaction->GetType())  // <=======
             return pTransaction;
     }
 
@@ -2118,6 +2270,7 @@ int32_t Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
                         //
                         m_mapTransactions[pTransaction->GetTransactionNum()] =
                             pTransaction;
+                        InvalidateIndex();
                         pTransaction->SetParent(*this);
                         //                      otLog5 << "Loaded abbreviated
                         // transaction and adding to m_mapTransactions in
@@ -2286,6 +2439,7 @@ int32_t Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
                 //
                 m_mapTransactions[pTransaction->GetTransactionNum()] =
                     pTransaction;
+                InvalidateIndex();
                 pTransaction->SetParent(*this);
                 //                otLog5 << "Loaded full transaction and adding
                 // to m_mapTransactions in OTLedger\n");
@@ -2383,6 +2537,8 @@ void Ledger::ReleaseTransactions()
 {
     // If there were any dynamically allocated objects, clean them up here.
 
+    InvalidateIndex();
+
     while (!m_mapTransactions.empty()) {
         OTTransaction* pTransaction = m_mapTransactions.begin()->second;
         m_mapTransactions.erase(m_mapTransactions.begin());
@@ -42,6 +42,7 @@
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/core/util/RingBuffer.hpp"
 #include "opentxs/core/util/stacktrace.h"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/Version.hpp"
@@ -72,18 +73,23 @@
 #include <sys/types.h>
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
 #include <deque>
 #include <exception>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <typeinfo>
+#include <vector>
 
 #define LOG_DEQUE_SIZE 1024
+#define LOG_QUEUE_SIZE 8192
+#define LOG_FLUSH_INTERVAL_MS 10
 
 extern "C" {
 
@@ -142,6 +148,74 @@ struct sigcontext
 namespace opentxs
 {
 
+class Log::Writer
+{
+public:
+    /** A line waiting for the flusher thread. */
+    struct Entry {
+        bool m_bMemlog{false};
+        std::string m_strText;
+    };
+
+    RingBuffer<Entry> m_queue{LOG_QUEUE_SIZE};
+    std::unique_ptr<std::thread> m_pFlusher;
+    std::unique_ptr<std::ofstream> m_pLogFile;
+    std::atomic<bool> m_bRunning{false};
+    std::atomic<uint64_t> m_lQueued{0};
+    std::atomic<uint64_t> m_lWritten{0};
+    std::mutex m_flushLock;
+    std::condition_variable m_flushCondition;
+
+    void Start(const String& strLogFilePath);
+    void Stop();
+
+private:
+    void Flusher();
+    void WriteEntry(const Entry& entry);
+};
+
+namespace
+{
+/** Collects one thread's output for one OTLogStream until a line is
+ *  complete. */
+class LineBuffer : public std::streambuf
+{
+public:
+    std::string m_strLines;
+    std::size_t m_lComplete{0};
+
+protected:
+    int overflow(int c) override
+    {
+        if (traits_type::eof() == c) return traits_type::not_eof(c);
+
+        m_strLines.push_back(static_cast<char>(c));
+
+        // Very long lines are logged in pieces.
+        if (('\n' == c) || (1000 <= m_strLines.size() - m_lComplete)) {
+            m_lComplete = m_strLines.size();
+        }
+
+        return c;
+    }
+};
+
+class ThreadStream : public std::ostream
+{
+public:
+    LineBuffer m_buffer;
+
+    ThreadStream()
+        : std::ostream(nullptr)
+    {
+        rdbuf(&m_buffer);
+    }
+};
+
+std::atomic<std::size_t> stream_count_{0};
+thread_local std::vector<std::unique_ptr<ThreadStream>> thread_streams_;
+} // namespace
+
 Log* Log::pLogger = nullptr;
 
 const String Log::m_strVersion = OPENTXS_VERSION_STRING;
@@ -158,36 +232,69 @@ OTLOG_IMPORT OTLogStream otLog5(5); // logs using OTLog::vOutput(5)
 OTLogStream::OTLogStream(int _logLevel)
     : std::ostream(this)
     , logLevel(_logLevel)
-    , next(0)
-    , pBuffer(new char[1024])
+    , index_(stream_count_.fetch_add(1))
 {
+    Enable(Log::LogLevel());
 }
 
-OTLogStream::~OTLogStream()
+void OTLogStream::Enable(const int32_t nLogLevel)
 {
-    delete[] pBuffer;
-    pBuffer = nullptr;
+    const bool bEnabled =
+        (logLevel < 0) || ((-1 != nLogLevel) && (logLevel <= nLogLevel));
+
+    enabled_.store(bEnabled, std::memory_order_relaxed);
 }
 
-int OTLogStream::overflow(int c)
+OTLogStream::~OTLogStream() {}
+
+std::ostream& OTLogStream::thread_stream()
 {
-    pBuffer[next++] = c;
-    if (c != '\n' && next < 1000) {
-        return 0;
-    }
+    if (thread_streams_.size() <= index_) thread_streams_.resize(index_ + 1);
+
+    auto& stream = thread_streams_[index_];
+
+    if (!stream) stream.reset(new ThreadStream);
+
+    return *stream;
+}
+
+void OTLogStream::write_lines(std::ostream& stream)
+{
+    auto& buffer = static_cast<ThreadStream&>(stream).m_buffer;
+
+    if (0 == buffer.m_lComplete) return;
 
-    pBuffer[next++] = '\0';
-    next = 0;
+    const std::string lines = buffer.m_strLines.substr(0, buffer.m_lComplete);
+    buffer.m_strLines.erase(0, buffer.m_lComplete);
+    buffer.m_lComplete = 0;
 
     if (logLevel < 0) {
-        Log::Error(pBuffer);
-        return 0;
+        Log::Error(lines.c_str());
+    } else {
+        Log::Output(logLevel, lines.c_str());
+    }
+}
+
+int OTLogStream::overflow(int c)
+{
+    if (std::streambuf::traits_type::eof() == c) {
+        return std::streambuf::traits_type::not_eof(c);
     }
 
-    Log::Output(logLevel, pBuffer);
-    return 0;
+    std::ostream& stream = thread_stream();
+    stream.put(static_cast<char>(c));
+    write_lines(stream);
+
+    return c;
 }
 
+Log::Log()
+    : m_pWriter(new Writer)
+{
+}
+
+Log::~Log() {}
+
 //  OTLog Init, must run this before using any OTLog function.
 
 // static
@@ -247,6 +354,8 @@ bool Log::Init(const String& strThreadContext, const int32_t& nLogLevel)
             }
 
         pLogger->m_bInitialized = true;
+        UpdateStreams();
+        pLogger->m_pWriter->Start(pLogger->m_strLogFilePath);
 
         // Set the new log-assert function pointer.
         Assert* pLogAssert = new Assert(Log::logAssert);
@@ -271,8 +380,10 @@ bool Log::IsInitialized()
 bool Log::Cleanup()
 {
     if (nullptr != pLogger) {
+        pLogger->m_pWriter->Stop();
         delete pLogger;
         pLogger = nullptr;
+        UpdateStreams();
         return true;
     }
     return false;
@@ -286,6 +397,173 @@ bool Log::CheckLogger(Log* pLogger)
     OT_FAIL;
 }
 
+// static
+void Log::UpdateStreams()
+{
+    const int32_t nLogLevel = LogLevel();
+
+    otErr.Enable(nLogLevel);
+    otInfo.Enable(nLogLevel);
+    otOut.Enable(nLogLevel);
+    otWarn.Enable(nLogLevel);
+    otLog3.Enable(nLogLevel);
+    otLog4.Enable(nLogLevel);
+    otLog5.Enable(nLogLevel);
+}
+
+void Log::Writer::Start(const String& strLogFilePath)
+{
+    if (m_bRunning.load()) return;
+
+    if (strLogFilePath.Exists()) {
+        m_pLogFile.reset(
+            new std::ofstream(strLogFilePath.Get(), std::ios::app));
+
+        if (m_pLogFile->fail()) m_pLogFile.reset();
+    }
+
+    m_bRunning.store(true);
+    m_pFlusher.reset(new std::thread(&Log::Writer::Flusher, this));
+}
+
+void Log::Writer::Stop()
+{
+    if (!m_bRunning.exchange(false)) return;
+
+    m_flushCondition.notify_all();
+
+    if (m_pFlusher && m_pFlusher->joinable()) m_pFlusher->join();
+
+    m_pFlusher.reset();
+
+    // Anything queued after the flusher made its final pass.
+    Entry entry;
+    while (m_queue.Pop(entry)) WriteEntry(entry);
+
+    if (m_pLogFile) m_pLogFile->flush();
+
+    m_pLogFile.reset();
+}
+
+// Writes everything currently in the queue, flushing the outputs once per
+// batch instead of once per line.
+void Log::Writer::Flusher()
+{
+    bool bStop = false;
+
+    while (!bStop) {
+        bStop = !m_bRunning.load();
+        uint64_t written = 0;
+        Entry entry;
+
+        while (m_queue.Pop(entry)) {
+            WriteEntry(entry);
+            ++written;
+        }
+
+        if (0 < written) {
+            std::cerr.flush();
+
+            if (m_pLogFile) m_pLogFile->flush();
+        }
+
+        std::unique_lock<std::mutex> lock(m_flushLock);
+
+        if (0 < written) {
+            m_lWritten.fetch_add(written);
+            m_flushCondition.notify_all();
+        }
+
+        if (!bStop && m_bRunning.load()) {
+            m_flushCondition.wait_for(
+                lock, std::chrono::milliseconds(LOG_FLUSH_INTERVAL_MS));
+        }
+    }
+}
+
+void Log::Writer::WriteEntry(const Entry& entry)
+{
+    std::cerr << entry.m_strText;
+
+    if (m_pLogFile) *m_pLogFile << entry.m_strText;
+
+    if (entry.m_bMemlog && !entry.m_strText.empty() &&
+        Log::IsInitialized()) {
+        Log::PushMemlogFront(entry.m_strText.c_str());
+    }
+}
+
+// If the flusher thread is running the line is queued for it, otherwise
+// (before Init or after Cleanup) it is written immediately.
+//
+// static
+bool Log::Write(const char* szText, bool bMemlog)
+{
+    if (nullptr == szText) return false;
+
+    Log* pLog = pLogger;
+    const bool bHaveLogger = (nullptr != pLog) && pLog->m_bInitialized;
+
+    if (bHaveLogger && pLog->m_pWriter->m_bRunning.load()) {
+        Writer& writer = *pLog->m_pWriter;
+        Writer::Entry entry;
+        entry.m_bMemlog = bMemlog;
+        entry.m_strText = szText;
+
+        // When the queue is full, wait for the flusher rather than lose the
+        // line.
+        while (!writer.m_queue.Push(std::move(entry))) {
+            writer.m_flushCondition.notify_all();
+            std::this_thread::yield();
+        }
+
+        writer.m_lQueued.fetch_add(1);
+
+        return pLog->m_strLogFilePath.Exists();
+    }
+
+    std::cerr << szText;
+    std::cerr.flush();
+
+    bool bSuccess = false;
+
+    if (bHaveLogger) {
+        if (bMemlog && ('\0' != szText[0])) Log::PushMemlogFront(szText);
+
+        // Append to logfile
+        if (('\0' != szText[0]) && (pLog->m_strLogFilePath.Exists())) {
+            std::ofstream logfile;
+            logfile.open(Log::LogFilePath(), std::ios::app);
+
+            if (!logfile.fail()) {
+                logfile << szText;
+                logfile.close();
+                bSuccess = true;
+            }
+        }
+    }
+
+    return bSuccess;
+}
+
+// static
+void Log::Flush()
+{
+    Log* pLog = pLogger;
+
+    if ((nullptr == pLog) || !pLog->m_pWriter->m_bRunning.load()) return;
+
+    Writer& writer = *pLog->m_pWriter;
+    const uint64_t target = writer.m_lQueued.load();
+    std::unique_lock<std::mutex> lock(writer.m_flushLock);
+    writer.m_flushCondition.notify_all();
+
+    while ((writer.m_lWritten.load() < target) && writer.m_bRunning.load()) {
+        writer.m_flushCondition.wait_for(
+            lock, std::chrono::milliseconds(LOG_FLUSH_INTERVAL_MS));
+    }
+}
+
 // OTLog Constants.
 
 // Compiled into OTLog:
@@ -341,6 +619,7 @@ bool Log::SetLogLevel(const int32_t& nLogLevel)
     }
     else {
         pLogger->m_nLogLevel = nLogLevel;
+        UpdateStreams();
         return true;
     }
 }
@@ -355,48 +634,21 @@ bool Log::SetLogLevel(const int32_t& nLogLevel)
 // static
 bool Log::LogToFile(const String& strOutput)
 {
-    // We now do this either way.
-    {
-        std::cerr << strOutput;
-        std::cerr.flush();
-    }
-
-    // now log to file, if we can.
-
-    bool bHaveLogger(false);
-    if (nullptr != pLogger)
-        if (pLogger->IsInitialized()) bHaveLogger = true;
-
-    // lets check if we are Initialized in this context
-    if (bHaveLogger) CheckLogger(Log::pLogger);
-
-    bool bSuccess = false;
-
-    if (bHaveLogger) {
-        // Append to logfile
-        if ((strOutput.Exists()) && (Log::pLogger->m_strLogFilePath.Exists())) {
-            std::ofstream logfile;
-            logfile.open(Log::LogFilePath(), std::ios::app);
-
-            if (!logfile.fail()) {
-                logfile << strOutput;
-                logfile.close();
-                bSuccess = true;
-            }
-        }
-    }
-
-    return bSuccess;
+    return Write(strOutput.Get(), false);
 }
 
 String Log::GetMemlogAtIndex(int32_t nIndex)
 {
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
+    // Lines still queued for the flusher belong in the memlog.
+    Flush();
 
     uint32_t uIndex = static_cast<uint32_t>(nIndex);
+    std::unique_lock<std::mutex> lock(Log::pLogger->m_memlogLock);
 
     if ((nIndex < 0) || (uIndex >= Log::pLogger->logDeque.size())) {
+        lock.unlock();
         otErr << __FUNCTION__ << ": index out of bounds: " << nIndex << "\n";
         return "";
     }
@@ -420,6 +672,9 @@ int32_t Log::GetMemlogSize()
 {
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
+    // Lines still queued for the flusher belong in the memlog.
+    Flush();
+    std::lock_guard<std::mutex> lock(Log::pLogger->m_memlogLock);
 
     return static_cast<int32_t>(Log::pLogger->logDeque.size());
 }
@@ -428,6 +683,9 @@ String Log::PeekMemlogFront()
 {
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
+    // Lines still queued for the flusher belong in the memlog.
+    Flush();
+    std::lock_guard<std::mutex> lock(Log::pLogger->m_memlogLock);
 
     if (Log::pLogger->logDeque.size() <= 0) return nullptr;
 
@@ -448,6 +706,9 @@ String Log::PeekMemlogBack()
 {
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
+    // Lines still queued for the flusher belong in the memlog.
+    Flush();
+    std::lock_guard<std::mutex> lock(Log::pLogger->m_memlogLock);
 
     if (Log::pLogger->logDeque.size() <= 0) return nullptr;
 
@@ -469,6 +730,9 @@ bool Log::PopMemlogFront()
 {
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
+    // Lines still queued for the flusher belong in the memlog.
+    Flush();
+    std::lock_guard<std::mutex> lock(Log::pLogger->m_memlogLock);
 
     if (Log::pLogger->logDeque.size() <= 0) return false;
 
@@ -486,6 +750,9 @@ bool Log::PopMemlogBack()
 {
     // lets check if we are Initialized in this context
     CheckLogger(Log::pLogger);
+    // Lines still queued for the flusher belong in the memlog.
+    Flush();
+    std::lock_guard<std::mutex> lock(Log::pLogger->m_memlogLock);
 
     if (Log::pLogger->logDeque.size() <= 0) return false;
 
@@ -506,11 +773,13 @@ bool Log::PushMemlogFront(const String& strLog)
 
     OT_ASSERT(strLog.Exists());
 
+    std::lock_guard<std::mutex> lock(Log::pLogger->m_memlogLock);
     Log::pLogger->logDeque.push_front(new String(strLog));
 
+    // We start removing from the back when it reaches this size.
     if (Log::pLogger->logDeque.size() > LOG_DEQUE_SIZE) {
-        Log::PopMemlogBack(); // We start removing from the back when it
-                              // reaches this size.
+        delete Log::pLogger->logDeque.back();
+        Log::pLogger->logDeque.pop_back();
     }
 
     return true;
@@ -537,10 +806,9 @@ size_t Log::logAssert(const char* szFilename, size_t nLinenumber,
 {
     if (nullptr != szMessage) {
 #ifndef ANDROID // if NOT android
-        std::cerr << szMessage << "\n";
-
         LogToFile(szMessage);
         LogToFile("\n");
+        Flush();
 
 #else // if Android
         __android_log_write(ANDROID_LOG_FATAL, "OT Assert (or Fail)",
@@ -559,6 +827,7 @@ size_t Log::logAssert(const char* szFilename, size_t nLinenumber,
         strTemp.Format("\nOT_ASSERT in %s at line %" PRI_SIZE "\n", szFilename,
                        nLinenumber);
         LogToFile(strTemp.Get());
+        Flush();
 
 #else // if Android
         String strAndroidAssertMsg;
@@ -593,12 +862,10 @@ void Log::Output(int32_t nVerbosity, const char* szOutput)
         (LogLevel() == (-1)))
         return;
 
-    // We store the last 1024 logs so programmers can access them via the API.
-    if (bHaveLogger) Log::PushMemlogFront(szOutput);
-
 #ifndef ANDROID // if NOT android
 
-    LogToFile(szOutput);
+    // We store the last 1024 logs so programmers can access them via the API.
+    Write(szOutput, bHaveLogger);
 
 #else // if IS Android
     /*
@@ -645,9 +912,9 @@ void Log::vOutput(int32_t nVerbosity, const char* szOutput, ...)
     if (bHaveLogger) CheckLogger(Log::pLogger);
 
     // If log level is 0, and verbosity of this message is 2, don't bother
-    // logging it.
-    if (((0 != LogLevel()) && (nVerbosity > LogLevel())) ||
-        (nullptr == szOutput))
+    // formatting it, since Output would drop it anyway.
+    if ((nVerbosity > LogLevel()) || (nullptr == szOutput) ||
+        (LogLevel() == (-1)))
         return;
 
     va_list args;
@@ -666,6 +933,54 @@ void Log::vOutput(int32_t nVerbosity, const char* szOutput, ...)
     return;
 }
 
+// static
+void Log::Structured(
+    int32_t nVerbosity,
+    const char* szEvent,
+    const LogFields& fields)
+{
+    if ((nVerbosity > LogLevel()) || (nullptr == szEvent) ||
+        (LogLevel() == (-1)))
+        return;
+
+    std::string strOutput(szEvent);
+
+    for (auto& it : fields) {
+        const std::string& value = it.second;
+        const bool bQuote =
+            value.empty() ||
+            (std::string::npos != value.find_first_of(" \"=\\\n"));
+
+        strOutput += " ";
+        strOutput += it.first;
+        strOutput += "=";
+
+        if (!bQuote) {
+            strOutput += value;
+            continue;
+        }
+
+        strOutput += "\"";
+
+        for (auto& c : value) {
+            if ('\n' == c) {
+                strOutput += "\\n";
+                continue;
+            }
+
+            if (('"' == c) || ('\\' == c)) strOutput += "\\";
+
+            strOutput += c;
+        }
+
+        strOutput += "\"";
+    }
+
+    strOutput += "\n";
+
+    Log::Output(nVerbosity, strOutput.c_str());
+}
+
 // the vError name is to avoid name conflicts
 void Log::vError(const char* szError, ...)
 {
@@ -709,12 +1024,10 @@ void Log::Error(const char* szError)
 
     if ((nullptr == szError)) return;
 
-    // We store the last 1024 logs so programmers can access them via the API.
-    if (bHaveLogger) Log::PushMemlogFront(szError);
-
 #ifndef ANDROID // if NOT android
 
-    LogToFile(szError);
+    // We store the last 1024 logs so programmers can access them via the API.
+    Write(szError, bHaveLogger);
 
 #else // if Android
     __android_log_write(ANDROID_LOG_ERROR, "OT Error", szError);
@@ -2622,6 +2622,235 @@ RegisterStrategy StrategyGetBoxReceiptResponse::reg(
     "getBoxReceiptResponse",
     new StrategyGetBoxReceiptResponse());
 
+class StrategyGetBoxReceipts : public OTMessageStrategy
+{
+public:
+    virtual void writeXml(Message& m, Tag& parent)
+    {
+        TagPtr pTag(new Tag(m.m_strCommand.Get()));
+
+        pTag->add_attribute("requestNum", m.m_strRequestNum.Get());
+        pTag->add_attribute("nymID", m.m_strNymID.Get());
+        pTag->add_attribute("notaryID", m.m_strNotaryID.Get());
+        // If retrieving box receipts for Nymbox, NymID
+        // will appear in this variable.
+        pTag->add_attribute("accountID", m.m_strAcctID.Get());
+        pTag->add_attribute(
+            "boxType",  // outbox is 2.
+            (m.m_lDepth == 0) ? "nymbox"
+                              : ((m.m_lDepth == 1) ? "inbox" : "outbox"));
+
+        // The requested transaction numbers, as a NumList.
+        if (m.m_ascPayload.GetLength()) {
+            pTag->add_tag("transactionNums", m.m_ascPayload.Get());
+        }
+
+        parent.add_tag(pTag);
+    }
+
+    int32_t processXml(Message& m, irr::io::IrrXMLReader*& xml)
+    {
+        m.m_strCommand = xml->getNodeName();  // Command
+        m.m_strNymID = xml->getAttributeValue("nymID");
+        m.m_strNotaryID = xml->getAttributeValue("notaryID");
+        m.m_strAcctID = xml->getAttributeValue("accountID");
+        m.m_strRequestNum = xml->getAttributeValue("requestNum");
+
+        const String strBoxType = xml->getAttributeValue("boxType");
+
+        if (strBoxType.Compare("nymbox"))
+            m.m_lDepth = 0;
+        else if (strBoxType.Compare("inbox"))
+            m.m_lDepth = 1;
+        else if (strBoxType.Compare("outbox"))
+            m.m_lDepth = 2;
+        else {
+            m.m_lDepth = 0;
+            otErr << "Error in OTMessage::ProcessXMLNode:\n"
+                     "Expected boxType to be inbox, outbox, or nymbox, in "
+                     "getBoxReceipts\n";
+            return (-1);
+        }
+
+        const char* pElementExpected = "transactionNums";
+        OTASCIIArmor& ascTextExpected = m.m_ascPayload;
+
+        if (!Contract::LoadEncodedTextFieldByName(
+                xml, ascTextExpected, pElementExpected)) {
+            otErr << "Error in OTMessage::ProcessXMLNode: "
+                     "Expected "
+                  << pElementExpected << " element with text field, for "
+                  << m.m_strCommand << ".\n";
+            return (-1);  // error condition
+        }
+
+        otWarn << "\n Command: " << m.m_strCommand
+               << " \n NymID:    " << m.m_strNymID
+               << "\n AccountID:    " << m.m_strAcctID << "\n"
+                                                          " NotaryID: "
+               << m.m_strNotaryID << "\n Request#: " << m.m_strRequestNum
+               << "   boxType: "
+               << ((m.m_lDepth == 0) ? "nymbox" : (m.m_lDepth == 1) ? "inbox"
+                                                                    : "outbox")
+               << "\n\n";  // outbox is 2.);
+
+        return 1;
+    }
+    static RegisterStrategy reg;
+};
+RegisterStrategy StrategyGetBoxReceipts::reg(
+    "getBoxReceipts",
+    new StrategyGetBoxReceipts());
+
+class StrategyGetBoxReceiptsResponse : public OTMessageStrategy
+{
+public:
+    virtual void writeXml(Message& m, Tag& parent)
+    {
+        TagPtr pTag(new Tag(m.m_strCommand.Get()));
+
+        const bool bHasReceipts = m.m_bSuccess && m.m_ascPayload.GetLength();
+        const bool bHasRemaining = m.m_ascPayload2.GetLength();
+        const bool bHasFailed = m.m_ascPayload3.GetLength();
+
+        pTag->add_attribute("success", formatBool(m.m_bSuccess));
+        pTag->add_attribute("requestNum", m.m_strRequestNum.Get());
+        pTag->add_attribute("nymID", m.m_strNymID.Get());
+        pTag->add_attribute("notaryID", m.m_strNotaryID.Get());
+        pTag->add_attribute("accountID", m.m_strAcctID.Get());
+        pTag->add_attribute(
+            "boxType",  // outbox is 2.
+            (m.m_lDepth == 0) ? "nymbox"
+                              : ((m.m_lDepth == 1) ? "inbox" : "outbox"));
+        pTag->add_attribute("hasReceipts", formatBool(bHasReceipts));
+        pTag->add_attribute("hasRemaining", formatBool(bHasRemaining));
+        pTag->add_attribute("hasFailed", formatBool(bHasFailed));
+
+        if (m.m_ascInReferenceTo.GetLength()) {
+            pTag->add_tag("inReferenceTo", m.m_ascInReferenceTo.Get());
+        }
+
+        // Encoded StringMap of transaction number to box receipt.
+        if (bHasReceipts) {
+            pTag->add_tag("boxReceipts", m.m_ascPayload.Get());
+        }
+
+        // Requested numbers that didn't fit in this reply.
+        if (bHasRemaining) {
+            pTag->add_tag("remaining", m.m_ascPayload2.Get());
+        }
+
+        // Requested numbers the server couldn't load or verify.
+        if (bHasFailed) {
+            pTag->add_tag("failed", m.m_ascPayload3.Get());
+        }
+
+        parent.add_tag(pTag);
+    }
+
+    int32_t processXml(Message& m, irr::io::IrrXMLReader*& xml)
+    {
+        processXmlSuccess(m, xml);
+
+        m.m_strCommand = xml->getNodeName();  // Command
+        m.m_strRequestNum = xml->getAttributeValue("requestNum");
+        m.m_strNymID = xml->getAttributeValue("nymID");
+        m.m_strNotaryID = xml->getAttributeValue("notaryID");
+        m.m_strAcctID = xml->getAttributeValue("accountID");
+
+        const String strBoxType = xml->getAttributeValue("boxType");
+
+        if (strBoxType.Compare("nymbox"))
+            m.m_lDepth = 0;
+        else if (strBoxType.Compare("inbox"))
+            m.m_lDepth = 1;
+        else if (strBoxType.Compare("outbox"))
+            m.m_lDepth = 2;
+        else {
+            m.m_lDepth = 0;
+            otErr << "Error in OTMessage::ProcessXMLNode:\n"
+                     "Expected boxType to be inbox, outbox, or nymbox, in "
+                     "getBoxReceiptsResponse reply\n";
+            return (-1);
+        }
+
+        const String strHasReceipts = xml->getAttributeValue("hasReceipts");
+        const String strHasRemaining = xml->getAttributeValue("hasRemaining");
+        const String strHasFailed = xml->getAttributeValue("hasFailed");
+
+        // inReferenceTo contains the getBoxReceipts (original request)
+
+        {
+            const char* pElementExpected = "inReferenceTo";
+            OTASCIIArmor& ascTextExpected = m.m_ascInReferenceTo;
+
+            if (!Contract::LoadEncodedTextFieldByName(
+                    xml, ascTextExpected, pElementExpected)) {
+                otErr << "Error in OTMessage::ProcessXMLNode: "
+                         "Expected "
+                      << pElementExpected << " element with text field, for "
+                      << m.m_strCommand << ".\n";
+                return (-1);  // error condition
+            }
+        }
+
+        if (strHasReceipts.Compare("true")) {
+            const char* pElementExpected = "boxReceipts";
+            OTASCIIArmor& ascTextExpected = m.m_ascPayload;
+
+            if (!Contract::LoadEncodedTextFieldByName(
+                    xml, ascTextExpected, pElementExpected)) {
+                otErr << "Error in OTMessage::ProcessXMLNode: "
+                         "Expected "
+                      << pElementExpected << " element with text field, for "
+                      << m.m_strCommand << ".\n";
+                return (-1);  // error condition
+            }
+        }
+
+        if (strHasRemaining.Compare("true")) {
+            const char* pElementExpected = "remaining";
+            OTASCIIArmor& ascTextExpected = m.m_ascPayload2;
+
+            if (!Contract::LoadEncodedTextFieldByName(
+                    xml, ascTextExpected, pElementExpected)) {
+                otErr << "Error in OTMessage::ProcessXMLNode: "
+                         "Expected "
+                      << pElementExpected << " element with text field, for "
+                      << m.m_strCommand << ".\n";
+                return (-1);  // error condition
+            }
+        }
+
+        if (strHasFailed.Compare("true")) {
+            const char* pElementExpected = "failed";
+            OTASCIIArmor& ascTextExpected = m.m_ascPayload3;
+
+            if (!Contract::LoadEncodedTextFieldByName(
+                    xml, ascTextExpected, pElementExpected)) {
+                otErr << "Error in OTMessage::ProcessXMLNode: "
+                         "Expected "
+                      << pElementExpected << " element with text field, for "
+                      << m.m_strCommand << ".\n";
+                return (-1);  // error condition
+            }
+        }
+
+        otWarn << "\nCommand: " << m.m_strCommand << "   "
+               << (m.m_bSuccess ? "SUCCESS" : "FAILED")
+               << "\nNymID:    " << m.m_strNymID
+               << "\nAccountID: " << m.m_strAcctID << "\n"
+                                                      "NotaryID: "
+               << m.m_strNotaryID << "\n\n";
+
+        return 1;
+    }
+    static RegisterStrategy reg;
+};
+RegisterStrategy StrategyGetBoxReceiptsResponse::reg(
+    "getBoxReceiptsResponse",
+    new StrategyGetBoxReceiptsResponse());
+
 class StrategyUnregisterAccount : public OTMessageStrategy
 {
 public:
@@ -3076,6 +3305,16 @@ public:
         pTag->add_attribute("notaryID", m.m_strNotaryID.Get());
         pTag->add_attribute("accountID", m.m_strAcctID.Get());
 
+        // Hashes of the boxes the client already has. The server leaves out
+        // any box that still matches.
+        if (m.m_strInboxHash.Exists()) {
+            pTag->add_attribute("inboxHash", m.m_strInboxHash.Get());
+        }
+
+        if (m.m_strOutboxHash.Exists()) {
+            pTag->add_attribute("outboxHash", m.m_strOutboxHash.Get());
+        }
+
         parent.add_tag(pTag);
     }
 
@@ -3086,6 +3325,8 @@ public:
         m.m_strNotaryID = xml->getAttributeValue("notaryID");
         m.m_strAcctID = xml->getAttributeValue("accountID");
         m.m_strRequestNum = xml->getAttributeValue("requestNum");
+        m.m_strInboxHash = xml->getAttributeValue("inboxHash");
+        m.m_strOutboxHash = xml->getAttributeValue("outboxHash");
 
         otWarn << "\nCommand: " << m.m_strCommand
                << "\nNymID:    " << m.m_strNymID
@@ -3116,6 +3357,15 @@ public:
         pTag->add_attribute("inboxHash", m.m_strInboxHash.Get());
         pTag->add_attribute("outboxHash", m.m_strOutboxHash.Get());
 
+        // A box is left out when the client already has it.
+        if (m.m_bSuccess && !m.m_ascPayload2.GetLength()) {
+            pTag->add_attribute("inboxUnchanged", formatBool(true));
+        }
+
+        if (m.m_bSuccess && !m.m_ascPayload3.GetLength()) {
+            pTag->add_attribute("outboxUnchanged", formatBool(true));
+        }
+
         if (m.m_ascInReferenceTo.GetLength()) {
             pTag->add_tag("inReferenceTo", m.m_ascInReferenceTo.Get());
         }
@@ -3147,6 +3397,11 @@ public:
         m.m_strInboxHash = xml->getAttributeValue("inboxHash");
         m.m_strOutboxHash = xml->getAttributeValue("outboxHash");
 
+        const String strInboxUnchanged =
+            xml->getAttributeValue("inboxUnchanged");
+        const String strOutboxUnchanged =
+            xml->getAttributeValue("outboxUnchanged");
+
         if (m.m_bSuccess) {
             if (!Contract::LoadEncodedTextFieldByName(
                     xml, m.m_ascPayload, "account")) {
@@ -3156,7 +3411,8 @@ public:
                 return (-1);  // error condition
             }
 
-            if (!Contract::LoadEncodedTextFieldByName(
+            if (!strInboxUnchanged.Compare("true") &&
+                !Contract::LoadEncodedTextFieldByName(
                     xml, m.m_ascPayload2, "inbox")) {
                 otErr << "Error in OTMessage::ProcessXMLNode: Expected inbox"
                       << " element with text field, for " << m.m_strCommand
@@ -3164,7 +3420,8 @@ public:
                 return (-1);  // error condition
             }
 
-            if (!Contract::LoadEncodedTextFieldByName(
+            if (!strOutboxUnchanged.Compare("true") &&
+                !Contract::LoadEncodedTextFieldByName(
                     xml, m.m_ascPayload3, "outbox")) {
                 otErr << "Error in OTMessage::ProcessXMLNode: Expected outbox"
                       << " element with text field, for " << m.m_strCommand
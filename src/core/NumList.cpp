@@ -42,23 +42,49 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/util/Assert.hpp"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdint>
+#include <limits>
 #include <locale>
 #include <ostream>
 #include <set>
 #include <string>
 
+// The most numbers a single string may add through ranges. Callers expand
+// numlists into std::sets, so a short string must not stand for millions.
+// Output() writes any numbers past this one by one.
+#ifndef OT_MAX_NUMLIST_RANGE
+#define OT_MAX_NUMLIST_RANGE 100000
+#endif
+
 // OTNumList (helper class.)
 
 namespace opentxs
 {
 
+namespace
+{
+
+// How many numbers from first to last, inclusive. (Unsigned, so that ranges
+// wider than INT64_MAX don't overflow.)
+uint64_t range_size(const int64_t first, const int64_t last)
+{
+    return static_cast<uint64_t>(last) - static_cast<uint64_t>(first) + 1;
+}
+
+} // namespace
+
 NumList::NumList(const std::set<int64_t>& theNumbers)
 {
     Add(theNumbers);
 }
 
+NumList::NumList(const NumberSet& theNumbers)
+    : m_setData(theNumbers)
+{
+}
+
 NumList::NumList(int64_t lInput)
 {
     Add(lInput);
@@ -105,7 +131,7 @@ bool NumList::Add(const std::string& strNumbers) // if false, means the
 
 // This function is private, so you can't use it without passing an OTString.
 // (For security reasons.) It takes a comma-separated list of numbers, and adds
-// them to *this.
+// them to *this. An entry may also be a range of numbers, such as "5-9".
 //
 bool NumList::Add(const char* szNumbers) // if false, means the numbers were
                                          // already there. (At least one of
@@ -126,6 +152,9 @@ bool NumList::Add(const char* szNumbers) // if false, means the numbers were
                // set to false when anything else. That way when we go to add
                // the number to the list, and it's "0", we'll know it's a real
                // number we're supposed to add, and not just a default value.
+    bool bInRange = false; // Set after the '-' of a range, until its end.
+    int64_t lRangeStart = 0;
+    uint64_t uRangeTotal = 0; // Numbers added through ranges so far.
 
     for (;;) // We already know it's not null, due to the assert. (So at least
              // one iteration will happen.)
@@ -135,16 +164,48 @@ bool NumList::Add(const char* szNumbers) // if false, means the numbers were
 
             int32_t nDigit = (*pChar - '0');
 
+            if (lNum > (std::numeric_limits<int64_t>::max() - nDigit) / 10) {
+                otErr << "OTNumList::Add: Error: Number too large.\n";
+                bSuccess = false;
+                break;
+            }
+
             lNum *= 10; // Move it up a decimal place.
             lNum += nDigit;
         }
+        // the first number of a range is done, the last one comes next.
+        else if (('-' == *pChar) && bStartedANumber && !bInRange) {
+            lRangeStart = lNum;
+            bInRange = true;
+            lNum = 0;
+            bStartedANumber = false;
+        }
         // if separator, or end of string, either way, add lNum to *this.
         else if ((',' == *pChar) || ('\0' == *pChar) ||
                  std::isspace(*pChar, loc)) // first sign of a space, and we are
                                             // done with current number. (On to
                                             // the next.)
         {
-            if ((lNum > 0) || (bStartedANumber && (0 == lNum))) {
+            if (bInRange) {
+                const uint64_t uCount =
+                    (lNum < lRangeStart) ? 0 : range_size(lRangeStart, lNum);
+
+                if (!bStartedANumber || (0 == uCount) ||
+                    ((OT_MAX_NUMLIST_RANGE - uRangeTotal) < uCount)) {
+                    otErr << "OTNumList::Add: Error: Invalid range of longs: "
+                          << lRangeStart << "-" << lNum << "\n";
+                    bSuccess = false;
+                    break;
+                }
+
+                uRangeTotal += uCount;
+                const auto count = m_setData.insert(lRangeStart, lNum);
+
+                if (count != uCount) {
+                    bSuccess = false; // Some were already there.
+                }
+            }
+            else if ((lNum > 0) || (bStartedANumber && (0 == lNum))) {
                 if (!Add(lNum)) // <=========
                 {
                     bSuccess = false; // We still go ahead and try to add them
@@ -156,6 +217,7 @@ bool NumList::Add(const char* szNumbers) // if false, means the numbers were
             lNum = 0; // reset for the next transaction number (in the
                       // comma-separated list.)
             bStartedANumber = false; // reset
+            bInRange = false;
         }
         else {
             otErr << "OTNumList::Add: Error: Unexpected character found in "
@@ -181,60 +243,39 @@ bool NumList::Add(const char* szNumbers) // if false, means the numbers were
 bool NumList::Add(const int64_t& theValue) // if false, means the value was
                                            // already there.
 {
-    auto it = m_setData.find(theValue);
-
-    if (m_setData.end() == it) // it's not already there, so add it.
-    {
-        m_setData.insert(theValue);
-        return true;
-    }
-    return false; // it was already there.
+    return m_setData.insert(theValue);
 }
 
 bool NumList::Peek(int64_t& lPeek) const
 {
-    auto it = m_setData.begin();
+    if (m_setData.empty()) return false;
 
-    if (m_setData.end() != it) // it's there.
-    {
-        lPeek = *it;
-        return true;
-    }
-    return false;
+    lPeek = m_setData.front();
+
+    return true;
 }
 
 bool NumList::Pop()
 {
-    auto it = m_setData.begin();
+    if (m_setData.empty()) return false;
 
-    if (m_setData.end() != it) // it's there.
-    {
-        m_setData.erase(it);
-        return true;
-    }
-    return false;
+    m_setData.erase(m_setData.front());
+
+    return true;
 }
 
 bool NumList::Remove(const int64_t& theValue) // if false, means the value was
                                               // NOT already there.
 {
-    auto it = m_setData.find(theValue);
-
-    if (m_setData.end() != it) // it's there.
-    {
-        m_setData.erase(it);
-        return true;
-    }
-    return false; // it wasn't there (so how could you remove it then?)
+    // if it wasn't there, how could you remove it?
+    return 1 == m_setData.erase(theValue);
 }
 
 bool NumList::Verify(const int64_t& theValue) const // returns true/false
                                                     // (whether value is
                                                     // already there.)
 {
-    auto it = m_setData.find(theValue);
-
-    return (m_setData.end() == it) ? false : true;
+    return 1 == m_setData.count(theValue);
 }
 
 // True/False, based on whether values are already there.
@@ -258,34 +299,22 @@ bool NumList::Verify(const std::set<int64_t>& theNumbers) const
 ///
 bool NumList::Verify(const NumList& rhs) const
 {
-    // Verify they have the same number of elements.
-    //
-    if (Count() != rhs.Count()) return false;
-
-    // Verify each value on *this is also found on rhs.
-    //
-    for (auto& it : m_setData) {
-        if (!rhs.Verify(it)) return false;
-    }
-
-    return true;
+    return m_setData == rhs.m_setData;
 }
 
 /// True/False, based on whether ANY of the numbers in rhs are found in *this.
 ///
 bool NumList::VerifyAny(const NumList& rhs) const
 {
-    return rhs.VerifyAny(m_setData);
+    return m_setData.intersects(rhs.m_setData);
 }
 
 /// Verify whether ANY of the numbers on *this are found in setData.
 ///
 bool NumList::VerifyAny(const std::set<int64_t>& setData) const
 {
-    for (const auto& it : m_setData) {
-        auto it_find = setData.find(it);
-
-        if (it_find != setData.end()) // found a match.
+    for (const auto& it : setData) {
+        if (Verify(it)) // found a match.
             return true;
     }
 
@@ -296,10 +325,16 @@ bool NumList::Add(const NumList& theNumList) // if false, means the numbers
                                              // were already there. (At
                                              // least one of them.)
 {
-    std::set<int64_t> theOutput;
-    theNumList.Output(theOutput); // returns false if the numlist was empty.
+    bool bSuccess = true;
 
-    return Add(theOutput);
+    for (const auto& range : theNumList.m_setData.ranges()) {
+        const auto count = m_setData.insert(range.first, range.second);
+
+        if (count != range_size(range.first, range.second))
+            bSuccess = false; // Some of them were already there.
+    }
+
+    return bSuccess;
 }
 
 bool NumList::Add(const std::set<int64_t>& theNumbers) // if false, means the
@@ -339,6 +374,14 @@ bool NumList::Remove(const std::set<int64_t>& theNumbers) // if false, means
 bool NumList::Output(std::set<int64_t>& theOutput) const // returns false if
                                                          // the numlist was
                                                          // empty.
+{
+    theOutput = std::set<int64_t>(m_setData.begin(), m_setData.end());
+
+    return !m_setData.empty();
+}
+
+bool NumList::Output(NumberSet& theOutput) const // returns false if the
+                                                 // numlist was empty.
 {
     theOutput = m_setData;
 
@@ -346,23 +389,48 @@ bool NumList::Output(std::set<int64_t>& theOutput) const // returns false if
 }
 
 // Outputs the numlist as a comma-separated string (for serialization, usually.)
+// If bRanges is set, runs of three or more consecutive numbers are written as
+// ranges, up to the OT_MAX_NUMLIST_RANGE numbers that Add() accepts that way.
 //
-bool NumList::Output(String& strOutput) const // returns false if the
-                                              // numlist was empty.
+bool NumList::Output(
+    String& strOutput,
+    const bool bRanges) const // returns false if the numlist was empty.
 {
-    int32_t nIterationCount = 0;
+    // Built here and appended once, since String::Concatenate copies the
+    // whole string each time.
+    std::string output;
+    uint64_t uRangeBudget = bRanges ? OT_MAX_NUMLIST_RANGE : 0;
+
+    for (auto& it : m_setData.ranges()) {
+        int64_t lNext = it.first;
+        const uint64_t uCount =
+            std::min(range_size(it.first, it.second), uRangeBudget);
+
+        if (!output.empty()) output += ",";
+
+        if (3 <= uCount) {
+            const int64_t lLast = it.first + static_cast<int64_t>(uCount - 1);
 
-    for (auto& it : m_setData) {
-        nIterationCount++;
+            output += std::to_string(it.first) + "-" + std::to_string(lLast);
+            uRangeBudget -= uCount;
 
-        strOutput.Concatenate(
-            "%s%" PRId64,
-            // If first iteration, prepend a blank string (instead of a comma.)
-            // Like this:  "%" PRId64 ""
-            // But for all subsequent iterations, concatenate: ",%" PRId64 ""
-            (1 == nIterationCount) ? "" : ",", it);
+            if (lLast == it.second) { continue; }
+
+            output += ",";
+            lNext = lLast + 1;
+        }
+
+        for (;; ++lNext) {
+            output += std::to_string(lNext);
+
+            if (lNext == it.second) { break; }
+
+            output += ",";
+        }
     }
 
+    if (!output.empty()) { strOutput.Concatenate(String(output)); }
+
     return !m_setData.empty();
 }
 
@@ -0,0 +1,315 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/core/NumberSet.hpp"
+
+#include "opentxs/core/util/Assert.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace opentxs
+{
+namespace
+{
+typedef NumberSet::value_type value_type;
+
+// True if a range ending at end overlaps or adjoins one starting at start
+bool touches(const value_type end, const value_type start)
+{
+    if (start <= end) { return true; }
+
+    return (std::numeric_limits<value_type>::max() != end) &&
+           (end + 1 == start);
+}
+
+std::size_t width(const value_type first, const value_type last)
+{
+    return static_cast<std::size_t>(
+        static_cast<std::uint64_t>(last) - static_cast<std::uint64_t>(first) +
+        1);
+}
+}  // namespace
+
+NumberSet::const_iterator::const_iterator(
+    const Ranges::const_iterator& range,
+    const Ranges::const_iterator& end)
+    : range_(range)
+    , end_(end)
+    , value_((range == end) ? 0 : range->first)
+{
+}
+
+NumberSet::const_iterator& NumberSet::const_iterator::operator++()
+{
+    OT_ASSERT(end_ != range_);
+
+    if (range_->second == value_) {
+        ++range_;
+
+        if (end_ != range_) {
+            value_ = range_->first;
+        }
+    } else {
+        ++value_;
+    }
+
+    return *this;
+}
+
+NumberSet::const_iterator NumberSet::const_iterator::operator++(int)
+{
+    const_iterator output(*this);
+    ++(*this);
+
+    return output;
+}
+
+bool NumberSet::const_iterator::operator==(const const_iterator& rhs) const
+{
+    if (range_ != rhs.range_) { return false; }
+
+    return (end_ == range_) || (value_ == rhs.value_);
+}
+
+bool NumberSet::const_iterator::operator!=(const const_iterator& rhs) const
+{
+    return !(*this == rhs);
+}
+
+NumberSet::NumberSet(const std::set<value_type>& numbers)
+{
+    for (const auto& number : numbers) {
+        insert(number);
+    }
+}
+
+bool NumberSet::operator==(const NumberSet& rhs) const
+{
+    // Ranges are always merged, so equal sets have identical ranges.
+    return (size_ == rhs.size_) && (ranges_ == rhs.ranges_);
+}
+
+bool NumberSet::operator!=(const NumberSet& rhs) const
+{
+    return !(*this == rhs);
+}
+
+NumberSet::const_iterator NumberSet::begin() const
+{
+    return const_iterator(ranges_.begin(), ranges_.end());
+}
+
+void NumberSet::clear()
+{
+    ranges_.clear();
+    size_ = 0;
+}
+
+std::size_t NumberSet::count(const value_type value) const
+{
+    return (ranges_.end() == find(value)) ? 0 : 1;
+}
+
+NumberSet NumberSet::difference(const NumberSet& rhs) const
+{
+    NumberSet output;
+
+    for (const auto& range : ranges_) {
+        value_type next = range.first;
+        bool finished = false;
+        auto it = rhs.ranges_.upper_bound(range.first);
+
+        if (rhs.ranges_.begin() != it) {
+            --it;
+        }
+
+        for (; (rhs.ranges_.end() != it) && (it->first <= range.second);
+             ++it) {
+            if (it->second < next) { continue; }
+
+            if (it->first > next) {
+                output.insert(next, it->first - 1);
+            }
+
+            if (it->second >= range.second) {
+                finished = true;
+
+                break;
+            }
+
+            next = it->second + 1;
+        }
+
+        if (!finished) {
+            output.insert(next, range.second);
+        }
+    }
+
+    return output;
+}
+
+bool NumberSet::empty() const { return ranges_.empty(); }
+
+NumberSet::const_iterator NumberSet::end() const
+{
+    return const_iterator(ranges_.end(), ranges_.end());
+}
+
+std::size_t NumberSet::erase(const value_type value)
+{
+    const auto it = find(value);
+
+    if (ranges_.end() == it) { return 0; }
+
+    const value_type first = it->first;
+    const value_type last = it->second;
+    ranges_.erase(it);
+
+    if (first < value) {
+        ranges_.emplace(first, value - 1);
+    }
+
+    if (value < last) {
+        ranges_.emplace(value + 1, last);
+    }
+
+    --size_;
+
+    return 1;
+}
+
+NumberSet::Ranges::const_iterator NumberSet::find(const value_type value) const
+{
+    auto it = ranges_.upper_bound(value);
+
+    if (ranges_.begin() == it) { return ranges_.end(); }
+
+    --it;
+
+    return (value <= it->second) ? it : ranges_.end();
+}
+
+NumberSet::value_type NumberSet::front() const
+{
+    OT_ASSERT(!ranges_.empty());
+
+    return ranges_.begin()->first;
+}
+
+bool NumberSet::includes(const NumberSet& rhs) const
+{
+    if (rhs.size_ > size_) { return false; }
+
+    for (const auto& range : rhs.ranges_) {
+        const auto it = find(range.first);
+
+        if (ranges_.end() == it) { return false; }
+
+        if (it->second < range.second) { return false; }
+    }
+
+    return true;
+}
+
+bool NumberSet::insert(const value_type value)
+{
+    return 1 == insert(value, value);
+}
+
+std::size_t NumberSet::insert(const value_type first, const value_type last)
+{
+    if (last < first) { return 0; }
+
+    auto it = ranges_.upper_bound(first);
+
+    if (ranges_.begin() != it) {
+        const auto previous = std::prev(it);
+
+        if (touches(previous->second, first)) {
+            it = previous;
+        }
+    }
+
+    value_type start = first;
+    value_type end = last;
+    std::size_t existing = 0;
+
+    // Absorb every range which overlaps or adjoins the new one.
+    while ((ranges_.end() != it) && touches(end, it->first)) {
+        const value_type low = std::max(first, it->first);
+        const value_type high = std::min(last, it->second);
+
+        if (low <= high) {
+            existing += width(low, high);
+        }
+
+        start = std::min(start, it->first);
+        end = std::max(end, it->second);
+        it = ranges_.erase(it);
+    }
+
+    ranges_.emplace_hint(it, start, end);
+    const std::size_t added = width(first, last) - existing;
+    size_ += added;
+
+    return added;
+}
+
+bool NumberSet::intersects(const NumberSet& rhs) const
+{
+    auto lhsIt = ranges_.begin();
+    auto rhsIt = rhs.ranges_.begin();
+
+    while ((ranges_.end() != lhsIt) && (rhs.ranges_.end() != rhsIt)) {
+        if (lhsIt->second < rhsIt->first) {
+            ++lhsIt;
+        } else if (rhsIt->second < lhsIt->first) {
+            ++rhsIt;
+        } else {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+const NumberSet::Ranges& NumberSet::ranges() const { return ranges_; }
+
+std::size_t NumberSet::size() const { return size_; }
+}  // namespace opentxs
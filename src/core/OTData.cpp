@@ -94,13 +94,47 @@ OTData::OTData(OTData&& other)
     , position_(0)
     , size_(0)
 {
-    data_ = other.data_;
-    position_ = other.position_;
-    size_ = other.size_;
+    swap(other);
+}
+
+// Returns zeroed storage for size bytes, using the inline buffer when it fits.
+void* OTData::Allocate(uint32_t size)
+{
+    if (size <= INLINE_CAPACITY) {
+        OTPassword::zeroMemory(inline_, size);
+
+        return inline_;
+    }
+
+    void* output = static_cast<void*>(new uint8_t[size]{});
+    OT_ASSERT(output != nullptr);
+
+    return output;
+}
+
+void OTData::Free(void* data, uint32_t size) const
+{
+    if (data == nullptr) {
+        return;
+    }
+
+    if (secure_) {
+        OTPassword::zeroMemory(data, size);
+    }
+
+    if (data != inline_) {
+        delete[] static_cast<uint8_t*>(data);
+    }
+}
 
-    other.data_ = nullptr;
-    other.position_ = 0;
-    other.size_ = 0;
+void OTData::SetSecure(bool secure)
+{
+    secure_ = secure;
+}
+
+bool OTData::IsSecure() const
+{
+    return secure_;
 }
 
 bool OTData::operator==(const OTData& rhs) const
@@ -167,10 +201,8 @@ void OTData::zeroMemory() const
 void OTData::Release()
 {
     if (data_ != nullptr) {
-        // For security reasons, we clear the memory to 0 when deleting the
-        // object. (Seems smart.)
-        OTPassword::zeroMemory(data_, size_);
-        delete[] static_cast<uint8_t*>(data_);
+        // Only secure data is cleared to 0 on the way out.
+        Free(data_, size_);
         // If data_ was already nullptr, no need to re-Initialize().
         Initialize();
     }
@@ -178,15 +210,43 @@ void OTData::Release()
 
 OTData& OTData::operator=(OTData rhs)
 {
+    // Secure data stays secure whatever is assigned to it, and the old
+    // contents leave in rhs with the old setting.
+    const bool secure = secure_ || rhs.secure_;
     swap(rhs);
+    secure_ = secure;
     return *this;
 }
 
 void OTData::swap(OTData& rhs)
 {
+    const bool isInline = (data_ == inline_);
+    const bool rhsInline = (rhs.data_ == rhs.inline_);
+
     std::swap(data_, rhs.data_);
     std::swap(position_, rhs.position_);
     std::swap(size_, rhs.size_);
+    std::swap(secure_, rhs.secure_);
+
+    // Inline contents have to move with the pointers that refer to them.
+    if (isInline || rhsInline) {
+        uint8_t temp[INLINE_CAPACITY];
+        std::memcpy(temp, inline_, INLINE_CAPACITY);
+        std::memcpy(inline_, rhs.inline_, INLINE_CAPACITY);
+        std::memcpy(rhs.inline_, temp, INLINE_CAPACITY);
+
+        if (secure_ || rhs.secure_) {
+            OTPassword::zeroMemory(temp, INLINE_CAPACITY);
+        }
+
+        if (rhsInline) {
+            data_ = inline_;
+        }
+
+        if (isInline) {
+            rhs.data_ = rhs.inline_;
+        }
+    }
 }
 
 void OTData::Assign(const OTData& source)
@@ -196,6 +256,10 @@ void OTData::Assign(const OTData& source)
         return;
     }
 
+    if (source.secure_) {
+        secure_ = true;
+    }
+
     if (!source.IsEmpty()) {
         Assign(source.data_, source.size_);
     }
@@ -221,8 +285,7 @@ void OTData::Assign(const void* data, uint32_t size)
     Release();
 
     if (data != nullptr && size > 0) {
-        data_ = static_cast<void*>(new uint8_t[size]{});
-        OT_ASSERT(data_ != nullptr);
+        data_ = Allocate(size);
         OTPassword::safe_memcpy(data_, size, data, size);
         size_ = size;
     }
@@ -233,14 +296,13 @@ bool OTData::Randomize(uint32_t size)
 {
     Release(); // This releases all memory and zeros out all members.
     if (size > 0) {
-        data_ = static_cast<void*>(new uint8_t[size]{});
-        OT_ASSERT(data_ != nullptr);
+        data_ = Allocate(size);
 
         if (!OTPassword::randomizeMemory_uint8(static_cast<uint8_t*>(data_),
                                                size)) {
             // randomizeMemory already logs, so I'm not logging again twice
             // here.
-            delete[] static_cast<uint8_t*>(data_);
+            Free(data_, size);
             data_ = nullptr;
             return false;
         }
@@ -267,32 +329,28 @@ void OTData::Concatenate(const void* data, uint32_t size)
     }
 
     if (GetSize()>0) {
-        void* newData = nullptr;
-        uint32_t newSize = GetSize() + size;
-
-        if (newSize > 0) {
-            newData = static_cast<void*>(new uint8_t[newSize]{});
-            OT_ASSERT(newData != nullptr);
-            OTPassword::zeroMemory(newData, newSize);
-        }
-        // If there's a new memory buffer (for the combined..)
-        if (newData != nullptr) {
-            // if THIS object has data inside of it...
-            if (!IsEmpty()) {
-                // Copy THIS object into the new
-                // buffer, starting at the
-                // beginning.
-                OTPassword::safe_memcpy(newData, newSize, data_, GetSize());
-            }
-
-            // Next we copy the data being appended...
-            OTPassword::safe_memcpy(static_cast<uint8_t*>(newData) + GetSize(),
-                                    newSize - GetSize(), data, size);
+        const uint32_t oldSize = GetSize();
+        const uint32_t newSize = oldSize + size;
+
+        // Inline data with room to spare is appended to in place.
+        if ((data_ == inline_) && (newSize <= INLINE_CAPACITY)) {
+            OTPassword::safe_memcpy(inline_ + oldSize,
+                                    INLINE_CAPACITY - oldSize, data, size);
+            size_ = newSize;
+            return;
         }
 
-        if (data_ != nullptr) {
-            delete[] static_cast<uint8_t*>(data_);
-        }
+        void* newData = static_cast<void*>(new uint8_t[newSize]{});
+        OT_ASSERT(newData != nullptr);
+
+        // Copy THIS object into the new buffer, starting at the beginning.
+        OTPassword::safe_memcpy(newData, newSize, data_, oldSize);
+
+        // Next we copy the data being appended...
+        OTPassword::safe_memcpy(static_cast<uint8_t*>(newData) + oldSize,
+                                newSize - oldSize, data, size);
+
+        Free(data_, oldSize);
 
         data_ = newData;
         size_ = newSize;
@@ -314,9 +372,7 @@ void OTData::SetSize(uint32_t size)
     Release();
 
     if (size > 0) {
-        data_ = static_cast<void*>(new uint8_t[size]{});
-        OT_ASSERT(data_ != nullptr);
-        OTPassword::zeroMemory(data_, size);
+        data_ = Allocate(size);
         size_ = size;
     }
 }
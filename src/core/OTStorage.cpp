@@ -46,6 +46,13 @@
 #include "opentxs/core/util/OTDataFolder.hpp"
 #include "opentxs/core/util/OTPaths.hpp"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstdio>
 #include <fstream>
 #include <sstream>
 #include <typeinfo>
@@ -680,6 +687,70 @@ std::string QueryPlainString(
         ot_strFolder.Get(), ot_oneStr.Get(), twoStr, threeStr);
 }
 
+bool AppendPlainString(
+    const std::string& strContents,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    String ot_strFolder(strFolder), ot_oneStr(oneStr), ot_twoStr(twoStr),
+        ot_threeStr(threeStr);
+    OT_ASSERT_MSG(
+        ot_strFolder.Exists(), "OTDB::AppendPlainString: strFolder is null");
+
+    if (!ot_oneStr.Exists()) {
+        OT_ASSERT_MSG(
+            (!ot_twoStr.Exists() && !ot_threeStr.Exists()),
+            "OTDB::AppendPlainString: bad options");
+        ot_oneStr = strFolder.c_str();
+        ot_strFolder = ".";
+    }
+    Storage* pStorage = details::s_pStorage;
+
+    OT_ASSERT((strFolder.length() > 3) || (0 == strFolder.compare(0, 1, ".")));
+    OT_ASSERT((oneStr.length() < 1) || (oneStr.length() > 3));
+
+    if (nullptr == pStorage) {
+        return false;
+    }
+
+    return pStorage->AppendPlainString(
+        strContents, ot_strFolder.Get(), ot_oneStr.Get(), twoStr, threeStr);
+}
+
+bool ReplacePlainString(
+    const std::string& strContents,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    String ot_strFolder(strFolder), ot_oneStr(oneStr), ot_twoStr(twoStr),
+        ot_threeStr(threeStr);
+    OT_ASSERT_MSG(
+        ot_strFolder.Exists(), "OTDB::ReplacePlainString: strFolder is null");
+
+    if (!ot_oneStr.Exists()) {
+        OT_ASSERT_MSG(
+            (!ot_twoStr.Exists() && !ot_threeStr.Exists()),
+            "OTDB::ReplacePlainString: bad options");
+        ot_oneStr = strFolder.c_str();
+        ot_strFolder = ".";
+    }
+    Storage* pStorage = details::s_pStorage;
+
+    OT_ASSERT((strFolder.length() > 3) || (0 == strFolder.compare(0, 1, ".")));
+    OT_ASSERT((oneStr.length() < 1) || (oneStr.length() > 3));
+
+    if (nullptr == pStorage) {
+        return false;
+    }
+
+    return pStorage->ReplacePlainString(
+        strContents, ot_strFolder.Get(), ot_oneStr.Get(), twoStr, threeStr);
+}
+
 // Store/Retrieve an object. (Storable.)
 
 bool StoreObject(
@@ -2275,6 +2346,57 @@ std::string Storage::QueryPlainString(
     return theString;
 }
 
+bool Storage::AppendPlainString(
+    const std::string& strContents,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    return onAppendPlainString(
+        strContents, strFolder, oneStr, twoStr, threeStr);
+}
+
+bool Storage::ReplacePlainString(
+    const std::string& strContents,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    return onReplacePlainString(
+        strContents, strFolder, oneStr, twoStr, threeStr);
+}
+
+bool Storage::onAppendPlainString(
+    const std::string& theBuffer,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string theString("");
+
+    // A missing or empty value reads back as a failure.
+    if (Exists(strFolder, oneStr, twoStr, threeStr) &&
+        !onQueryPlainString(theString, strFolder, oneStr, twoStr, threeStr))
+        theString = "";
+
+    theString += theBuffer;
+
+    return onStorePlainString(theString, strFolder, oneStr, twoStr, threeStr);
+}
+
+bool Storage::onReplacePlainString(
+    const std::string& theBuffer,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    return onStorePlainString(theBuffer, strFolder, oneStr, twoStr, threeStr);
+}
+
 bool Storage::StoreObject(
     Storable& theContents,
     const std::string& strFolder,
@@ -2924,6 +3046,134 @@ bool StorageFS::onEraseValueByKey(
     return bSuccess;
 }
 
+#ifndef _WIN32
+namespace
+{
+
+bool write_all(const int fd, const std::string& theBuffer)
+{
+    std::size_t done = 0;
+
+    while (done < theBuffer.size()) {
+        const auto bytes =
+            ::write(fd, theBuffer.data() + done, theBuffer.size() - done);
+
+        if (0 < bytes) {
+            done += bytes;
+        } else if ((0 > bytes) && (EINTR == errno)) {
+            continue;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+#endif
+
+// The data is on disk when this returns.
+bool StorageFS::onAppendPlainString(
+    const std::string& theBuffer,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+    std::string strOutput;
+
+    if (0 > ConstructAndCreatePath(
+                strOutput, strFolder, oneStr, twoStr, threeStr)) {
+        otErr << "StorageFS::" << __FUNCTION__ << ": Error writing to "
+              << strOutput << ".\n";
+        return false;
+    }
+
+#ifdef _WIN32
+    std::ofstream ofs(
+        strOutput.c_str(), std::ios::out | std::ios::app | std::ios::binary);
+    ofs << theBuffer;
+    ofs.flush();
+
+    return ofs.good();
+#else
+    const int fd = ::open(
+        strOutput.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0666);
+
+    if (-1 == fd) {
+        otErr << __FUNCTION__ << ": Error opening file: " << strOutput << "\n";
+        return false;
+    }
+
+    bool bSuccess = write_all(fd, theBuffer) && (0 == ::fsync(fd));
+
+    if (0 != ::close(fd)) bSuccess = false;
+
+    return bSuccess;
+#endif
+}
+
+// Writes a temporary file next to the target and renames it over the target
+// once it is on disk, so a crash leaves either the old file or the new one.
+bool StorageFS::onReplacePlainString(
+    const std::string& theBuffer,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr)
+{
+#ifdef _WIN32
+    // rename() can't replace an existing file here.
+    return onStorePlainString(theBuffer, strFolder, oneStr, twoStr, threeStr);
+#else
+    std::string strOutput;
+
+    if (0 > ConstructAndCreatePath(
+                strOutput, strFolder, oneStr, twoStr, threeStr)) {
+        otErr << "StorageFS::" << __FUNCTION__ << ": Error writing to "
+              << strOutput << ".\n";
+        return false;
+    }
+
+    const std::string strTemp = strOutput + ".tmp";
+    const int fd = ::open(
+        strTemp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+
+    if (-1 == fd) {
+        otErr << __FUNCTION__ << ": Error opening file: " << strTemp << "\n";
+        return false;
+    }
+
+    bool bSuccess = write_all(fd, theBuffer) && (0 == ::fsync(fd));
+
+    if (0 != ::close(fd)) bSuccess = false;
+
+    if (bSuccess) bSuccess = (0 == rename(strTemp.c_str(), strOutput.c_str()));
+
+    if (!bSuccess) {
+        otErr << __FUNCTION__ << ": Error writing file: " << strOutput << "\n";
+        remove(strTemp.c_str());
+
+        return false;
+    }
+
+    // Make the rename itself durable.
+    const std::size_t slash = strOutput.find_last_of('/');
+
+    if (std::string::npos != slash) {
+        const int dir = ::open(strOutput.substr(0, slash).c_str(), O_RDONLY);
+
+        if (-1 != dir) {
+            ::fsync(dir);
+            ::close(dir);
+        }
+    }
+
+    return true;
+#endif
+}
+
 // Constructor for Filesystem storage context.
 //
 StorageFS::StorageFS()
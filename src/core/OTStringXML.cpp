@@ -41,6 +41,7 @@
 #include "opentxs/core/String.hpp"
 
 #include <irrxml/irrXML.hpp>
+#include <cstring>
 
 namespace opentxs
 {
@@ -113,16 +114,15 @@ OTStringXML::operator irr::io::IFileReadCallBack*()
 
 int32_t OTStringXML::read(void* buffer, uint32_t sizeToRead)
 {
-    if (buffer && sizeToRead && Exists()) {
-        char* pBuf = static_cast<char*>(buffer);
-
-        int32_t nBytesToCopy =
-            (sizeToRead > GetLength() ? GetLength() : sizeToRead);
-        int32_t i;
-        for (i = 0; i < nBytesToCopy; i++) {
-            pBuf[i] = sgetc();
-        }
-        return i;
+    if (buffer && sizeToRead && Exists() && (position_ < length_)) {
+        const uint32_t nRemaining = length_ - position_;
+        const uint32_t nBytesToCopy =
+            (sizeToRead > nRemaining ? nRemaining : sizeToRead);
+
+        memcpy(buffer, data_ + position_, nBytesToCopy);
+        position_ += nBytesToCopy;
+
+        return static_cast<int32_t>(nBytesToCopy);
     }
     else {
         return 0;
@@ -40,6 +40,7 @@
 
 #include "opentxs/consensus/ServerContext.hpp"
 #include "opentxs/core/cron/OTCronItem.hpp"
+#include "opentxs/core/crypto/CryptoAsymmetric.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
 #include "opentxs/core/recurring/OTPaymentPlan.hpp"
 #include "opentxs/core/script/OTSmartContract.hpp"
@@ -2842,6 +2843,8 @@ bool OTTransaction::VerifyItems(Nym& theNym)
     // if pointer not null, and it's a withdrawal, and it's an acknowledgement
     // (not a rejection or error)
     //
+    std::vector<const Item*> items;
+
     for (auto& it : GetItemList()) {
         // loop through the ALL items that make up this transaction and check
         // to see if a response to deposit.
@@ -2852,13 +2855,31 @@ bool OTTransaction::VerifyItems(Nym& theNym)
 
         if (NYM_ID != pItem->GetNymID()) return false;
 
-        if (!pItem->VerifySignature(theNym)) // NO need to call
-                                             // VerifyAccount since
-                                             // VerifyContractID is
-                                             // ALREADY called and now
-                                             // here's
-                                             // VerifySignature().
-            return false;
+        items.push_back(pItem);
+    }
+
+    // The signatures are the expensive part, so they are checked together in
+    // one batch. (processInbox can carry thousands of items.) Only this
+    // thread looks up theNym's keys; the engine spreads the signature checks
+    // themselves over the executor. Items whose key is ambiguous, or every
+    // item if the batch fails, go through VerifySignature() one at a time,
+    // which tries every candidate key.
+    //
+    // NO need to call VerifyAccount since VerifyContractID is ALREADY called
+    // and now here's VerifySignature().
+    std::vector<CryptoAsymmetric::BatchItem> batch;
+    std::vector<const Item*> unbatched;
+
+    for (auto& pItem : items) {
+        if (!pItem->BatchSignature(theNym, batch)) {
+            unbatched.push_back(pItem);
+        }
+    }
+
+    if (!CryptoAsymmetric::VerifyBatches(batch)) { unbatched.swap(items); }
+
+    for (auto& pItem : unbatched) {
+        if (!pItem->VerifySignature(theNym)) { return false; }
     }
 
     return true;
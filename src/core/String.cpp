@@ -642,11 +642,9 @@ void String::zeroMemory() const
 void String::Release_String(void)
 {
     if (nullptr != data_) {
-        // for security purposes.
-        //
-        OTPassword::zeroMemory(data_, length_);
-        //        memset(data_, 0, length_);
-        delete[] data_;
+        if (secure_) OTPassword::zeroMemory(data_, length_);
+
+        if (inline_ != data_) delete[] data_;
     }
     data_ = nullptr;
     position_ = 0;
@@ -754,6 +752,14 @@ String::String(const String& strValue)
     LowLevelSetStr(strValue);
 }
 
+String::String(String&& strValue)
+    : length_(0)
+    , position_(0)
+    , data_(nullptr)
+{
+    swap(strValue);
+}
+
 String::String(const char* new_string)
     : length_(0)
     , position_(0)
@@ -781,10 +787,32 @@ String::String(const std::string& new_string)
     LowLevelSet(new_string.c_str(), static_cast<uint32_t>(new_string.length()));
 }
 
+char* String::Allocate(uint32_t length)
+{
+    if (length < INLINE_CAPACITY) return inline_;
+
+    char* output = new char[length + 1];
+    OT_ASSERT(nullptr != output);
+
+    return output;
+}
+
+void String::SetSecure(bool secure)
+{
+    secure_ = secure;
+}
+
+bool String::IsSecure() const
+{
+    return secure_;
+}
+
 void String::LowLevelSetStr(const String& strBuf)
 {
     OT_ASSERT(nullptr == data_); // otherwise memory leak.
 
+    if (strBuf.secure_) secure_ = true;
+
     if (strBuf.Exists()) {
         length_ = (MAX_STRING_LENGTH > strBuf.length_)
                       ? strBuf.length_
@@ -796,7 +824,9 @@ void String::LowLevelSetStr(const String& strBuf)
                       "anyway--it would have been truncated here, potentially "
                       "causing data corruption.)"); // 10 being a buffer.
 
-        data_ = str_dup2(strBuf.data_, length_);
+        data_ = Allocate(length_);
+        memcpy(data_, strBuf.data_, length_);
+        data_[length_] = '\0';
     }
 }
 
@@ -843,12 +873,10 @@ void String::LowLevelSet(const char* new_string, uint32_t nEnforcedMaxLength)
         //
         //      new_string[nLength] = '\0';
 
-        data_ = str_dup2(new_string, nLength);
-
-        if (nullptr != data_)
-            length_ = nLength;
-        else
-            length_ = 0;
+        data_ = Allocate(nLength);
+        memcpy(data_, new_string, nLength);
+        data_[nLength] = '\0';
+        length_ = nLength;
     }
 }
 
@@ -861,8 +889,7 @@ bool String::MemSet(const char* pMem, uint32_t theSize) // if theSize is 10...
     // -------------------
     if ((nullptr == pMem) || (theSize < 1)) return true;
 
-    char* str_new = new char[theSize + 1]; // then we allocate 11
-    OT_ASSERT(nullptr != str_new);
+    char* str_new = Allocate(theSize); // then we allocate 11
     // -------------------
     OTPassword::zeroMemory(str_new, theSize + 1);
 
@@ -901,16 +928,40 @@ bool String::MemSet(const char* pMem, uint32_t theSize) // if theSize is 10...
 
 String& String::operator=(String rhs)
 {
-    if (this != &rhs) // Compare addresses.
-        swap(rhs);    // Only swap if they are different objects.
+    if (this != &rhs) { // Compare addresses.
+        // A secure string stays secure whatever is assigned to it, and the
+        // old contents leave in rhs with the old setting.
+        const bool secure = secure_ || rhs.secure_;
+        swap(rhs); // Only swap if they are different objects.
+        secure_ = secure;
+    }
     return *this;
 }
 
 void String::swap(String& rhs)
 {
+    const bool bInline = (inline_ == data_);
+    const bool bRhsInline = (rhs.inline_ == rhs.data_);
+
     std::swap(length_, rhs.length_);
     std::swap(position_, rhs.position_);
     std::swap(data_, rhs.data_);
+    std::swap(secure_, rhs.secure_);
+
+    // Inline contents have to move with the pointers that refer to them.
+    if (bInline || bRhsInline) {
+        char temp[INLINE_CAPACITY];
+        memcpy(temp, inline_, INLINE_CAPACITY);
+        memcpy(inline_, rhs.inline_, INLINE_CAPACITY);
+        memcpy(rhs.inline_, temp, INLINE_CAPACITY);
+
+        if (secure_ || rhs.secure_) {
+            OTPassword::zeroMemory(temp, INLINE_CAPACITY);
+        }
+
+        if (bRhsInline) data_ = inline_;
+        if (bInline) rhs.data_ = rhs.inline_;
+    }
 }
 
 bool String::At(uint32_t lIndex, char& c) const
@@ -38,6 +38,7 @@
 
 #include "opentxs/core/contract/UnitDefinition.hpp"
 
+#include "opentxs/api/Executor.hpp"
 #include "opentxs/api/OT.hpp"
 #include "opentxs/api/Wallet.hpp"
 #include "opentxs/core/contract/CurrencyContract.hpp"
@@ -45,14 +46,13 @@
 #include "opentxs/core/contract/Signable.hpp"
 #include "opentxs/core/contract/basket/BasketContract.hpp"
 #include "opentxs/core/util/Assert.hpp"
-#include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/core/Account.hpp"
+#include "opentxs/core/AccountRegistry.hpp"
 #include "opentxs/core/AccountVisitor.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Nym.hpp"
 #include "opentxs/core/OTData.hpp"
-#include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/Proto.hpp"
 #include "opentxs/core/stdafx.hpp"
 #include "opentxs/core/String.hpp"
@@ -69,6 +69,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -290,131 +291,119 @@ bool UnitDefinition::DisplayStatistics(String& strContents) const
     return true;
 }
 
-// currently only "user" accounts (normal user asset accounts) are added to
-// this list Any "special" accounts, such as basket reserve accounts, or voucher
-// reserve accounts, or cash reserve accounts, are not included on this list.
-bool UnitDefinition::VisitAccountRecords(AccountVisitor& visitor) const
+namespace
 {
-    Lock lock(lock_);
+// Loads one registered account, unless the visitor already has it loaded, and
+// triggers the visitor on it. Errors are appended to error instead of being
+// logged, since this runs on several threads at once.
+bool visit_account(
+    const std::string& accountID,
+    AccountVisitor& visitor,
+    std::string& error)
+{
+    Identifier* pNotaryID = visitor.GetNotaryID();
+    OT_ASSERT_MSG(
+        nullptr != pNotaryID,
+        "Assert: nullptr Notary ID on functor. "
+        "(How did you even construct the "
+        "thing?)");
+
+    Account* pAccount = nullptr;
+    std::unique_ptr<Account> theAcctAngel;
+    const Identifier theAccountID(accountID);
+
+    // Before loading it from local storage, let's first make sure it's not
+    // already loaded. (visitor functor has a list of 'already loaded'
+    // accounts, just in case.)
+    mapOfAccounts* pLoadedAccounts = visitor.GetLoadedAccts();
+
+    if (nullptr != pLoadedAccounts) {
+        auto found_it = pLoadedAccounts->find(accountID);
+
+        if (pLoadedAccounts->end() != found_it) {
+            pAccount = found_it->second;
+            OT_ASSERT(nullptr != pAccount);
+
+            if (theAccountID != pAccount->GetPurportedAccountID()) {
+                error += "Error: the actual account didn't have the ID that "
+                         "the std::map SAID it had! (Should never happen.) "
+                         "Account: " + accountID + "\n";
+                pAccount = nullptr;
+            }
+        }
+    }
 
-    const String strInstrumentDefinitionID(id(lock));
-    String strAcctRecordFile;
-    strAcctRecordFile.Format("%s.a", strInstrumentDefinitionID.Get());
+    // I guess it wasn't already loaded...
+    // Let's try to load it.
+    if (nullptr == pAccount) {
+        pAccount = Account::LoadExistingAccount(theAccountID, *pNotaryID);
+        theAcctAngel.reset(pAccount);
+    }
 
-    std::unique_ptr<OTDB::Storable> pStorable(
-        OTDB::QueryObject(
-            OTDB::STORED_OBJ_STRING_MAP,
-            OTFolders::Contract().Get(),
-            strAcctRecordFile.Get()));
+    if (nullptr == pAccount) {
+        error += std::string(__FUNCTION__) +
+                 ": Error: Failed Loading Account " + accountID + "\n";
 
-    OTDB::StringMap* pMap = dynamic_cast<OTDB::StringMap*>(pStorable.get());
+        return false;
+    }
 
-    // There was definitely a StringMap loaded from local storage.
-    // (Even an empty one, possibly.) This is the only block that matters in
-    // this function.
-    //
-    if (nullptr != pMap) {
-        Identifier* pNotaryID = visitor.GetNotaryID();
-        OT_ASSERT_MSG(
-            nullptr != pNotaryID,
-            "Assert: nullptr Notary ID on functor. "
-            "(How did you even construct the "
-            "thing?)");
-
-        auto& theMap = pMap->the_map;
-
-        // todo: optimize: will probably have to use a database for this,
-        // int64_t term.
-        // (What if there are a million acct IDs in this flat file? Not
-        // scaleable.)
-        //
-        for (auto& it : theMap) {
-            const std::string& str_acct_id =
-                it.first;  // Containing the account ID.
-            const std::string& str_instrument_definition_id =
-                it.second;  // Containing the instrument definition ID. (Just in
-                            // case
-                            // someone copied the wrong file here...)
-
-            if (!strInstrumentDefinitionID.Compare(
-                    str_instrument_definition_id.c_str())) {
-                otErr << "OTUnitDefinition::VisitAccountRecords: Error: wrong "
-                         "instrument definition ID ("
-                      << str_instrument_definition_id
-                      << ") when expecting: " << strInstrumentDefinitionID
-                      << "\n";
-            } else {
-                Account* pAccount = nullptr;
-                std::unique_ptr<Account> theAcctAngel;
-
-                const Identifier theAccountID(str_acct_id);
-
-                // Before loading it from local storage, let's first make sure
-                // it's not already loaded.
-                // (visitor functor has a list of 'already loaded' accounts,
-                // just in case.)
-                //
-                mapOfAccounts* pLoadedAccounts = visitor.GetLoadedAccts();
-
-                if (nullptr !=
-                    pLoadedAccounts)  // there are some accounts already loaded,
-                {  // let's see if the one we're looking for is there...
-                    auto found_it = pLoadedAccounts->find(str_acct_id);
-
-                    if (pLoadedAccounts->end() != found_it)  // FOUND IT.
-                    {
-                        pAccount = found_it->second;
-                        OT_ASSERT(nullptr != pAccount);
-
-                        if (theAccountID != pAccount->GetPurportedAccountID()) {
-                            otErr << "Error: the actual account didn't have "
-                                     "the ID that the std::map SAID it had! "
-                                     "(Should never happen.)\n";
-                            pAccount = nullptr;
-                        }
-                    }
-                }
+    const bool bTriggerSuccess = visitor.Trigger(*pAccount);
 
-                // I guess it wasn't already loaded...
-                // Let's try to load it.
-                //
-                if (nullptr == pAccount) {
-                    pAccount =
-                        Account::LoadExistingAccount(theAccountID, *pNotaryID);
-                    theAcctAngel.reset(pAccount);
-                }
+    if (!bTriggerSuccess) {
+        error += std::string(__FUNCTION__) + ": Error: Trigger Failed for " +
+                 "account " + accountID + "\n";
+    }
 
-                bool bSuccessLoadingAccount =
-                    ((pAccount != nullptr) ? true : false);
-                if (bSuccessLoadingAccount) {
-                    bool bTriggerSuccess = visitor.Trigger(*pAccount);
-                    if (!bTriggerSuccess)
-                        otErr << __FUNCTION__ << ": Error: Trigger Failed.";
-                } else {
-                    otErr << __FUNCTION__ << ": Error: Failed Loading Account!";
-                }
-            }
-        }
-        return true;
+    return bTriggerSuccess;
+}
+
+// Visits one page of the account registry on up to threads threads of the
+// shared executor.
+void visit_page(
+    const std::vector<std::string>& accounts,
+    AccountVisitor& visitor,
+    const std::size_t threads)
+{
+    // One per account, logged in order once they have all been visited.
+    std::vector<std::string> errors(accounts.size());
+
+    OT::App().Executor().Parallel(
+        accounts.size(),
+        [&](const std::size_t i) -> void {
+            visit_account(accounts[i], visitor, errors[i]);
+        },
+        threads);
+
+    for (const auto& error : errors) {
+        if (!error.empty()) { otErr << error; }
     }
-    return true;
 }
+}  // namespace
 
-bool UnitDefinition::AddAccountRecord(const Account& theAccount) const  // adds
-                                                                        // the
-// account
-// to the
-// list.
-// (When
-// account
-// is
-// created.)
+// currently only "user" accounts (normal user asset accounts) are added to
+// this list Any "special" accounts, such as basket reserve accounts, or voucher
+// reserve accounts, or cash reserve accounts, are not included on this list.
+bool UnitDefinition::VisitAccountRecords(
+    AccountVisitor& visitor,
+    const std::size_t threads) const
 {
-    //  Load up account list StringMap. Create it if doesn't already exist.
-    //  See if account is already there in the map. Add it otherwise.
-    //  Save the StringMap back again. (The account records list for a given
-    // instrument definition.)
+    Lock lock(lock_);
+
+    const AccountRegistry registry(String(id(lock)).Get());
 
+    // Pages are loaded one at a time, so memory use does not grow with the
+    // number of accounts.
+    return registry.Visit(
+        [&visitor, threads](const std::vector<std::string>& page) -> bool {
+            visit_page(page, visitor, threads);
+
+            return true;
+        });
+}
+
+// adds the account to the list. (When account is created.)
+bool UnitDefinition::AddAccountRecord(const Account& theAccount) const
+{
     Lock lock(lock_);
     const char* szFunc = "OTUnitDefinition::AddAccountRecord";
 
@@ -426,183 +415,42 @@ bool UnitDefinition::AddAccountRecord(const Account& theAccount) const  // adds
 
     const Identifier theAcctID(theAccount);
     const String strAcctID(theAcctID);
-
     const String strInstrumentDefinitionID(id(lock));
-    String strAcctRecordFile;
-    strAcctRecordFile.Format("%s.a", strInstrumentDefinitionID.Get());
-
-    OTDB::Storable* pStorable = nullptr;
-    std::unique_ptr<OTDB::Storable> theAngel;
-    OTDB::StringMap* pMap = nullptr;
-
-    if (OTDB::Exists(
-            OTFolders::Contract().Get(),
-            strAcctRecordFile.Get()))  // the file already exists; let's
-                                       // try to load it up.
-        pStorable = OTDB::QueryObject(
-            OTDB::STORED_OBJ_STRING_MAP,
-            OTFolders::Contract().Get(),
-            strAcctRecordFile.Get());
-    else  // the account records file (for this instrument definition) doesn't
-          // exist.
-        pStorable = OTDB::CreateObject(
-            OTDB::STORED_OBJ_STRING_MAP);  // this asserts already, on failure.
-
-    theAngel.reset(pStorable);
-    pMap = (nullptr == pStorable) ? nullptr
-                                  : dynamic_cast<OTDB::StringMap*>(pStorable);
-
-    // It exists.
-    //
-    if (nullptr == pMap) {
-        otErr << szFunc
-              << ": Error: failed trying to load or create the account records "
-                 "file for instrument definition: "
-              << strInstrumentDefinitionID << "\n";
-        return false;
-    }
-
-    auto& theMap = pMap->the_map;
-    auto map_it = theMap.find(strAcctID.Get());
-
-    if (theMap.end() != map_it)  // we found it.
-    {                            // We were ADDING IT, but it was ALREADY THERE.
-        // (Thus, we're ALREADY DONE.)
-        // Let's just make sure the right instrument definition ID is associated
-        // with this
-        // account
-        // (it better be, since we loaded the account records file based on the
-        // instrument definition ID as its filename...)
-        //
-        const std::string& str2 = map_it->second;  // Containing the instrument
-                                                   // definition ID. (Just in
-                                                   // case
-        // someone copied the wrong file here,
-        // --------------------------------          // every account should map
-        // to the SAME instrument definition id.)
-
-        if (false == strInstrumentDefinitionID.Compare(str2.c_str()))  // should
-                                                                       // never
-        // happen.
-        {
-            otErr << szFunc << ": Error: wrong instrument definition found in "
-                               "account records "
-                               "file...\n For instrument definition: "
-                  << strInstrumentDefinitionID << "\n "
-                                                  "For account: "
-                  << strAcctID
-                  << "\n Found wrong instrument definition: " << str2 << "\n";
-            return false;
-        }
-
-        return true;  // already there (no need to add.) + the instrument
-                      // definition ID
-                      // matches.
-    }
-
-    // it wasn't already on the list...
-
-    // ...so add it.
-    //
-    theMap[strAcctID.Get()] = strInstrumentDefinitionID.Get();
+    AccountRegistry registry(strInstrumentDefinitionID.Get());
 
-    // Then save it back to local storage:
-    //
-    if (!OTDB::StoreObject(
-            *pMap, OTFolders::Contract().Get(), strAcctRecordFile.Get())) {
+    if (!registry.Add(strAcctID.Get())) {
         otErr << szFunc
-              << ": Failed trying to StoreObject, while saving updated "
-                 "account records file for instrument definition: "
+              << ": Failed saving updated account records for instrument "
+                 "definition: "
               << strInstrumentDefinitionID
               << "\n to contain account ID: " << strAcctID << "\n";
         return false;
     }
 
-    // Okay, we saved the updated file, with the account added. (done, success.)
-    //
     return true;
 }
 
-bool UnitDefinition::EraseAccountRecord(const Identifier& theAcctID)
-    const  // removes the account from the list. (When
-           // account is deleted.)
+// removes the account from the list. (When account is deleted.)
+bool UnitDefinition::EraseAccountRecord(const Identifier& theAcctID) const
 {
-    //  Load up account list StringMap. Create it if doesn't already exist.
-    //  See if account is already there in the map. Erase it, if it is.
-    //  Save the StringMap back again. (The account records list for a given
-    // instrument definition.)
-
     Lock lock(lock_);
     const char* szFunc = "OTUnitDefinition::EraseAccountRecord";
 
     const String strAcctID(theAcctID);
-
     const String strInstrumentDefinitionID(id(lock));
-    String strAcctRecordFile;
-    strAcctRecordFile.Format("%s.a", strInstrumentDefinitionID.Get());
-
-    OTDB::Storable* pStorable = nullptr;
-    std::unique_ptr<OTDB::Storable> theAngel;
-    OTDB::StringMap* pMap = nullptr;
-
-    if (OTDB::Exists(
-            OTFolders::Contract().Get(),
-            strAcctRecordFile.Get()))  // the file already exists; let's
-                                       // try to load it up.
-        pStorable = OTDB::QueryObject(
-            OTDB::STORED_OBJ_STRING_MAP,
-            OTFolders::Contract().Get(),
-            strAcctRecordFile.Get());
-    else  // the account records file (for this instrument definition) doesn't
-          // exist.
-        pStorable = OTDB::CreateObject(
-            OTDB::STORED_OBJ_STRING_MAP);  // this asserts already, on failure.
-
-    theAngel.reset(pStorable);
-    pMap = (nullptr == pStorable) ? nullptr
-                                  : dynamic_cast<OTDB::StringMap*>(pStorable);
-
-    // It exists.
-    //
-    if (nullptr == pMap) {
-        otErr << szFunc
-              << ": Error: failed trying to load or create the account records "
-                 "file for instrument definition: "
-              << strInstrumentDefinitionID << "\n";
-        return false;
-    }
-
-    // Before we can erase it, let's see if it's even there....
-    //
-    auto& theMap = pMap->the_map;
-    auto map_it = theMap.find(strAcctID.Get());
-
-    // we found it!
-    if (theMap.end() != map_it)  //  Acct ID was already there...
-    {
-        theMap.erase(map_it);  // remove it
-    }
-
-    // it wasn't already on the list...
-    // (So it's like success, since the end result is, acct ID will not appear
-    // on this list--whether
-    // it was there or not beforehand, it's definitely not there now.)
+    AccountRegistry registry(strInstrumentDefinitionID.Get());
 
-    // Then save it back to local storage:
-    //
-    if (!OTDB::StoreObject(
-            *pMap, OTFolders::Contract().Get(), strAcctRecordFile.Get())) {
+    // If the account wasn't on the list, that's success too: it definitely
+    // isn't there now.
+    if (!registry.Remove(strAcctID.Get())) {
         otErr << szFunc
-              << ": Failed trying to StoreObject, while saving updated "
-                 "account records file for instrument definition: "
+              << ": Failed saving updated account records for instrument "
+                 "definition: "
               << strInstrumentDefinitionID
               << "\n to erase account ID: " << strAcctID << "\n";
         return false;
     }
 
-    // Okay, we saved the updated file, with the account removed. (done,
-    // success.)
-    //
     return true;
 }
 
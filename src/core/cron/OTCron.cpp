@@ -48,6 +48,7 @@
 #include "opentxs/core/cron/OTCronItem.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
 #include "opentxs/core/trade/OTMarket.hpp"
+#include "opentxs/core/trade/OTOrderBook.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/util/OTFolders.hpp"
@@ -57,12 +58,16 @@
 
 #include <irrxml/irrXML.hpp>
 #include <string.h>
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -80,6 +85,10 @@ int32_t OTCron::__cron_max_items_per_nym = 10; // The maximum number of cron
                                                // items any given Nym can have
                                                // active at the same time.
 
+int32_t OTCron::__cron_journal_compaction = 1000; // The number of journal
+                                                  // records before the file
+                                                  // is saved whole again.
+
 Timer OTCron::tCron(true);
 
 // Make sure Server Nym is set on this cron object before loading or saving,
@@ -96,6 +105,9 @@ bool OTCron::LoadCron()
 
     if (bSuccess) bSuccess = VerifySignature(*(GetServerNym()));
 
+    // Then apply whatever changed since the cron file was saved.
+    if (bSuccess) bSuccess = ReplayJournal();
+
     return bSuccess;
 }
 
@@ -108,6 +120,9 @@ bool OTCron::SaveCron()
 
     ReleaseSignatures();
 
+    // The journal records written from here on belong to this new version.
+    ++m_lJournalGeneration;
+
     // Sign it, save it internally to string, and then save that out to the
     // file.
     if (!SignContract(*m_pServerNym) || !SaveContract() ||
@@ -116,8 +131,163 @@ bool OTCron::SaveCron()
               << Log::PathSeparator() << szFilename << "\n";
         return false;
     }
-    else
-        return true;
+
+    m_bNumbersChanged = false;
+
+    // Everything in the journal is in the cron file now.
+    if (!GetJournal().Reset(m_lJournalGeneration)) {
+        otErr << "Error emptying the journal for main Cronfile:\n"
+              << szFoldername << Log::PathSeparator() << szFilename << "\n";
+    }
+
+    return true;
+}
+
+bool OTCron::SaveCronItem(OTCronItem& theItem)
+{
+    auto it_multimap = FindItemOnMultimap(theItem.GetTransactionNum());
+
+    // Not (or no longer) on cron, so there is nothing to save for the item.
+    if (m_multimapCronItems.end() == it_multimap) {
+        otWarn << __FUNCTION__ << ": CronItem is not on cron. Transaction #: "
+               << theItem.GetTransactionNum() << "\n";
+        return SaveTransactionNumbers();
+    }
+
+    OTCronJournal::Record theRecord;
+    theRecord.m_strType = "cronItem";
+    theRecord.m_lKey = theItem.GetTransactionNum();
+    theRecord.m_tDateAdded = it_multimap->first;
+    theRecord.m_strPayload = String(theItem);
+
+    return Journal(theRecord);
+}
+
+bool OTCron::SaveTransactionNumbers()
+{
+    if (!m_bNumbersChanged) return true;
+
+    OTCronJournal::Record theRecord;
+    theRecord.m_strType = "transactionNums";
+
+    return Journal(theRecord);
+}
+
+OTCronJournal& OTCron::GetJournal()
+{
+    if (!m_pJournal) {
+        m_pJournal.reset(new OTCronJournal(
+            OTFolders::Cron().Get(),
+            "OT-CRON.crn")); // todo stop hardcoding filenames.
+    }
+
+    return *m_pJournal;
+}
+
+// Appends theRecord to the journal, along with the list of transaction
+// numbers if it has changed since the last save. Once the journal is long
+// enough, or if it can't be written, the whole cron file is saved instead.
+bool OTCron::Journal(const OTCronJournal::Record& theRecord)
+{
+    OT_ASSERT(nullptr != GetServerNym());
+
+    OTCronJournal& theJournal = GetJournal();
+
+    if (theJournal.GetCount() >= OTCron::GetCronJournalCompaction()) {
+        return SaveCron();
+    }
+
+    if (m_bNumbersChanged) {
+        OTCronJournal::Record theNumbers;
+        theNumbers.m_strType = "transactionNums";
+
+        for (auto& lTransactionNum : m_listTransactionNumbers) {
+            if (theNumbers.m_strPayload.Exists())
+                theNumbers.m_strPayload.Concatenate(",");
+
+            theNumbers.m_strPayload.Concatenate(
+                "%s", formatLong(lTransactionNum).c_str());
+        }
+
+        if (!theJournal.Append(theNumbers, *m_pServerNym)) return SaveCron();
+
+        m_bNumbersChanged = false;
+    }
+
+    // (The numbers record above is all there is to SaveTransactionNumbers.)
+    if (theRecord.m_strType.Compare("transactionNums")) return true;
+
+    if (!theJournal.Append(theRecord, *m_pServerNym)) return SaveCron();
+
+    return true;
+}
+
+// Applies the journal records for the cron file which was just loaded.
+bool OTCron::ReplayJournal()
+{
+    std::vector<OTCronJournal::Record> vecRecords;
+
+    if (!GetJournal().Load(m_lJournalGeneration, *m_pServerNym, vecRecords)) {
+        otErr << "OTCron::" << __FUNCTION__
+              << ": Failed loading the journal for the cron file.\n";
+        return false;
+    }
+
+    for (auto& theRecord : vecRecords) {
+        if (theRecord.m_strType.Compare("transactionNums")) {
+            m_listTransactionNumbers.clear();
+
+            std::istringstream stream(theRecord.m_strPayload.Get());
+            std::string strNumber;
+
+            while (std::getline(stream, strNumber, ',')) {
+                if (!strNumber.empty()) {
+                    m_listTransactionNumbers.push_back(
+                        String::StringToLong(strNumber));
+                }
+            }
+        }
+        else if (theRecord.m_strType.Compare("cronItem")) {
+            EraseCronItem(theRecord.m_lKey);
+
+            if (!theRecord.m_bErase &&
+                !LoadCronItem(theRecord.m_strPayload, theRecord.m_tDateAdded))
+                return false;
+        }
+        else {
+            otErr << "OTCron::" << __FUNCTION__
+                  << ": Unknown journal record type: " << theRecord.m_strType
+                  << "\n";
+            return false;
+        }
+    }
+
+    otInfo << "OTCron::" << __FUNCTION__ << ": Replayed " << vecRecords.size()
+           << " journal records.\n";
+
+    m_bNumbersChanged = false;
+
+    return true;
+}
+
+// Removes an item without any of the side effects of RemoveCronItem, for
+// replaying the journal.
+void OTCron::EraseCronItem(int64_t lTransactionNum)
+{
+    auto it_map = FindItemOnMap(lTransactionNum);
+
+    if (m_mapCronItems.end() == it_map) return;
+
+    auto it_multimap = FindItemOnMultimap(lTransactionNum);
+    OT_ASSERT(m_multimapCronItems.end() != it_multimap);
+
+    OTCronItem* pItem = it_map->second;
+
+    m_multimapCronItems.erase(it_multimap);
+    UnscheduleCronItem(lTransactionNum);
+    m_mapCronItems.erase(it_map);
+
+    delete pItem;
 }
 
 // Loops through ALL markets, and calls pMarket->GetNym_OfferList(NYM_ID,
@@ -252,13 +422,13 @@ bool OTCron::GetMarketList(OTASCIIArmor& ascOutput, int32_t& nMarketCount)
 
         pMarketData->last_sale_date = pMarket->GetLastSaleDate();
 
-        const mapOfOffers::size_type theBidCount = pMarket->GetBidCount();
-        const mapOfOffers::size_type theAskCount = pMarket->GetAskCount();
+        const OTOrderBook::size_type theBidCount = pMarket->GetBidCount();
+        const OTOrderBook::size_type theAskCount = pMarket->GetAskCount();
 
         pMarketData->number_bids =
-            to_string<mapOfOffers::size_type>(theBidCount);
+            to_string<OTOrderBook::size_type>(theBidCount);
         pMarketData->number_asks =
-            to_string<mapOfOffers::size_type>(theAskCount);
+            to_string<OTOrderBook::size_type>(theAskCount);
 
         // In the past 24 hours.
         // (I'm not collecting this data yet, (maybe never), so these values
@@ -340,6 +510,7 @@ int32_t OTCron::GetTransactionCount() const
 void OTCron::AddTransactionNumber(const int64_t& lTransactionNum)
 {
     m_listTransactionNumbers.push_back(lTransactionNum);
+    m_bNumbersChanged = true;
 }
 
 // Once this starts returning 0, OTCron can no longer process trades and
@@ -351,6 +522,7 @@ int64_t OTCron::GetNextTransactionNumber()
     int64_t lTransactionNum = m_listTransactionNumbers.front();
 
     m_listTransactionNumbers.pop_front();
+    m_bNumbersChanged = true;
 
     return lTransactionNum;
 }
@@ -379,6 +551,8 @@ int32_t OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
         const String strNotaryID(xml->getAttributeValue("notaryID"));
 
         m_NOTARY_ID.SetString(strNotaryID);
+        m_lJournalGeneration =
+            String::StringToLong(xml->getAttributeValue("journalGeneration"));
 
         otOut << "\n\nLoading OTCron for NotaryID: " << strNotaryID << "\n";
 
@@ -412,55 +586,8 @@ int32_t OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
                      "value.\n";
             return (-1); // error condition
         }
-        else {
-            OTCronItem* pItem = OTCronItem::NewCronItem(strData);
-
-            if (nullptr == pItem) {
-                otErr << "Unable to create cron item from data in cron file.\n";
-                return (-1);
-            }
-
-            // Why not do this here (when loading from storage), as well as when
-            // first adding the item to cron,
-            // and thus save myself the trouble of verifying the signature EVERY
-            // ITERATION of ProcessCron().
-            //
-            if (!pItem->VerifySignature(*m_pServerNym)) {
-                otErr << "OTCron::ProcessXMLNode: ERROR SECURITY: Server "
-                         "signature failed to "
-                         "verify on a cron item while loading: "
-                      << pItem->GetTransactionNum() << "\n";
-                delete pItem;
-                pItem = nullptr;
-                return (-1);
-            }
-            else if (AddCronItem(*pItem, nullptr,
-                                   false, // bSaveReceipt=false. The receipt is
-                                          // only saved once: When item FIRST
-                                          // added to cron...
-                                   tDateAdded)) { // ...But here, the item was
-                                                  // ALREADY in cron, and is
-                                                  // merely being loaded from
-                                                  // disk.
-                // Thus, it would be wrong to try to create the "original
-                // record" as if it were brand
-                // new and still had the user's signature on it. (Once added to
-                // Cron, the signatures are
-                // released and the SERVER signs it from there. That's why the
-                // user's version is saved
-                // as a receipt in the first place -- so we have a record of the
-                // user's authorization.)
-                otInfo << "Successfully loaded cron item and added to list.\n";
-            }
-            else {
-                otErr << "OTCron::ProcessXMLNode: Though loaded / verified "
-                         "successfully, "
-                         "unable to add cron item (from cron file) to cron "
-                         "list.\n";
-                delete pItem;
-                pItem = nullptr;
-                return (-1);
-            }
+        else if (!LoadCronItem(strData, tDateAdded)) {
+            return (-1);
         }
 
         nReturnVal = 1;
@@ -511,6 +638,61 @@ int32_t OTCron::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
     return nReturnVal;
 }
 
+// Creates a cron item from its serialized form (from the cron file or the
+// journal), verifies it and adds it to cron.
+bool OTCron::LoadCronItem(const String& strData, const time64_t& tDateAdded)
+{
+    OTCronItem* pItem = OTCronItem::NewCronItem(strData);
+
+    if (nullptr == pItem) {
+        otErr << "Unable to create cron item from data in cron file.\n";
+        return false;
+    }
+
+    // Why not do this here (when loading from storage), as well as when
+    // first adding the item to cron,
+    // and thus save myself the trouble of verifying the signature EVERY
+    // ITERATION of ProcessCron().
+    //
+    if (!pItem->VerifySignature(*m_pServerNym)) {
+        otErr << "OTCron::LoadCronItem: ERROR SECURITY: Server signature "
+                 "failed to verify on a cron item while loading: "
+              << pItem->GetTransactionNum() << "\n";
+        delete pItem;
+        pItem = nullptr;
+        return false;
+    }
+    else if (AddCronItem(*pItem, nullptr,
+                         false, // bSaveReceipt=false. The receipt is
+                                // only saved once: When item FIRST
+                                // added to cron...
+                         tDateAdded)) { // ...But here, the item was
+                                        // ALREADY in cron, and is
+                                        // merely being loaded from
+                                        // disk.
+        // Thus, it would be wrong to try to create the "original
+        // record" as if it were brand
+        // new and still had the user's signature on it. (Once added to
+        // Cron, the signatures are
+        // released and the SERVER signs it from there. That's why the
+        // user's version is saved
+        // as a receipt in the first place -- so we have a record of the
+        // user's authorization.)
+        otInfo << "Successfully loaded cron item and added to list.\n";
+    }
+    else {
+        otErr << "OTCron::LoadCronItem: Though loaded / verified "
+                 "successfully, "
+                 "unable to add cron item (from cron file) to cron "
+                 "list.\n";
+        delete pItem;
+        pItem = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
 void OTCron::UpdateContents()
 {
     // I release this because I'm about to repopulate it.
@@ -522,6 +704,7 @@ void OTCron::UpdateContents()
 
     tag.add_attribute("version", m_strVersion.Get());
     tag.add_attribute("notaryID", NOTARY_ID.Get());
+    tag.add_attribute("journalGeneration", formatLong(m_lJournalGeneration));
 
     // Save the Market entries (the markets themselves are saved in a markets
     // folder.)
@@ -577,7 +760,83 @@ void OTCron::UpdateContents()
 
 int64_t OTCron::computeTimeout()
 {
-    return OTCron::GetCronMsBetweenProcess() - tCron.getElapsedTimeInMilliSec();
+    if (!m_bIsActivated) return OTCron::GetCronMsBetweenProcess();
+
+    const int64_t lTimeout =
+        OTCron::GetCronMsBetweenProcess() - tCron.getElapsedTimeInMilliSec();
+
+    const int64_t lFirstDue = m_lFirstDue.load();
+
+    if (m_bThrottled || (0 > lFirstDue)) return lTimeout;
+
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    const int64_t lNow =
+        std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    const int64_t lDue = lFirstDue * 1000;
+
+    return std::min(lTimeout, lDue - lNow);
+}
+
+bool OTCron::CronItemsAreDue(const time64_t& tNow) const
+{
+    return !m_multimapSchedule.empty() &&
+           (m_multimapSchedule.begin()->first <= tNow);
+}
+
+void OTCron::PublishFirstDue()
+{
+    m_lFirstDue.store(
+        m_multimapSchedule.empty()
+            ? -1
+            : OTTimeGetSecondsFromTime(m_multimapSchedule.begin()->first));
+}
+
+// Puts theItem on the schedule at the date it reports as next due, but no
+// earlier than tNotBefore.
+void OTCron::ScheduleCronItem(OTCronItem& theItem, const time64_t& tNotBefore)
+{
+    const int64_t lTransactionNum = theItem.GetTransactionNum();
+    auto it_entry = m_mapScheduleEntries.find(lTransactionNum);
+    OT_ASSERT(m_mapScheduleEntries.end() != it_entry);
+
+    ScheduleEntry& theEntry = it_entry->second;
+
+    if (theEntry.m_bScheduled) m_multimapSchedule.erase(theEntry.m_itDue);
+
+    const time64_t tDue = std::max(theItem.GetCronDueDate(), tNotBefore);
+
+    theEntry.m_itDue = m_multimapSchedule.insert(
+        std::pair<time64_t, int64_t>(tDue, lTransactionNum));
+    theEntry.m_bScheduled = true;
+    PublishFirstDue();
+}
+
+void OTCron::UnscheduleCronItem(int64_t lTransactionNum)
+{
+    auto it_entry = m_mapScheduleEntries.find(lTransactionNum);
+
+    if (m_mapScheduleEntries.end() == it_entry) return;
+
+    if (it_entry->second.m_bScheduled)
+        m_multimapSchedule.erase(it_entry->second.m_itDue);
+
+    m_mapScheduleEntries.erase(it_entry);
+    PublishFirstDue();
+}
+
+void OTCron::RescheduleCronItem(int64_t lTransactionNum)
+{
+    auto it_entry = m_mapScheduleEntries.find(lTransactionNum);
+
+    // Items which are being processed right now get rescheduled afterwards.
+    if ((m_mapScheduleEntries.end() == it_entry) ||
+        !it_entry->second.m_bScheduled)
+        return;
+
+    auto it_map = FindItemOnMap(lTransactionNum);
+    OT_ASSERT(m_mapCronItems.end() != it_map);
+
+    ScheduleCronItem(*it_map->second, OT_TIME_ZERO);
 }
 
 // Make sure to call this regularly so the CronItems get a chance to process and
@@ -589,11 +848,19 @@ void OTCron::ProcessCronItems()
         return;
     }
 
-    // check elapsed time since last items processing
-    if (computeTimeout() > 0) {
+    const time64_t tNow = OTTimeGetCurrentTime();
+    const bool bRegularRound =
+        (OTCron::GetCronMsBetweenProcess() <= tCron.getElapsedTimeInMilliSec());
+
+    // Between the regular rounds, only wake up for items that are due.
+    if (!bRegularRound && (m_bThrottled || !CronItemsAreDue(tNow))) {
         return;
     }
-    tCron.start();
+
+    if (bRegularRound) {
+        tCron.start();
+        m_bThrottled = false;
+    }
 
     const int32_t nTwentyPercent = OTCron::GetCronRefillAmount() / 5;
     if (GetTransactionCount() <= nTwentyPercent) {
@@ -607,15 +874,42 @@ void OTCron::ProcessCronItems()
               << " were used in the last round alone!!! \n"
                  "SKIPPING THE CRON ITEMS THAT WERE SCHEDULED FOR THIS "
                  "ROUND!!!\n\n";
+        m_bThrottled = true;
         return;
     }
-    bool bNeedToSave = false;
 
-    // loop through the cron items and tell each one to ProcessCron().
+    // Take everything that is due off the schedule before processing any of
+    // it, since processing one item can reschedule others.
+    std::vector<int64_t> vecDue;
+
+    while (CronItemsAreDue(tNow)) {
+        auto it_due = m_multimapSchedule.begin();
+        auto it_entry = m_mapScheduleEntries.find(it_due->second);
+        OT_ASSERT(m_mapScheduleEntries.end() != it_entry);
+
+        vecDue.push_back(it_due->second);
+        it_entry->second.m_bScheduled = false;
+        m_multimapSchedule.erase(it_due);
+    }
+
+    PublishFirstDue();
+
+    // An item is not processed again sooner than the regular round would
+    // have processed it.
+    const time64_t tNextRound = OTTimeAddTimeInterval(
+        tNow, std::max(1, OTCron::GetCronMsBetweenProcess() / 1000));
+
+    // loop through the due cron items and tell each one to ProcessCron().
     // If the item returns true, that means leave it on the list. Otherwise,
     // if it returns false, that means "it's done: remove it."
-    for (auto it = m_multimapCronItems.begin();
-         it != m_multimapCronItems.end();) {
+    for (std::size_t i = 0; i < vecDue.size(); ++i) {
+        auto it_map = FindItemOnMap(vecDue[i]);
+
+        if (m_mapCronItems.end() == it_map) continue;
+
+        OTCronItem* pItem = it_map->second;
+        OT_ASSERT(nullptr != pItem);
+
         if (GetTransactionCount() <= nTwentyPercent) {
             otErr << "WARNING: Cron has fewer than 20 percent of its normal "
                      "transaction "
@@ -628,32 +922,49 @@ void OTCron::ProcessCronItems()
                   << " were used in the current round alone!!! \n"
                      "SKIPPING THE REMAINDER OF THE CRON ITEMS THAT WERE "
                      "SCHEDULED FOR THIS ROUND!!!\n\n";
+            m_bThrottled = true;
+
+            // The rest stay due for the next round.
+            for (; i < vecDue.size(); ++i) {
+                auto it_skipped = FindItemOnMap(vecDue[i]);
+
+                if (m_mapCronItems.end() != it_skipped)
+                    ScheduleCronItem(*it_skipped->second, OT_TIME_ZERO);
+            }
+
             break;
         }
-        OTCronItem* pItem = it->second;
-        OT_ASSERT(nullptr != pItem);
+
         otInfo << "OTCron::" << __FUNCTION__
                << ": Processing item number: " << pItem->GetTransactionNum()
                << " \n";
 
         if (pItem->ProcessCron()) {
-            it++;
+            ScheduleCronItem(*pItem, tNextRound);
             continue;
         }
         pItem->HookRemovalFromCron(nullptr, GetNextTransactionNumber());
         otOut << "OTCron::" << __FUNCTION__
               << ": Removing cron item: " << pItem->GetTransactionNum() << "\n";
-        it = m_multimapCronItems.erase(it);
-        auto it_map = FindItemOnMap(pItem->GetTransactionNum());
-        OT_ASSERT(m_mapCronItems.end() != it_map);
+        auto it_multimap = FindItemOnMultimap(pItem->GetTransactionNum());
+        OT_ASSERT(m_multimapCronItems.end() != it_multimap);
+        m_multimapCronItems.erase(it_multimap);
+        UnscheduleCronItem(pItem->GetTransactionNum());
         m_mapCronItems.erase(it_map);
 
+        OTCronJournal::Record theRemoval;
+        theRemoval.m_strType = "cronItem";
+        theRemoval.m_lKey = pItem->GetTransactionNum();
+        theRemoval.m_bErase = true;
+
         delete pItem;
         pItem = nullptr;
 
-        bNeedToSave = true;
+        Journal(theRemoval);
     }
-    if (bNeedToSave) SaveCron();
+
+    // In case any numbers were used without an item being saved.
+    SaveTransactionNumbers();
 }
 
 // OTCron IS responsible for cleaning up theItem, and takes ownership.
@@ -702,7 +1013,7 @@ bool OTCron::AddCronItem(OTCronItem& theItem, Nym* pActivator,
 
         // Insert to the MULTIMAP (by Date)
         //
-        m_multimapCronItems.insert(
+        auto it_added = m_multimapCronItems.insert(
             m_multimapCronItems.upper_bound(tDateAdded),
             std::pair<time64_t, OTCronItem*>(tDateAdded, &theItem));
 
@@ -710,6 +1021,11 @@ bool OTCron::AddCronItem(OTCronItem& theItem, Nym* pActivator,
         theItem.setServerNym(m_pServerNym);
         theItem.setNotaryID(&m_NOTARY_ID);
 
+        // And put it on the schedule (by date next due)
+        //
+        m_mapScheduleEntries[theItem.GetTransactionNum()].m_itAdded = it_added;
+        ScheduleCronItem(theItem, OT_TIME_ZERO);
+
         bool bSuccess = true;
 
         theItem.HookActivationOnCron(
@@ -743,7 +1059,7 @@ bool OTCron::AddCronItem(OTCronItem& theItem, Nym* pActivator,
             //            theItem.SaveContract();
 
             // Since we added an item to the Cron, we SAVE it.
-            bSuccess = SaveCron();
+            bSuccess = SaveCronItem(theItem);
 
             if (bSuccess)
                 otOut << __FUNCTION__
@@ -795,11 +1111,17 @@ bool OTCron::RemoveCronItem(int64_t lTransactionNum,
 
         m_mapCronItems.erase(it_map);           // Remove from MAP.
         m_multimapCronItems.erase(it_multimap); // Remove from MULTIMAP.
+        UnscheduleCronItem(lTransactionNum);    // Remove from schedule.
 
         delete pItem;
 
         // An item has been removed from Cron. SAVE.
-        return SaveCron();
+        OTCronJournal::Record theRemoval;
+        theRemoval.m_strType = "cronItem";
+        theRemoval.m_lKey = lTransactionNum;
+        theRemoval.m_bErase = true;
+
+        return Journal(theRemoval);
     }
 
     return false;
@@ -844,16 +1166,14 @@ mapOfCronItems::iterator OTCron::FindItemOnMap(int64_t lTransactionNum)
 multimapOfCronItems::iterator OTCron::FindItemOnMultimap(
     int64_t lTransactionNum)
 {
-    auto itt = m_multimapCronItems.begin();
+    auto it_entry = m_mapScheduleEntries.find(lTransactionNum);
 
-    while (m_multimapCronItems.end() != itt) {
-        OTCronItem* pItem = itt->second;
-        OT_ASSERT((nullptr != pItem));
+    if (m_mapScheduleEntries.end() == it_entry)
+        return m_multimapCronItems.end();
 
-        if (pItem->GetTransactionNum() == lTransactionNum) break;
-
-        ++itt;
-    }
+    auto itt = it_entry->second.m_itAdded;
+    OT_ASSERT(nullptr != itt->second);
+    OT_ASSERT(itt->second->GetTransactionNum() == lTransactionNum);
 
     return itt;
 }
@@ -1127,6 +1447,11 @@ void OTCron::Release_Cron()
 {
     // If there were any dynamically allocated objects, clean them up here.
 
+    m_multimapSchedule.clear();
+    m_mapScheduleEntries.clear();
+    m_bThrottled = false;
+    PublishFirstDue();
+
     while (!m_multimapCronItems.empty()) {
         auto it = m_multimapCronItems.begin();
         m_multimapCronItems.erase(it);
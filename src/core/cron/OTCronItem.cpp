@@ -64,6 +64,7 @@
 
 #include <inttypes.h>
 #include <irrxml/irrXML.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <deque>
 #include <memory>
@@ -703,6 +704,24 @@ bool OTCronItem::ProcessCron()
     return true;
 }
 
+// virtual
+time64_t OTCronItem::GetCronDueDate() const
+{
+    // Never processed yet (for example, just loaded after a server reboot.)
+    if (GetLastProcessDate() <= OT_TIME_ZERO) return OT_TIME_ZERO;
+
+    // ProcessCron does nothing until more than GetProcessInterval() has
+    // passed since the last time.
+    const time64_t tDue = OTTimeAddTimeInterval(
+        GetLastProcessDate(), GetProcessInterval() + 1);
+
+    // Nor does anything happen before the item becomes valid, except for
+    // removal, which is not otherwise processed sooner than tDue anyway.
+    if (IsFlaggedForRemoval()) return tDue;
+
+    return std::max(tDue, GetValidFrom());
+}
+
 // OTCron calls this when a cron item is added.
 // bForTheFirstTime=true means that this cron item is being
 // activated for the very first time. (Versus being re-added
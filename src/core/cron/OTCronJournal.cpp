@@ -0,0 +1,260 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/core/cron/OTCronJournal.hpp"
+
+#include "opentxs/core/Contract.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/core/crypto/OTASCIIArmor.hpp"
+#include "opentxs/core/util/Common.hpp"
+#include "opentxs/core/util/Tag.hpp"
+
+#include <irrxml/irrXML.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+namespace opentxs
+{
+
+namespace
+{
+
+// The signed form of a journal record, as it is stored in the log.
+class JournalEntry : public Contract
+{
+public:
+    int64_t m_lGeneration{0};
+    OTCronJournal::Record m_Record;
+
+    JournalEntry()
+        : Contract()
+    {
+        m_strContractType.Set("JOURNAL ENTRY");
+    }
+
+    void UpdateContents() override
+    {
+        m_xmlUnsigned.Release();
+
+        Tag tag("journalEntry");
+
+        tag.add_attribute("version", m_strVersion.Get());
+        tag.add_attribute("generation", formatLong(m_lGeneration));
+        tag.add_attribute("type", m_Record.m_strType.Get());
+        tag.add_attribute("key", formatLong(m_Record.m_lKey));
+        tag.add_attribute("value", formatLong(m_Record.m_lValue));
+        tag.add_attribute("erase", formatBool(m_Record.m_bErase));
+        tag.add_attribute(
+            "dateAdded", formatTimestamp(m_Record.m_tDateAdded));
+
+        if (m_Record.m_strPayload.Exists()) {
+            OTASCIIArmor ascPayload(m_Record.m_strPayload);
+            tag.add_tag("payload", ascPayload.Get());
+        }
+
+        std::string str_result;
+        tag.output(str_result);
+
+        m_xmlUnsigned.Concatenate("%s", str_result.c_str());
+    }
+
+protected:
+    int32_t ProcessXMLNode(irr::io::IrrXMLReader*& xml) override
+    {
+        if (!strcmp("journalEntry", xml->getNodeName())) {
+            m_strVersion = xml->getAttributeValue("version");
+            m_lGeneration =
+                String::StringToLong(xml->getAttributeValue("generation"));
+            m_Record.m_strType = xml->getAttributeValue("type");
+            m_Record.m_lKey =
+                String::StringToLong(xml->getAttributeValue("key"));
+
+            const String strValue(xml->getAttributeValue("value"));
+            m_Record.m_lValue = strValue.Exists() ? strValue.ToLong() : 0;
+
+            const String strErase(xml->getAttributeValue("erase"));
+            m_Record.m_bErase = strErase.Compare("true");
+
+            const String strDateAdded(xml->getAttributeValue("dateAdded"));
+            m_Record.m_tDateAdded = OTTimeGetTimeFromSeconds(
+                strDateAdded.Exists() ? parseTimestamp(strDateAdded.Get())
+                                      : 0);
+
+            return 1;
+        }
+        else if (!strcmp("payload", xml->getNodeName())) {
+            if (!Contract::LoadEncodedTextField(xml, m_Record.m_strPayload)) {
+                otErr << "Error in JournalEntry::ProcessXMLNode: payload "
+                         "field without value.\n";
+                return (-1); // error condition
+            }
+
+            return 1;
+        }
+
+        return 0;
+    }
+};
+
+} // namespace
+
+OTCronJournal::OTCronJournal(
+    const std::string& strFolder,
+    const std::string& strFilename)
+    : m_strFolder(strFolder)
+    , m_strFilename(strFilename + ".jrn")
+{
+}
+
+bool OTCronJournal::Append(const Record& theRecord, const Nym& theSigner)
+{
+    JournalEntry theEntry;
+    theEntry.m_lGeneration = m_lGeneration;
+    theEntry.m_Record = theRecord;
+
+    String strEntry;
+
+    if (!theEntry.SignContract(theSigner) || !theEntry.SaveContract() ||
+        !theEntry.SaveContractRaw(strEntry)) {
+        otErr << "OTCronJournal::" << __FUNCTION__
+              << ": Failed signing journal entry for " << m_strFilename
+              << "\n";
+        return false;
+    }
+
+    // Each record is its length on a line by itself, followed by the record.
+    const std::string strRecord = std::to_string(strEntry.GetLength()) +
+                                  "\n" + strEntry.Get() + "\n";
+
+    if (!OTDB::AppendPlainString(strRecord, m_strFolder, m_strFilename)) {
+        otErr << "OTCronJournal::" << __FUNCTION__
+              << ": Failed writing journal " << m_strFolder
+              << Log::PathSeparator() << m_strFilename << "\n";
+        return false;
+    }
+
+    ++m_lCount;
+
+    return true;
+}
+
+bool OTCronJournal::Load(
+    const int64_t& lGeneration,
+    const Nym& theSigner,
+    std::vector<Record>& output)
+{
+    m_lGeneration = lGeneration;
+    m_lCount = 0;
+
+    const String strPath(
+        m_strFolder + Log::PathSeparator() + m_strFilename);
+
+    // Nothing journaled yet.
+    if (!OTDB::Exists(m_strFolder, m_strFilename)) return true;
+
+    // (An empty journal reads back as an empty string.)
+    const std::string strContents =
+        OTDB::QueryPlainString(m_strFolder, m_strFilename);
+
+    std::size_t position = 0;
+
+    while (position < strContents.size()) {
+        const std::size_t newline = strContents.find('\n', position);
+
+        if (std::string::npos == newline) break;
+
+        const std::string strLength =
+            strContents.substr(position, newline - position);
+        char* szEnd = nullptr;
+        const int64_t lLength = std::strtoll(strLength.c_str(), &szEnd, 10);
+        const std::size_t start = newline + 1;
+
+        if (strLength.empty() || ('\0' != *szEnd) || (0 >= lLength) ||
+            (strContents.size() < start + lLength + 1) ||
+            ('\n' != strContents[start + lLength]))
+            break;
+
+        JournalEntry theEntry;
+        const String strEntry(strContents.substr(start, lLength));
+
+        if (!theEntry.LoadContractFromString(strEntry) ||
+            !theEntry.VerifySignature(theSigner)) {
+            otErr << "OTCronJournal::" << __FUNCTION__
+                  << ": ERROR SECURITY: Server signature failed to verify on "
+                     "a journal entry in " << strPath << "\n";
+            return false;
+        }
+
+        ++m_lCount;
+        position = start + lLength + 1;
+
+        if (lGeneration == theEntry.m_lGeneration) {
+            output.push_back(theEntry.m_Record);
+        }
+    }
+
+    if (position < strContents.size()) {
+        otErr << "OTCronJournal::" << __FUNCTION__
+              << ": Discarding an incomplete record at the end of " << strPath
+              << "\n";
+
+        // The records before it are already committed, so the trimmed
+        // journal replaces the old one in a single step.
+        if (!OTDB::ReplacePlainString(
+                strContents.substr(0, position), m_strFolder, m_strFilename))
+            return false;
+    }
+
+    return true;
+}
+
+bool OTCronJournal::Reset(const int64_t& lGeneration)
+{
+    m_lGeneration = lGeneration;
+    m_lCount = 0;
+
+    if (!OTDB::Exists(m_strFolder, m_strFilename)) return true;
+
+    return OTDB::EraseValueByKey(m_strFolder, m_strFilename);
+}
+
+} // namespace opentxs
@@ -44,6 +44,7 @@
 #include "opentxs/core/crypto/Ecdsa.hpp"
 #include "opentxs/core/crypto/OTPassword.hpp"
 #include "opentxs/core/crypto/OTPasswordData.hpp"
+#include "opentxs/core/crypto/SigningSession.hpp"
 #ifdef ANDROID
 #include "opentxs/core/util/android_string.hpp"
 #endif // ANDROID
@@ -59,6 +60,8 @@ extern "C" {
 #include <sodium/crypto_box.h>
 }
 
+#include <mutex>
+
 namespace opentxs
 {
 AsymmetricKeyEC::AsymmetricKeyEC(
@@ -137,9 +140,32 @@ bool AsymmetricKeyEC::GetKey(proto::Ciphertext& key) const
     return false;
 }
 
+bool AsymmetricKeyEC::GetParsedKey(OTData& parsed) const
+{
+    std::lock_guard<std::mutex> lock(parsed_key_lock_);
+
+    if (parsed_key_) {
+        parsed.Assign(*parsed_key_);
+
+        return true;
+    }
+
+    return false;
+}
+
+std::shared_ptr<SigningSession> AsymmetricKeyEC::GetSigningSession() const
+{
+    std::lock_guard<std::mutex> lock(signing_session_lock_);
+
+    return signing_session_;
+}
+
 bool AsymmetricKeyEC::GetPublicKey(String& strKey) const
 {
     strKey.reset();
+
+    if (!key_) { return false; }
+
     strKey.Set(OT::App().Crypto().Encode().DataEncode(*key_).c_str());
 
     return true;
@@ -312,6 +338,8 @@ bool AsymmetricKeyEC::SetKey(std::unique_ptr<OTData>& key)
     m_bIsPublicKey = true;
     m_bIsPrivateKey = false;
     key_.swap(key);
+    std::lock_guard<std::mutex> lock(parsed_key_lock_);
+    parsed_key_.reset();
 
     return true;
 }
@@ -326,6 +354,19 @@ bool AsymmetricKeyEC::SetKey(std::unique_ptr<proto::Ciphertext>& key)
     return true;
 }
 
+void AsymmetricKeyEC::SetParsedKey(const OTData& parsed) const
+{
+    std::lock_guard<std::mutex> lock(parsed_key_lock_);
+    parsed_key_.reset(new OTData(parsed));
+}
+
+void AsymmetricKeyEC::SetSigningSession(
+    const std::shared_ptr<SigningSession>& session) const
+{
+    std::lock_guard<std::mutex> lock(signing_session_lock_);
+    signing_session_ = session;
+}
+
 bool AsymmetricKeyEC::TransportKey(
     OTData& publicKey,
     OTPassword& privateKey) const
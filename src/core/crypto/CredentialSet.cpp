@@ -66,6 +66,7 @@
 #include "opentxs/core/crypto/ChildKeyCredential.hpp"
 #include "opentxs/core/crypto/ContactCredential.hpp"
 #include "opentxs/core/crypto/Credential.hpp"
+#include "opentxs/core/crypto/CryptoAsymmetric.hpp"
 #include "opentxs/core/crypto/KeyCredential.hpp"
 #include "opentxs/core/crypto/MasterCredential.hpp"
 #include "opentxs/core/crypto/NymParameters.hpp"
@@ -89,6 +90,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -136,23 +138,45 @@ bool CredentialSet::VerifyInternally() const
         return false;
     }
 
-    // Check each child credential for validity.
+    // Check each child credential for validity. Their signatures are
+    // independent of each other, so rather than being checked as each child
+    // is validated, they are collected and checked together in one batch.
+    // Everything else, including every use of this set and its master
+    // credential, stays on this thread.
+    std::vector<CryptoAsymmetric::BatchItem> batch;
+    auto* previous = KeyCredential::deferred_;
+    KeyCredential::deferred_ = &batch;
+    bool valid = true;
+
     for (const auto& it : m_mapCredentials) {
-        std::string str_sub_id = it.first;
         auto& pSub = it.second;
 
         OT_ASSERT(pSub);
 
         if (!pSub->Validate()) {
-            otOut << __FUNCTION__
-                  << ": Child credential failed to verify: " << str_sub_id
-                  << "\nNymID: " << GetNymID() << "\n";
+            valid = false;
 
-            return false;
+            break;
         }
     }
 
-    return true;
+    KeyCredential::deferred_ = previous;
+
+    if (valid) { valid = CryptoAsymmetric::VerifyBatches(batch); }
+
+    if (valid) { return true; }
+
+    // Find the culprit the slow way, one child at a time.
+    for (const auto& it : m_mapCredentials) {
+        if (!it.second->Validate()) {
+            otOut << __FUNCTION__ << ": Child credential failed to verify: "
+                  << it.first << "\nNymID: " << GetNymID() << "\n";
+
+            break;
+        }
+    }
+
+    return false;
 }
 
 const String& CredentialSet::GetNymID() const { return m_strNymID; }
@@ -38,10 +38,20 @@
 
 #include "opentxs/core/crypto/CryptoAsymmetric.hpp"
 
+#include "opentxs/api/Executor.hpp"
+#include "opentxs/api/OT.hpp"
 #include "opentxs/core/OTData.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/core/crypto/CryptoEngine.hpp"
+#include "opentxs/core/crypto/CryptoHashEngine.hpp"
+#include "opentxs/core/crypto/OTAsymmetricKey.hpp"
 #include "opentxs/core/crypto/OTSignature.hpp"
 
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+
 namespace opentxs
 {
 
@@ -89,6 +99,33 @@ EcdsaCurve CryptoAsymmetric::KeyTypeToCurve(
    return output;
 }
 
+bool CryptoAsymmetric::check_verified(const std::string& id) const
+{
+    std::lock_guard<std::mutex> lock(verified_lock_);
+    auto it = verified_index_.find(id);
+
+    if (verified_index_.end() == it) { return false; }
+
+    verified_.splice(verified_.begin(), verified_, it->second);
+
+    return true;
+}
+
+void CryptoAsymmetric::set_verified(const std::string& id) const
+{
+    std::lock_guard<std::mutex> lock(verified_lock_);
+
+    if (verified_index_.end() != verified_index_.find(id)) { return; }
+
+    verified_.push_front(id);
+    verified_index_[id] = verified_.begin();
+
+    while (VerificationCacheSize < verified_.size()) {
+        verified_index_.erase(verified_.back());
+        verified_.pop_back();
+    }
+}
+
 bool CryptoAsymmetric::SignContract(
     const String& strContractUnsigned,
     const OTAsymmetricKey& theKey,
@@ -122,9 +159,11 @@ bool CryptoAsymmetric::VerifyContractSignature(
     OTData plaintext(strContractToVerify.Get(), strContractToVerify.GetLength()+1); //include null terminator
     OTData signature;
     theSignature.GetData(signature);
+    OTData digest;
 
-    return Verify(
+    return VerifyWithDigest(
             plaintext,
+            digest,
             theKey,
             signature,
             hashType,
@@ -132,4 +171,127 @@ bool CryptoAsymmetric::VerifyContractSignature(
 
 }
 
+bool CryptoAsymmetric::VerifyAll(
+    const std::size_t count,
+    const std::function<bool(const std::size_t)>& verify)
+{
+    std::atomic<bool> failed{false};
+    OT::App().Executor().Parallel(
+        count,
+        [&](const std::size_t i) -> void {
+            if (!failed.load() && !verify(i)) { failed.store(true); }
+        },
+        (count + ChecksPerThread - 1) / ChecksPerThread,
+        Executor::Priority::HIGH);
+
+    return !failed.load();
+}
+
+bool CryptoAsymmetric::VerifyBatches(const std::vector<BatchItem>& batch)
+{
+    std::map<CryptoAsymmetric*, std::vector<BatchItem>> engines;
+    CryptoAsymmetric* first = nullptr;
+    bool mixed = false;
+
+    for (const auto& item : batch) {
+        if (nullptr == item.key_) { return false; }
+
+        auto& engine = item.key_->engine();
+
+        if (nullptr == first) {
+            first = &engine;
+        } else if (first != &engine) {
+            mixed = true;
+        }
+    }
+
+    if (nullptr == first) { return true; }
+
+    if (!mixed) { return first->VerifyBatch(batch); }
+
+    for (const auto& item : batch) {
+        engines[&item.key_->engine()].push_back(item);
+    }
+
+    for (const auto& it : engines) {
+        if (!it.first->VerifyBatch(it.second)) { return false; }
+    }
+
+    return true;
+}
+
+bool CryptoAsymmetric::VerifyBatch(
+    const std::vector<BatchItem>& batch,
+    const OTPasswordData* pPWData) const
+{
+    return VerifyAll(batch.size(), [&](const std::size_t i) -> bool {
+        const auto& item = batch[i];
+
+        if (nullptr == item.key_) { return false; }
+
+        OTData digest;
+
+        return VerifyWithDigest(
+            item.plaintext_,
+            digest,
+            *item.key_,
+            item.signature_,
+            item.hash_type_,
+            pPWData);
+    });
+}
+
+bool CryptoAsymmetric::verify_digest(
+    const OTData& plaintext,
+    __attribute__((unused)) const OTData& digest,
+    const OTAsymmetricKey& theKey,
+    const OTData& signature,
+    const proto::HashType hashType,
+    const OTPasswordData* pPWData) const
+{
+    return Verify(plaintext, theKey, signature, hashType, pPWData);
+}
+
+bool CryptoAsymmetric::VerifyWithDigest(
+    const OTData& plaintext,
+    OTData& digest,
+    const OTAsymmetricKey& theKey,
+    const OTData& signature,
+    const proto::HashType hashType,
+    const OTPasswordData* pPWData) const
+{
+    if (0 == signature.GetSize()) { return false; }
+
+    if (0 == digest.GetSize()) {
+        if (!OT::App().Crypto().Hash().Digest(hashType, plaintext, digest)) {
+
+            return false;
+        }
+    }
+
+    String publicKey;
+
+    if (!theKey.GetPublicKey(publicKey)) {
+
+        return verify_digest(
+            plaintext, digest, theKey, signature, hashType, pPWData);
+    }
+
+    // The digest has a fixed size for a given hash type, so the digest and
+    // signature can follow each other unambiguously.
+    std::string id = std::to_string(hashType) + "|" + publicKey.Get() + "|";
+    id.append(static_cast<const char*>(digest.GetPointer()), digest.GetSize());
+    id.append(
+        static_cast<const char*>(signature.GetPointer()), signature.GetSize());
+
+    if (check_verified(id)) { return true; }
+
+    const bool verified = verify_digest(
+        plaintext, digest, theKey, signature, hashType, pPWData);
+
+    if (verified) { set_verified(id); }
+
+    return verified;
+}
+
 } // namespace opentxs
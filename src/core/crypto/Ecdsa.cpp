@@ -49,10 +49,13 @@
 #include "opentxs/core/crypto/CryptoUtil.hpp"
 #include "opentxs/core/crypto/OTPassword.hpp"
 #include "opentxs/core/crypto/OTPasswordData.hpp"
+#include "opentxs/core/crypto/SigningSession.hpp"
 #include "opentxs/core/crypto/SymmetricKey.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/OTData.hpp"
 
+#include <mutex>
+
 namespace opentxs
 {
 bool Ecdsa::AsymmetricKeyToECPrivatekey(
@@ -60,13 +63,29 @@ bool Ecdsa::AsymmetricKeyToECPrivatekey(
     const OTPasswordData& passwordData,
     OTPassword& privkey) const
 {
+    auto session = asymmetricKey.GetSigningSession();
+
+    if (session && session->Get(privkey)) { return true; }
+
+    // The notary signs replies to concurrent read-only commands with the same
+    // key. Decrypting it goes through the cached master key and the password
+    // callback, which must not run on two threads at once.
+    static std::mutex decrypt_lock;
+    std::lock_guard<std::mutex> lock(decrypt_lock);
+
+    if (session && session->Get(privkey)) { return true; }
+
     proto::Ciphertext dataPrivkey;
     const bool havePrivateKey = asymmetricKey.GetKey(dataPrivkey);
 
     if (!havePrivateKey) { return false; }
 
-    return AsymmetricKeyToECPrivkey(
-        dataPrivkey, passwordData, privkey);
+    const bool decrypted =
+        AsymmetricKeyToECPrivkey(dataPrivkey, passwordData, privkey);
+
+    if (decrypted && session) { session->Set(privkey); }
+
+    return decrypted;
 }
 
 bool Ecdsa::AsymmetricKeyToECPrivkey(
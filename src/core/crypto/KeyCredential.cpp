@@ -89,10 +89,14 @@
 #include <cstdint>
 #include <memory>
 #include <ostream>
+#include <vector>
 
 namespace opentxs
 {
 
+thread_local std::vector<CryptoAsymmetric::BatchItem>*
+    KeyCredential::deferred_{nullptr};
+
 bool KeyCredential::VerifySignedBySelf(const Lock& lock) const
 {
     OT_ASSERT(m_SigningKey);
@@ -594,6 +598,25 @@ bool KeyCredential::Verify(
 
     OT_ASSERT(nullptr != keyToUse);
 
+    if (nullptr != deferred_) {
+        const auto& publicKey = keyToUse->GetPublicKey();
+
+        if (publicKey.IsPrivate()) {
+            otErr << "You must use public keys to verify signatures.\n";
+
+            return false;
+        }
+
+        CryptoAsymmetric::BatchItem item;
+        item.plaintext_ = plaintext;
+        item.key_ = &publicKey;
+        item.signature_.Assign(sig.signature().c_str(), sig.signature().size());
+        item.hash_type_ = sig.hashtype();
+        deferred_->push_back(std::move(item));
+
+        return true;
+    }
+
     return keyToUse->Verify(plaintext, sig);
 }
 
@@ -324,6 +324,8 @@ bool Letter::Open(
     const OTPasswordData& keyPassword,
     String& theOutput)
 {
+    theOutput.SetSecure();
+
     auto serialized = proto::DataToProto<proto::Envelope>(dataInput);
 
     const bool haveInput = proto::Check(serialized, 0, 0xFFFFFFFF);
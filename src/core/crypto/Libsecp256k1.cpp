@@ -58,7 +58,9 @@
 #include "opentxs/core/String.hpp"
 
 #include <stdint.h>
+#include <cstring>
 #include <ostream>
+#include <set>
 
 namespace opentxs
 {
@@ -174,27 +176,27 @@ bool Libsecp256k1::Verify(
     const OTAsymmetricKey& theKey,
     const OTData& signature,
     const proto::HashType hashType,
-    __attribute__((unused)) const OTPasswordData* pPWData) const
+    const OTPasswordData* pPWData) const
 {
     OTData hash;
     bool haveDigest = OT::App().Crypto().Hash().Digest(hashType, plaintext, hash);
 
     if (!haveDigest) { return false; }
 
-    const AsymmetricKeyEC* key =
-        dynamic_cast<const AsymmetricKeySecp256k1*>(&theKey);
-
-    if (nullptr == key) { return false; }
-
-    OTData ecdsaPubkey;
-    const bool havePublicKey = AsymmetricKeyToECPubkey(*key, ecdsaPubkey);
-
-    if (!havePublicKey) { return false; }
+    return verify_digest(plaintext, hash, theKey, signature, hashType, pPWData);
+}
 
+bool Libsecp256k1::verify_digest(
+    __attribute__((unused)) const OTData& plaintext,
+    const OTData& hash,
+    const OTAsymmetricKey& theKey,
+    const OTData& signature,
+    __attribute__((unused)) const proto::HashType hashType,
+    __attribute__((unused)) const OTPasswordData* pPWData) const
+{
     secp256k1_pubkey point;
-    const bool pubkeyParsed = ParsePublicKey(ecdsaPubkey, point);
 
-    if (!pubkeyParsed) { return false; }
+    if (!parsed_key(theKey, point)) { return false; }
 
     secp256k1_ecdsa_signature ecdsaSignature;
     const bool haveSignature = OTDataToECSignature(signature, ecdsaSignature);
@@ -208,6 +210,61 @@ bool Libsecp256k1::Verify(
         &point);
 }
 
+bool Libsecp256k1::VerifyBatch(
+    const std::vector<BatchItem>& batch,
+    const OTPasswordData* pPWData) const
+{
+    std::set<const OTAsymmetricKey*> keys;
+
+    for (const auto& item : batch) {
+        if (nullptr == item.key_) { return false; }
+
+        if (sizeof(secp256k1_ecdsa_signature) != item.signature_.GetSize()) {
+
+            return false;
+        }
+
+        if (keys.insert(item.key_).second) {
+            secp256k1_pubkey point;
+
+            if (!parsed_key(*item.key_, point)) { return false; }
+        }
+    }
+
+    return CryptoAsymmetric::VerifyBatch(batch, pPWData);
+}
+
+bool Libsecp256k1::parsed_key(
+    const OTAsymmetricKey& theKey,
+    secp256k1_pubkey& output) const
+{
+    const AsymmetricKeyEC* key =
+        dynamic_cast<const AsymmetricKeySecp256k1*>(&theKey);
+
+    if (nullptr == key) { return false; }
+
+    OTData parsed;
+
+    if (key->GetParsedKey(parsed) && (sizeof(output) == parsed.GetSize())) {
+        std::memcpy(output.data, parsed.GetPointer(), sizeof(output));
+
+        return true;
+    }
+
+    OTData ecdsaPubkey;
+    const bool havePublicKey = AsymmetricKeyToECPubkey(*key, ecdsaPubkey);
+
+    if (!havePublicKey) { return false; }
+
+    const bool pubkeyParsed = ParsePublicKey(ecdsaPubkey, output);
+
+    if (!pubkeyParsed) { return false; }
+
+    key->SetParsedKey(OTData(output.data, sizeof(output)));
+
+    return true;
+}
+
 bool Libsecp256k1::OTDataToECSignature(
     const OTData& inSignature,
     secp256k1_ecdsa_signature& outSignature) const
@@ -49,6 +49,7 @@
 #include "opentxs/core/OTData.hpp"
 
 #include <array>
+#include <map>
 
 extern "C" {
 #include <sodium.h>
@@ -589,4 +590,54 @@ bool Libsodium::Verify(
 
     return false;
 }
+
+bool Libsodium::VerifyBatch(
+    const std::vector<BatchItem>& batch,
+    __attribute__((unused)) const OTPasswordData* pPWData) const
+{
+    std::map<const OTAsymmetricKey*, OTData> pubkeys;
+
+    for (const auto& item : batch) {
+        if (proto::HASHTYPE_BLAKE2B256 != item.hash_type_) {
+            otErr << __FUNCTION__ << ": Invalid hash function: "
+                  << CryptoHash::HashTypeToString(item.hash_type_)
+                  << std::endl;
+
+            return false;
+        }
+
+        if (crypto_sign_BYTES != item.signature_.GetSize()) { return false; }
+
+        if (pubkeys.end() != pubkeys.find(item.key_)) { continue; }
+
+        const AsymmetricKeyEC* key =
+            dynamic_cast<const AsymmetricKeyEd25519*>(item.key_);
+
+        if (nullptr == key) { return false; }
+
+        OTData pubkey;
+        const bool havePublicKey = AsymmetricKeyToECPubkey(*key, pubkey);
+
+        if (!havePublicKey ||
+            (crypto_sign_PUBLICKEYBYTES != pubkey.GetSize())) {
+            otErr << __FUNCTION__ << ": Can not extract ed25519 public key "
+                  << "from OTAsymmetricKey." << std::endl;
+
+            return false;
+        }
+
+        pubkeys.emplace(item.key_, std::move(pubkey));
+    }
+
+    return VerifyAll(batch.size(), [&](const std::size_t i) -> bool {
+        const auto& item = batch[i];
+        const auto& pubkey = pubkeys.at(item.key_);
+
+        return (0 == ::crypto_sign_verify_detached(
+            static_cast<const unsigned char*>(item.signature_.GetPointer()),
+            static_cast<const unsigned char*>(item.plaintext_.GetPointer()),
+            item.plaintext_.GetSize(),
+            static_cast<const unsigned char*>(pubkey.GetPointer())));
+    });
+}
 } // namespace opentxs
@@ -1064,9 +1064,11 @@ bool OTAsymmetricKey::Verify(
 
     OTData signature;
     signature.Assign(sig.signature().c_str(), sig.signature().size());
+    OTData digest;
 
-    return engine().Verify(
+    return engine().VerifyWithDigest(
         plaintext,
+        digest,
         *this,
         signature,
         sig.hashtype(),
@@ -220,6 +220,8 @@ bool OTEnvelope::Decrypt(String& theOutput, const OTSymmetricKey& theKey,
         (thePassword.isMemory() && (thePassword.getMemorySize() > 0)));
     OT_ASSERT(theKey.IsGenerated());
 
+    theOutput.SetSecure();
+
     OTPassword theRawSymmetricKey;
 
     if (false ==
@@ -335,6 +337,7 @@ bool OTEnvelope::Decrypt(String& theOutput, const OTSymmetricKey& theKey,
     // Now we've got all the pieces together, let's try to decrypt it...
     //
     OTData thePlaintext; // for output.
+    thePlaintext.SetSecure();
     CryptoSymmetricDecryptOutput plaintext(thePlaintext);
 
     const bool bDecrypted = OT::App().Crypto().AES().Decrypt(
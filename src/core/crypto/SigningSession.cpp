@@ -0,0 +1,92 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/core/crypto/SigningSession.hpp"
+
+#include "opentxs/core/crypto/OTPassword.hpp"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+namespace opentxs
+{
+
+SigningSession::SigningSession(const std::chrono::seconds& lifetime)
+    : lifetime_(lifetime)
+    , lock_()
+    , key_(nullptr)
+    , expires_()
+{
+}
+
+void SigningSession::Close()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    key_.reset();  // OTPassword zeroes and unlocks its memory
+}
+
+bool SigningSession::Get(OTPassword& privkey) const
+{
+    std::lock_guard<std::mutex> lock(lock_);
+
+    if (!key_) { return false; }
+
+    if ((std::chrono::seconds(0) < lifetime_) &&
+        (std::chrono::steady_clock::now() >= expires_)) {
+        key_.reset();
+
+        return false;
+    }
+
+    privkey = *key_;
+
+    return true;
+}
+
+void SigningSession::Set(const OTPassword& privkey)
+{
+    if (std::chrono::seconds(0) == lifetime_) { return; }
+
+    std::lock_guard<std::mutex> lock(lock_);
+    key_.reset(new OTPassword(privkey));
+    expires_ = std::chrono::steady_clock::now() + lifetime_;
+}
+
+SigningSession::~SigningSession() { Close(); }
+}  // namespace opentxs
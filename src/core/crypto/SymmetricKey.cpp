@@ -272,6 +272,8 @@ bool SymmetricKey::Decrypt(
     const OTPasswordData& keyPassword,
     OTData& plaintext)
 {
+    plaintext.SetSecure();
+
     if (!Allocate(ciphertext.data().size(), plaintext)) {
 
         return false;
@@ -63,6 +63,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
+#include <algorithm>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -1253,7 +1254,7 @@ void OTPaymentPlan::ProcessInitialPayment()
     // if it is dirty, or instruct it to update itself if it is.  Anyway, let's
     // save Cron...
 
-    GetCron()->SaveCron();
+    GetCron()->SaveCronItem(*this);
 
     // Todo: put the actual Cron items in separate files, so I don't have to
     // update
@@ -1332,7 +1333,7 @@ void OTPaymentPlan::ProcessPaymentPlan()
     // and re-sign it and save it, no matter what. So I just
     // call this here to keep it simple:
 
-    GetCron()->SaveCron();
+    GetCron()->SaveCronItem(*this);
 }
 
 // OTCron calls this regularly, which is my chance to expire, etc.
@@ -1388,13 +1389,11 @@ bool OTPaymentPlan::ProcessCron()
 
     // First process the initial payment...
 
-    if (HasInitialPayment() &&     // If I have an initial payment...
-        !IsInitialPaymentDone() && // and I have not yet processed it...
-        (OTTimeGetCurrentTime() > GetInitialPaymentDate()) && // and we're past the initial payment due date...
-        ( (0 == GetLastFailedInitialPaymentDate()) || // And we've not yet got a failed date, OR
-          (OTTimeGetTimeInterval(OTTimeGetCurrentTime(), GetLastFailedInitialPaymentDate()) > // it's been more than a day
-           OTTimeGetSecondsFromTime(OT_TIME_DAY_IN_SECONDS)) )                     // since I last failed attmpting this...
-         )
+    const time64_t tNow = OTTimeGetCurrentTime();
+    time64_t tInitialDue = OT_TIME_ZERO;
+
+    if (GetInitialPaymentDueDate(tInitialDue) && // If I have an initial payment I have not yet processed...
+        (tNow >= tInitialDue)) // and we're past its due date, and more than a day past any failed attempt...
     { // THEN we're due for the initial payment! Process it!
 
         otOut << "Cron: Processing initial payment...\n";
@@ -1418,44 +1417,9 @@ bool OTPaymentPlan::ProcessCron()
     //
     if (!IsFlaggedForRemoval() &&
          HasPaymentPlan()      &&
-        (OTTimeGetCurrentTime() > GetPaymentPlanStartDate()))
+        (tNow > GetPaymentPlanStartDate()))
     {
-//      otErr << "DEBUG: Payment Plan -------------\n";
-
-        // First I'll calculate whether the next payment would be due, based on start date,
-        // time between payments, and date of last payment.
-
-        const int64_t DURATION_SINCE_START = OTTimeGetTimeInterval(
-            OTTimeGetCurrentTime(), GetPaymentPlanStartDate());
-
-        // Let's say the plan charges every week, and it's been 16 DAYS DURATION since starting.
-        // The first charge would have been on the 1st day, 16 days ago.
-        // Then the second charge would have been on the 8th day, (7 days later)
-        // Then the third charge would have been on the 15th day, (7 days later again)
-        // That means the next charge isn't due until the 22nd.
-
-        // Right now in this example, DURATION_SINCE_START is: (16 * OT_TIME_DAY_IN_SECONDS).
-        // I must calculate from that, that three charges have already happened, and that the
-        // next one is not yet due.
-        //
-        // I also know that GetTimeBetweenPayments() is set to (OT_TIME_DAY_IN_SECONDS * 7)
-        //
-        // Duration / timebetween == 16/7 == 2 with 2 remainder. (+1 to get 3: THREE should have already happened.)
-        // if it was the 14th, 14/7 == 2 with 0 remainder.       (+1 to get 3: THREE should have happened by the 14th)
-        // If it was the 22nd, 22/7 == 3 with 1 remainder.       (+1 to get 4: FOUR payments should have already happened.)
-        //
-        // Can also just add the TimeBetweenPayments to the DateOfLastPayment...
-        //
-        const int64_t nNoPaymentsThatShouldHaveHappenedByNow =
-            DURATION_SINCE_START / OTTimeGetSecondsFromTime(GetTimeBetweenPayments()) + 1;
-        // The +1 is because it charges on the 1st day of the plan. So 14 days,
-        // which is 7 times 2, equals *3* payments, not 2.
-
-//      OTLog::vOutput(0, "Payments that should have happened by now: %d\n"
-//                     "Number payments done: %d      date of last payment: %d\n"
-//                     "Date of last failed payment: %d   Time Between: %d",
-//                     nNoPaymentsThatShouldHaveHappenedByNow, GetNoPaymentsDone(), GetDateOfLastPayment(),
-//                     GetDateOfLastFailedPayment(), GetTimeBetweenPayments());
+        time64_t tEnd = OT_TIME_ZERO, tPaymentDue = OT_TIME_ZERO;
 
         // It's expired, remove it. (I check >0 because this one is an optional field.)
         if ((GetMaximumNoPayments() > 0) &&
@@ -1464,34 +1428,18 @@ bool OTPaymentPlan::ProcessCron()
             otOut << "Payment plan has expired by reaching max number of payments allowed.\n";
             return false; // This payment plan will be removed from Cron by returning false.
         }
-        // Again, I check >0 because the plan length is optional and might just be 0.
-        else if ((GetPaymentPlanLength() >  OT_TIME_ZERO) &&
-                 (OTTimeGetCurrentTime() >= OTTimeAddTimeInterval(
-                      GetPaymentPlanStartDate(),
-                      OTTimeGetSecondsFromTime(GetPaymentPlanLength())))) {
+        // The plan length is optional and might just be 0.
+        else if (GetPaymentPlanEndDate(tEnd) && (tNow >= tEnd)) {
             otWarn << "Payment plan has expired by reaching its maximum length of time.\n";
             return false; // This payment plan will be removed from Cron by returning false.
         }
-        else if (GetNoPaymentsDone() >= nNoPaymentsThatShouldHaveHappenedByNow) // if enough payments have happened for now...
-        {
-//            otLog3 << "DEBUG: Enough payments have already been made at the current time.\n";
-        }
-        else if (OTTimeGetTimeInterval(OTTimeGetCurrentTime(), GetDateOfLastPayment()) <
-                   OTTimeGetSecondsFromTime( GetTimeBetweenPayments() )) // and the time since last
-                                                  // payment is more than the payment period...
+        else if (!GetNextPaymentDueDate(tPaymentDue) || (tNow < tPaymentDue))
         {
-            otWarn << "DEBUG: Not enough time has elapsed.\n";
-        }
-        else if ( (0 != GetDateOfLastFailedPayment()) &&
-                  (OTTimeGetTimeInterval(OTTimeGetCurrentTime(), GetDateOfLastFailedPayment()) <
-                   OTTimeGetSecondsFromTime(OT_TIME_DAY_IN_SECONDS)) ) // and it hasn't been at least 24 hrs since the last failed payment...
-        {
-            otOut << "Cron (processing payment plan): Not enough time since last failed payment. (Returning--for now.)\n";
+            otWarn << "DEBUG: The next payment is not due yet.\n";
         }
         // Okay -- PROCESS IT!
-        else // The above 3 end-comments have opposite logic from their if(), since they used to be here.
-        {    // I reversed the operators so they could be failures, resulting in this else block for success.
-
+        else
+        {
             otOut << "Cron: Processing payment...\n";
 
             // This function assumes the payment is due, and it only fails in the case of
@@ -1525,6 +1473,115 @@ bool OTPaymentPlan::ProcessCron()
     return true;
 }
 
+// The initial payment is due once its date has passed, and not within a day
+// of the last failed attempt.
+bool OTPaymentPlan::GetInitialPaymentDueDate(time64_t& tDue) const
+{
+    if (!HasInitialPayment() || IsInitialPaymentDone()) return false;
+
+    tDue = OTTimeAddTimeInterval(GetInitialPaymentDate(), 1);
+
+    if (GetLastFailedInitialPaymentDate() > OT_TIME_ZERO)
+        tDue = std::max(
+            tDue,
+            OTTimeAddTimeInterval(
+                GetLastFailedInitialPaymentDate(),
+                OTTimeGetSecondsFromTime(OT_TIME_DAY_IN_SECONDS) + 1));
+
+    return true;
+}
+
+// The plan charges on its first day and then once every time between
+// payments. So with weekly payments, three are due by the 14th day, and the
+// fourth on the 21st. A payment is also never made sooner than the time
+// between payments after the last one, nor within a day of a failed one.
+bool OTPaymentPlan::GetNextPaymentDueDate(time64_t& tDue) const
+{
+    if (!HasPaymentPlan()) return false;
+
+    const int64_t lBetween = OTTimeGetSecondsFromTime(GetTimeBetweenPayments());
+
+    if (lBetween <= 0) return false;
+
+    tDue = std::max(
+        OTTimeAddTimeInterval(GetPaymentPlanStartDate(), 1),
+        OTTimeAddTimeInterval(
+            GetPaymentPlanStartDate(), GetNoPaymentsDone() * lBetween));
+    tDue = std::max(
+        tDue, OTTimeAddTimeInterval(GetDateOfLastPayment(), lBetween));
+
+    if (GetDateOfLastFailedPayment() > OT_TIME_ZERO)
+        tDue = std::max(
+            tDue,
+            OTTimeAddTimeInterval(
+                GetDateOfLastFailedPayment(),
+                OTTimeGetSecondsFromTime(OT_TIME_DAY_IN_SECONDS)));
+
+    return true;
+}
+
+bool OTPaymentPlan::GetPaymentPlanEndDate(time64_t& tEnd) const
+{
+    if (GetPaymentPlanLength() <= OT_TIME_ZERO) return false;
+
+    tEnd = OTTimeAddTimeInterval(
+        GetPaymentPlanStartDate(),
+        OTTimeGetSecondsFromTime(GetPaymentPlanLength()));
+
+    return true;
+}
+
+// Payment plans process far more often than payments come due, so this works
+// out the date of the next thing which could actually happen: the initial
+// payment, the next payment, or the plan expiring.
+//
+// virtual
+time64_t OTPaymentPlan::GetCronDueDate() const
+{
+    const time64_t tDue = ot_super::GetCronDueDate();
+
+    // Not yet processed, not yet valid, or about to be removed.
+    if ((tDue <= OT_TIME_ZERO) || IsFlaggedForRemoval() ||
+        (GetValidFrom() >= tDue))
+        return tDue;
+
+    time64_t tNext = GetValidTo();
+
+    auto earliest = [&tNext](const time64_t& tDate) {
+        if ((tNext <= OT_TIME_ZERO) || (tDate < tNext)) tNext = tDate;
+    };
+
+    time64_t tInitial = OT_TIME_ZERO;
+
+    if (GetInitialPaymentDueDate(tInitial)) {
+        earliest(tInitial);
+    }
+    else if (!HasPaymentPlan()) {
+        return tDue; // Nothing left to do, so it gets removed.
+    }
+
+    if (HasPaymentPlan()) {
+        if ((GetMaximumNoPayments() > 0) &&
+            (GetNoPaymentsDone() >= GetMaximumNoPayments()))
+            return tDue; // Reached its max payments, so it gets removed.
+
+        // ProcessCron only looks at the plan once its start date has passed.
+        const time64_t tStarted =
+            OTTimeAddTimeInterval(GetPaymentPlanStartDate(), 1);
+        time64_t tEnd = OT_TIME_ZERO, tPayment = OT_TIME_ZERO;
+
+        if (GetPaymentPlanEndDate(tEnd)) earliest(std::max(tStarted, tEnd));
+
+        if (!GetNextPaymentDueDate(tPayment)) return tDue;
+
+        earliest(tPayment);
+    }
+
+    if (tNext <= OT_TIME_ZERO) return tDue;
+
+    return std::max(tDue, tNext);
+}
+
 void OTPaymentPlan::InitPaymentPlan()
 {
     m_strContractType = "PAYMENT PLAN";
@@ -212,11 +212,17 @@ OTScript::OTScript(const std::string& new_string)
 {
 }
 
-OTScript::~OTScript()
+OTScript::~OTScript() { Release(); }
+
+// Forgets the parties, accounts and variables of the previous execution, so
+// the same script object can run again with a different set.
+void OTScript::Release()
 {
     // mapOfParties; // NO NEED to clean this up, since OTScript doesn't own the
     // parties.
     // See OTSmartContract, rather, for that.
+    m_mapParties.clear();
+    m_mapAccounts.clear();
 
     while (!m_mapVariables.empty()) {
         OTVariable* pVar = m_mapVariables.begin()->second;
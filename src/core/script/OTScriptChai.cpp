@@ -55,11 +55,81 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <exception>
+#include <map>
 #include <string>
+#include <utility>
 
 namespace opentxs
 {
 
+class OTScriptChai::Cache
+{
+public:
+    typedef decltype(
+        std::declval<chaiscript::ChaiScript&>().get_state()) State;
+    typedef decltype(
+        std::declval<chaiscript::ChaiScript&>().get_locals()) Locals;
+
+    // The interpreter with its native calls and compiled scripts, but without
+    // the parties, accounts and variables of any execution.
+    State state_;
+    Locals locals_;
+    // script -> name of the function compiled from it. Empty if the script
+    // can't be wrapped in a function and has to be evaluated directly.
+    std::map<std::string, std::string> functions_;
+
+    Cache(chaiscript::ChaiScript& chai)
+        : state_(chai.get_state())
+        , locals_(chai.get_locals())
+        , functions_()
+    {
+    }
+};
+
+// Returns the name of the function compiled from m_str_script, compiling it
+// first if this is the first time it runs on this interpreter.
+std::string OTScriptChai::compile()
+{
+    using namespace chaiscript;
+
+    OT_ASSERT(cache_);
+
+    auto it = cache_->functions_.find(m_str_script);
+
+    if (cache_->functions_.end() != it) { return it->second; }
+
+    std::string name =
+        "ot_script_" + std::to_string(cache_->functions_.size());
+
+    try {
+        chai->eval(
+            "def " + name + "() {\n" + m_str_script + "\n}",
+            exception_specification<const std::exception&>(),
+            m_str_display_filename);
+        cache_->state_ = chai->get_state();
+    } catch (...) {
+        // The script will report its own errors when it is evaluated.
+        name.clear();
+        chai->set_state(cache_->state_);
+    }
+
+    cache_->functions_.emplace(m_str_script, name);
+
+    return name;
+}
+
+void OTScriptChai::restore()
+{
+    if (!cache_) {
+        cache_.reset(new Cache(*chai));
+
+        return;
+    }
+
+    chai->set_state(cache_->state_);
+    chai->set_locals(cache_->locals_);
+}
+
 bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
 {
     using namespace chaiscript;
@@ -67,6 +137,10 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
     OT_ASSERT(nullptr != chai);
 
     if (m_str_script.size() > 0) {
+        restore();
+        const std::string function = compile();
+        const std::string code =
+            function.empty() ? m_str_script : (function + "()");
 
         /*
         chai->add(user_type<OTParty>(), "OTParty");
@@ -175,10 +249,9 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
                     chai->add_global_const(const_var(pVar->CopyValueInteger()),
                                            var_name.c_str());
                 else
-                    chai->add(var(&nValue), // passing ptr here so the
-                                            // script can modify this
-                                            // variable if it wants.
-                              var_name.c_str());
+                    // passing ptr here so the script can modify this variable
+                    // if it wants. Globals, so the compiled function sees it.
+                    chai->add_global(var(&nValue), var_name.c_str());
             } break;
 
             case OTVariable::Var_Bool: {
@@ -189,10 +262,9 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
                     chai->add_global_const(const_var(pVar->CopyValueBool()),
                                            var_name.c_str());
                 else
-                    chai->add(var(&bValue), // passing ptr here so the
-                                            // script can modify this
-                                            // variable if it wants.
-                              var_name.c_str());
+                    // passing ptr here so the script can modify this variable
+                    // if it wants. Globals, so the compiled function sees it.
+                    chai->add_global(var(&bValue), var_name.c_str());
             } break;
 
             case OTVariable::Var_String: {
@@ -209,10 +281,9 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
                     // str_Value.c_str());
                 }
                 else {
-                    chai->add(var(&str_Value), // passing ptr here so the
-                                               // script can modify this
-                                               // variable if it wants.
-                              var_name.c_str());
+                    // passing ptr here so the script can modify this variable
+                    // if it wants. Globals, so the compiled function sees it.
+                    chai->add_global(var(&str_Value), var_name.c_str());
 
                     //                      otErr << "\n\n\nOTSCRIPT DEBUGGING
                     // var added to script: %s \n\n\n", str_Value.c_str());
@@ -236,7 +307,7 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
 
         try {
             if (nullptr == pReturnVar) // Nothing to return.
-                chai->eval(m_str_script.c_str(),
+                chai->eval(code.c_str(),
                            exception_specification<const std::exception&>(),
                            m_str_display_filename);
 
@@ -245,7 +316,7 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
                 switch (pReturnVar->GetType()) {
                 case OTVariable::Var_Integer: {
                     int32_t nResult = chai->eval<int32_t>(
-                        m_str_script.c_str(),
+                        code.c_str(),
                         exception_specification<const std::exception&>(),
                         m_str_display_filename);
                     pReturnVar->SetValue(nResult);
@@ -253,7 +324,7 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
 
                 case OTVariable::Var_Bool: {
                     bool bResult = chai->eval<bool>(
-                        m_str_script.c_str(),
+                        code.c_str(),
                         exception_specification<const std::exception&>(),
                         m_str_display_filename);
                     pReturnVar->SetValue(bResult);
@@ -261,7 +332,7 @@ bool OTScriptChai::ExecuteScript(OTVariable* pReturnVar)
 
                 case OTVariable::Var_String: {
                     std::string str_Result = chai->eval<std::string>(
-                        m_str_script.c_str(),
+                        code.c_str(),
                         exception_specification<const std::exception&>(),
                         m_str_display_filename);
                     pReturnVar->SetValue(str_Result);
@@ -571,6 +571,34 @@ void OTScriptable::ClearTemporaryPointers()
     }
 }
 
+std::shared_ptr<OTScript> OTScriptable::GetInterpreter(
+    const std::string& str_language,
+    const std::string& str_code)
+{
+    auto& pScript = m_mapInterpreters[str_language];
+
+    if (!pScript) {
+        pScript = OTScriptFactory(str_language);
+
+        if (!pScript) {
+            m_mapInterpreters.erase(str_language);
+
+            return nullptr;
+        }
+
+        // Register the special server-side native OT calls we make available
+        // to all scripts. They stay registered for the life of the
+        // interpreter.
+        //
+        RegisterOTNativeCallsWithScript(*pScript);
+    }
+
+    pScript->Release();
+    pScript->SetScript(str_code);
+
+    return pScript;
+}
+
 bool OTScriptable::ExecuteCallback(OTClause& theCallbackClause,
                                    mapOfVariables& theParameters,
                                    OTVariable& varReturnVal)
@@ -591,18 +619,13 @@ bool OTScriptable::ExecuteCallback(OTClause& theCallbackClause,
     const std::string str_language =
         pBylaw->GetLanguage(); // language it's in. (Default is "chai")
 
-    std::shared_ptr<OTScript> pScript = OTScriptFactory(str_language, str_code);
+    std::shared_ptr<OTScript> pScript = GetInterpreter(str_language, str_code);
 
     //
-    // SET UP THE NATIVE CALLS, REGISTER THE PARTIES, REGISTER THE VARIABLES,
-    // AND EXECUTE THE SCRIPT.
+    // REGISTER THE PARTIES, REGISTER THE VARIABLES, AND EXECUTE THE SCRIPT.
+    // (The native calls were registered when the interpreter was created.)
     //
     if (pScript) {
-        // Register the special server-side native OT calls we make available to
-        // all scripts.
-        //
-        RegisterOTNativeCallsWithScript(*pScript);
-
         // Register all the parties with the script.
         for (auto& it : m_mapParties) {
             const std::string str_party_name = it.first;
@@ -3536,6 +3559,9 @@ void OTScriptable::specifyAssetTypes(bool bNewState)
 
 void OTScriptable::Release_Scriptable()
 {
+    // The interpreters hold pointers to the parties and variables.
+    m_mapInterpreters.clear();
+
     // Go through the existing list of parties and bylaws at this point, and
     // delete them all.
     // (After all, I own them.)
@@ -548,6 +548,7 @@ various sequence numbers. Hm.
 #endif
 #include <irrxml/irrXML.hpp>
 #include <inttypes.h>
+#include <algorithm>
 #include <memory>
 #include <stdint.h>
 #include <string>
@@ -3007,8 +3008,9 @@ bool OTSmartContract::StashFunds(
     // and re-sign it and save it, no matter what. So I just
     // call this here to keep it simple:
 
-    pCron->SaveCron(); // TODO No need to call this here if I can make sure it's
-                       // being called higher up somewhere
+    pCron->SaveCronItem(*this); // TODO No need to call this here if I can
+                                // make sure it's being called higher up
+                                // somewhere
     // (Imagine a script that has 10 account moves in it -- maybe don't need to
     // save cron until
     // after all 10 are done. Or maybe DO need to do in between. Todo research
@@ -3522,6 +3524,36 @@ void OTSmartContract::onFinalReceipt(
     }
 }
 
+void OTSmartContract::SetNextProcessDate(const time64_t& tNEXT_DATE)
+{
+    m_tNextProcessDate = tNEXT_DATE;
+
+    // A script may set or clear the timer outside of ProcessCron (from a
+    // triggered clause, for example.)
+    if (nullptr != GetCron()) {
+        GetCron()->RescheduleCronItem(GetTransactionNum());
+    }
+}
+
+// Nothing runs until the timer pops, if the script has set one.
+//
+// virtual
+time64_t OTSmartContract::GetCronDueDate() const
+{
+    const time64_t tDue = ot_super::GetCronDueDate();
+    const time64_t& tNextProcessDate = GetNextProcessDate();
+
+    if (tNextProcessDate <= OT_TIME_ZERO) return tDue;
+
+    time64_t tTimer = OTTimeAddTimeInterval(tNextProcessDate, 1);
+
+    // Still wake up to expire it.
+    if ((GetValidTo() > OT_TIME_ZERO) && (GetValidTo() < tTimer))
+        tTimer = GetValidTo();
+
+    return std::max(tDue, tTimer);
+}
+
 // OTCron calls this regularly, which is my chance to expire, etc.
 // Return True if I should stay on the Cron list for more processing.
 // Return False if I should be removed and deleted.
@@ -3663,20 +3695,16 @@ void OTSmartContract::ExecuteClauses(mapOfClauses& theClauses,
             pBylaw->GetLanguage(); // language it's in. (Default is "chai")
 
         std::shared_ptr<OTScript> pScript =
-            OTScriptFactory(str_language, str_code);
+            GetInterpreter(str_language, str_code);
 
         std::unique_ptr<OTVariable> theVarAngel;
 
         //
-        // SET UP THE NATIVE CALLS, REGISTER THE PARTIES, REGISTER THE
-        // VARIABLES, AND EXECUTE THE SCRIPT.
+        // REGISTER THE PARTIES, REGISTER THE VARIABLES, AND EXECUTE THE
+        // SCRIPT. (The native calls were registered when the interpreter was
+        // created.)
         //
         if (pScript) {
-            // Register the special server-side native OT calls we make
-            // available to all scripts.
-            //
-            RegisterOTNativeCallsWithScript(*pScript);
-
             // Register all the parties with the script.
             //
             for (auto& it : m_mapParties) {
@@ -6458,7 +6486,7 @@ bool OTSmartContract::MoveFunds(
     // and re-sign it and save it, no matter what. So I just
     // call this here to keep it simple:
 
-    GetCron()->SaveCron();
+    GetCron()->SaveCronItem(*this);
 
     return bSuccess;
 }
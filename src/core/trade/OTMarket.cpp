@@ -51,9 +51,11 @@
 #include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/cron/OTCron.hpp"
+#include "opentxs/core/cron/OTCronJournal.hpp"
 #include "opentxs/core/cron/OTCronItem.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
 #include "opentxs/core/trade/OTOffer.hpp"
+#include "opentxs/core/trade/OTOrderBook.hpp"
 #include "opentxs/core/trade/OTTrade.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
@@ -71,6 +73,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -97,6 +100,8 @@ int32_t OTMarket::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
         m_lLastSalePrice =
             String::StringToLong(xml->getAttributeValue("lastSalePrice"));
         m_strLastSaleDate = xml->getAttributeValue("lastSaleDate");
+        m_lJournalGeneration =
+            String::StringToLong(xml->getAttributeValue("journalGeneration"));
 
         const String strNotaryID(xml->getAttributeValue("notaryID")),
             strInstrumentDefinitionID(
@@ -178,10 +183,11 @@ void OTMarket::UpdateContents()
     tag.add_attribute("marketScale", formatLong(m_lScale));
     tag.add_attribute("lastSaleDate", m_strLastSaleDate);
     tag.add_attribute("lastSalePrice", formatLong(m_lLastSalePrice));
+    tag.add_attribute("journalGeneration", formatLong(m_lJournalGeneration));
 
-    // Save the offers for sale.
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
+    // Save the offers for sale. (Each book is saved in the order it is
+    // matched, so the line at each price is the same after loading.)
+    for (auto& pOffer : m_bookAsks) {
         OT_ASSERT(nullptr != pOffer);
 
         String strOffer(
@@ -195,8 +201,7 @@ void OTMarket::UpdateContents()
     }
 
     // Save the bids.
-    for (auto& it : m_mapBids) {
-        OTOffer* pOffer = it.second;
+    for (auto& pOffer : m_bookBids) {
         OT_ASSERT(nullptr != pOffer);
 
         String strOffer(
@@ -219,8 +224,7 @@ int64_t OTMarket::GetTotalAvailableAssets()
 {
     int64_t lTotal = 0;
 
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
+    for (auto& pOffer : m_bookAsks) {
         OT_ASSERT(nullptr != pOffer);
 
         lTotal += pOffer->GetAmountAvailable();
@@ -414,17 +418,14 @@ bool OTMarket::GetOfferList(OTASCIIArmor& ascOutput, int64_t lDepth,
         dynamic_cast<OTDB::OfferListMarket*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
 
-    //    mapOfOffers            m_mapBids;        // The buyers, ordered by
-    // price limit
-    //    mapOfOffers            m_mapAsks;        // The sellers, ordered by
-    // price limit
+    // Both books are walked from the best price down, so the depth limit
+    // keeps the top of each book.
 
     int32_t nTempDepth = 0;
 
-    for (auto& it : m_mapBids) {
+    for (auto& pOffer : m_bookBids) {
         if (nTempDepth++ > lDepth) break;
 
-        OTOffer* pOffer = it.second;
         OT_ASSERT(nullptr != pOffer);
 
         const int64_t& lPriceLimit = pOffer->GetPriceLimit();
@@ -457,10 +458,9 @@ bool OTMarket::GetOfferList(OTASCIIArmor& ascOutput, int64_t lDepth,
 
     nTempDepth = 0;
 
-    for (auto& it : m_mapAsks) {
+    for (auto& pOffer : m_bookAsks) {
         if (nTempDepth++ > lDepth) break;
 
-        OTOffer* pOffer = it.second;
         OT_ASSERT(nullptr != pOffer);
 
         // OfferDataMarket
@@ -533,18 +533,6 @@ bool OTMarket::GetOfferList(OTASCIIArmor& ascOutput, int64_t lDepth,
     return false;
 }
 
-// To insure that offers of a specific price are always inserted at the upper
-// bound,
-// use this:  my_mmap.insert(my_mmap.upper_bound(key), my_mmap::value_type(key,
-// val));
-// This way I can read them from the lower bound later, and always get them in
-// the
-// order received for that price.
-//
-// typedef std::multimap<int64_t, OTOffer *>    mapOfOffers;
-// mapOfOffers    m_mapBids; // The buyers, ordered
-// mapOfOffers    m_mapAsks; // The sellers, ordered
-
 OTOffer* OTMarket::GetOffer(const int64_t& lTransactionNum)
 {
     // See if there's something there with that transaction number.
@@ -574,8 +562,19 @@ OTOffer* OTMarket::GetOffer(const int64_t& lTransactionNum)
 bool OTMarket::RemoveOffer(const int64_t& lTransactionNum) // if false, offer
                                                            // wasn't found.
 {
-    bool bReturnValue = false;
+    if (!EraseOffer(lTransactionNum)) return false;
+
+    OTCronJournal::Record theRecord;
+    theRecord.m_strType = "offer";
+    theRecord.m_lKey = lTransactionNum;
+    theRecord.m_bErase = true;
 
+    return Journal(theRecord); // <====== SAVE since an offer was removed.
+}
+
+// Removes the offer from the market without saving anything.
+bool OTMarket::EraseOffer(const int64_t& lTransactionNum)
+{
     // See if there's something there with that transaction number.
     auto it = m_mapOffers.find(lTransactionNum);
 
@@ -585,74 +584,92 @@ bool OTMarket::RemoveOffer(const int64_t& lTransactionNum) // if false, offer
                  "Transaction #: " << lTransactionNum << "\n";
         return false;
     }
-    // Otherwise, if it WAS already there, remove it properly.
-    else {
-        OTOffer* pOffer = it->second;
-
-        OT_ASSERT(nullptr != pOffer);
-
-        // This removes it from one list (the one indexed by transaction
-        // number.)
-        // But it's still on one of the other lists...
-        m_mapOffers.erase(it);
 
-        // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
+    OTOffer* pOffer = it->second;
 
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
+    OT_ASSERT(nullptr != pOffer);
 
-        for (mapOfOffers::iterator iii = pMap->begin(); iii != pMap->end();
-             ++iii) {
-            pSameOffer = iii->second;
+    // This removes it from one list (the one indexed by transaction number.)
+    // But it's still on the bid or ask book...
+    m_mapOffers.erase(it);
 
-            OT_ASSERT_MSG(nullptr != pSameOffer,
-                          "nullptr offer pointer in OTMarket::RemoveOffer.\n");
+    // The code operates the same whether ask or bid. Just use a pointer.
+    OTOrderBook* pBook = (pOffer->IsBid() ? &m_bookBids : &m_bookAsks);
 
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
+    // The book finds the offer by its handle, without searching.
+    OTOffer* pSameOffer = pBook->Erase(lTransactionNum);
 
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
-        }
+    bool bReturnValue = false;
 
-        if (nullptr == pSameOffer) {
-            otErr << "Removed Offer from offers list, but not found on bid/ask "
-                     "list.\n";
-        }
-        else // This means it was found and removed from the second list as
-               // well.
-        {
-            bReturnValue = true; // Success.
-        }
+    if (nullptr == pSameOffer) {
+        otErr << "Removed Offer from offers list, but not found on bid/ask "
+                 "list.\n";
+    }
+    else // This means it was found and removed from the book as well.
+    {
+        bReturnValue = true; // Success.
 
         // pOffer was found on the Offers list.
-        // pSameOffer was found on the Bid or Ask list, with the same
-        // transaction ID.
+        // pSameOffer was found on the book, with the same transaction ID.
         // They SHOULD be pointers to the SAME object.
         // Therefore I CANNOT delete them both.
         //
         OT_ASSERT(pOffer == pSameOffer);
-
-        delete pOffer;
-        pOffer = nullptr;
-        pSameOffer = nullptr;
     }
 
-    if (bReturnValue)
-        return SaveMarket(); // <====== SAVE since an offer was removed.
-    else
+    delete pOffer;
+    pOffer = nullptr;
+    pSameOffer = nullptr;
+
+    return bReturnValue;
+}
+
+// Puts theOffer in the place of the offer on the market with the same
+// transaction number and price, so it keeps its place in line. Returns false,
+// and changes nothing, if there isn't one.
+bool OTMarket::ReplaceOffer(OTOffer& theOffer, time64_t tDateAddedToMarket)
+{
+    auto it = m_mapOffers.find(theOffer.GetTransactionNum());
+
+    if (it == m_mapOffers.end()) return false;
+
+    OTOffer* pOldOffer = it->second;
+
+    OT_ASSERT(nullptr != pOldOffer);
+
+    if ((pOldOffer->IsBid() != theOffer.IsBid()) ||
+        !ValidateOfferForMarket(theOffer))
         return false;
+
+    OTOrderBook& theBook = (theOffer.IsBid() ? m_bookBids : m_bookAsks);
+
+    if (nullptr == theBook.Replace(theOffer)) return false;
+
+    it->second = &theOffer;
+    theOffer.SetDateAddedToMarket(tDateAddedToMarket);
+
+    delete pOldOffer;
+    pOldOffer = nullptr;
+
+    return true;
+}
+
+bool OTMarket::SaveOffer(OTOffer& theOffer)
+{
+    if (m_mapOffers.end() == m_mapOffers.find(theOffer.GetTransactionNum())) {
+        otErr << "OTMarket::" << __FUNCTION__
+              << ": Offer is not on the market. Transaction #: "
+              << theOffer.GetTransactionNum() << "\n";
+        return false;
+    }
+
+    OTCronJournal::Record theRecord;
+    theRecord.m_strType = "offer";
+    theRecord.m_lKey = theOffer.GetTransactionNum();
+    theRecord.m_tDateAdded = theOffer.GetDateAddedToMarket();
+    theRecord.m_strPayload = String(theOffer);
+
+    return Journal(theRecord);
 }
 
 // This method demands an Offer reference in order to verify that it really
@@ -665,8 +682,7 @@ bool OTMarket::RemoveOffer(const int64_t& lTransactionNum) // if false, offer
 bool OTMarket::AddOffer(OTTrade* pTrade, OTOffer& theOffer, bool bSaveFile,
                         time64_t tDateAddedToMarket)
 {
-    const int64_t lTransactionNum = theOffer.GetTransactionNum(),
-                  lPriceLimit = theOffer.GetPriceLimit();
+    const int64_t lTransactionNum = theOffer.GetTransactionNum();
 
     // Make sure the offer is even appropriate for this market...
     if (!ValidateOfferForMarket(theOffer)) {
@@ -701,26 +717,18 @@ bool OTMarket::AddOffer(OTTrade* pTrade, OTOffer& theOffer, bool bSaveFile,
         // know it validated as an offer, AND we know it wasn't already on the
         // market.
         //
-        // So next, let's add it to the lists that are indexed by price:
+        // So next, let's add it to the book for its side, where it goes to
+        // the back of the line for its price.
 
-        // Determine if it's a buy or sell, and add it to the right list.
+        // Determine if it's a buy or sell, and add it to the right book.
+        // No bother checking if the offer is already on the book, since the
+        // code above basically already verifies that for us.
         if (theOffer.IsBid()) {
-            // No bother checking if the offer is already on this list,
-            // since the code above basically already verifies that for us.
-
-            m_mapBids.insert(
-                m_mapBids.lower_bound(lPriceLimit), // highest bidders go first,
-                                                    // so I am last in line at
-                                                    // lower bound.
-                std::pair<int64_t, OTOffer*>(lPriceLimit, &theOffer));
+            m_bookBids.Insert(theOffer);
             otLog4 << "Offer added as a bid to the market.\n";
         }
         else {
-            m_mapAsks.insert(
-                m_mapAsks.upper_bound(lPriceLimit), // lowest price sells first,
-                                                    // so I am last in line at
-                                                    // upper bound.
-                std::pair<int64_t, OTOffer*>(lPriceLimit, &theOffer));
+            m_bookAsks.Insert(theOffer);
             otLog4 << "Offer added as an ask to the market.\n";
         }
 
@@ -730,8 +738,8 @@ bool OTMarket::AddOffer(OTTrade* pTrade, OTOffer& theOffer, bool bSaveFile,
             //
             theOffer.SetDateAddedToMarket(OTTimeGetCurrentTime());
 
-            return SaveMarket(); // <====== SAVE since an offer was added to the
-                                 // Market.
+            return SaveOffer(theOffer); // <====== SAVE since an offer was
+                                        // added to the Market.
         }
         else {
             // Set this to the date passed in, since this offer was
@@ -763,6 +771,9 @@ bool OTMarket::LoadMarket()
 
     if (bSuccess) bSuccess = VerifySignature(*(GetCron()->GetServerNym()));
 
+    // Then apply whatever changed since the market file was saved.
+    if (bSuccess) bSuccess = ReplayJournal();
+
     // Load the list of recent market trades (informational only.)
     //
     if (bSuccess) {
@@ -800,6 +811,9 @@ bool OTMarket::SaveMarket()
     // the old version of the market from before the most recent changes.
     ReleaseSignatures();
 
+    // The journal records written from here on belong to this new version.
+    ++m_lJournalGeneration;
+
     // Sign it, save it internally to string, and then save that out to the
     // file.
     if (!SignContract(*(GetCron()->GetServerNym())) || !SaveContract() ||
@@ -809,9 +823,24 @@ bool OTMarket::SaveMarket()
         return false;
     }
 
-    // Save a copy of recent trades.
+    // Everything in the journal is in the market file now.
+    if (!GetJournal().Reset(m_lJournalGeneration)) {
+        otErr << "Error emptying the journal for Market:\n" << szFoldername
+              << Log::PathSeparator() << szFilename << "\n";
+    }
+
+    return SaveRecentTrades();
+}
 
+// Save a copy of recent trades.
+bool OTMarket::SaveRecentTrades()
+{
     if (nullptr != m_pTradeList) {
+        Identifier MARKET_ID(*this);
+        String str_MARKET_ID(MARKET_ID);
+
+        const char* szFoldername = OTFolders::Market().Get();
+        const char* szFilename = str_MARKET_ID.Get();
 
         String str_TRADES_FILE;
         str_TRADES_FILE.Format("%s.bin", str_MARKET_ID.Get());
@@ -830,6 +859,107 @@ bool OTMarket::SaveMarket()
     return true;
 }
 
+OTCronJournal& OTMarket::GetJournal()
+{
+    if (!m_pJournal) {
+        Identifier MARKET_ID(*this);
+        String str_MARKET_ID(MARKET_ID);
+
+        m_pJournal.reset(
+            new OTCronJournal(OTFolders::Market().Get(), str_MARKET_ID.Get()));
+    }
+
+    return *m_pJournal;
+}
+
+// Appends theRecord to the journal. Once the journal is long enough, or if it
+// can't be written, the whole market file is saved instead.
+bool OTMarket::Journal(const OTCronJournal::Record& theRecord)
+{
+    OT_ASSERT(nullptr != GetCron());
+    OT_ASSERT(nullptr != GetCron()->GetServerNym());
+
+    OTCronJournal& theJournal = GetJournal();
+
+    if (theJournal.GetCount() >= OTCron::GetCronJournalCompaction()) {
+        return SaveMarket();
+    }
+
+    if (!theJournal.Append(theRecord, *(GetCron()->GetServerNym()))) {
+        return SaveMarket();
+    }
+
+    return true;
+}
+
+// Applies the journal records for the market file which was just loaded.
+bool OTMarket::ReplayJournal()
+{
+    std::vector<OTCronJournal::Record> vecRecords;
+
+    if (!GetJournal().Load(m_lJournalGeneration,
+                           *(GetCron()->GetServerNym()), vecRecords)) {
+        otErr << "OTMarket::" << __FUNCTION__
+              << ": Failed loading the journal for the market file.\n";
+        return false;
+    }
+
+    for (auto& theRecord : vecRecords) {
+        if (theRecord.m_strType.Compare("offer")) {
+            if (theRecord.m_bErase) {
+                if (m_mapOffers.end() != m_mapOffers.find(theRecord.m_lKey))
+                    EraseOffer(theRecord.m_lKey);
+
+                continue;
+            }
+
+            OTOffer* pOffer =
+                new OTOffer(m_NOTARY_ID, m_INSTRUMENT_DEFINITION_ID,
+                            m_CURRENCY_TYPE_ID, m_lScale);
+
+            OT_ASSERT(nullptr != pOffer);
+
+            if (!pOffer->LoadContractFromString(theRecord.m_strPayload)) {
+                otErr << "OTMarket::" << __FUNCTION__
+                      << ": Error loading journaled offer.\n";
+                delete pOffer;
+                pOffer = nullptr;
+                return false;
+            }
+
+            // An offer that is already on the market keeps its place in
+            // line.
+            if (ReplaceOffer(*pOffer, theRecord.m_tDateAdded)) continue;
+
+            if (m_mapOffers.end() != m_mapOffers.find(theRecord.m_lKey))
+                EraseOffer(theRecord.m_lKey);
+
+            if (!AddOffer(nullptr, *pOffer, false, theRecord.m_tDateAdded)) {
+                otErr << "OTMarket::" << __FUNCTION__
+                      << ": Error adding journaled offer to market.\n";
+                delete pOffer;
+                pOffer = nullptr;
+                return false;
+            }
+        }
+        else if (theRecord.m_strType.Compare("lastSale")) {
+            m_lLastSalePrice = theRecord.m_lValue;
+            m_strLastSaleDate = theRecord.m_strPayload.Get();
+        }
+        else {
+            otErr << "OTMarket::" << __FUNCTION__
+                  << ": Unknown journal record type: " << theRecord.m_strType
+                  << "\n";
+            return false;
+        }
+    }
+
+    otInfo << "OTMarket::" << __FUNCTION__ << ": Replayed "
+           << vecRecords.size() << " journal records.\n";
+
+    return true;
+}
+
 // A Market's ID is based on the instrument definition, the currency type, and
 // the scale.
 //
@@ -853,46 +983,26 @@ void OTMarket::GetIdentifier(Identifier& theIdentifier) const
 // bid on the market.
 int64_t OTMarket::GetHighestBidPrice()
 {
-    int64_t lPrice = 0;
-
-    mapOfOffers::reverse_iterator rr = m_mapBids.rbegin();
-
-    if (rr != m_mapBids.rend()) {
-        lPrice = rr->first;
-    }
-
-    return lPrice;
+    return m_bookBids.BestPrice();
 }
 
 // returns 0 if there are no asks. Otherwise returns the value of the lowest ask
 // on the market.
 int64_t OTMarket::GetLowestAskPrice()
 {
-    int64_t lPrice = 0;
-
-    auto it = m_mapAsks.begin();
-
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
-
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
-
-            if (it == m_mapAsks.end()) break;
-
-            lPrice = it->first;
-        }
+    // Market orders have a 0 price, so we need to skip them if they are
+    // here.
+    //
+    // Note that we don't have to do this with the highest bid price (above
+    // function) but in the case of asks, a "0 price" will undercut the other
+    // actual prices, so we need to skip the 0 price level. (There is at most
+    // one level per price, so this loop runs at most twice.)
+    //
+    for (auto& it : m_bookAsks.Levels()) {
+        if (0 != it.first) return it.first;
     }
 
-    return lPrice;
+    return 0;
 }
 
 // This utility function is used directly below (only).
@@ -1856,13 +1966,24 @@ void OTMarket::ProcessTrade(OTTrade& theTrade, OTOffer& theOffer,
                 // Account balances have changed based on these trades that we
                 // just processed.
                 // Make sure to save the Market since it contains those offers
-                // that have just updated.
-                SaveMarket();
-
-                // The Trade has changed, and it is stored as a CronItem. So I
-                // save Cron as well, for
-                // the same reason I saved the Market.
-                pCron->SaveCron();
+                // that have just updated. (Only the two offers, and the last
+                // sale, are journaled -- not the whole market.)
+                SaveOffer(theOffer);
+                SaveOffer(theOtherOffer);
+
+                OTCronJournal::Record theLastSale;
+                theLastSale.m_strType = "lastSale";
+                theLastSale.m_lValue = m_lLastSalePrice;
+                theLastSale.m_strPayload = m_strLastSaleDate.c_str();
+                Journal(theLastSale);
+
+                SaveRecentTrades();
+
+                // The Trades have changed, and they are stored as CronItems.
+                // So I save them on Cron as well, for the same reason I saved
+                // the offers.
+                pCron->SaveCronItem(theTrade);
+                pCron->SaveCronItem(*pOtherTrade);
             }
 
             //
@@ -2423,17 +2544,13 @@ bool OTMarket::ProcessTrade(OTTrade& theTrade, OTOffer& theOffer)
 
     if (theOffer.IsAsk()) // If I'm selling,
     {
-        // rbegin puts us on the upper bound of the highest bidder (any new
-        // bidders at the same price would
-        // be added at the lower bound, where they are last in line.) The upper
-        // bound, on the other hand, is
-        // first in line.  So we start there, and loop backwards until there are
-        // no other bids within my price range.
-        for (mapOfOffers::reverse_iterator rr = m_mapBids.rbegin();
-             rr != m_mapBids.rend(); ++rr) {
+        // The bid book starts with the first in line at the highest price
+        // (any new bidders at the same price are added at the back of that
+        // line.) So we start there, and loop down until there are no other
+        // bids within my price range.
+        for (OTOffer* pBid : m_bookBids) {
             // then I want to start at the highest bidder and loop DOWN until
             // hitting my price limit.
-            OTOffer* pBid = rr->second;
             OT_ASSERT(nullptr != pBid);
 
             // NOTE: Market orders only process once, and they are processed in
@@ -2519,17 +2636,14 @@ bool OTMarket::ProcessTrade(OTTrade& theTrade, OTOffer& theOffer)
     }
     // I'm buying
     else {
-        // Begin puts us on the lower bound of the lowest seller (any new
-        // sellers at the same price would
-        // be added at the upper bound for that price, where they are last in
-        // line.) The lower bound, on the other hand, is
-        // first in line.  So we start there, and loop forwards until there are
-        // no other asks within my price range.
+        // The ask book starts with the first in line at the lowest price (any
+        // new sellers at the same price are added at the back of that line.)
+        // So we start there, and loop up until there are no other asks
+        // within my price range.
         //
-        for (auto& it : m_mapAsks) {
+        for (OTOffer* pAsk : m_bookAsks) {
             // then I want to start at the lowest seller and loop UP until
             // hitting my price limit.
-            OTOffer* pAsk = it.second;
             OT_ASSERT(nullptr != pAsk);
 
             // NOTE: Market orders only process once, and they are processed in
@@ -2762,18 +2876,16 @@ void OTMarket::Release_Market()
     }
 
     // If there were any dynamically allocated objects, clean them up here.
-    while (!m_mapBids.empty()) {
-        OTOffer* pOffer = m_mapBids.begin()->second;
-        m_mapBids.erase(m_mapBids.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
-    while (!m_mapAsks.empty()) {
-        OTOffer* pOffer = m_mapAsks.begin()->second;
-        m_mapAsks.erase(m_mapAsks.begin());
+    // (Every offer is on m_mapOffers, and on one of the books.)
+    for (auto& it : m_mapOffers) {
+        OTOffer* pOffer = it.second;
         delete pOffer;
         pOffer = nullptr;
     }
+
+    m_mapOffers.clear();
+    m_bookBids.clear();
+    m_bookAsks.clear();
 }
 
 void OTMarket::Release()
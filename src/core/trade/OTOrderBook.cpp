@@ -0,0 +1,193 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/core/trade/OTOrderBook.hpp"
+
+#include "opentxs/core/trade/OTOffer.hpp"
+#include "opentxs/core/util/Assert.hpp"
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <utility>
+
+namespace opentxs
+{
+
+OTOrderBook::const_iterator::const_iterator(
+    mapOfLevels::const_iterator itLevel, mapOfLevels::const_iterator itEnd)
+    : m_itLevel(itLevel)
+    , m_itEnd(itEnd)
+    , m_itOffer()
+{
+    // Levels are erased as soon as they are empty, so there is always a
+    // first offer.
+    if (m_itLevel != m_itEnd) m_itOffer = m_itLevel->second.begin();
+}
+
+OTOrderBook::const_iterator& OTOrderBook::const_iterator::operator++()
+{
+    if (++m_itOffer == m_itLevel->second.end()) {
+        if (++m_itLevel != m_itEnd) m_itOffer = m_itLevel->second.begin();
+    }
+
+    return *this;
+}
+
+OTOrderBook::const_iterator OTOrderBook::const_iterator::operator++(int)
+{
+    const_iterator output(*this);
+    ++(*this);
+
+    return output;
+}
+
+bool OTOrderBook::const_iterator::operator==(const const_iterator& rhs) const
+{
+    if (m_itLevel != rhs.m_itLevel) return false;
+
+    // Both at the end, where the offer iterator has no meaning.
+    if (m_itLevel == m_itEnd) return true;
+
+    return m_itOffer == rhs.m_itOffer;
+}
+
+OTOrderBook::OTOrderBook(bool bDescending)
+    : m_mapLevels(PriceOrder(bDescending))
+    , m_mapHandles()
+{
+}
+
+bool OTOrderBook::Insert(OTOffer& theOffer)
+{
+    const int64_t& lTransactionNum = theOffer.GetTransactionNum();
+
+    if (m_mapHandles.end() != m_mapHandles.find(lTransactionNum)) return false;
+
+    // Creates the level if this is the first offer at this price.
+    auto itLevel = m_mapLevels.insert(
+        std::make_pair(theOffer.GetPriceLimit(), listOfOffers())).first;
+    auto itOffer =
+        itLevel->second.insert(itLevel->second.end(), &theOffer);
+
+    Handle theHandle;
+    theHandle.m_itLevel = itLevel;
+    theHandle.m_itOffer = itOffer;
+    m_mapHandles.insert(std::make_pair(lTransactionNum, theHandle));
+
+    return true;
+}
+
+OTOffer* OTOrderBook::Erase(const int64_t& lTransactionNum)
+{
+    auto it = m_mapHandles.find(lTransactionNum);
+
+    if (m_mapHandles.end() == it) return nullptr;
+
+    Handle& theHandle = it->second;
+    OTOffer* pOffer = *theHandle.m_itOffer;
+
+    theHandle.m_itLevel->second.erase(theHandle.m_itOffer);
+
+    if (theHandle.m_itLevel->second.empty())
+        m_mapLevels.erase(theHandle.m_itLevel);
+
+    m_mapHandles.erase(it);
+
+    return pOffer;
+}
+
+OTOffer* OTOrderBook::Replace(OTOffer& theOffer)
+{
+    auto it = m_mapHandles.find(theOffer.GetTransactionNum());
+
+    if (m_mapHandles.end() == it) return nullptr;
+
+    Handle& theHandle = it->second;
+
+    if (theHandle.m_itLevel->first != theOffer.GetPriceLimit()) return nullptr;
+
+    OTOffer* pOffer = *theHandle.m_itOffer;
+    *theHandle.m_itOffer = &theOffer;
+
+    return pOffer;
+}
+
+OTOffer* OTOrderBook::Find(const int64_t& lTransactionNum) const
+{
+    auto it = m_mapHandles.find(lTransactionNum);
+
+    if (m_mapHandles.end() == it) return nullptr;
+
+    return *(it->second.m_itOffer);
+}
+
+OTOffer* OTOrderBook::Best() const
+{
+    if (m_mapLevels.empty()) return nullptr;
+
+    OT_ASSERT(!m_mapLevels.begin()->second.empty());
+
+    return m_mapLevels.begin()->second.front();
+}
+
+int64_t OTOrderBook::BestPrice() const
+{
+    if (m_mapLevels.empty()) return 0;
+
+    return m_mapLevels.begin()->first;
+}
+
+OTOrderBook::const_iterator OTOrderBook::begin() const
+{
+    return const_iterator(m_mapLevels.begin(), m_mapLevels.end());
+}
+
+OTOrderBook::const_iterator OTOrderBook::end() const
+{
+    return const_iterator(m_mapLevels.end(), m_mapLevels.end());
+}
+
+void OTOrderBook::clear()
+{
+    m_mapHandles.clear();
+    m_mapLevels.clear();
+}
+
+} // namespace opentxs
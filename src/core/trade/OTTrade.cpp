@@ -530,7 +530,7 @@ OTOffer* OTTrade::GetOffer(Identifier* offerMarketId, OTMarket** market)
             offer_->SignContract(*(GetCron()->GetServerNym()));
             offer_->SaveContract();
 
-            pMarket->SaveMarket();
+            pMarket->SaveOffer(*offer_);
 
             // Now when the market loads next time, it can verify this offer
             // using the server's signature,
@@ -597,7 +597,7 @@ OTOffer* OTTrade::GetOffer(Identifier* offerMarketId, OTMarket** market)
                 offer_->SignContract(*(GetCron()->GetServerNym()));
                 offer_->SaveContract();
 
-                pMarket->SaveMarket();
+                pMarket->SaveOffer(*offer_);
 
                 // Now when the market loads next time, it can verify this offer
                 // using the server's signature,
@@ -48,6 +48,7 @@
 #include "opentxs/core/Message.hpp"
 #include "opentxs/core/Proto.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/network/WireFormat.hpp"
 
 #ifdef ANDROID
 #include "opentxs/core/util/android_string.hpp"
@@ -67,6 +68,7 @@ ServerConnection::ServerConnection(
         , lock_(new std::mutex)
         , shutdown_(shutdown)
         , keep_alive_(keepAlive)
+        , binary_enabled_(BinaryFramesEnabled())
 {
     if (!zsys_has_curve()) {
         otErr << __FUNCTION__ << ": libzmq has no libsodium support."
@@ -91,10 +93,77 @@ ServerConnection::~ServerConnection()
     zsock_destroy(&request_socket_);
 }
 
+bool ServerConnection::BinaryFrames(bool& timeout)
+{
+    timeout = false;
+
+    if (!binary_enabled_) { return false; }
+
+    OT_ASSERT(lock_);
+
+    std::lock_guard<std::mutex> lock(*lock_);
+
+    if (binary_negotiated_) { return binary_; }
+
+    // A notary which supports binary frames echoes the tag back. Older
+    // notaries fail to parse it and send an empty reply.
+    const bool sent =
+        (0 == zstr_send(request_socket_, WireFormat::TAG.c_str()));
+
+    if (!sent) {
+        ResetSocket();
+
+        return false;
+    }
+
+    ResetTimer();
+    std::string reply;
+
+    if (!Receive(reply)) {
+        status_.store(false);
+        timeout = true;
+        // The probe is still outstanding, so the REQ socket won't accept
+        // another request until it is replaced.
+        ResetSocket();
+
+        return false;
+    }
+
+    status_.store(true);
+    binary_negotiated_ = true;
+    binary_ = WireFormat::IsProbe(reply);
+
+    otInfo << __FUNCTION__ << ": Binary frames "
+           << (binary_ ? "enabled" : "not supported") << " for "
+           << remote_endpoint_ << std::endl;
+
+    return binary_;
+}
+
+bool ServerConnection::BinaryFramesEnabled()
+{
+    bool changed = false;
+    bool enabled = true;
+    OT::App().Config().CheckSet_bool(
+        "Connection",
+        "binary_frames",
+        true,
+        enabled,
+        changed);
+
+    if (changed) {
+        OT::App().Config().Save();
+    }
+
+    return enabled;
+}
+
 void ServerConnection::Init()
 {
     shutdown_.store(false);
     status_.store(false);
+    binary_negotiated_ = false;
+    binary_ = false;
     SetProxy();
     SetTimeouts();
     SetRemoteKey();
@@ -204,6 +273,8 @@ NetworkReplyRaw ServerConnection::Send(const std::string& message)
     } else {
         status_.store(false);
         output.first = SendResult::TIMEOUT_RECEIVING;
+        // The REQ socket won't accept another request until it is replaced.
+        ResetSocket();
     }
 
     return output;
@@ -211,12 +282,24 @@ NetworkReplyRaw ServerConnection::Send(const std::string& message)
 
 NetworkReplyString ServerConnection::Send(const String& message)
 {
-    OTASCIIArmor envelope(message);
+    bool timeout = false;
+
+    if (BinaryFrames(timeout)) { return SendBinary(message); }
+
     NetworkReplyString output{SendResult::ERROR_SENDING, nullptr};
     output.second.reset(new String);
 
     OT_ASSERT(output.second);
 
+    // Don't wait for a second timeout from a notary which didn't answer.
+    if (timeout) {
+        output.first = SendResult::TIMEOUT_RECEIVING;
+
+        return output;
+    }
+
+    OTASCIIArmor envelope(message);
+
     if (!envelope.Exists()) { return output; }
 
     auto rawOutput = Send(std::string(envelope.Get()));
@@ -231,6 +314,70 @@ NetworkReplyString ServerConnection::Send(const String& message)
     return output;
 }
 
+NetworkReplyString ServerConnection::SendBinary(const String& message)
+{
+    OT_ASSERT(lock_);
+
+    std::lock_guard<std::mutex> lock(*lock_);
+
+    NetworkReplyString output{SendResult::ERROR_SENDING, nullptr};
+    output.second.reset(new String);
+
+    OT_ASSERT(output.second);
+
+    std::string header, payload;
+
+    if (!WireFormat::Encode(message, header, payload)) { return output; }
+
+    zmsg_t* request = zmsg_new();
+    zmsg_addmem(request, header.data(), header.size());
+    zmsg_addmem(request, payload.data(), payload.size());
+    const bool sent = (0 == zmsg_send(&request, request_socket_));
+
+    if (!sent) {
+        zmsg_destroy(&request);
+        ResetSocket();
+
+        return output;
+    }
+
+    ResetTimer();
+    zmsg_t* reply = zmsg_recv(request_socket_);
+
+    if (nullptr == reply) {
+        status_.store(false);
+        output.first = SendResult::TIMEOUT_RECEIVING;
+        // The REQ socket won't accept another request until it is replaced.
+        ResetSocket();
+
+        return output;
+    }
+
+    status_.store(true);
+    output.first = SendResult::HAVE_REPLY;
+
+    // A notary which failed to process the request sends a single empty
+    // frame, which leaves the reply string empty just like the armored path.
+    if (2 == zmsg_size(reply)) {
+        zframe_t* replyHeader = zmsg_pop(reply);
+        zframe_t* replyPayload = zmsg_pop(reply);
+        WireFormat::Decode(
+            std::string(
+                reinterpret_cast<const char*>(zframe_data(replyHeader)),
+                zframe_size(replyHeader)),
+            std::string(
+                reinterpret_cast<const char*>(zframe_data(replyPayload)),
+                zframe_size(replyPayload)),
+            *output.second);
+        zframe_destroy(&replyHeader);
+        zframe_destroy(&replyPayload);
+    }
+
+    zmsg_destroy(&reply);
+
+    return output;
+}
+
 NetworkReplyMessage ServerConnection::Send(const Message& message)
 {
     NetworkReplyMessage output{SendResult::ERROR_SENDING, nullptr};
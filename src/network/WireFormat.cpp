@@ -0,0 +1,209 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/network/WireFormat.hpp"
+
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/String.hpp"
+
+#include <zlib.h>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+namespace opentxs
+{
+
+const std::string WireFormat::TAG = "OTWIRE1";
+const std::size_t WireFormat::MAX_MESSAGE_SIZE;
+
+bool WireFormat::Deflate(const std::string& input, std::string& output)
+{
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+
+    if (Z_OK != deflateInit(&zs, Z_BEST_SPEED)) { return false; }
+
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    zs.avail_in = static_cast<uInt>(input.size());
+    output.resize(deflateBound(&zs, static_cast<uLong>(input.size())));
+    zs.next_out = reinterpret_cast<Bytef*>(&output[0]);
+    zs.avail_out = static_cast<uInt>(output.size());
+
+    const int result = deflate(&zs, Z_FINISH);
+    output.resize(zs.total_out);
+    deflateEnd(&zs);
+
+    return (Z_STREAM_END == result);
+}
+
+bool WireFormat::Inflate(const std::string& input, std::string& output)
+{
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+
+    if (Z_OK != inflateInit(&zs)) { return false; }
+
+    zs.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    zs.avail_in = static_cast<uInt>(input.size());
+
+    int result = Z_OK;
+    char buffer[32768];
+    output.clear();
+
+    do {
+        zs.next_out = reinterpret_cast<Bytef*>(buffer);
+        zs.avail_out = sizeof(buffer);
+        result = inflate(&zs, Z_NO_FLUSH);
+
+        if ((Z_OK != result) && (Z_STREAM_END != result)) { break; }
+
+        const std::size_t size = sizeof(buffer) - zs.avail_out;
+
+        // The payload comes from the network, so a small one must not be
+        // allowed to expand into an arbitrarily large message.
+        if (MAX_MESSAGE_SIZE < (output.size() + size)) {
+            otErr << __FUNCTION__ << ": inflated payload exceeds "
+                  << MAX_MESSAGE_SIZE << " bytes." << std::endl;
+            result = Z_DATA_ERROR;
+
+            break;
+        }
+
+        output.append(buffer, size);
+    } while (Z_OK == result);
+
+    inflateEnd(&zs);
+
+    return (Z_STREAM_END == result);
+}
+
+bool WireFormat::Encode(
+    const String& message,
+    std::string& header,
+    std::string& payload)
+{
+    // The notary would refuse to decode it, so don't send it.
+    if (MAX_MESSAGE_SIZE < message.GetLength()) {
+        otErr << __FUNCTION__ << ": message exceeds " << MAX_MESSAGE_SIZE
+              << " bytes." << std::endl;
+
+        return false;
+    }
+
+    header = TAG;
+    payload.assign(message.Get(), message.GetLength());
+
+    if (COMPRESSION_THRESHOLD > payload.size()) {
+        header.push_back(ENCODING_RAW);
+
+        return true;
+    }
+
+    std::string compressed;
+
+    if (!Deflate(payload, compressed)) {
+        otErr << __FUNCTION__ << ": compression failed." << std::endl;
+
+        return false;
+    }
+
+    header.push_back(ENCODING_ZLIB);
+    payload.swap(compressed);
+
+    return true;
+}
+
+bool WireFormat::Decode(
+    const std::string& header,
+    const std::string& payload,
+    String& message)
+{
+    if (!IsHeader(header)) {
+        otErr << __FUNCTION__ << ": invalid header." << std::endl;
+
+        return false;
+    }
+
+    if (MAX_MESSAGE_SIZE < payload.size()) {
+        otErr << __FUNCTION__ << ": payload exceeds " << MAX_MESSAGE_SIZE
+              << " bytes." << std::endl;
+
+        return false;
+    }
+
+    switch (header[TAG.size()]) {
+        case ENCODING_RAW: {
+            message.Set(payload.c_str(), static_cast<uint32_t>(payload.size()));
+        } break;
+        case ENCODING_ZLIB: {
+            std::string decompressed;
+
+            if (!Inflate(payload, decompressed)) {
+                otErr << __FUNCTION__ << ": decompression failed."
+                      << std::endl;
+
+                return false;
+            }
+
+            message.Set(
+                decompressed.c_str(),
+                static_cast<uint32_t>(decompressed.size()));
+        } break;
+        default: {
+            otErr << __FUNCTION__ << ": unknown payload encoding."
+                  << std::endl;
+
+            return false;
+        }
+    }
+
+    return message.Exists();
+}
+
+bool WireFormat::IsHeader(const std::string& frame)
+{
+    return (frame.size() == (TAG.size() + 1)) &&
+           (0 == frame.compare(0, TAG.size(), TAG));
+}
+
+bool WireFormat::IsProbe(const std::string& frame)
+{
+    return (frame == TAG);
+}
+} // namespace opentxs
@@ -144,6 +144,56 @@ bool ConfigLoader::load(String& walletFilename)
         OTCron::SetCronMaxItemsPerNym(static_cast<int32_t>(lValue));
     }
 
+    {
+        const char* szComment = "; journal_compaction is the number of "
+                                "changes journaled to the cron and market\n"
+                                "; files before each is saved whole again.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        OT::App().Config().CheckSet_long("cron", "journal_compaction", 1000,
+                                lValue, bIsNewKey, szComment);
+        OTCron::SetCronJournalCompaction(static_cast<int32_t>(lValue));
+    }
+
+    // TRANSACTION NUMBERS
+
+    {
+        const char* szComment = ";; TRANSACTION NUMBERS\n";
+
+        bool bSectionExist = false;
+        OT::App().Config().CheckSetSection("transactions", szComment,
+                                  bSectionExist);
+    }
+
+    {
+        const char* szComment = "; number_block is how many transaction "
+                                "numbers are reserved each time the\n"
+                                "; notary file is saved. After a crash, "
+                                "the unused part of a block is skipped.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        OT::App().Config().CheckSet_long("transactions", "number_block", 100,
+                                lValue, bIsNewKey, szComment);
+        ServerSettings::SetTransactionNumberBlock(lValue);
+    }
+
+    {
+        const char* szComment = "; box_receipts_per_reply is the most box "
+                                "receipts sent back in one\n"
+                                "; getBoxReceipts reply. The client asks "
+                                "again for the rest.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        OT::App().Config().CheckSet_long("transactions",
+                                "box_receipts_per_reply",
+                                ServerSettings::GetBoxReceiptsPerReply(),
+                                lValue, bIsNewKey, szComment);
+        ServerSettings::SetBoxReceiptsPerReply(static_cast<int32_t>(lValue));
+    }
+
     // HEARTBEAT
 
     {
@@ -177,6 +227,41 @@ bool ConfigLoader::load(String& walletFilename)
             static_cast<int32_t>(lValue));
     }
 
+    // WORKERS
+
+    {
+        const char* szComment = ";; WORKERS\n";
+
+        bool bSectionExist = false;
+        OT::App().Config().CheckSetSection("workers", szComment, bSectionExist);
+    }
+
+    {
+        const char* szComment = "; threads is the number of threads which "
+                                "process client requests.\n"
+                                "; 0 means one thread per CPU core.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        OT::App().Config().CheckSet_long("workers", "threads", 0, lValue,
+                                bIsNewKey, szComment);
+        ServerSettings::SetWorkerThreads(static_cast<int32_t>(lValue));
+    }
+
+    {
+        const char* szComment = "; dividend_threads is the number of threads "
+                                "which send out the vouchers of a dividend "
+                                "payout.\n"
+                                "; 0 means one thread per CPU core.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        OT::App().Config().CheckSet_long("workers", "dividend_threads",
+                                ServerSettings::GetDividendThreads(), lValue,
+                                bIsNewKey, szComment);
+        ServerSettings::SetDividendThreads(static_cast<int32_t>(lValue));
+    }
+
     // PERMISSIONS
 
     {
@@ -245,6 +330,23 @@ bool ConfigLoader::load(String& walletFilename)
         OTCachedKey::It()->SetTimeoutSeconds(lValue);
     }
 
+    // Signing Session Timeout
+    {
+        const char* szComment =
+            "; signing_session_timeout is how long the server's private keys "
+            "stay decrypted in memory for signing.\n"
+            "; 0   : means the key is decrypted for every signature.\n"
+            "; 300 : means the key is decrypted once per 5 minutes.\n"
+            "; -1  : means the key is decrypted once PER RUN.\n";
+
+        bool bIsNewKey = false;
+        std::int64_t lValue = 0;
+        OT::App().Config().CheckSet_long("security", "signing_session_timeout",
+                                ServerSettings::GetSigningSessionTimeout(),
+                                lValue, bIsNewKey, szComment);
+        ServerSettings::SetSigningSessionTimeout(lValue);
+    }
+
     // Use System Keyring
     {
         bool bIsNewKey = false;
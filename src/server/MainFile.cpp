@@ -83,8 +83,11 @@ bool MainFile::SaveMainFileToString(String& strMainFile)
                       OTCachedKey::It()->IsGenerated() ? "2.0" : version_);
     tag.add_attribute("notaryID", server_->m_strNotaryID.Get());
     tag.add_attribute("serverNymID", server_->m_strServerNymID.Get());
-    tag.add_attribute("transactionNum",
-                      formatLong(server_->transactor_.transactionNumber()));
+    // Only the top of the reserved block is saved. (See
+    // Transactor::issueNextTransactionNumber.)
+    tag.add_attribute(
+        "transactionNum",
+        formatLong(server_->transactor_.reservedTransactionNumber()));
 
     if (OTCachedKey::It()->IsGenerated()) // If it exists, then serialize it.
     {
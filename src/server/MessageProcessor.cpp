@@ -44,13 +44,16 @@
 #include "opentxs/core/Message.hpp"
 #include "opentxs/core/Nym.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/network/WireFormat.hpp"
 #include "opentxs/network/ZMQ.hpp"
 #include "opentxs/server/ClientConnection.hpp"
 #include "opentxs/server/OTServer.hpp"
 #include "opentxs/server/ServerLoader.hpp"
+#include "opentxs/server/ServerSettings.hpp"
 #include "opentxs/server/UserCommandProcessor.hpp"
 
 #include <stddef.h>
+#include <cstdint>
 #include <sys/types.h>
 #include <ostream>
 #include <string>
@@ -58,20 +61,145 @@
 namespace opentxs
 {
 
+const std::string MessageProcessor::REPLY_ENDPOINT =
+    "inproc://opentxs/notary/replies";
+
+void MessageProcessor::NotaryLock::lock()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+    ++waiting_writers_;
+    cv_.wait(lock, [&]() { return (!writer_) && (0 == readers_); });
+    --waiting_writers_;
+    writer_ = true;
+}
+
+void MessageProcessor::NotaryLock::unlock()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    writer_ = false;
+    cv_.notify_all();
+}
+
+void MessageProcessor::NotaryLock::lock_shared()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+    cv_.wait(lock, [&]() { return (!writer_) && (0 == waiting_writers_); });
+    ++readers_;
+}
+
+void MessageProcessor::NotaryLock::unlock_shared()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    OT_ASSERT(0 < readers_);
+
+    if (0 == --readers_) {
+        cv_.notify_all();
+    }
+}
+
+MessageProcessor::NotaryLock::SharedGuard::SharedGuard(NotaryLock& lock)
+    : lock_(lock)
+{
+    lock_.lock_shared();
+}
+
+MessageProcessor::NotaryLock::SharedGuard::~SharedGuard()
+{
+    lock_.unlock_shared();
+}
+
+void MessageProcessor::KeyedLock::lock(const std::string& key)
+{
+    Entry* entry = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(map_lock_);
+        auto& it = map_[key];
+
+        if (!it) {
+            it.reset(new Entry);
+        }
+
+        entry = it.get();
+        ++entry->users_;
+    }
+
+    OT_ASSERT(nullptr != entry);
+
+    entry->mutex_.lock();
+}
+
+void MessageProcessor::KeyedLock::unlock(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(map_lock_);
+    auto it = map_.find(key);
+
+    OT_ASSERT(map_.end() != it);
+
+    auto& entry = it->second;
+    entry->mutex_.unlock();
+
+    if (0 == --entry->users_) {
+        map_.erase(it);
+    }
+}
+
+MessageProcessor::KeyedLock::Guard::Guard(
+    KeyedLock& lock,
+    const std::string& key)
+    : lock_(lock)
+    , key_(key)
+{
+    lock_.lock(key_);
+}
+
+MessageProcessor::KeyedLock::Guard::~Guard() { lock_.unlock(key_); }
+
+void MessageProcessor::lockKeys(
+    KeyedLock& lock,
+    const std::set<std::string>& keys,
+    KeyedGuards& guards)
+{
+    // std::set is sorted, so every thread takes these locks in the same order
+    for (const auto& key : keys) {
+        if (key.empty()) { continue; }
+
+        guards.emplace_back(new KeyedLock::Guard(lock, key));
+    }
+}
+
 MessageProcessor::MessageProcessor(ServerLoader& loader)
     : server_(loader.getServer())
-    , zmqSocket_(zsock_new_rep(NULL))
+    , zmqSocket_(zsock_new_router(NULL))
+    , zmqReplySocket_(zsock_new_pull(("@" + REPLY_ENDPOINT).c_str()))
     , zmqAuth_(zactor_new(zauth, NULL))
-    , zmqPoller_(zpoller_new(zmqSocket_, NULL))
+    , zmqPoller_(zpoller_new(zmqSocket_, zmqReplySocket_, NULL))
+    , shutdown_(false)
 {
     init(loader.getPort(), loader.getTransportKey());
 }
 
 MessageProcessor::~MessageProcessor()
 {
+    shutdown_.store(true);
+    queue_cv_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker->join();
+    }
+
+    workers_.clear();
+
+    for (auto& job : queue_) {
+        zmsg_destroy(&job.envelope_);
+    }
+
+    queue_.clear();
+    zpoller_remove(zmqPoller_, zmqReplySocket_);
     zpoller_remove(zmqPoller_, zmqSocket_);
     zpoller_destroy(&zmqPoller_);
     zactor_destroy(&zmqAuth_);
+    zsock_destroy(&zmqReplySocket_);
     zsock_destroy(&zmqSocket_);
 }
 
@@ -91,6 +219,26 @@ void MessageProcessor::init(int port, zcert_t* transportKey)
     zcert_apply(transportKey, zmqSocket_);
     zcert_destroy(&transportKey);
     zsock_bind(zmqSocket_, "tcp://*:%d", port);
+
+    const std::int32_t configured = ServerSettings::GetWorkerThreads();
+    std::size_t threads =
+        (0 < configured) ? static_cast<std::size_t>(configured) : 0;
+
+    if (0 == threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    if (0 == threads) {
+        threads = 1;
+    }
+
+    Log::vOutput(0, "MessageProcessor: starting %zu worker threads.\n",
+                 threads);
+
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back(
+            new std::thread(&MessageProcessor::worker, this));
+    }
 }
 
 void MessageProcessor::run()
@@ -99,16 +247,23 @@ void MessageProcessor::run()
         // timeout is the time left until the next cron should execute.
         int64_t timeout = server_->computeTimeout();
         if (timeout <= 0) {
+            std::lock_guard<NotaryLock> lock(notary_lock_);
             server_->ProcessCron();
             continue;
         }
 
         // wait for incoming message or up to timeout,
         // i.e. stop polling in time for the next cron execution.
-        if (zpoller_wait(zmqPoller_, timeout)) {
+        void* socket = zpoller_wait(zmqPoller_, timeout);
+
+        if (zmqSocket_ == socket) {
             processSocket();
             continue;
         }
+        if (zmqReplySocket_ == socket) {
+            processReply();
+            continue;
+        }
         if (zpoller_terminated(zmqPoller_)) {
             otErr << __FUNCTION__
                   << ": zpoller_terminated - process interrupted or"
@@ -126,33 +281,137 @@ void MessageProcessor::run()
 
 void MessageProcessor::processSocket()
 {
-    char* msg = zstr_recv(zmqSocket_);
+    zmsg_t* msg = zmsg_recv(zmqSocket_);
     if (msg == nullptr) {
         Log::Error("zeromq recv() failed\n");
         return;
     }
-    std::string requestString(msg);
-    zstr_free(&msg);
 
-    std::string responseString;
+    // Everything up to and including the empty delimiter frame is the
+    // routing envelope, which must be sent back in front of the reply.
+    zmsg_t* envelope = zmsg_new();
+    zframe_t* frame = nullptr;
+
+    while (nullptr != (frame = zmsg_pop(msg))) {
+        const bool delimiter = (0 == zframe_size(frame));
+        zmsg_append(envelope, &frame);
+
+        if (delimiter) {
+            break;
+        }
+    }
+
+    Job job;
+    job.envelope_ = envelope;
 
-    bool error = processMessage(requestString, responseString);
+    // Armored requests consist of a single frame. Binary requests have a
+    // header frame followed by the payload frame.
+    frame = zmsg_pop(msg);
 
-    if (error) {
-        responseString = "";
+    if (nullptr != frame) {
+        job.request_.assign(
+            reinterpret_cast<const char*>(zframe_data(frame)),
+            zframe_size(frame));
+        zframe_destroy(&frame);
     }
 
-    int rc = zstr_send(zmqSocket_, responseString.c_str());
+    frame = zmsg_pop(msg);
 
-    if (rc != 0) {
-        Log::vError("MessageProcessor: failed to send response\n"
-                    "request:\n%s\n\n"
-                    "response:\n%s\n\n",
-                    requestString.c_str(), responseString.c_str());
+    if ((nullptr != frame) && WireFormat::IsHeader(job.request_)) {
+        job.binary_ = true;
+        job.header_.swap(job.request_);
+        job.request_.assign(
+            reinterpret_cast<const char*>(zframe_data(frame)),
+            zframe_size(frame));
     }
+
+    zframe_destroy(&frame);
+    zmsg_destroy(&msg);
+
+    {
+        std::lock_guard<std::mutex> lock(queue_lock_);
+        queue_.push_back(job);
+    }
+
+    queue_cv_.notify_one();
 }
 
-bool MessageProcessor::processMessage(const std::string& messageString,
+void MessageProcessor::processReply()
+{
+    zmsg_t* msg = zmsg_recv(zmqReplySocket_);
+
+    if (nullptr == msg) {
+        Log::Error("MessageProcessor: failed to receive worker reply\n");
+        return;
+    }
+
+    if (0 != zmsg_send(&msg, zmqSocket_)) {
+        Log::Error("MessageProcessor: failed to send response\n");
+        zmsg_destroy(&msg);
+    }
+}
+
+void MessageProcessor::worker()
+{
+    zsock_t* replySocket = zsock_new_push((">" + REPLY_ENDPOINT).c_str());
+
+    OT_ASSERT(nullptr != replySocket);
+
+    for (;;) {
+        Job job;
+
+        {
+            std::unique_lock<std::mutex> lock(queue_lock_);
+            queue_cv_.wait(
+                lock, [&]() { return shutdown_.load() || !queue_.empty(); });
+
+            if (shutdown_.load()) {
+                break;
+            }
+
+            job = queue_.front();
+            queue_.pop_front();
+        }
+
+        std::string header;
+        std::string responseString;
+        bool error = false;
+
+        if (job.binary_) {
+            error = processBinary(job.header_, job.request_, header,
+                                  responseString);
+        } else if (WireFormat::IsProbe(job.request_)) {
+            // The client is asking whether binary frames are supported.
+            responseString = WireFormat::TAG;
+        } else {
+            error = processArmored(job.request_, responseString);
+        }
+
+        if (error) {
+            header = "";
+            responseString = "";
+        }
+
+        if (!header.empty()) {
+            zmsg_addmem(job.envelope_, header.data(), header.size());
+        }
+
+        zmsg_addmem(job.envelope_, responseString.data(),
+                    responseString.size());
+
+        if (0 != zmsg_send(&job.envelope_, replySocket)) {
+            Log::vError("MessageProcessor: failed to send response\n"
+                        "request:\n%s\n\n"
+                        "response:\n%s\n\n",
+                        job.request_.c_str(), responseString.c_str());
+            zmsg_destroy(&job.envelope_);
+        }
+    }
+
+    zsock_destroy(&replySocket);
+}
+
+bool MessageProcessor::processArmored(const std::string& messageString,
                                       std::string& reply)
 {
     if (messageString.size() < 1) return false;
@@ -163,6 +422,50 @@ bool MessageProcessor::processMessage(const std::string& messageString,
 
     String messageContents;
     ascMessage.GetString(messageContents);
+    String replyString;
+
+    if (processMessage(messageContents, replyString)) {
+        return true;
+    }
+
+    OTASCIIArmor ascReply(replyString);
+
+    if (!ascReply.Exists()) {
+        Log::vOutput(0, "Unable to WriteArmoredString from "
+                        "OTASCIIArmor object into OTString object. (No reply "
+                        "message will be sent.)\n");
+        return true;
+    }
+
+    reply.assign(ascReply.Get(), ascReply.GetLength());
+
+    return false;
+}
+
+bool MessageProcessor::processBinary(const std::string& header,
+                                     const std::string& payload,
+                                     std::string& replyHeader,
+                                     std::string& replyPayload)
+{
+    String messageContents;
+
+    if (!WireFormat::Decode(header, payload, messageContents)) {
+        Log::Error("MessageProcessor: failed to decode binary request\n");
+        return true;
+    }
+
+    String replyString;
+
+    if (processMessage(messageContents, replyString)) {
+        return true;
+    }
+
+    return !WireFormat::Encode(replyString, replyHeader, replyPayload);
+}
+
+bool MessageProcessor::processMessage(const String& messageContents,
+                                      String& reply)
+{
     // All decrypted--now let's load the results into an OTMessage.
     // No need to call message.ParseRawFile() after, since
     // LoadContractFromString handles it.
@@ -186,74 +489,98 @@ bool MessageProcessor::processMessage(const std::string& messageString,
 
     ClientConnection client;
 
-    bool processedUserCmd = server_->userCommandProcessor_.ProcessUserCommand(
-        message, replyMessage, &client);
-
-    // By optionally passing in &client, the client Nym's public
-    // key will be set on it whenever verification is complete. (So
-    // for the reply, I'll  have the key and thus I'll be able to
-    // encrypt reply to the recipient.)
-    if (!processedUserCmd) {
-        String s1(message);
-
-        Log::vOutput(0, "Unable to process user command: %s\n ********** "
-                        "REQUEST:\n\n%s\n\n",
-                     message.m_strCommand.Get(), s1.Get());
-
-        // NOTE: normally you would even HAVE a true or false if
-        // we're in this block. ProcessUserCommand()
-        // is what tries to process a command and then sets false
-        // if/when it fails. Until that point, you
-        // wouldn't get any server reply.  I'm now changing this
-        // slightly, so you still get a reply (defaulted
-        // to success==false.) That way if a client needs to re-sync
-        // his request number, he will get the false
-        // and therefore know to resync the # as his next move, vs
-        // being stuck with no server reply (and thus
-        // stuck with a bad socket.)
-        // We sign the reply here, but not in the else block, since
-        // it's already signed in cases where
-        // ProcessUserCommand() is a success, by the time that call
-        // returns.
-
-        // Since the process call definitely failed, I'm
-        replyMessage.m_bSuccess = false;
-        // making sure this here is definitely set to
-        // false (even though it probably was already.)
-        replyMessage.SignContract(server_->GetServerNym());
-        replyMessage.SaveContract();
-
-        String s2(replyMessage);
-
-        Log::vOutput(0, " ********** RESPONSE:\n\n%s\n\n", s2.Get());
+    auto process = [&]() -> void {
+        const bool processedUserCmd =
+            server_->userCommandProcessor_.ProcessUserCommand(
+                message, replyMessage, &client);
+
+        // By optionally passing in &client, the client Nym's public
+        // key will be set on it whenever verification is complete. (So
+        // for the reply, I'll  have the key and thus I'll be able to
+        // encrypt reply to the recipient.)
+        if (!processedUserCmd) {
+            String s1(message);
+
+            Log::vOutput(0, "Unable to process user command: %s\n "
+                            "********** REQUEST:\n\n%s\n\n",
+                         message.m_strCommand.Get(), s1.Get());
+
+            // NOTE: normally you would even HAVE a true or false if
+            // we're in this block. ProcessUserCommand()
+            // is what tries to process a command and then sets false
+            // if/when it fails. Until that point, you
+            // wouldn't get any server reply.  I'm now changing this
+            // slightly, so you still get a reply (defaulted
+            // to success==false.) That way if a client needs to re-sync
+            // his request number, he will get the false
+            // and therefore know to resync the # as his next move, vs
+            // being stuck with no server reply (and thus
+            // stuck with a bad socket.)
+            // We sign the reply here, but not in the else block, since
+            // it's already signed in cases where
+            // ProcessUserCommand() is a success, by the time that call
+            // returns.
+
+            // Since the process call definitely failed, I'm
+            replyMessage.m_bSuccess = false;
+            // making sure this here is definitely set to
+            // false (even though it probably was already.)
+            replyMessage.SignContract(server_->GetServerNym());
+            replyMessage.SaveContract();
+
+            String s2(replyMessage);
+
+            Log::vOutput(0, " ********** RESPONSE:\n\n%s\n\n", s2.Get());
+        }
+        else {
+            // At this point the reply is ready to go, and client
+            // has the public key of the recipient...
+            Log::vOutput(1, "Successfully processed user command: %s.\n",
+                         message.m_strCommand.Get());
+        }
+    };
+
+    auto& processor = server_->userCommandProcessor_;
+    std::set<std::string> nyms, accounts;
+    bool processed = false;
+
+    if (processor.LockKeys(message, nyms, accounts)) {
+        // Nym locks are always taken before account locks, each set in
+        // sorted order, and the notary lock last.
+        KeyedGuards nymLocks, accountLocks;
+        lockKeys(nym_lock_, nyms, nymLocks);
+        lockKeys(account_lock_, accounts, accountLocks);
+        const auto known = accounts.size();
+
+        if (processor.InboxLockKeys(message, accounts)) {
+            if (known != accounts.size()) {
+                // Start the account locks over so they stay in order. The
+                // receipts which named the new accounts can only be removed
+                // by this Nym, whose lock is still held.
+                accountLocks.clear();
+                lockKeys(account_lock_, accounts, accountLocks);
+            }
+
+            NotaryLock::SharedGuard notaryLock(notary_lock_);
+            process();
+            processed = true;
+        }
     }
-    else {
-        // At this point the reply is ready to go, and client
-        // has the public key of the recipient...
-        Log::vOutput(1, "Successfully processed user command: %s.\n",
-                     message.m_strCommand.Get());
+
+    if (!processed) {
+        std::lock_guard<NotaryLock> notaryLock(notary_lock_);
+        process();
     }
 
-    String replyString(replyMessage);
+    reply.Set(String(replyMessage));
 
-    if (!replyString.Exists()) {
+    if (!reply.Exists()) {
         Log::vOutput(0, "Failed trying to grab the reply "
                         "in OTString form. "
                         "(No reply message will be sent.)\n");
         return true;
     }
 
-    OTASCIIArmor ascReply(replyString);
-
-    if (!ascReply.Exists()) {
-        Log::vOutput(0, "Unable to WriteArmoredString from "
-                        "OTASCIIArmor object into OTString object. (No reply "
-                        "message will be sent.)\n");
-        return true;
-    }
-
-    reply.assign(ascReply.Get(), ascReply.GetLength());
-
     return false;
 }
 
@@ -81,6 +81,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 
 namespace opentxs
@@ -2004,11 +2005,21 @@ void Notary::NotarizePayDividend(
                                 // lAmountPerShare * number of shares in
                                 // account.)
                                 //
+                                const std::int32_t configured =
+                                    ServerSettings::GetDividendThreads();
+                                std::size_t threads =
+                                    (0 < configured)
+                                        ? static_cast<std::size_t>(configured)
+                                        : std::thread::hardware_concurrency();
+
+                                if (0 == threads) { threads = 1; }
+
                                 const bool bForEachAcct =
                                     pSharesContract->VisitAccountRecords(
-                                        actionPayDividend);  // <================
-                                                             // pay all the
-                                                             // dividends here.
+                                        actionPayDividend,
+                                        threads);  // <================
+                                                   // pay all the
+                                                   // dividends here.
 
                                 // TODO: Since the above line of code loops
                                 // through all the accounts and loads them
@@ -43,11 +43,13 @@
 #include "opentxs/api/Settings.hpp"
 #include "opentxs/api/Wallet.hpp"
 #include "opentxs/core/cron/OTCron.hpp"
+#include "opentxs/core/crypto/AsymmetricKeyEC.hpp"
 #include "opentxs/core/crypto/Bip39.hpp"
 #include "opentxs/core/crypto/CryptoEncodingEngine.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
 #include "opentxs/core/crypto/OTCachedKey.hpp"
 #include "opentxs/core/crypto/OTEnvelope.hpp"
+#include "opentxs/core/crypto/SigningSession.hpp"
 #ifdef ANDROID
 #include "opentxs/core/util/android_string.hpp"
 #endif // ANDROID
@@ -64,12 +66,15 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/ext/OTPayment.hpp"
 #include "opentxs/server/ConfigLoader.hpp"
+#include "opentxs/server/ServerSettings.hpp"
 #include "opentxs/server/Transactor.hpp"
 
 #include <inttypes.h>
 #include <stdint.h>
 #include <sys/types.h>
+#include <chrono>
 #include <fstream>
+#include <memory>
 #include <string>
 
 #define SERVER_PID_FILENAME "ot.pid"
@@ -125,7 +130,7 @@ void OTServer::ProcessCron()
     }
 
     if (bAddedNumbers) {
-        m_Cron.SaveCron();
+        m_Cron.SaveTransactionNumbers();
     }
 
     m_Cron.ProcessCronItems();  // This needs to be called regularly for trades,
@@ -449,6 +454,32 @@ void OTServer::CreateMainFile(
     OT::App().Config().Save();
 }
 
+void OTServer::OpenSigningSession()
+{
+    const std::int64_t timeout = ServerSettings::GetSigningSessionTimeout();
+
+    if (0 == timeout) { return; }
+
+    // One session per key: the sign key and the auth key are encrypted
+    // separately, so sharing a session would hand out the wrong secret.
+    for (const auto* key : {&m_nymServer.GetPrivateSignKey(),
+                            &m_nymServer.GetPrivateAuthKey()}) {
+        const auto* ecKey = dynamic_cast<const AsymmetricKeyEC*>(key);
+
+        if (nullptr == ecKey) { continue; }
+
+        ecKey->SetSigningSession(std::make_shared<SigningSession>(
+            std::chrono::seconds(timeout)));
+    }
+
+    Log::vOutput(
+        0,
+        "%s: Server private keys will be kept decrypted for %" PRId64
+        " seconds.\n",
+        __FUNCTION__,
+        timeout);
+}
+
 void OTServer::Init(std::map<std::string, std::string>& args, bool readOnly)
 {
     m_bReadOnly = readOnly;
@@ -567,6 +598,8 @@ void OTServer::Init(std::map<std::string, std::string>& args, bool readOnly)
         }
     }
 
+    OpenSigningSession();
+
     auto password = OT::App().Crypto().Encode().Nonce(16);
     String notUsed;
     bool ignored;
@@ -75,6 +75,10 @@ PayDividendVisitor::PayDividendVisitor(
     , m_lPayoutPerShare(lPayoutPerShare)
     , m_lAmountPaidOut(0)
     , m_lAmountReturned(0)
+    , number_lock_()
+    , nym_lock_()
+    , nym_locks_()
+    , log_lock_()
 {
 }
 
@@ -95,6 +99,16 @@ PayDividendVisitor::~PayDividendVisitor()
     m_lAmountReturned = 0;
 }
 
+std::mutex& PayDividendVisitor::nym_lock(const Identifier& nymID)
+{
+    std::lock_guard<std::mutex> lock(nym_lock_);
+    auto& output = nym_locks_[String(nymID).Get()];
+
+    if (!output) { output.reset(new std::mutex); }
+
+    return *output;
+}
+
 // For each "user" account of a specific instrument definition, this function
 // is called in order to pay a dividend to the Nym who owns that account.
 
@@ -111,6 +125,7 @@ bool PayDividendVisitor::Trigger(Account& theSharesAccount) // theSharesAccount
         (theSharesAccount.GetBalance() * GetPayoutPerShare());
 
     if (lPayoutAmount <= 0) {
+        std::lock_guard<std::mutex> logLock(log_lock_);
         Log::Output(0, "PayDividendVisitor::Trigger: nothing to pay, "
                        "since this account owns no shares. (Returning "
                        "true.)");
@@ -158,15 +173,19 @@ bool PayDividendVisitor::Trigger(Account& theSharesAccount) // theSharesAccount
                                                          // 180 days (6 months).
                                                          // Todo hardcoding.
     TransactionNumber lNewTransactionNumber = 0;
-    auto context = OT::App().Contract().mutable_ClientContext(
-        theServerNym.ID(), theServerNym.ID());
-    bool bGotNextTransNum =
-        theServer.transactor_.issueNextTransactionNumberToNym(
-            context.It(), lNewTransactionNumber); // We save the transaction
-    // number on the server Nym (normally we'd discard it) because
-    // when the cheque is deposited, the server nym, as the owner of
-    // the voucher account, needs to verify the transaction # on the
-    // cheque (to prevent double-spending of cheques.)
+    bool bGotNextTransNum = false;
+    {
+        std::lock_guard<std::mutex> numberLock(number_lock_);
+        auto context = OT::App().Contract().mutable_ClientContext(
+            theServerNym.ID(), theServerNym.ID());
+        bGotNextTransNum =
+            theServer.transactor_.issueNextTransactionNumberToNym(
+                context.It(), lNewTransactionNumber); // We save the transaction
+        // number on the server Nym (normally we'd discard it) because
+        // when the cheque is deposited, the server nym, as the owner of
+        // the voucher account, needs to verify the transaction # on the
+        // cheque (to prevent double-spending of cheques.)
+    }
     if (bGotNextTransNum) {
         const bool bIssueVoucher = theVoucher.IssueCheque(
             lPayoutAmount,         // The amount of the cheque.
@@ -210,6 +229,7 @@ bool PayDividendVisitor::Trigger(Account& theSharesAccount) // theSharesAccount
             OTPayment thePayment(strVoucher);
 
             // calls DropMessageToNymbox
+            std::lock_guard<std::mutex> nymLock(nym_lock(RECIPIENT_ID));
             bSent = theServer.SendInstrumentToNym(
                 theNotaryID, theServerNymID,          // sender nym
                 RECIPIENT_ID,                         // recipient nym
@@ -226,6 +246,7 @@ bool PayDividendVisitor::Trigger(Account& theSharesAccount) // theSharesAccount
             const String strPayoutInstrumentDefinitionID(
                 thePayoutInstrumentDefinitionID),
                 strRecipientNymID(RECIPIENT_ID);
+            std::lock_guard<std::mutex> logLock(log_lock_);
             Log::vError("PayDividendVisitor::Trigger: ERROR failed "
                         "issuing voucher (to send to dividend payout "
                         "recipient.) "
@@ -272,6 +293,7 @@ bool PayDividendVisitor::Trigger(Account& theSharesAccount) // theSharesAccount
                 OTPayment theReturnPayment(strReturnVoucher);
 
                 // calls DropMessageToNymbox
+                std::lock_guard<std::mutex> nymLock(nym_lock(theSenderNymID));
                 bSent = theServer.SendInstrumentToNym(
                     theNotaryID, theServerNymID, // sender nym
                     theSenderNymID, // recipient nym (original sender.)
@@ -288,6 +310,7 @@ bool PayDividendVisitor::Trigger(Account& theSharesAccount) // theSharesAccount
                 const String strPayoutInstrumentDefinitionID(
                     thePayoutInstrumentDefinitionID),
                     strSenderNymID(theSenderNymID);
+                std::lock_guard<std::mutex> logLock(log_lock_);
                 Log::vError("PayDividendVisitor::Trigger: ERROR "
                             "failed issuing voucher (to return back to "
                             "the dividend payout initiator, after a failed "
@@ -306,6 +329,7 @@ bool PayDividendVisitor::Trigger(Account& theSharesAccount) // theSharesAccount
         const String strPayoutInstrumentDefinitionID(
             thePayoutInstrumentDefinitionID),
             strRecipientNymID(RECIPIENT_ID);
+        std::lock_guard<std::mutex> logLock(log_lock_);
         Log::vError(
             "PayDividendVisitor::Trigger: ERROR!! Failed issuing next "
             "transaction "
@@ -48,10 +48,21 @@ namespace opentxs
 // (static)
 
 int64_t ServerSettings::__min_market_scale = 1;
+// The number of transaction numbers reserved each time the main file is saved.
+int64_t ServerSettings::__transaction_number_block = 100;
 // The number of client requests that will be processed per heartbeat.
 int32_t ServerSettings::__heartbeat_no_requests = 10;
 // number of ms between each heartbeat.
 int32_t ServerSettings::__heartbeat_ms_between_beats = 100;
+// number of threads processing client requests (0 means one per core.)
+int32_t ServerSettings::__worker_threads = 0;
+// number of threads paying out a dividend (0 means one per core.)
+int32_t ServerSettings::__dividend_threads = 1;
+// most box receipts returned by one getBoxReceipts reply.
+int32_t ServerSettings::__box_receipts_per_reply = 100;
+// seconds the server's decrypted private keys are kept for signing (0 means
+// they are decrypted for every signature, -1 means for the whole run.)
+int64_t ServerSettings::__signing_session_timeout = 300;
 // The Nym who's allowed to do certain
 // commands even if they are turned off.
 std::string ServerSettings::__override_nym_id;
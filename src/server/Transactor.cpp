@@ -52,11 +52,14 @@
 #include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/server/MainFile.hpp"
 #include "opentxs/server/OTServer.hpp"
+#include "opentxs/server/ServerSettings.hpp"
 
 #include <inttypes.h>
 #include <stdint.h>
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -65,6 +68,7 @@ namespace opentxs
 
 Transactor::Transactor(OTServer* server)
     : transactionNumber_(0)
+    , reservedTransactionNumber_(0)
     , server_(server)
 {
 }
@@ -91,17 +95,32 @@ Transactor::~Transactor()
 /// can be used in transaction requests.
 bool Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber)
+{
+    std::lock_guard<std::mutex> lock(number_lock_);
+
+    return issue_next_number(lTransactionNumber);
+}
+
+bool Transactor::issue_next_number(TransactionNumber& lTransactionNumber)
 {
     // transactionNumber_ stores the last VALID AND ISSUED transaction number.
     // So first, we increment that, since we don't want to issue the same number
     // twice.
     transactionNumber_++;
 
-    // Next, we save it to file.
-    if (!server_->mainFile_.SaveMainFile()) {
-        Log::Error("Error saving main server file.\n");
-        transactionNumber_--;
-        return false;
+    // The main file only records the top of the currently reserved block, so
+    // it only needs to be saved when that block is used up.
+    if (transactionNumber_ > reservedTransactionNumber_) {
+        const int64_t blockSize =
+            std::max<int64_t>(1, ServerSettings::GetTransactionNumberBlock());
+        reservedTransactionNumber_ = transactionNumber_ + blockSize - 1;
+
+        if (!server_->mainFile_.SaveMainFile()) {
+            Log::Error("Error saving main server file.\n");
+            transactionNumber_--;
+            reservedTransactionNumber_ = transactionNumber_;
+            return false;
+        }
     }
 
     // SUCCESS?
@@ -115,7 +134,9 @@ bool Transactor::issueNextTransactionNumberToNym(
     ClientContext& context,
     TransactionNumber& lTransactionNumber)
 {
-    if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
+    std::lock_guard<std::mutex> lock(number_lock_);
+
+    if (!issue_next_number(lTransactionNumber)) { return false; }
 
     // Each Nym stores the transaction numbers that have been issued to it.
     // (On client AND server side.)
@@ -126,10 +147,9 @@ bool Transactor::issueNextTransactionNumberToNym(
     // which numbers are valid for each Nym.
     if (!context.IssueNumber(transactionNumber_)) {
         Log::Error("Error adding transaction number to Nym file.\n");
+        // We're not issuing this number after all. It is still inside the
+        // reserved block, so there is no need to save the main file again.
         transactionNumber_--;
-        // Save it back how it was, since we're not issuing this number after
-        // all.
-        server_->mainFile_.SaveMainFile();
 
         return false;
     }
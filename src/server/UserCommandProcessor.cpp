@@ -43,6 +43,7 @@
 #include "opentxs/api/Wallet.hpp"
 #include "opentxs/cash/Mint.hpp"
 #include "opentxs/consensus/ClientContext.hpp"
+#include "opentxs/core/Cheque.hpp"
 #include "opentxs/core/contract/basket/BasketContract.hpp"
 #include "opentxs/core/cron/OTCron.hpp"
 #include "opentxs/core/cron/OTCronItem.hpp"
@@ -53,6 +54,7 @@
 #include "opentxs/core/script/OTSmartContract.hpp"
 #include "opentxs/core/trade/OTMarket.hpp"
 #include "opentxs/core/util/Assert.hpp"
+#include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/core/Account.hpp"
 #include "opentxs/core/Identifier.hpp"
@@ -77,6 +79,7 @@
 
 #include <inttypes.h>
 #include <stdint.h>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -89,6 +92,241 @@ UserCommandProcessor::UserCommandProcessor(OTServer* server)
 {
 }
 
+// The locks each command needs while it runs. Every command may update the
+// sending Nym, its context and its Nymbox. Commands which are missing from
+// this table lock the whole notary.
+const std::map<std::string, UserCommandProcessor::LockScope>
+    UserCommandProcessor::lock_scope_{
+        {"pingNotary", LockScope::NYM},
+        {"registerNym", LockScope::NYM},
+        {"getRequestNumber", LockScope::NYM},
+        {"getTransactionNumbers", LockScope::NYM},
+        {"checkNym", LockScope::NYM},
+        {"sendNymMessage", LockScope::NYMS},
+        {"sendNymInstrument", LockScope::NYMS},
+        {"unregisterNym", LockScope::NYM},
+        {"unregisterAccount", LockScope::NOTARY},
+        {"registerAccount", LockScope::NOTARY},
+        {"registerInstrumentDefinition", LockScope::NOTARY},
+        {"issueBasket", LockScope::NOTARY},
+        {"notarizeTransaction", LockScope::LEDGER},
+        {"getNymbox", LockScope::NYM},
+        {"getBoxReceipt", LockScope::ACCOUNT},
+        {"getBoxReceipts", LockScope::ACCOUNT},
+        {"getAccountData", LockScope::ACCOUNT},
+        {"processNymbox", LockScope::NYM},
+        {"processInbox", LockScope::LEDGER},
+        {"queryInstrumentDefinitions", LockScope::NYM},
+        {"getInstrumentDefinition", LockScope::NYM},
+        {"getMint", LockScope::NYM},
+        {"getMarketList", LockScope::NYM},
+        {"getMarketOffers", LockScope::NYM},
+        {"getMarketRecentTrades", LockScope::NYM},
+        {"getNymMarketOffers", LockScope::NYM},
+        {"triggerClause", LockScope::NOTARY},
+        {"usageCredits", LockScope::NYMS},
+        {"registerContract", LockScope::NOTARY},
+        {"requestAdmin", LockScope::NOTARY},
+        {"addClaim", LockScope::NOTARY},
+    };
+
+bool UserCommandProcessor::LockKeys(
+    const Message& msgIn,
+    std::set<std::string>& nyms,
+    std::set<std::string>& accounts) const
+{
+    const auto it = lock_scope_.find(msgIn.m_strCommand.Get());
+
+    if (lock_scope_.end() == it) { return false; }
+
+    nyms.insert(msgIn.m_strNymID.Get());
+
+    switch (it->second) {
+        case LockScope::NYM: {
+
+            return true;
+        }
+        case LockScope::NYMS: {
+            if (msgIn.m_strNymID2.Exists()) {
+                nyms.insert(msgIn.m_strNymID2.Get());
+            }
+
+            return true;
+        }
+        case LockScope::ACCOUNT: {
+            if (msgIn.m_strAcctID.Exists()) {
+                accounts.insert(msgIn.m_strAcctID.Get());
+            }
+
+            return true;
+        }
+        case LockScope::LEDGER: {
+            break;
+        }
+        case LockScope::NOTARY:
+        default: {
+
+            return false;
+        }
+    }
+
+    if (msgIn.m_strAcctID.Exists()) {
+        accounts.insert(msgIn.m_strAcctID.Get());
+    }
+
+    const Identifier NOTARY_ID(server_->m_strNotaryID);
+    Ledger theLedger(
+        Identifier(msgIn.m_strNymID), Identifier(msgIn.m_strAcctID), NOTARY_ID);
+
+    // The handler rejects a request whose ledger does not load, and will
+    // only touch the sender's own account while doing so.
+    if (!load_request_ledger(msgIn, theLedger)) { return true; }
+
+    for (auto& it : theLedger.GetTransactionMap()) {
+        OTTransaction* pTransaction = it.second;
+
+        OT_ASSERT(nullptr != pTransaction);
+
+        switch (pTransaction->GetType()) {
+            case OTTransaction::transfer: {
+                Item* pItem = pTransaction->GetItem(Item::transfer);
+
+                if (nullptr != pItem) {
+                    accounts.insert(
+                        String(pItem->GetPurportedAccountID()).Get());
+                    accounts.insert(
+                        String(pItem->GetDestinationAcctID()).Get());
+                }
+            } break;
+            case OTTransaction::processInbox: {
+                // Handled by InboxLockKeys
+            } break;
+            case OTTransaction::deposit: {
+                // Cash deposits go through the mint
+                if (nullptr != pTransaction->GetItem(Item::deposit)) {
+                    return false;
+                }
+
+                Item* pItem = pTransaction->GetItem(Item::depositCheque);
+
+                if (nullptr == pItem) { break; }
+
+                String strCheque;
+                pItem->GetAttachment(strCheque);
+                Cheque theCheque;
+
+                if (!theCheque.LoadContractFromString(strCheque)) { break; }
+
+                // Vouchers are drawn on the notary's voucher accounts
+                if (theCheque.HasRemitter()) { return false; }
+
+                // Depositing a cheque debits the sender's account and
+                // closes the cheque number on the sender's context
+                nyms.insert(String(theCheque.GetSenderNymID()).Get());
+                accounts.insert(String(theCheque.GetSenderAcctID()).Get());
+            } break;
+            default: {
+                // Withdrawals, dividends, cron items and baskets all touch
+                // shared notary state
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool UserCommandProcessor::InboxLockKeys(
+    const Message& msgIn,
+    std::set<std::string>& accounts) const
+{
+    const auto it = lock_scope_.find(msgIn.m_strCommand.Get());
+
+    if ((lock_scope_.end() == it) || (LockScope::LEDGER != it->second)) {
+
+        return true;
+    }
+
+    const Identifier NYM_ID(msgIn.m_strNymID), ACCOUNT_ID(msgIn.m_strAcctID),
+        NOTARY_ID(server_->m_strNotaryID);
+    Ledger theLedger(NYM_ID, ACCOUNT_ID, NOTARY_ID);
+
+    if (!load_request_ledger(msgIn, theLedger)) { return true; }
+
+    std::unique_ptr<Ledger> pInbox;
+
+    for (auto& it : theLedger.GetTransactionMap()) {
+        OTTransaction* pTransaction = it.second;
+
+        OT_ASSERT(nullptr != pTransaction);
+
+        if (OTTransaction::processInbox != pTransaction->GetType()) {
+            continue;
+        }
+
+        for (auto& pItem : pTransaction->GetItemList()) {
+            OT_ASSERT(nullptr != pItem);
+
+            // Accepting or rejecting a pending transfer updates the boxes of
+            // the account it came from. Every other receipt only touches the
+            // sender's own account.
+            if ((Item::acceptPending != pItem->GetType()) &&
+                (Item::rejectPending != pItem->GetType())) {
+                continue;
+            }
+
+            if (!pInbox) {
+                pInbox.reset(new Ledger(NYM_ID, ACCOUNT_ID, NOTARY_ID));
+
+                // The handler rejects the request if the inbox is missing
+                if (!pInbox->LoadInbox()) { return true; }
+            }
+
+            const auto number = pItem->GetReferenceToNum();
+            OTTransaction* pServerTransaction = pInbox->GetTransaction(number);
+
+            if (nullptr == pServerTransaction) { continue; }
+
+            if (pServerTransaction->IsAbbreviated()) {
+                if (!pInbox->LoadBoxReceipt(number)) { continue; }
+
+                pServerTransaction = pInbox->GetTransaction(number);
+
+                OT_ASSERT(nullptr != pServerTransaction);
+            }
+
+            String strOriginalItem;
+            pServerTransaction->GetReferenceString(strOriginalItem);
+            std::unique_ptr<Item> pOriginalItem(Item::CreateItemFromString(
+                strOriginalItem,
+                NOTARY_ID,
+                pServerTransaction->GetReferenceToNum()));
+
+            if (nullptr == pOriginalItem) { continue; }
+
+            accounts.insert(
+                String(pOriginalItem->GetPurportedAccountID()).Get());
+        }
+    }
+
+    return true;
+}
+
+bool UserCommandProcessor::load_request_ledger(
+    const Message& msgIn,
+    Ledger& ledger) const
+{
+    // Load the ledger exactly the way the command handler does
+    const String strLedger(msgIn.m_ascPayload);
+
+    if (msgIn.m_strCommand.Compare("processInbox")) {
+
+        return ledger.LoadContractFromString(strLedger);
+    }
+
+    return ledger.LoadLedgerFromString(strLedger);
+}
+
 bool UserCommandProcessor::ProcessUserCommand(
     Message& theMessage,
     Message& msgOut,
@@ -979,6 +1217,25 @@ bool UserCommandProcessor::ProcessUserCommand(
 
         if (bRunIt) UserCmdGetBoxReceipt(theMessage, msgOut);
 
+        return true;
+    } else if (theMessage.m_strCommand.Compare("getBoxReceipts")) {
+        Log::vOutput(
+            0,
+            "\n==> Received a getBoxReceipts message. Nym: %s ...\n",
+            strMsgNymID.Get());
+
+        bool bRunIt = true;
+        if (0 == theMessage.m_lDepth)
+            OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_get_nymbox)
+        else if (1 == theMessage.m_lDepth)
+            OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_get_inbox)
+        else if (2 == theMessage.m_lDepth)
+            OT_ENFORCE_PERMISSION_MSG(ServerSettings::__cmd_get_outbox)
+        else
+            bRunIt = false;
+
+        if (bRunIt) UserCmdGetBoxReceipts(theMessage, msgOut);
+
         return true;
     } else if (theMessage.m_strCommand.Compare("getAccountData")) {
         Log::vOutput(
@@ -2937,9 +3194,18 @@ void UserCommandProcessor::UserCmdGetAccountData(
                                                              // outgoing message
     } else                                                   // SUCCESS.
     {
+        // Leave out any box the client says it already has.
+        const bool bInboxUnchanged =
+            strInboxHash.Exists() && MsgIn.m_strInboxHash.Compare(strInboxHash);
+        const bool bOutboxUnchanged = strOutboxHash.Exists() &&
+                                      MsgIn.m_strOutboxHash.Compare(strOutboxHash);
+
         msgOut.m_ascPayload.SetString(strAccount);
-        msgOut.m_ascPayload2.SetString(strInbox);
-        msgOut.m_ascPayload3.SetString(strOutbox);
+
+        if (!bInboxUnchanged) msgOut.m_ascPayload2.SetString(strInbox);
+
+        if (!bOutboxUnchanged) msgOut.m_ascPayload3.SetString(strOutbox);
+
         msgOut.m_strInboxHash = strInboxHash;
         msgOut.m_strOutboxHash = strOutboxHash;
         msgOut.m_bSuccess = true;
@@ -3668,6 +3934,191 @@ void UserCommandProcessor::UserCmdGetBoxReceipt(Message& MsgIn, Message& msgOut)
     msgOut.SaveContract();
 }
 
+// Same as getBoxReceipt, except "transactionNums" holds a NumList of receipts
+// to retrieve from the one box. The box is loaded and verified once for the
+// whole list. At most GetBoxReceiptsPerReply() receipts (and roughly
+// MAX_BOX_RECEIPTS_REPLY_SIZE bytes of them) go into a reply. Numbers that
+// didn't fit are returned in "remaining" for the client to request again, and
+// numbers that couldn't be loaded or verified are returned in "failed".
+//
+void UserCommandProcessor::UserCmdGetBoxReceipts(
+    Message& MsgIn,
+    Message& msgOut)
+{
+    static const std::size_t MAX_BOX_RECEIPTS_REPLY_SIZE = 4 * 1024 * 1024;
+
+    // (1) set up member variables
+    msgOut.m_strCommand = "getBoxReceiptsResponse";  // reply to getBoxReceipts
+    msgOut.m_strNymID = MsgIn.m_strNymID;            // NymID
+    msgOut.m_strAcctID = MsgIn.m_strAcctID;  // the asset account ID
+                                             // (inbox/outbox), or Nym ID
+                                             // (nymbox)
+    msgOut.m_lDepth = MsgIn.m_lDepth;
+    msgOut.m_bSuccess = false;
+
+    const char* szBoxType =
+        (MsgIn.m_lDepth == 0)
+            ? "nymbox"
+            : ((MsgIn.m_lDepth == 1) ? "inbox" : "outbox");  // outbox is 2.
+    const Identifier NYM_ID(MsgIn.m_strNymID), NOTARY_ID(MsgIn.m_strNotaryID),
+        ACCOUNT_ID(MsgIn.m_strAcctID);
+
+    std::set<int64_t> setRequested;
+    NumList numlistRequested;
+
+    if (MsgIn.m_ascPayload.Exists()) {
+        const String strRequested(MsgIn.m_ascPayload);
+        numlistRequested.Add(strRequested);
+    }
+
+    numlistRequested.Output(setRequested);
+
+    std::unique_ptr<Ledger> pLedger(new Ledger(NYM_ID, ACCOUNT_ID, NOTARY_ID));
+
+    bool bSuccessLoading = false;
+
+    // The Nymbox is addressed by NymID, the asset account boxes by AcctID.
+    switch (MsgIn.m_lDepth) {
+        case 0:  // Nymbox
+            if (NYM_ID == ACCOUNT_ID) bSuccessLoading = pLedger->LoadNymbox();
+            break;
+        case 1:  // Inbox
+            if (NYM_ID != ACCOUNT_ID) bSuccessLoading = pLedger->LoadInbox();
+            break;
+        case 2:  // Outbox
+            if (NYM_ID != ACCOUNT_ID) bSuccessLoading = pLedger->LoadOutbox();
+            break;
+        default:
+            break;
+    }
+
+    if (setRequested.empty()) {
+        Log::vError(
+            "UserCommandProcessor::UserCmdGetBoxReceipts: User didn't "
+            "request any transaction numbers from the %s. NymID (%s) and "
+            "AccountID (%s) FYI.\n",
+            szBoxType,
+            MsgIn.m_strNymID.Get(),
+            MsgIn.m_strAcctID.Get());
+    } else if (
+        bSuccessLoading && pLedger->VerifyContractID() &&
+        pLedger->VerifySignature(server_->m_nymServer)) {
+        std::unique_ptr<OTDB::Storable> pStorable(
+            OTDB::CreateObject(OTDB::STORED_OBJ_STRING_MAP));
+        OTDB::StringMap* pMap = dynamic_cast<OTDB::StringMap*>(pStorable.get());
+        OT_ASSERT(nullptr != pMap);
+
+        const std::size_t maxReceipts =
+            (0 < ServerSettings::GetBoxReceiptsPerReply())
+                ? ServerSettings::GetBoxReceiptsPerReply()
+                : 1;
+        std::size_t replySize = 0;
+        NumList numlistRemaining, numlistFailed;
+
+        for (const auto& lTransactionNum : setRequested) {
+            if ((pMap->the_map.size() >= maxReceipts) ||
+                (replySize >= MAX_BOX_RECEIPTS_REPLY_SIZE)) {
+                numlistRemaining.Add(lTransactionNum);
+
+                continue;
+            }
+
+            if (nullptr == pLedger->GetTransaction(lTransactionNum)) {
+                numlistFailed.Add(lTransactionNum);
+
+                continue;
+            }
+
+            // See UserCmdGetBoxReceipt for why the transaction is looked up
+            // again after calling LoadBoxReceipt().
+            pLedger->LoadBoxReceipt(lTransactionNum);
+            OTTransaction* pTransaction =
+                pLedger->GetTransaction(lTransactionNum);
+
+            if ((nullptr != pTransaction) && !pTransaction->IsAbbreviated() &&
+                pTransaction->VerifyContractID() &&
+                pTransaction->VerifySignature(server_->m_nymServer)) {
+                const String strBoxReceipt(*pTransaction);
+                OT_ASSERT(strBoxReceipt.Exists());
+
+                replySize += strBoxReceipt.GetLength();
+                pMap->the_map[formatLong(lTransactionNum)] =
+                    strBoxReceipt.Get();
+            } else {
+                numlistFailed.Add(lTransactionNum);
+            }
+        }
+
+        if (0 < numlistFailed.Count()) {
+            String strFailed;
+            // Only clients with this command can have sent it, and they
+            // parse ranges.
+            numlistFailed.Output(strFailed, true);
+            msgOut.m_ascPayload3.SetString(strFailed);
+
+            Log::vError(
+                "UserCommandProcessor::UserCmdGetBoxReceipts: Failed "
+                "retrieving transaction numbers (%s) from the %s. NymID (%s) "
+                "and AccountID (%s) FYI.\n",
+                strFailed.Get(),
+                szBoxType,
+                MsgIn.m_strNymID.Get(),
+                MsgIn.m_strAcctID.Get());
+        }
+
+        if (0 < numlistRemaining.Count()) {
+            String strRemaining;
+            numlistRemaining.Output(strRemaining, true);
+            msgOut.m_ascPayload2.SetString(strRemaining);
+        }
+
+        if (!pMap->the_map.empty()) {
+            const std::string str_Encoded = OTDB::EncodeObject(*pMap);
+
+            if (str_Encoded.size() > 0) {
+                msgOut.m_ascPayload = str_Encoded.c_str();
+                msgOut.m_bSuccess = true;
+            }
+        }
+
+        Log::vOutput(
+            3,
+            "UserCommandProcessor::UserCmdGetBoxReceipts: User is retrieving "
+            "%" PRIu64 " box receipts from the %s for NymID (%s) AccountID "
+            "(%s). %d remaining, %d failed.\n",
+            static_cast<uint64_t>(pMap->the_map.size()),
+            szBoxType,
+            MsgIn.m_strNymID.Get(),
+            MsgIn.m_strAcctID.Get(),
+            numlistRemaining.Count(),
+            numlistFailed.Count());
+    } else {
+        Log::vError(
+            "UserCommandProcessor::UserCmdGetBoxReceipts: Failed loading or "
+            "verifying %s. NymID (%s) and AccountID (%s) FYI.\n",
+            szBoxType,
+            MsgIn.m_strNymID.Get(),
+            MsgIn.m_strAcctID.Get());
+    }
+
+    // Grab the incoming message in plaintext form
+    const String tempInMessage(MsgIn);
+    // Set it into the base64-encoded object on the outgoing message
+    msgOut.m_ascInReferenceTo.SetString(tempInMessage);
+
+    // (2) Sign the Message
+    msgOut.SignContract(static_cast<const Nym&>(server_->m_nymServer));
+
+    // (3) Save the Message (with signatures and all, back to its internal
+    // member m_strRawFile.)
+    //
+    // FYI, SaveContract takes m_xmlUnsigned and wraps it with the signatures
+    // and ------- BEGIN  bookends
+    // If you don't pass a string in, then SaveContract saves the new version to
+    // its member, m_strRawFile
+    msgOut.SaveContract();
+}
+
 // If the client wants to delete an asset account, the server will allow it...
 // ...IF: the Inbox and Outbox are both EMPTY. AND the Balance must be empty as
 // well!
@@ -47,6 +47,8 @@
 #include "opentxs/storage/drivers/StorageFS.hpp"
 #elif OT_STORAGE_SQLITE
 #include "opentxs/storage/drivers/StorageSqlite3.hpp"
+#elif OT_STORAGE_PACK
+#include "opentxs/storage/drivers/StoragePack.hpp"
 #endif
 #include "opentxs/storage/tree/Credentials.hpp"
 #include "opentxs/storage/tree/Nym.hpp"
@@ -66,6 +68,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstdlib>
+#include <ctime>
 #include <stdexcept>
 #include <utility>
 
@@ -88,6 +91,9 @@ Storage::Storage(
     #elif OT_STORAGE_SQLITE
         primary_plugin_.reset(
             new StorageSqlite3(config_, digest_, random_, primary_bucket_));
+    #elif OT_STORAGE_PACK
+        primary_plugin_.reset(
+            new StoragePack(config_, digest_, random_, primary_bucket_));
     #endif
 
     OT_ASSERT(primary_plugin_);
@@ -99,6 +105,7 @@ void Storage::Cleanup_Storage()
 {
     if (meta_) {
         meta_->cleanup();
+        RunCommit(true);
     }
 }
 
@@ -341,27 +348,24 @@ bool Storage::Load(
     return Meta().Tree().UnitNode().Load(id, contract, alias, checking);
 }
 
-// Applies a lambda to all public nyms in the database in a detached thread.
+// Applies a lambda to all public nyms in the database in the background.
 void Storage::MapPublicNyms(NymLambda& lambda)
 {
-    std::thread bgMap(&Storage::RunMapPublicNyms, this, lambda);
-    bgMap.detach();
+    config_.Execute(std::bind(&Storage::RunMapPublicNyms, this, lambda));
 }
 
-// Applies a lambda to all server contracts in the database in a detached
-// thread.
+// Applies a lambda to all server contracts in the database in the
+// background.
 void Storage::MapServers(ServerLambda& lambda)
 {
-    std::thread bgMap(&Storage::RunMapServers, this, lambda);
-    bgMap.detach();
+    config_.Execute(std::bind(&Storage::RunMapServers, this, lambda));
 }
 
-// Applies a lambda to all unit definitions in the database in a detached
-// thread.
+// Applies a lambda to all unit definitions in the database in the
+// background.
 void Storage::MapUnitDefinitions(UnitLambda& lambda)
 {
-    std::thread bgMap(&Storage::RunMapUnits, this, lambda);
-    bgMap.detach();
+    config_.Execute(std::bind(&Storage::RunMapUnits, this, lambda));
 }
 
 Editor<storage::Root> Storage::mutable_Meta()
@@ -369,7 +373,15 @@ Editor<storage::Root> Storage::mutable_Meta()
     std::function<void(storage::Root*, Lock&)> callback =
         [&](storage::Root* in, Lock& lock) -> void {this->save(in, lock);};
 
-    return Editor<storage::Root>(write_lock_, meta(), callback);
+    Editor<storage::Root> output(write_lock_, meta(), callback);
+
+    OT_ASSERT(primary_plugin_);
+
+    // Every node saved by this edit, and the new root hash, are written
+    // together. save() commits once the root hash is stored.
+    primary_plugin_->Begin();
+
+    return output;
 }
 
 ObjectList Storage::NymBoxList(
@@ -433,12 +445,21 @@ storage::Root* Storage::meta() const
         primary_plugin_.get(),
         std::placeholders::_1);
 
+    FlushStorage flush = std::bind(&Storage::commit, this, true);
+
+    ExecuteCB execute = std::bind(
+        &StorageConfig::Execute,
+        &config_,
+        std::placeholders::_1);
+
     if (!meta_) {
         meta_.reset(new storage::Root(
             *primary_plugin_,
             primary_plugin_->LoadRoot(),
             gc_interval_,
             bucket,
+            flush,
+            execute,
             primary_bucket_));
     }
 
@@ -586,6 +607,8 @@ bool Storage::RemoveUnitDefinition(const std::string& id)
         .Delete(id);
 }
 
+void Storage::RunCommit(const bool force) { commit(force); }
+
 void Storage::RunGC()
 {
     if (shutdown_.load()) {
@@ -610,13 +633,73 @@ void Storage::RunMapUnits(UnitLambda lambda)
     return Meta().Tree().UnitNode().Map(lambda);
 }
 
+// Writes the pending tree nodes and the root hash, if the commit interval has
+// passed or force is set. With force the root hash is written even if there
+// are no pending nodes, since garbage collection relies on it being current.
+bool Storage::commit(const bool force) const
+{
+    OT_ASSERT(primary_plugin_);
+
+    if (!meta_) { return false; }
+
+    if (!force && (0 == primary_plugin_->PendingNodes())) { return true; }
+
+    Lock lock(write_lock_);
+    const std::int64_t now = std::time(nullptr);
+
+    if (!force && ((now - last_commit_) < config_.commit_interval_)) {
+        return true;
+    }
+
+    primary_plugin_->Begin();
+    const bool output = flush(lock);
+
+    if (!primary_plugin_->Commit()) {
+        otErr << __FUNCTION__ << ": Failed to commit storage transaction."
+              << std::endl;
+
+        return false;
+    }
+
+    return output;
+}
+
+// Writes the pending tree nodes, then the root hash which refers to them
+bool Storage::flush(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+    OT_ASSERT(meta_);
+
+    // Garbage collection saves the root without the storage write lock
+    Lock rootLock(meta_->write_lock_);
+    last_commit_ = std::time(nullptr);
+
+    if (!primary_plugin_->FlushNodes()) {
+        otErr << __FUNCTION__ << ": Failed to write tree nodes. The root hash "
+              << "will not be updated." << std::endl;
+
+        return false;
+    }
+
+    return primary_plugin_->StoreRoot(meta_->root_);
+}
+
 void Storage::save(storage::Root* in, const Lock& lock)
 {
     OT_ASSERT(verify_write_lock(lock));
     OT_ASSERT(nullptr != in);
     OT_ASSERT(primary_plugin_);
 
-    primary_plugin_->StoreRoot(in->root_);
+    const std::int64_t now = std::time(nullptr);
+
+    if ((now - last_commit_) >= config_.commit_interval_) {
+        flush(lock);
+    }
+
+    if (!primary_plugin_->Commit()) {
+        otErr << __FUNCTION__ << ": Failed to commit storage transaction."
+              << std::endl;
+    }
 }
 
 bool Storage::SetDefaultSeed(const std::string& id)
@@ -63,6 +63,66 @@ StoragePlugin_impl::StoragePlugin_impl(
     current_bucket_.store(false);
 }
 
+bool StoragePlugin_impl::Begin() const { return true; }
+
+bool StoragePlugin_impl::Commit() const { return true; }
+
+bool StoragePlugin_impl::find_pending(
+    const std::string& key,
+    std::string& value) const
+{
+    std::lock_guard<std::mutex> lock(node_lock_);
+    const auto it = pending_nodes_.find(key);
+
+    if (pending_nodes_.end() == it) { return false; }
+
+    value = it->second.first;
+
+    return true;
+}
+
+bool StoragePlugin_impl::FlushNodes() const
+{
+    std::map<std::string, PendingNode> nodes;
+
+    {
+        std::lock_guard<std::mutex> lock(node_lock_);
+        nodes = pending_nodes_;
+    }
+
+    if (nodes.empty()) { return true; }
+
+    const bool bucket = current_bucket_.load();
+    bool output = true;
+
+    for (const auto& it : nodes) {
+        const auto& key = it.first;
+        const auto& value = it.second.first;
+
+        if (!Store(key, value, bucket)) {
+            otErr << __FUNCTION__ << ": Failed to write node " << key
+                  << std::endl;
+            output = false;
+        }
+    }
+
+    if (!output) { return false; }
+
+    std::lock_guard<std::mutex> lock(node_lock_);
+
+    for (auto it = node_versions_.begin(); it != node_versions_.end();) {
+        if (nodes.count(it->second)) {
+            it = node_versions_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (const auto& it : nodes) { pending_nodes_.erase(it.first); }
+
+    return true;
+}
+
 bool StoragePlugin_impl::Load(
     const std::string& key,
     const bool checking,
@@ -76,6 +136,8 @@ bool StoragePlugin_impl::Load(
         return false;
     }
 
+    if (find_pending(key, value)) { return true; }
+
     bool valid = false;
     const bool bucket = current_bucket_.load();
 
@@ -109,8 +171,13 @@ bool StoragePlugin_impl::Migrate(const std::string& key) const
     if (key.empty()) { return false; }
 
     std::string value;
+
     const auto bucket = current_bucket_.load();
 
+    // A pending node may be flushed to either bucket while garbage collection
+    // is running, so write it to the active bucket now.
+    if (find_pending(key, value)) { return Store(key, value, bucket); }
+
     // try to load the key from the inactive bucket
     if (Load(key, value, !bucket)) {
 
@@ -150,4 +217,52 @@ bool StoragePlugin_impl::Store(
 
     return false;
 }
+
+bool StoragePlugin_impl::StoreNode(
+    const std::string& value,
+    std::string& key,
+    const void* node) const
+{
+    if (!digest_) { return false; }
+
+    digest_(Storage::HASH_TYPE, value, key);
+
+    if (0 == config_.commit_interval_) {
+
+        return Store(key, value, current_bucket_.load());
+    }
+
+    std::lock_guard<std::mutex> lock(node_lock_);
+    auto& version = node_versions_[node];
+
+    if (version == key) { return true; }
+
+    if (!version.empty()) {
+        // The previous version of this node was never written, and nothing
+        // will refer to it once the new version is committed.
+        auto previous = pending_nodes_.find(version);
+
+        if (pending_nodes_.end() != previous) {
+            if (1 >= previous->second.second) {
+                pending_nodes_.erase(previous);
+            } else {
+                --previous->second.second;
+            }
+        }
+    }
+
+    auto& pending = pending_nodes_[key];
+    pending.first = value;
+    ++pending.second;
+    version = key;
+
+    return true;
+}
+
+std::size_t StoragePlugin_impl::PendingNodes() const
+{
+    std::lock_guard<std::mutex> lock(node_lock_);
+
+    return pending_nodes_.size();
+}
 } // namespace opentxs
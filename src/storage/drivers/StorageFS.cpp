@@ -42,13 +42,31 @@
 
 #include <boost/filesystem.hpp>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
 #include <cstdio>
 #include <fstream>
+#include <functional>
 #include <ios>
 #include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
 #include <thread>
 #include <vector>
 
+// Files at least this large are read through a memory mapping instead of
+// read().
+#define OT_STORAGE_FS_MMAP_THRESHOLD 65536
+
 namespace opentxs
 {
 
@@ -68,6 +86,31 @@ std::string StorageFS::GetBucketName(const bool bucket) const
     return bucket ? config_.fs_secondary_bucket_ : config_.fs_primary_bucket_;
 }
 
+std::string StorageFS::GetDirectory(
+    const std::string& key,
+    const bool bucket) const
+{
+    std::string output = folder_ + "/" + GetBucketName(bucket);
+    const std::size_t depth =
+        (0 < config_.fs_shard_depth_) ? config_.fs_shard_depth_ : 0;
+
+    // Keys too short to shard stay at the top of the bucket.
+    if (key.size() <= (2 * depth)) { return output; }
+
+    for (std::size_t i = 0; i < depth; ++i) {
+        output += "/" + key.substr(2 * i, 2);
+    }
+
+    return output;
+}
+
+bool StorageFS::InBatch() const
+{
+    std::lock_guard<std::mutex> lock(pending_lock_);
+
+    return (0 < batch_depth_) && (std::this_thread::get_id() == batch_owner_);
+}
+
 void StorageFS::Init_StorageFS()
 {
     boost::filesystem::create_directory(
@@ -76,6 +119,27 @@ void StorageFS::Init_StorageFS()
         folder_+ "/" + config_.fs_secondary_bucket_);
 }
 
+bool StorageFS::PrepareDirectory(const std::string& directory) const
+{
+    std::lock_guard<std::mutex> lock(directory_lock_);
+
+    if (directories_.end() != directories_.find(directory)) { return true; }
+
+    boost::system::error_code error;
+    boost::filesystem::create_directories(directory, error);
+
+    if (error) {
+        std::cerr << __FUNCTION__ << ": Failed to create " << directory << ": "
+                  << error.message() << std::endl;
+
+        return false;
+    }
+
+    directories_.insert(directory);
+
+    return true;
+}
+
 void StorageFS::Purge(const std::string& path) const
 {
     if (path.empty()) { return; }
@@ -83,112 +147,318 @@ void StorageFS::Purge(const std::string& path) const
     boost::filesystem::remove_all(path);
 }
 
-std::string StorageFS::LoadRoot() const
+bool StorageFS::ReadFile(const std::string& filename, std::string& value) const
 {
-    if (!folder_.empty()) {
-        std::string filename = folder_ + "/" + config_.fs_root_file_;
+#ifdef _WIN32
+    std::ifstream file(
+        filename,
+        std::ios::in | std::ios::ate | std::ios::binary);
+
+    if (!file.good()) { return false; }
 
-        if (!boost::filesystem::exists(filename)) { return ""; }
+    std::ifstream::pos_type pos = file.tellg();
 
-        std::ifstream file(
-            filename,
-            std::ios::in | std::ios::ate | std::ios::binary);
+    if ((0 >= pos) || (0xFFFFFFFF <= pos)) { return false; }
 
-        if (file.good()) {
-            std::ifstream::pos_type pos = file.tellg();
+    uint32_t size(pos);
 
-            if ((0 >= pos) || (0xFFFFFFFF <= pos)) { return ""; }
+    file.seekg(0, std::ios::beg);
+    value.resize(size);
+    file.read(&value[0], size);
 
-            uint32_t size(pos);
+    return file.good();
+#else
+    const int fd = ::open(filename.c_str(), O_RDONLY);
 
-            file.seekg(0, std::ios::beg);
+    if (-1 == fd) { return false; }
 
-            std::vector<char> bytes(size);
-            file.read(&bytes[0], size);
+    struct stat info;
+    bool success = false;
 
-            return std::string(&bytes[0], size);
+    if ((0 == ::fstat(fd, &info)) && (0 < info.st_size) &&
+        (0xFFFFFFFF > info.st_size)) {
+        const std::size_t size = info.st_size;
+        void* mapped = MAP_FAILED;
+
+        if (OT_STORAGE_FS_MMAP_THRESHOLD <= size) {
+            mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+
+        if (MAP_FAILED != mapped) {
+            value.assign(static_cast<const char*>(mapped), size);
+            ::munmap(mapped, size);
+            success = true;
+        } else {
+            value.resize(size);
+            std::size_t done = 0;
+
+            while (done < size) {
+                const auto bytes = ::read(fd, &value[done], size - done);
+
+                if (0 < bytes) {
+                    done += bytes;
+                } else if ((0 > bytes) && (EINTR == errno)) {
+                    continue;
+                } else {
+                    break;
+                }
+            }
+
+            success = (done == size);
         }
     }
 
-    return "";
+    ::close(fd);
+
+    return success;
+#endif
 }
 
-bool StorageFS::Load(
-    const std::string& key,
-    std::string& value,
-    const bool bucket) const
+// Flushes the contents of each file, then each directory entry, to disk.
+bool StorageFS::Sync(
+    const std::vector<std::string>& files,
+    const std::set<std::string>& directories) const
 {
-    std::string folder =  folder_ + "/" + GetBucketName(bucket);
-    std::string filename = folder + "/" + key;
+#ifdef _WIN32
+    return true;
+#else
+    bool success = true;
+#ifdef __linux__
+    // One call flushes everything on the filesystem, which is cheaper than
+    // a call per file once there are more than a few.
+    if (1 < files.size()) {
+        const int fd = ::open(folder_.c_str(), O_RDONLY);
+
+        if (-1 != fd) {
+            const bool synced = (0 == ::syncfs(fd));
+            ::close(fd);
+
+            if (synced) { return true; }
+        }
+    }
+#endif
 
-    if (!boost::filesystem::exists(filename)) { return false; }
+    for (const auto& filename : files) {
+        const int fd = ::open(filename.c_str(), O_RDONLY);
 
-    if (!folder_.empty()) {
-        std::ifstream file(
-            filename,
-            std::ios::in | std::ios::ate | std::ios::binary);
+        // The bucket may have been emptied since the file was written.
+        if (-1 == fd) { continue; }
 
-        if (file.good()) {
-            std::ifstream::pos_type pos = file.tellg();
+        if (0 != ::fsync(fd)) { success = false; }
 
-            if ((0 >= pos) || (0xFFFFFFFF <= pos)) { return false; }
+        ::close(fd);
+    }
+
+    for (const auto& directory : directories) {
+        const int fd = ::open(directory.c_str(), O_RDONLY);
 
-            uint32_t size(pos);
+        if (-1 == fd) { continue; }
 
-            file.seekg(0, std::ios::beg);
+        if (0 != ::fsync(fd)) { success = false; }
 
-            std::vector<char> bytes(size);
-            file.read(&bytes[0], size);
+        ::close(fd);
+    }
 
-            value.assign(&bytes[0], size);
+    return success;
+#endif
+}
+
+// Writes to a temporary file, then renames it over filename, so a reader
+// never sees a partly written file.
+bool StorageFS::WriteFile(
+    const std::string& directory,
+    const std::string& filename,
+    const std::string& value,
+    const bool sync) const
+{
+    const std::string path = directory + "/" + filename;
+    const std::string temp =
+        path + "." + std::to_string(temp_counter_++) + ".tmp";
+#ifdef _WIN32
+    std::ofstream file(
+        temp,
+        std::ios::out | std::ios::trunc | std::ios::binary);
+
+    if (!file.good()) { return false; }
+
+    file.write(value.c_str(), value.size());
+    file.close();
+
+    if (!file.good()) {
+        std::remove(temp.c_str());
+
+        return false;
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::rename(temp, path, error);
+
+    if (error) {
+        std::remove(temp.c_str());
+
+        return false;
+    }
 
-            return true;
+    return true;
+#else
+    const int fd =
+        ::open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+
+    if (-1 == fd) { return false; }
+
+    std::size_t done = 0;
+
+    while (done < value.size()) {
+        const auto bytes =
+            ::write(fd, value.data() + done, value.size() - done);
+
+        if (0 < bytes) {
+            done += bytes;
+        } else if ((0 > bytes) && (EINTR == errno)) {
+            continue;
+        } else {
+            break;
         }
     }
 
-    return false;
+    bool success = (done == value.size());
+
+    if (success && sync) { success = (0 == ::fsync(fd)); }
+
+    if (0 != ::close(fd)) { success = false; }
+
+    if (success) { success = (0 == std::rename(temp.c_str(), path.c_str())); }
+
+    if (!success) {
+        std::remove(temp.c_str());
+
+        return false;
+    }
+
+    if (sync) { return Sync({}, {directory}); }
+
+    return true;
+#endif
 }
 
-bool StorageFS::StoreRoot(const std::string& hash) const
+std::string StorageFS::LoadRoot() const
 {
     if (!folder_.empty()) {
-        std::string filename = folder_ + "/" + config_.fs_root_file_;
-        std::ofstream file(
-            filename,
-            std::ios::out | std::ios::trunc | std::ios::binary);
-
-        if (file.good()) {
-            file.write(hash.c_str(), hash.size());
-            file.close();
+        std::string value;
 
-            return true;
+        if (ReadFile(folder_ + "/" + config_.fs_root_file_, value)) {
+            return value;
         }
     }
 
+    return "";
+}
+
+bool StorageFS::Load(
+    const std::string& key,
+    std::string& value,
+    const bool bucket) const
+{
+    if (folder_.empty()) { return false; }
+
+    if (ReadFile(GetDirectory(key, bucket) + "/" + key, value)) {
+        return true;
+    }
+
+    // Objects stored before sharding was turned on are still at the top of
+    // the bucket, until garbage collection moves them.
+    if (0 < config_.fs_shard_depth_) {
+        return ReadFile(folder_ + "/" + GetBucketName(bucket) + "/" + key,
+                        value);
+    }
+
     return false;
 }
 
+bool StorageFS::StoreRoot(const std::string& hash) const
+{
+    if (folder_.empty()) { return false; }
+
+    if (InBatch()) {
+        std::lock_guard<std::mutex> lock(pending_lock_);
+        pending_root_ = hash;
+        root_pending_ = true;
+
+        return true;
+    }
+
+    return WriteFile(folder_, config_.fs_root_file_, hash, config_.fs_sync_);
+}
+
 bool StorageFS::Store(
     const std::string& key,
     const std::string& value,
     const bool bucket) const
 {
-    std::string folder =  folder_ + "/" + GetBucketName(bucket);
-    std::string filename = folder + "/" + key;
+    if (folder_.empty()) { return false; }
 
-    if (!folder_.empty()) {
-        std::ofstream file(
-            filename,
-            std::ios::out | std::ios::trunc | std::ios::binary);
-        if (file.good()) {
-            file.write(value.c_str(), value.size());
-            file.close();
-
-            return true;
+    const std::string directory = GetDirectory(key, bucket);
+
+    if (!PrepareDirectory(directory)) { return false; }
+
+    if (config_.fs_sync_ && InBatch()) {
+        if (!WriteFile(directory, key, value, false)) { return false; }
+
+        std::lock_guard<std::mutex> lock(pending_lock_);
+        pending_files_.push_back(directory + "/" + key);
+        pending_directories_.insert(directory);
+
+        return true;
+    }
+
+    return WriteFile(directory, key, value, config_.fs_sync_);
+}
+
+bool StorageFS::Begin() const
+{
+    batch_lock_.lock();
+
+    std::lock_guard<std::mutex> lock(pending_lock_);
+
+    if (0 == batch_depth_++) { batch_owner_ = std::this_thread::get_id(); }
+
+    return true;
+}
+
+bool StorageFS::Commit() const
+{
+    std::unique_lock<std::mutex> lock(pending_lock_);
+
+    assert(0 < batch_depth_);
+
+    bool success = true;
+
+    if (0 == --batch_depth_) {
+        std::vector<std::string> files;
+        std::set<std::string> directories;
+        std::string root;
+        const bool writeRoot = root_pending_;
+        files.swap(pending_files_);
+        directories.swap(pending_directories_);
+        root.swap(pending_root_);
+        root_pending_ = false;
+        batch_owner_ = std::thread::id();
+        lock.unlock();
+
+        // The objects must be on disk before the root which refers to them.
+        if (config_.fs_sync_) { success = Sync(files, directories); }
+
+        if (success && writeRoot) {
+            success =
+                WriteFile(folder_, config_.fs_root_file_, root, config_.fs_sync_);
         }
+    } else {
+        lock.unlock();
     }
 
-    return false;
+    batch_lock_.unlock();
+
+    return success;
 }
 
 bool StorageFS::EmptyBucket(const bool bucket) const
@@ -203,8 +473,22 @@ bool StorageFS::EmptyBucket(const bool bucket) const
         return false;
     }
 
-    std::thread backgroundDelete(&StorageFS::Purge, this, newName);
-    backgroundDelete.detach();
+    // The subdirectories went with it.
+    const std::string prefix = oldDirectory + "/";
+    std::unique_lock<std::mutex> lock(directory_lock_);
+
+    for (auto it = directories_.begin(); it != directories_.end();) {
+        if ((oldDirectory == *it) ||
+            (0 == it->compare(0, prefix.size(), prefix))) {
+            it = directories_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    lock.unlock();
+
+    config_.Execute(std::bind(&StorageFS::Purge, this, newName));
 
     return boost::filesystem::create_directory(oldDirectory);
 }
@@ -0,0 +1,633 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#if OT_STORAGE_PACK
+#include "opentxs/storage/drivers/StoragePack.hpp"
+
+#include "opentxs/storage/StorageConfig.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+// Each record starts with a magic number, the key size, the value size and a
+// checksum of the key and value, as little endian 32 bit integers.
+#define OT_STORAGE_PACK_MAGIC 0x4b50544f // "OTPK"
+#define OT_STORAGE_PACK_HEADER_SIZE 16
+// Buffered appends are written once there are this many bytes of them.
+#define OT_STORAGE_PACK_BUFFER_SIZE (4 * 1024 * 1024)
+
+namespace opentxs
+{
+
+namespace
+{
+
+void put_u32(std::string& output, const std::uint32_t value)
+{
+    for (int i = 0; i < 4; ++i) {
+        output.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+std::uint32_t get_u32(const char* input)
+{
+    const auto* bytes = reinterpret_cast<const unsigned char*>(input);
+
+    return static_cast<std::uint32_t>(bytes[0]) |
+           (static_cast<std::uint32_t>(bytes[1]) << 8) |
+           (static_cast<std::uint32_t>(bytes[2]) << 16) |
+           (static_cast<std::uint32_t>(bytes[3]) << 24);
+}
+
+// FNV-1a. Only meant to catch torn or damaged records.
+std::uint32_t checksum(
+    const char* key,
+    const std::size_t keySize,
+    const char* value,
+    const std::size_t valueSize)
+{
+    std::uint32_t output = 2166136261u;
+
+    for (std::size_t i = 0; i < keySize; ++i) {
+        output = (output ^ static_cast<unsigned char>(key[i])) * 16777619u;
+    }
+
+    for (std::size_t i = 0; i < valueSize; ++i) {
+        output = (output ^ static_cast<unsigned char>(value[i])) * 16777619u;
+    }
+
+    return output;
+}
+
+// prefix holds the header and the key of the record.
+bool verify(
+    const std::string& prefix,
+    const std::uint32_t keySize,
+    const std::string& value)
+{
+    if ((OT_STORAGE_PACK_HEADER_SIZE + keySize) != prefix.size()) {
+        return false;
+    }
+
+    return get_u32(prefix.data() + 12) ==
+           checksum(
+               prefix.data() + OT_STORAGE_PACK_HEADER_SIZE,
+               keySize,
+               value.data(),
+               value.size());
+}
+
+bool pread_all(
+    const int fd,
+    char* output,
+    const std::size_t size,
+    const std::uint64_t offset)
+{
+    std::size_t done = 0;
+
+    while (done < size) {
+        const auto bytes = ::pread(fd, output + done, size - done, offset + done);
+
+        if (0 < bytes) {
+            done += bytes;
+        } else if ((0 > bytes) && (EINTR == errno)) {
+            continue;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool pwrite_all(
+    const int fd,
+    const char* input,
+    const std::size_t size,
+    const std::uint64_t offset)
+{
+    std::size_t done = 0;
+
+    while (done < size) {
+        const auto bytes =
+            ::pwrite(fd, input + done, size - done, offset + done);
+
+        if (0 < bytes) {
+            done += bytes;
+        } else if ((0 > bytes) && (EINTR == errno)) {
+            continue;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool sync_path(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (-1 == fd) { return false; }
+
+    const bool output = (0 == ::fsync(fd));
+    ::close(fd);
+
+    return output;
+}
+
+} // namespace
+
+StoragePack::File::~File()
+{
+    if (-1 != fd_) { ::close(fd_); }
+}
+
+StoragePack::StoragePack(
+    const StorageConfig& config,
+    const Digest& hash,
+    const Random& random,
+    std::atomic<bool>& bucket)
+    : ot_super(config, hash, random, bucket)
+    , folder_(config.path_)
+{
+    Init_StoragePack();
+}
+
+bool StoragePack::Begin() const
+{
+    batch_lock_.lock();
+
+    std::lock_guard<std::mutex> lock(batch_state_lock_);
+
+    if (0 == batch_depth_++) { batch_owner_ = std::this_thread::get_id(); }
+
+    return true;
+}
+
+void StoragePack::Cleanup_StoragePack()
+{
+    for (auto& pack : packs_) {
+        std::unique_lock<std::mutex> lock(pack.lock_);
+
+        if (!pack.file_) { continue; }
+
+        Flush(pack, lock);
+        ::fsync(pack.file_->fd_);
+        pack.file_.reset();
+        pack.index_.clear();
+    }
+}
+
+void StoragePack::Cleanup() { Cleanup_StoragePack(); }
+
+bool StoragePack::Commit() const
+{
+    bool last = false;
+
+    {
+        std::lock_guard<std::mutex> lock(batch_state_lock_);
+
+        assert(0 < batch_depth_);
+
+        last = (0 == --batch_depth_);
+
+        if (last) { batch_owner_ = std::thread::id(); }
+    }
+
+    bool success = true;
+
+    if (last) {
+        for (auto& pack : packs_) {
+            std::unique_lock<std::mutex> lock(pack.lock_);
+
+            if (!Flush(pack, lock)) { success = false; }
+        }
+    }
+
+    batch_lock_.unlock();
+
+    return success;
+}
+
+bool StoragePack::EmptyBucket(const bool bucket) const
+{
+    // The live objects were copied to the other pack, which must be on disk
+    // before this one goes away.
+    if (!Sync(!bucket)) { return false; }
+
+    Pack& pack = GetPack(bucket);
+    std::lock_guard<std::mutex> lock(pack.lock_);
+    pack.file_.reset();
+
+    if ((0 != std::remove(pack.filename_.c_str())) && (ENOENT != errno)) {
+        std::cerr << __FUNCTION__ << ": Failed to delete " << pack.filename_
+                  << std::endl;
+    }
+
+    sync_path(folder_);
+
+    return Open(pack);
+}
+
+// The caller must hold pack.lock_.
+bool StoragePack::Flush(
+    Pack& pack,
+    const std::unique_lock<std::mutex>& lock) const
+{
+    assert(lock.owns_lock());
+
+    if (pack.buffer_.empty()) { return true; }
+
+    if (pack.file_ && pwrite_all(
+                          pack.file_->fd_,
+                          pack.buffer_.data(),
+                          pack.buffer_.size(),
+                          pack.size_)) {
+        pack.size_ += pack.buffer_.size();
+        pack.buffer_.clear();
+
+        return true;
+    }
+
+    std::cerr << __FUNCTION__ << ": Failed to write to " << pack.filename_
+              << std::endl;
+
+    // Forget the records which didn't make it, and any part of them which
+    // did.
+    for (auto it = pack.index_.begin(); it != pack.index_.end();) {
+        if (it->second.offset_ >= pack.size_) {
+            it = pack.index_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    pack.buffer_.clear();
+
+    if (pack.file_) {
+        if (0 != ::ftruncate(pack.file_->fd_, pack.size_)) {
+            std::cerr << __FUNCTION__ << ": Failed to truncate "
+                      << pack.filename_ << std::endl;
+        }
+    }
+
+    return false;
+}
+
+StoragePack::Pack& StoragePack::GetPack(const bool bucket) const
+{
+    return packs_[bucket ? 1 : 0];
+}
+
+bool StoragePack::InBatch() const
+{
+    std::lock_guard<std::mutex> lock(batch_state_lock_);
+
+    return (0 < batch_depth_) && (std::this_thread::get_id() == batch_owner_);
+}
+
+void StoragePack::Init_StoragePack()
+{
+    packs_[0].filename_ =
+        folder_ + "/" + config_.pack_primary_bucket_ + ".pack";
+    packs_[1].filename_ =
+        folder_ + "/" + config_.pack_secondary_bucket_ + ".pack";
+
+    for (auto& pack : packs_) {
+        std::lock_guard<std::mutex> lock(pack.lock_);
+
+        if (!Open(pack)) {
+            std::cerr << __FUNCTION__ << ": Failed to open " << pack.filename_
+                      << std::endl;
+            assert(false);
+        }
+    }
+}
+
+bool StoragePack::Load(
+    const std::string& key,
+    std::string& value,
+    const bool bucket) const
+{
+    Pack& pack = GetPack(bucket);
+    Location location;
+    std::shared_ptr<File> file;
+    std::string prefix;
+
+    {
+        std::lock_guard<std::mutex> lock(pack.lock_);
+        const auto it = pack.index_.find(key);
+
+        if (pack.index_.end() == it) { return false; }
+
+        location = it->second;
+
+        if (location.offset_ >= pack.size_) {
+            // Still buffered
+            const std::size_t start = location.offset_ - pack.size_;
+            const std::size_t prefixSize =
+                OT_STORAGE_PACK_HEADER_SIZE + location.key_size_;
+            prefix.assign(pack.buffer_, start, prefixSize);
+            value.assign(
+                pack.buffer_, start + prefixSize, location.value_size_);
+        } else {
+            file = pack.file_;
+        }
+    }
+
+    bool valid = false;
+
+    if (file) {
+        valid = Read(*file, location, prefix, value) &&
+                verify(prefix, location.key_size_, value);
+    } else {
+        valid = verify(prefix, location.key_size_, value);
+    }
+
+    if (valid) { return true; }
+
+    std::cerr << __FUNCTION__ << ": Damaged record for " << key << " in "
+              << pack.filename_ << std::endl;
+    value.clear();
+
+    // Forget the record, so that the next Store() of this key writes it
+    // again instead of finding it in the index.
+    std::lock_guard<std::mutex> lock(pack.lock_);
+    const auto it = pack.index_.find(key);
+
+    if ((pack.index_.end() != it) &&
+        (it->second.offset_ == location.offset_)) {
+        pack.index_.erase(it);
+    }
+
+    return false;
+}
+
+std::string StoragePack::LoadRoot() const
+{
+    const std::string filename = folder_ + "/" + config_.pack_root_file_;
+    const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (-1 == fd) { return ""; }
+
+    std::string output;
+    struct stat info;
+
+    if ((0 == ::fstat(fd, &info)) && (0 < info.st_size)) {
+        output.resize(info.st_size);
+
+        if (!pread_all(fd, &output[0], output.size(), 0)) { output.clear(); }
+    }
+
+    ::close(fd);
+
+    return output;
+}
+
+// Opens the pack file, and indexes the records in it. The caller must hold
+// pack.lock_.
+bool StoragePack::Open(Pack& pack) const
+{
+    pack.index_.clear();
+    pack.buffer_.clear();
+    pack.size_ = 0;
+    pack.file_.reset();
+    const int fd = ::open(
+        pack.filename_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+
+    if (-1 == fd) { return false; }
+
+    pack.file_ = std::make_shared<File>(fd);
+    struct stat info;
+
+    if (0 != ::fstat(fd, &info)) { return false; }
+
+    const std::uint64_t size = info.st_size;
+    std::uint64_t offset = 0;
+
+    if (0 < size) {
+        void* mapped =
+            ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (MAP_FAILED == mapped) { return false; }
+
+        const char* data = static_cast<const char*>(mapped);
+
+        while ((offset + OT_STORAGE_PACK_HEADER_SIZE) <= size) {
+            const char* header = data + offset;
+
+            if (OT_STORAGE_PACK_MAGIC != get_u32(header)) { break; }
+
+            Location location;
+            location.offset_ = offset;
+            location.key_size_ = get_u32(header + 4);
+            location.value_size_ = get_u32(header + 8);
+            const std::uint64_t end = offset + OT_STORAGE_PACK_HEADER_SIZE +
+                                      location.key_size_ +
+                                      location.value_size_;
+
+            if (end > size) { break; }
+
+            const char* key = header + OT_STORAGE_PACK_HEADER_SIZE;
+            const char* value = key + location.key_size_;
+
+            // The record was written completely but has been damaged since.
+            // Records after it are still good, so only this one is lost.
+            if (get_u32(header + 12) != checksum(
+                                            key,
+                                            location.key_size_,
+                                            value,
+                                            location.value_size_)) {
+                std::cerr << __FUNCTION__ << ": Skipping damaged record at "
+                          << offset << " in " << pack.filename_ << std::endl;
+                offset = end;
+
+                continue;
+            }
+
+            pack.index_[std::string(key, location.key_size_)] = location;
+            offset = end;
+        }
+
+        ::munmap(mapped, size);
+    }
+
+    // Whatever follows the last complete record was being written when the
+    // process stopped. Appends must not follow it, or they would be lost on
+    // the next scan.
+    if (offset < size) {
+        std::cerr << __FUNCTION__ << ": Discarding " << (size - offset)
+                  << " bytes at the end of " << pack.filename_ << std::endl;
+
+        if (0 != ::ftruncate(fd, offset)) { return false; }
+    }
+
+    pack.size_ = offset;
+
+    return true;
+}
+
+// Reads a record which has been written to the file. The caller doesn't need
+// to hold the pack lock.
+bool StoragePack::Read(
+    const File& file,
+    const Location& location,
+    std::string& prefix,
+    std::string& output) const
+{
+    const std::size_t prefixSize =
+        OT_STORAGE_PACK_HEADER_SIZE + location.key_size_;
+    prefix.resize(prefixSize);
+    output.resize(location.value_size_);
+
+    if (!pread_all(file.fd_, &prefix[0], prefixSize, location.offset_)) {
+        return false;
+    }
+
+    if ((0 < location.value_size_) &&
+        !pread_all(
+            file.fd_,
+            &output[0],
+            location.value_size_,
+            location.offset_ + prefixSize)) {
+        return false;
+    }
+
+    return true;
+}
+
+bool StoragePack::Store(
+    const std::string& key,
+    const std::string& value,
+    const bool bucket) const
+{
+    if ((0xFFFFFFFF <= key.size()) || (0xFFFFFFFF <= value.size())) {
+        return false;
+    }
+
+    Pack& pack = GetPack(bucket);
+    std::unique_lock<std::mutex> lock(pack.lock_);
+
+    // Objects are addressed by the hash of their contents, so the object is
+    // already here. (Load() drops records which turn out to be damaged.)
+    if (pack.index_.end() != pack.index_.find(key)) { return true; }
+
+    Location location;
+    location.offset_ = pack.size_ + pack.buffer_.size();
+    location.key_size_ = key.size();
+    location.value_size_ = value.size();
+
+    put_u32(pack.buffer_, OT_STORAGE_PACK_MAGIC);
+    put_u32(pack.buffer_, location.key_size_);
+    put_u32(pack.buffer_, location.value_size_);
+    put_u32(
+        pack.buffer_,
+        checksum(key.data(), key.size(), value.data(), value.size()));
+    pack.buffer_.append(key);
+    pack.buffer_.append(value);
+    pack.index_[key] = location;
+
+    if ((!InBatch()) ||
+        (OT_STORAGE_PACK_BUFFER_SIZE <= pack.buffer_.size())) {
+
+        return Flush(pack, lock);
+    }
+
+    return true;
+}
+
+bool StoragePack::StoreRoot(const std::string& hash) const
+{
+    // Every object the new root can refer to must be on disk first.
+    if (!Sync(false) || !Sync(true)) { return false; }
+
+    const std::string filename = folder_ + "/" + config_.pack_root_file_;
+    const std::string temp = filename + ".tmp";
+    const int fd = ::open(
+        temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+
+    if (-1 == fd) { return false; }
+
+    bool success = pwrite_all(fd, hash.data(), hash.size(), 0);
+
+    if (success) { success = (0 == ::fsync(fd)); }
+
+    if (0 != ::close(fd)) { success = false; }
+
+    if (success) {
+        success = (0 == std::rename(temp.c_str(), filename.c_str()));
+    }
+
+    if (!success) {
+        std::remove(temp.c_str());
+
+        return false;
+    }
+
+    return sync_path(folder_);
+}
+
+bool StoragePack::Sync(const bool bucket) const
+{
+    Pack& pack = GetPack(bucket);
+    std::unique_lock<std::mutex> lock(pack.lock_);
+
+    if (!Flush(pack, lock) || !pack.file_) { return false; }
+
+    return (0 == ::fsync(pack.file_->fd_));
+}
+
+StoragePack::~StoragePack() { Cleanup_StoragePack(); }
+
+} // namespace opentxs
+#endif
@@ -38,14 +38,20 @@
 #if OT_STORAGE_SQLITE
 #include "opentxs/storage/drivers/StorageSqlite3.hpp"
 
+#include "opentxs/core/util/Assert.hpp"
 #include "opentxs/storage/Storage.hpp"
 #include "opentxs/storage/StorageConfig.hpp"
 
 #include <assert.h>
 #include <sqlite3.h>
 #include <stdint.h>
+#include <initializer_list>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 
 namespace opentxs
 {
@@ -65,11 +71,25 @@ bool StorageSqlite3::Select(
     const std::string& tablename,
     std::string& value) const
 {
-    sqlite3_stmt* statement = nullptr;
-    const std::string query =
-        "select v from `" + tablename + "` where k=?1 LIMIT 0,1;";
+    std::unique_lock<std::mutex> batchLock(batch_lock_);
+    auto batch = batches_.find(std::this_thread::get_id());
+
+    if (batches_.end() != batch) {
+        auto it = batch->second.values_.find(std::make_pair(tablename, key));
+
+        if (batch->second.values_.end() != it) {
+            value = it->second;
+
+            return true;
+        }
+    }
+
+    batchLock.unlock();
+    std::lock_guard<std::mutex> lock(statement_lock_);
+    sqlite3_stmt* statement = GetStatement(tablename, false);
+
+    if (nullptr == statement) { return false; }
 
-    sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, 0);
     sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
     int result = sqlite3_step(statement);
     bool success = false;
@@ -80,7 +100,8 @@ bool StorageSqlite3::Select(
         value.assign(static_cast<const char*>(pResult), size);
         success = true;
     }
-    sqlite3_finalize(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
 
     return success;
 }
@@ -90,20 +111,151 @@ bool StorageSqlite3::Upsert(
     const std::string& tablename,
     const std::string& value) const
 {
-    sqlite3_stmt *statement;
-    const std::string query =
-        "insert or replace into `" + tablename +
-        "` (k, v) values (?1, ?2);";
+    std::unique_lock<std::mutex> batchLock(batch_lock_);
+    auto batch = batches_.find(std::this_thread::get_id());
+
+    if (batches_.end() != batch) {
+        batch->second.values_[std::make_pair(tablename, key)] = value;
+
+        return true;
+    }
+
+    batchLock.unlock();
+    std::lock_guard<std::mutex> lock(transaction_lock_);
+
+    return Write(key, tablename, value);
+}
+
+// The caller must hold transaction_lock_.
+bool StorageSqlite3::Write(
+    const std::string& key,
+    const std::string& tablename,
+    const std::string& value) const
+{
+    std::lock_guard<std::mutex> lock(statement_lock_);
+    sqlite3_stmt* statement = GetStatement(tablename, true);
+
+    if (nullptr == statement) { return false; }
 
-    sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, 0);
     sqlite3_bind_text(statement, 1, key.c_str(), key.size(), SQLITE_STATIC);
     sqlite3_bind_blob(statement, 2, value.c_str(), value.size(), SQLITE_STATIC);
     int result = sqlite3_step(statement);
-    sqlite3_finalize(statement);
+    sqlite3_reset(statement);
+    sqlite3_clear_bindings(statement);
 
     return (result == SQLITE_DONE);
 }
 
+// The caller must hold statement_lock_.
+sqlite3_stmt* StorageSqlite3::GetStatement(
+    const std::string& tablename,
+    const bool upsert) const
+{
+    auto& cache = upsert ? upsert_statements_ : select_statements_;
+    auto it = cache.find(tablename);
+
+    if (cache.end() != it) { return it->second; }
+
+    const std::string query =
+        upsert
+            ? "insert or replace into `" + tablename +
+                  "` (k, v) values (?1, ?2);"
+            : "select v from `" + tablename + "` where k=?1 LIMIT 0,1;";
+    sqlite3_stmt* statement = nullptr;
+
+    if (SQLITE_OK !=
+        sqlite3_prepare_v2(db_, query.c_str(), -1, &statement, nullptr)) {
+        std::cerr << __FUNCTION__ << ": Failed to prepare statement: "
+                  << sqlite3_errmsg(db_) << std::endl;
+        sqlite3_finalize(statement);
+
+        return nullptr;
+    }
+
+    cache[tablename] = statement;
+
+    return statement;
+}
+
+// The caller must hold statement_lock_.
+void StorageSqlite3::FinalizeStatements(const std::string& tablename) const
+{
+    for (auto cache : {&select_statements_, &upsert_statements_}) {
+        auto it = cache->find(tablename);
+
+        if (cache->end() != it) {
+            sqlite3_finalize(it->second);
+            cache->erase(it);
+        }
+    }
+}
+
+bool StorageSqlite3::Begin() const
+{
+    std::lock_guard<std::mutex> lock(batch_lock_);
+    ++batches_[std::this_thread::get_id()].depth_;
+
+    return true;
+}
+
+bool StorageSqlite3::Commit() const
+{
+    Batch batch;
+
+    {
+        std::lock_guard<std::mutex> lock(batch_lock_);
+        auto it = batches_.find(std::this_thread::get_id());
+
+        OT_ASSERT(batches_.end() != it);
+        OT_ASSERT(0 < it->second.depth_);
+
+        if (0 < --it->second.depth_) { return true; }
+
+        batch.values_.swap(it->second.values_);
+        batches_.erase(it);
+    }
+
+    if (batch.values_.empty()) { return true; }
+
+    std::lock_guard<std::mutex> lock(transaction_lock_);
+    const bool transaction = (SQLITE_OK ==
+        sqlite3_exec(db_, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr));
+
+    if (!transaction) {
+        std::cerr << __FUNCTION__ << ": Failed to begin transaction: "
+                  << sqlite3_errmsg(db_) << std::endl;
+        // The writes are committed one at a time instead.
+    }
+
+    bool success = true;
+
+    for (const auto& it : batch.values_) {
+        const auto& tablename = it.first.first;
+        const auto& key = it.first.second;
+
+        if (!Write(key, tablename, it.second)) {
+            success = false;
+
+            if (transaction) { break; }
+        }
+    }
+
+    if (!transaction) { return success; }
+
+    if (success) {
+        success = (SQLITE_OK == sqlite3_exec(
+            db_, "COMMIT TRANSACTION;", nullptr, nullptr, nullptr));
+    }
+
+    if (!success) {
+        std::cerr << __FUNCTION__ << ": Failed to commit transaction: "
+                  << sqlite3_errmsg(db_) << std::endl;
+        sqlite3_exec(db_, "ROLLBACK TRANSACTION;", nullptr, nullptr, nullptr);
+    }
+
+    return success;
+}
+
 bool StorageSqlite3::Create(const std::string& tablename) const
 {
     const std::string createTable = "create table if not exists ";
@@ -118,6 +270,26 @@ bool StorageSqlite3::Purge(const std::string& tablename) const
 {
     const std::string sql = "DROP TABLE `" + tablename + "`;";
 
+    {
+        // Values this thread wrote to the table before purging it are gone.
+        std::lock_guard<std::mutex> batchLock(batch_lock_);
+        auto batch = batches_.find(std::this_thread::get_id());
+
+        if (batches_.end() != batch) {
+            auto& values = batch->second.values_;
+            auto it = values.lower_bound(std::make_pair(tablename, ""));
+
+            while ((values.end() != it) && (tablename == it->first.first)) {
+                it = values.erase(it);
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> transactionLock(transaction_lock_);
+    std::unique_lock<std::mutex> lock(statement_lock_);
+    FinalizeStatements(tablename);
+    lock.unlock();
+
     if (SQLITE_OK ==
         sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr)) {
             return Create(tablename);
@@ -187,7 +359,16 @@ bool StorageSqlite3::EmptyBucket(const bool bucket) const
 
 void StorageSqlite3::Cleanup_StorageSqlite3()
 {
+    std::lock_guard<std::mutex> lock(statement_lock_);
+
+    for (auto cache : {&select_statements_, &upsert_statements_}) {
+        for (auto& it : *cache) { sqlite3_finalize(it.second); }
+
+        cache->clear();
+    }
+
     sqlite3_close(db_);
+    db_ = nullptr;
 }
 
 void StorageSqlite3::Cleanup()
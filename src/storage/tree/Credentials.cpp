@@ -164,7 +164,7 @@ bool Credentials::save(const std::unique_lock<std::mutex>& lock) const
         return false;
     }
 
-    return driver_.StoreProto(serialized, root_);
+    return driver_.StoreNode(serialized, root_, this);
 }
 
 proto::StorageCredentials Credentials::serialize() const
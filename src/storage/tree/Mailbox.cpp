@@ -105,7 +105,7 @@ bool Mailbox::save(const std::unique_lock<std::mutex>& lock) const
         return false;
     }
 
-    return driver_.StoreProto(serialized, root_);
+    return driver_.StoreNode(serialized, root_, this);
 }
 
 proto::StorageNymList Mailbox::serialize() const
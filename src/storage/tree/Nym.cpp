@@ -581,7 +581,7 @@ bool Nym::save(const std::unique_lock<std::mutex>& lock) const
         return false;
     }
 
-    return driver_.StoreProto(serialized, root_);
+    return driver_.StoreNode(serialized, root_, this);
 }
 
 void Nym::save(
@@ -165,7 +165,7 @@ bool Nyms::save(const std::unique_lock<std::mutex>& lock) const
         return false;
     }
 
-    return driver_.StoreProto(serialized, root_);
+    return driver_.StoreNode(serialized, root_, this);
 }
 
 void Nyms::save(
@@ -129,7 +129,7 @@ bool PeerReplies::save(const std::unique_lock<std::mutex>& lock) const
         return false;
     }
 
-    return driver_.StoreProto(serialized, root_);
+    return driver_.StoreNode(serialized, root_, this);
 }
 
 proto::StorageNymList PeerReplies::serialize() const
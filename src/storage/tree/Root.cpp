@@ -49,6 +49,8 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Proto.hpp"
 
+#include <memory>
+
 namespace opentxs
 {
 namespace storage
@@ -58,10 +60,14 @@ Root::Root(
     const std::string& hash,
     const std::int64_t interval,
     const EmptyBucket& empty,
+    const FlushStorage& flush,
+    const ExecuteCB& execute,
     std::atomic<bool>& bucket)
     : ot_super(storage, hash)
     , gc_interval_(interval)
     , empty_bucket_(empty)
+    , flush_(flush)
+    , execute_(execute)
     , current_bucket_(bucket)
 {
     if (check_hash(hash)) {
@@ -82,13 +88,13 @@ Root::Root(
 void Root::cleanup() const
 {
     Lock gclock(gc_lock_);
+    auto done = gc_done_;
+    gc_done_ = std::shared_future<void>();
+    gclock.unlock();
 
-    if (gc_thread_) {
-        if (gc_thread_->joinable()) {
-            gc_thread_->join();
-        }
-
-        gc_thread_.reset();
+    // collect_garbage() takes gc_lock_ before it finishes, so wait without it
+    if (done.valid()) {
+        done.wait();
     }
 }
 
@@ -108,9 +114,15 @@ void Root::collect_garbage() const
     }
 
     lock.unlock();
-    bool success = false;
 
-    if (!gc_root_.empty()) {
+    // With group commit the root on disk may still refer to objects in the
+    // old bucket which aren't part of gc_root_, or to objects which haven't
+    // been written at all. Write everything before any object is moved or
+    // deleted, so that the root on disk only refers to gc_root_ and to
+    // objects in the new bucket.
+    bool success = flush_() && !gc_root_.empty();
+
+    if (success) {
         const class Tree tree(driver_, gc_root_);
         success = tree.Migrate();
     }
@@ -170,7 +182,16 @@ bool Root::Migrate() const
 
         if (!running) {
             cleanup();
-            gc_thread_.reset(new std::thread(&Root::collect_garbage, this));
+            // If the task is discarded without running, the promise is
+            // destroyed with it and cleanup() does not wait forever.
+            auto done = std::make_shared<std::promise<void>>();
+            Lock gclock(gc_lock_);
+            gc_done_ = done->get_future().share();
+            gclock.unlock();
+            execute_([this, done]() -> void {
+                collect_garbage();
+                done->set_value();
+            });
 
             return true;
         }
@@ -196,7 +217,7 @@ bool Root::save(const std::unique_lock<std::mutex>& lock) const
 
     if (!proto::Check(serialized, version_, version_)) { return false; }
 
-    return driver_.StoreProto(serialized, root_);
+    return driver_.StoreNode(serialized, root_, this);
 }
 
 void Root::save(class Tree* tree, const Lock& lock)
@@ -0,0 +1,417 @@
+// Parses a signed notary reply, a getNymboxResponse carrying a 24 record
+// nymbox, once with Contract::ParseRawFile and once with the previous
+// implementation, copied below unchanged: each line went through a fixed buffer
+// with String::sgets and was appended to the signed content and signatures
+// through printf-style Concatenate calls. Both versions load the same XML
+// afterwards.
+//
+// The reply follows the notary's serialization: Tag writes the XML, the signed
+// nymbox ledger is compressed and armored into 72 column lines, and each
+// signature carries the Version, Comment and Meta headers.
+
+#include "opentxs/client/OTAPI_Wrap.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/core/crypto/CryptoHash.hpp"
+#include "opentxs/core/crypto/OTSignature.hpp"
+#include "opentxs/core/crypto/OTSignatureMetadata.hpp"
+#include "opentxs/core/util/Assert.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+
+const std::size_t PARSES = 2000;
+
+const char* REPLY =
+    "-----BEGIN SIGNED MESSAGE-----\n"
+    "Hash: SHA256\n"
+    "\n"
+    "<notaryMessage\n"
+    " dateSigned=\"1476277082\"\n"
+    " version=\"2.0\">\n"
+    "<getNymboxResponse\n"
+    " notaryID=\"otx5ai2fjSuUZVVxgYLxiY7oBdLdJjakJH2W\"\n"
+    " nymID=\"otwHe7FKGqXdKGzAwrwe5TcjeVT1vbnNbxjE\"\n"
+    " nymboxHash=\"ot2PJ5Cjet7TV2tBoWFdU1ciqR1qMCsXqea\"\n"
+    " requestNum=\"1841\"\n"
+    " success=\"true\">\n"
+    "eNqlmNuymkgUhu99CsvrSTZn6F3ZqVJEiAJBOXvXQoPg5iAHBZ9+IM4kkxmmaotcrCqBhv9b\n"
+    "/a9F258+dcdCEL+pU/2bqArLqSwsRWHXn/40kWB5fJ3q0pygmcnkC/S8rE4rGfkhKibTv35+\n"
+    "W77NsuoqIXa1Ec+OvxFv82txRbThxcgy8MshVQ9NLMwm0zSrYNHeBzQ0jIgg1mtzb1lN6MpN\n"
+    "5LLZwpf9dQxPa4mw+wF1osGiiuD7DnlZ4ZdvM6w/3SYPvLVqc/Q268Ycsqb7eUFFGWXp24z4\n"
+    "jM2+Tr7cL9yfP5n6sEJ6FKbIf5vhFMsQLIPheDfMj8r8HbYWfK+7p3E41guJ0h0Klvcrd2k/\n"
+    "zqACpR4ysvupAnkoyqs+mb1mPQmIGM8SEglUkAckUxkcuaJoatOu5oRNLohecwHTEnpVJ1St\n"
+    "k7cZIBjyJ0qUllVRJyit1KyKPDSbvnyIA7AjJV89lkf8So0kj/V1l7/u5+pO9WrIEtuCU8wS\n"
+    "/RhzrlFZdXIPqOheyuHc3yB67Xmo7Cavk42G6ZifdAXK39uHwHASjAST183VNni2Nba7eXR2\n"
+    "s+BanbI6Xu+3OZJujTLIBR7gAk9wEdh/jYfj9GjnUWJbZo7sIt9PuCBEsRc4Uh2tvQ0pKuCU\n"
+    "m8IgA4s967x7GsZI5u2UzpfHs21GDH/WzqlSwzQ11rhEMUtL011pWPKvYkm6CYLhR5WSODW2\n"
+    "rC+FjKvnpTNH0dVxLS/XadzWbm4btC0tOhc45CWC+LiX2GdqhBxd/PB0aa5ZG8sHR+Wjtjw1\n"
+    "pUdthOsiP9zq2sov20Ew8gGwZ4qE4saCeW5BsHumydOUBXAvz4kTHsyhewGHsFIJQ4sHwaiP\n"
+    "g3HYE2A0MdaKcrlkyjKV8JtjBrG6hkGLE/ppeUnlg31jLOswCEb3Yrv5fpejsvoe3K90eIDk\n"
+    "iD+6QPaB6gPdB6YPbB+4PoAuAKwP+AMJIn4mqLzf/FiKaHpkipgL3RbHWNJDdQv2aU2hkJBB\n"
+    "64DVITKj6uTkgyliHkCjnpl7hhgJJmzOOzqAtYCgeyyijYsnQcKgOJ+b1sLceuzgJ41gHwCj\n"
+    "nwBjCHwkGLtuzIimN66kUFvWDtulB+w5vj1mRbvYX7RikIv7f0//27V96H0Oep+D3ueg9zno\n"
+    "fQ4eyQ/3lKe7T9DIDLXCfqm66xTNVx65WazZdKGkih3AA6KilbpyBjP0wGKGe6ZPM+zYdqaC\n"
+    "pNXES8XVgLECqAnxkmqkyorWucKFRca2Q2Ak9nGwe8saCwbGNiGF4K91qiGFaRFDx6KXJKYD\n"
+    "aSGCe5I9n3lpkOuB9gqIJ7hYkvjP6pMC41efMdm1IeYoamXbNaXFio7sOrGQTdI8aE91ZA8j\n"
+    "0M8uPll6rGIiajc39WKa5aFVbCAkJqGagTRf1PVmuRRPw2tPwIxce7KjK8TSd4XJk6QT7CgJ\n"
+    "yo1XoQMlulJXIZaMo4YaNBL1v70R9L0RdL2RwrA+4H0g+kD2geoD3QemDw/0RvBcb7x3q1Gl\n"
+    "VpxEveHtUDjqbB5s9MBPQ9gUzWmpbE9VuR6WC0ZOJffDBL/XDkmD0bVjn/LtxsPTljiqUJca\n"
+    "nlYyoWnC1tc4h3SOEB/ST2JP/3MDODNSMg40+7bNiUVYurqi06Z00w7ILiPu2K23zr4+6MmP\n"
+    "e4nEyCeaG+DGckkLyuKOHq+rxyq+GJedZdqLIpJd81TbKnS4ZhCMewDsiQUWi7Fjv0aue20r\n"
+    "e8dR5v5iGKfUTH1RmWergr+Irhv65SAXeICLe4aLG1s7RnDI+TkFakvzg4LBz+VaI1Z4yfHX\n"
+    "iJVo2RgUi+ODpT/58vLbLujXyadfO6j3rdMfG6lzw9wJ901U677f+Dr9nqN0avx6UznFPgPu\n"
+    "Mzbhs6QvzNfpsary15eXrLvxH4rKz1kRThRUwddpd8yzLJuoZ71iTkcncaziZWvw7osdOCq5\n"
+    "Aqvde0GJSIu/8+97wC3iw+psaO9VbX5bw3VG0nVc8ErE3yDykxua8AJhYMWOCs3v9r48H8nj\n"
+    "wqVx4W1yBxPU5TDWn8v4H0M=\n"
+    "\n"
+    "</getNymboxResponse>\n"
+    "<ackReplies>\n"
+    "eNoztDA01DG0MDQCEcYgwgREmIIIMwBU5wWu\n"
+    "\n"
+    "</ackReplies>\n"
+    "\n"
+    "</notaryMessage>\n"
+    "-----BEGIN MESSAGE SIGNATURE-----\n"
+    "Version: Open Transactions 0.98.0\n"
+    "Comment: http://opentransactions.org\n"
+    "Meta:    Aooo\n"
+    "vDgCUDs3z92eQ2vyFQHCDEDhzT4tRTA30dzideuCpocEGhsDXiYlA2t8FqeB8vrVakBa54qR\n"
+    "dn29oJECEbKVlLljrdu2fXc=\n"
+    "\n"
+    "-----END MESSAGE SIGNATURE-----";
+
+class BenchmarkMessage : public Message
+{
+public:
+    bool Current(const String& raw)
+    {
+        Release();
+        m_strRawFile = raw;
+
+        return ParseRawFile();
+    }
+
+    bool Legacy(const String& raw)
+    {
+        Release();
+        m_strRawFile = raw;
+
+        char buffer1[2100];  // a bit bigger than 2048, just for safety reasons.
+        OTSignature* pSig = nullptr;
+
+        std::string line;
+
+        bool bSignatureMode = false;           // "currently in signature mode"
+        bool bContentMode = false;             // "currently in content mode"
+        bool bHaveEnteredContentMode = false;  // "have yet to enter content mode"
+
+        if (!m_strRawFile.GetLength()) {
+            otErr << "Empty m_strRawFile in Contract::ParseRawFile. Filename: "
+                  << m_strFoldername << Log::PathSeparator() << m_strFilename
+                  << ".\n";
+            return false;
+        }
+
+        // This is redundant (I thought) but the problem hasn't cleared up yet.. so
+        // trying to really nail it now.
+        std::string str_Trim(m_strRawFile.Get());
+        std::string str_Trim2 = String::trim(str_Trim);
+        m_strRawFile.Set(str_Trim2.c_str());
+
+        bool bIsEOF = false;
+        m_strRawFile.reset();
+
+        do {
+            // Just a fresh start at the top of the loop block... probably
+            // unnecessary.
+            memset(
+                buffer1, 0, 2100);  // todo remove this in optimization. (might be
+                                    // removed already...)
+
+            // the call returns true if there's more to read, and false if there
+            // isn't.
+            bIsEOF = !(m_strRawFile.sgets(buffer1, 2048));
+
+            line = buffer1;
+            const char* pBuf = line.c_str();
+
+            if (line.length() < 2) {
+                if (bSignatureMode) continue;
+            }
+
+            // if we're on a dashed line...
+            else if (line.at(0) == '-') {
+                if (bSignatureMode) {
+                    // we just reached the end of a signature
+                    //    otErr << "%s\n", pSig->Get());
+                    pSig = nullptr;
+                    bSignatureMode = false;
+                    continue;
+                }
+
+                // if I'm NOT in signature mode, and I just hit a dash, that means
+                // there
+                // are only four options:
+
+                // a. I have not yet even entered content mode, and just now
+                // entering it for the first time.
+                if (!bHaveEnteredContentMode) {
+                    if ((line.length() > 3) &&
+                        (line.find("BEGIN") != std::string::npos) &&
+                        line.at(1) == '-' && line.at(2) == '-' &&
+                        line.at(3) == '-') {
+                        //                    otErr << "\nProcessing contract...
+                        // \n";
+                        bHaveEnteredContentMode = true;
+                        bContentMode = true;
+                        continue;
+                    } else {
+                        continue;
+                    }
+
+                }
+
+                // b. I am now entering signature mode!
+                else if (
+                    line.length() > 3 &&
+                    line.find("SIGNATURE") != std::string::npos &&
+                    line.at(1) == '-' && line.at(2) == '-' && line.at(3) == '-') {
+                    // if (bContentMode)
+                    //    otLog3 << "Finished reading contract.\n\nReading a
+                    // signature at the bottom of the contract...\n");
+                    // else
+                    //    otLog3 << "Reading another signature...\n");
+
+                    bSignatureMode = true;
+                    bContentMode = false;
+
+                    pSig = new OTSignature;
+
+                    OT_ASSERT_MSG(
+                        nullptr != pSig,
+                        "Error allocating memory for "
+                        "Signature in "
+                        "Contract::ParseRawFile\n");
+
+                    m_listSignatures.push_back(pSig);
+
+                    continue;
+                }
+                // c. There is an error in the file!
+                else if (
+                    line.length() < 3 || line.at(1) != ' ' || line.at(2) != '-') {
+                    otOut
+                        << "Error in contract " << m_strFilename
+                        << ": a dash at the beginning of the "
+                           "line should be followed by a space and another dash:\n"
+                        << m_strRawFile << "\n";
+                    return false;
+                }
+                // d. It is an escaped dash, and therefore kosher, so I merely
+                // remove the escape and add it.
+                // I've decided not to remove the dashes but to keep them as part of
+                // the signed content.
+                // It's just much easier to deal with that way. The input code will
+                // insert the extra dashes.
+                // pBuf += 2;
+            }
+
+            // Else we're on a normal line, not a dashed line.
+            else {
+                if (bHaveEnteredContentMode) {
+                    if (bSignatureMode) {
+                        if (line.length() < 2) {
+                            otLog3 << "Skipping short line...\n";
+
+                            if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
+                                otOut << "Error in signature for contract "
+                                      << m_strFilename
+                                      << ": Unexpected EOF after short line.\n";
+                                return false;
+                            }
+
+                            continue;
+                        } else if (line.compare(0, 8, "Version:") == 0) {
+                            otLog3 << "Skipping version section...\n";
+
+                            if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
+                                otOut << "Error in signature for contract "
+                                      << m_strFilename
+                                      << ": Unexpected EOF after \"Version:\"\n";
+                                return false;
+                            }
+
+                            continue;
+                        } else if (line.compare(0, 8, "Comment:") == 0) {
+                            otLog3 << "Skipping comment section...\n";
+
+                            if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
+                                otOut << "Error in signature for contract "
+                                      << m_strFilename
+                                      << ": Unexpected EOF after \"Comment:\"\n";
+                                return false;
+                            }
+
+                            continue;
+                        }
+                        if (line.compare(0, 5, "Meta:") == 0) {
+                            otLog3 << "Collecting signature metadata...\n";
+
+                            if (line.length() != 13)  // "Meta:    knms" (It will
+                                                      // always be exactly 13
+                            // characters int64_t.) knms represents the
+                            // first characters of the Key type, NymID,
+                            // Master Cred ID, and ChildCred ID. Key type is
+                            // (A|E|S) and the others are base62.
+                            {
+                                otOut << "Error in signature for contract "
+                                      << m_strFilename << ": Unexpected length for "
+                                                          "\"Meta:\" comment.\n";
+                                return false;
+                            }
+
+                            OT_ASSERT(nullptr != pSig);
+                            if (false ==
+                                pSig->getMetaData().SetMetadata(
+                                    line.at(9),
+                                    line.at(10),
+                                    line.at(11),
+                                    line.at(12)))  // "knms" from "Meta:    knms"
+                            {
+                                otOut << "Error in signature for contract "
+                                      << m_strFilename
+                                      << ": Unexpected metadata in the \"Meta:\" "
+                                         "comment.\nLine: "
+                                      << line << "\n";
+                                return false;
+                            }
+
+                            if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
+                                otOut << "Error in signature for contract "
+                                      << m_strFilename
+                                      << ": Unexpected EOF after \"Meta:\"\n";
+                                return false;
+                            }
+
+                            continue;
+                        }
+                    }
+                    if (bContentMode) {
+                        if (line.compare(0, 6, "Hash: ") == 0) {
+                            otLog3 << "Collecting message digest algorithm from "
+                                      "contract header...\n";
+
+                            std::string strTemp = line.substr(6);
+                            String strHashType = strTemp.c_str();
+                            strHashType.ConvertToUpperCase();
+
+                            m_strSigHashType =
+                                CryptoHash::StringToHashType(strHashType);
+
+                            if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
+                                otOut << "Error in contract " << m_strFilename
+                                      << ": Unexpected EOF after \"Hash:\"\n";
+                                return false;
+                            }
+
+                            continue;
+                        }
+                    }
+                }
+            }
+
+            if (bSignatureMode) {
+                OT_ASSERT_MSG(
+                    nullptr != pSig,
+                    "Error: Null Signature pointer WHILE "
+                    "processing signature, in "
+                    "Contract::ParseRawFile");
+
+                pSig->Concatenate("%s\n", pBuf);
+            } else if (bContentMode)
+                m_xmlUnsigned.Concatenate("%s\n", pBuf);
+        } while (!bIsEOF);
+
+        if (!bHaveEnteredContentMode) {
+            otErr << "Error in Contract::ParseRawFile: Found no BEGIN for signed "
+                     "content.\n";
+            return false;
+        } else if (bContentMode) {
+            otErr << "Error in Contract::ParseRawFile: EOF while reading xml "
+                     "content.\n";
+            return false;
+        } else if (bSignatureMode) {
+            otErr << "Error in Contract::ParseRawFile: EOF while reading "
+                     "signature.\n";
+            return false;
+        } else if (!LoadContractXML()) {
+            otErr << "Error in Contract::ParseRawFile: unable to load XML "
+                     "portion of contract into memory.\n";
+            return false;
+        } else if (proto::HASHTYPE_ERROR == m_strSigHashType) {
+            otErr << __FUNCTION__ << ": Failed to set hash type," << std::endl;
+
+            return false;
+        } else {
+
+            return true;
+        }
+    }
+};
+
+template <typename Parse>
+double run(const String& raw, Parse parse)
+{
+    BenchmarkMessage message;
+    std::size_t parsed = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < PARSES; ++i) {
+        if (parse(message, raw)) { ++parsed; }
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+
+    if (parsed != PARSES) { std::cerr << "parse failure" << std::endl; }
+
+    return std::chrono::duration<double, std::micro>(end - start).count() /
+           PARSES;
+}
+
+} // namespace
+
+int main()
+{
+    // Signature metadata is validated through the crypto engine.
+    OTAPI_Wrap::AppInit();
+
+    const String raw(REPLY);
+
+    const double legacy =
+        run(raw, [](BenchmarkMessage& message, const String& input) {
+            return message.Legacy(input);
+        });
+    const double current =
+        run(raw, [](BenchmarkMessage& message, const String& input) {
+            return message.Current(input);
+        });
+
+    std::cout << "Signed getNymboxResponse (" << raw.GetLength()
+              << " bytes, " << PARSES << " parses), us per parse:" << std::endl
+              << "  sgets line loop:          " << legacy << std::endl
+              << "  ParseRawFile:             " << current << std::endl;
+
+    OTAPI_Wrap::AppCleanup();
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+// Compares Identifier map lookups using the binary comparison operators
+// against the previous behaviour, which encoded both identifiers to strings
+// on every comparison. The legacy comparator below hex encodes instead of
+// base58 encoding, so it understates the old cost.
+
+#include "opentxs/core/Identifier.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+
+const std::size_t IDENTIFIERS = 100000;
+const std::size_t LOOKUPS = 1000000;
+const std::size_t ID_SIZE = 20;
+
+std::string encode(const Identifier& id)
+{
+    static const char* digits = "0123456789abcdef";
+    std::string output;
+    output.reserve(2 * id.GetSize());
+    const auto* it = static_cast<const std::uint8_t*>(id.GetPointer());
+
+    for (std::size_t i = 0; i < id.GetSize(); ++i, ++it) {
+        output.push_back(digits[*it >> 4]);
+        output.push_back(digits[*it & 0x0f]);
+    }
+
+    return output;
+}
+
+struct LegacyCompare {
+    bool operator()(const Identifier& lhs, const Identifier& rhs) const
+    {
+        return encode(lhs) < encode(rhs);
+    }
+};
+
+template <typename Map>
+double run(const std::vector<Identifier>& ids, const std::vector<std::size_t>& order)
+{
+    Map map;
+
+    for (std::size_t i = 0; i < ids.size(); ++i) { map[ids[i]] = i; }
+
+    std::size_t found = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto& index : order) {
+        if (map.end() != map.find(ids[index])) { ++found; }
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+
+    if (found != order.size()) { std::cerr << "lookup failure" << std::endl; }
+
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           order.size();
+}
+
+} // namespace
+
+int main()
+{
+    std::mt19937_64 random(42);
+    std::vector<Identifier> ids(IDENTIFIERS);
+
+    for (auto& id : ids) {
+        std::uint8_t bytes[ID_SIZE];
+
+        for (auto& byte : bytes) {
+            byte = static_cast<std::uint8_t>(random());
+        }
+
+        id.Assign(bytes, ID_SIZE);
+    }
+
+    std::vector<std::size_t> order(LOOKUPS);
+
+    for (auto& index : order) { index = random() % IDENTIFIERS; }
+
+    const double legacy =
+        run<std::map<Identifier, std::size_t, LegacyCompare>>(ids, order);
+    const double binary = run<std::map<Identifier, std::size_t>>(ids, order);
+    const double hashed =
+        run<std::unordered_map<Identifier, std::size_t>>(ids, order);
+
+    std::cout << "Identifier lookups (" << IDENTIFIERS << " keys, " << LOOKUPS
+              << " lookups), ns per lookup:" << std::endl
+              << "  std::map, string comparison:  " << legacy << std::endl
+              << "  std::map, binary comparison:  " << binary << std::endl
+              << "  std::unordered_map:           " << hashed << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+// Replays synthetic order flow through a simple price-time matching loop, once
+// on OTOrderBook and once on the multimap layout OTMarket used before, which
+// searched a whole side of the market to remove an offer. The flow is limit
+// orders around a drifting mid price, with a share of them cancelled later.
+
+#include "opentxs/core/trade/OTOffer.hpp"
+#include "opentxs/core/trade/OTOrderBook.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+
+const std::size_t ORDERS = 200000;
+const int64_t SPREAD = 50;          // Prices are mid +/- this many ticks.
+const int64_t MAX_AMOUNT = 100;
+const std::uint32_t CANCEL_PERCENT = 30;
+
+struct Order {
+    bool cancel{false};
+    bool selling{false};
+    int64_t price{0};
+    int64_t amount{0};
+    int64_t transaction{0}; // For a cancel, the order to cancel.
+};
+
+class LegacySide
+{
+public:
+    explicit LegacySide(bool bids)
+        : bids_(bids)
+    {
+    }
+
+    bool Insert(OTOffer& offer)
+    {
+        const int64_t price = offer.GetPriceLimit();
+
+        if (bids_) {
+            map_.insert(map_.lower_bound(price), std::make_pair(price, &offer));
+        }
+        else {
+            map_.insert(map_.upper_bound(price), std::make_pair(price, &offer));
+        }
+
+        return true;
+    }
+
+    OTOffer* Erase(const int64_t& transaction)
+    {
+        for (auto it = map_.begin(); it != map_.end(); ++it) {
+            if (transaction == it->second->GetTransactionNum()) {
+                OTOffer* output = it->second;
+                map_.erase(it);
+
+                return output;
+            }
+        }
+
+        return nullptr;
+    }
+
+    OTOffer* Best() const
+    {
+        if (map_.empty()) { return nullptr; }
+
+        return bids_ ? map_.rbegin()->second : map_.begin()->second;
+    }
+
+private:
+    bool bids_{false};
+    std::multimap<int64_t, OTOffer*> map_;
+};
+
+std::vector<Order> make_flow()
+{
+    std::mt19937_64 random(42);
+    std::vector<Order> output(ORDERS);
+    int64_t mid = 10000;
+
+    for (std::size_t i = 0; i < ORDERS; ++i) {
+        auto& order = output[i];
+        order.transaction = static_cast<int64_t>(i + 1);
+
+        if ((0 < i) && ((random() % 100) < CANCEL_PERCENT)) {
+            order.cancel = true;
+            order.transaction = static_cast<int64_t>(1 + (random() % i));
+
+            continue;
+        }
+
+        mid += static_cast<int64_t>(random() % 3) - 1;
+        order.selling = (0 == random() % 2);
+        order.price = mid + static_cast<int64_t>(random() % (2 * SPREAD + 1)) -
+                      SPREAD;
+        order.amount = 1 + static_cast<int64_t>(random() % MAX_AMOUNT);
+    }
+
+    return output;
+}
+
+template <typename Side>
+double run(const std::vector<Order>& flow, std::size_t& trades)
+{
+    std::vector<std::unique_ptr<OTOffer>> offers(flow.size());
+
+    for (std::size_t i = 0; i < flow.size(); ++i) {
+        const auto& order = flow[i];
+
+        if (order.cancel) { continue; }
+
+        offers[i].reset(new OTOffer);
+        offers[i]->MakeOffer(order.selling, order.price, order.amount, 1,
+                             order.transaction);
+    }
+
+    Side bids(true);
+    Side asks(false);
+    trades = 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < flow.size(); ++i) {
+        const auto& order = flow[i];
+
+        if (order.cancel) {
+            if (nullptr == bids.Erase(order.transaction)) {
+                asks.Erase(order.transaction);
+            }
+
+            continue;
+        }
+
+        OTOffer& offer = *offers[i];
+        Side& same = order.selling ? asks : bids;
+        Side& other = order.selling ? bids : asks;
+
+        while (0 < offer.GetAmountAvailable()) {
+            OTOffer* best = other.Best();
+
+            if (nullptr == best) { break; }
+
+            const bool crosses = order.selling
+                                     ? (best->GetPriceLimit() >= order.price)
+                                     : (best->GetPriceLimit() <= order.price);
+
+            if (!crosses) { break; }
+
+            const int64_t amount = std::min(offer.GetAmountAvailable(),
+                                            best->GetAmountAvailable());
+            offer.IncrementFinishedSoFar(amount);
+            best->IncrementFinishedSoFar(amount);
+            ++trades;
+
+            if (0 == best->GetAmountAvailable()) {
+                other.Erase(best->GetTransactionNum());
+            }
+        }
+
+        if (0 < offer.GetAmountAvailable()) { same.Insert(offer); }
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+
+    return flow.size() /
+           std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main()
+{
+    const auto flow = make_flow();
+    std::size_t legacyTrades = 0;
+    std::size_t bookTrades = 0;
+
+    const double legacy = run<LegacySide>(flow, legacyTrades);
+    const double book = run<OTOrderBook>(flow, bookTrades);
+
+    if (legacyTrades != bookTrades) {
+        std::cerr << "trade count mismatch" << std::endl;
+    }
+
+    std::cout << "Order matching (" << ORDERS << " orders, " << CANCEL_PERCENT
+              << "% cancels, " << bookTrades << " trades), orders per second:"
+              << std::endl
+              << "  std::multimap, searched removal:  " << legacy << std::endl
+              << "  OTOrderBook:                      " << book << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <cstdlib>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "opentxs/core/AccountRegistry.hpp"
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/core/util/OTDataFolder.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
+#include "opentxs/core/util/OTPaths.hpp"
+
+using namespace opentxs;
+
+namespace
+{
+
+const std::string UNIT_A = "otuXsBfE3jNjRxC8JzxGTv1MBSVJv2YdsCxM";
+const std::string UNIT_B = "otu5ai2fjSuUZVVxgYLxiY7oBdLdJjakJH2W";
+
+// Keeps the data folder, and the files OTDB writes into it, out of the
+// user's home directory.
+class Test_AccountRegistry : public ::testing::Test
+{
+public:
+    static std::string home_;
+
+    static void SetUpTestCase()
+    {
+        char folder[] = "/tmp/ot_account_registry_XXXXXX";
+
+        ASSERT_NE(nullptr, ::mkdtemp(folder));
+        home_ = folder;
+        OTPaths::SetHomeFolder(String(folder));
+        ASSERT_TRUE(OTDataFolder::Init("server"));
+        ASSERT_TRUE(OTDB::InitDefaultStorage(
+            OTDB_DEFAULT_STORAGE, OTDB_DEFAULT_PACKER));
+    }
+
+    static void TearDownTestCase()
+    {
+        if (!home_.empty()) {
+            std::system(("rm -rf " + home_).c_str());
+        }
+    }
+
+    static std::vector<std::string> Accounts(const std::size_t count)
+    {
+        std::vector<std::string> output;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            output.push_back("otAccount" + std::to_string(i));
+        }
+
+        return output;
+    }
+
+    static std::set<std::string> Visited(const AccountRegistry& registry)
+    {
+        std::set<std::string> output;
+
+        EXPECT_TRUE(registry.Visit([&](const std::vector<std::string>& ids) {
+            output.insert(ids.begin(), ids.end());
+
+            return true;
+        }));
+
+        return output;
+    }
+};
+
+std::string Test_AccountRegistry::home_;
+
+}  // namespace
+
+TEST_F(Test_AccountRegistry, add_and_remove)
+{
+    const std::string& unit = UNIT_A;
+    AccountRegistry registry(unit);
+
+    ASSERT_EQ(0, registry.Count());
+    ASSERT_TRUE(registry.Add("otAccountA"));
+    ASSERT_TRUE(registry.Add("otAccountA"));
+    ASSERT_TRUE(registry.Add("otAccountB"));
+    ASSERT_EQ(2, registry.Count());
+    ASSERT_TRUE(registry.Remove("otAccountA"));
+    ASSERT_TRUE(registry.Remove("otAccountA"));
+
+    const AccountRegistry reloaded(unit);
+
+    ASSERT_EQ(1, reloaded.Count());
+    ASSERT_EQ(std::set<std::string>{"otAccountB"}, Visited(reloaded));
+}
+
+TEST_F(Test_AccountRegistry, migrate_legacy_file)
+{
+    const std::string& unit = UNIT_B;
+    const auto accounts = Accounts(1000);
+
+    {
+        std::unique_ptr<OTDB::Storable> storable(
+            OTDB::CreateObject(OTDB::STORED_OBJ_STRING_MAP));
+        auto legacy = dynamic_cast<OTDB::StringMap*>(storable.get());
+
+        ASSERT_NE(nullptr, legacy);
+
+        for (const auto& id : accounts) { legacy->the_map[id] = unit; }
+
+        ASSERT_TRUE(OTDB::StoreObject(
+            *legacy, OTFolders::Contract().Get(), unit + ".a"));
+    }
+
+    const AccountRegistry registry(unit);
+
+    ASSERT_EQ(accounts.size(), registry.Count());
+    ASSERT_FALSE(OTDB::Exists(OTFolders::Contract().Get(), unit + ".a"));
+    ASSERT_TRUE(OTDB::Exists(OTFolders::Contract().Get(), unit + ".a.idx"));
+    ASSERT_EQ(
+        std::set<std::string>(accounts.begin(), accounts.end()),
+        Visited(registry));
+
+    const AccountRegistry reloaded(unit);
+
+    ASSERT_EQ(accounts.size(), reloaded.Count());
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "gtest/gtest-message.h"
+#include "gtest/gtest-test-part.h"
+#include "opentxs/core/Identifier.hpp"
+
+using namespace opentxs;
+
+namespace
+{
+
+Identifier make_id(const std::string& bytes)
+{
+    Identifier output;
+    output.Assign(bytes.data(), static_cast<uint32_t>(bytes.size()));
+
+    return output;
+}
+
+} // namespace
+
+TEST(Identifier, default_is_empty)
+{
+    Identifier one;
+    Identifier other;
+    ASSERT_TRUE(one.empty());
+    ASSERT_TRUE(one == other);
+    ASSERT_FALSE(one < other);
+}
+
+TEST(Identifier, compare_equal_to_other_same)
+{
+    const auto one = make_id("abcdefghijklmnopqrst");
+    const auto other = make_id("abcdefghijklmnopqrst");
+    ASSERT_TRUE(one == other);
+    ASSERT_FALSE(one != other);
+    ASSERT_TRUE(one <= other);
+    ASSERT_TRUE(one >= other);
+    ASSERT_EQ(one.Hash(), other.Hash());
+}
+
+TEST(Identifier, compare_ordering)
+{
+    const auto one = make_id("abcdefghijklmnopqrst");
+    const auto other = make_id("abcdefghijklmnopqrsu");
+    const auto longer = make_id("abcdefghijklmnopqrstu");
+    const Identifier empty;
+    ASSERT_TRUE(one != other);
+    ASSERT_TRUE(one < other);
+    ASSERT_TRUE(other > one);
+    ASSERT_TRUE(one < longer);
+    ASSERT_TRUE(empty < one);
+    ASSERT_FALSE(one < empty);
+}
+
+TEST(Identifier, assignment_copies_type)
+{
+    const auto one = make_id("abcdefghijklmnopqrst");
+    Identifier other;
+    other = one;
+    ASSERT_TRUE(one.Type() == other.Type());
+    ASSERT_TRUE(one == other);
+}
+
+TEST(Identifier, unordered_map_lookup)
+{
+    std::unordered_map<Identifier, int> map;
+    map[make_id("abcdefghijklmnopqrst")] = 1;
+    map[make_id("zzzzzzzzzzzzzzzzzzzz")] = 2;
+    ASSERT_EQ(2u, map.size());
+    ASSERT_EQ(1, map.at(make_id("abcdefghijklmnopqrst")));
+    ASSERT_EQ(2, map.at(make_id("zzzzzzzzzzzzzzzzzzzz")));
+    ASSERT_TRUE(map.end() == map.find(make_id("aaaaaaaaaaaaaaaaaaaa")));
+}
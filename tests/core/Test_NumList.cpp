@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <set>
+#include <string>
+
+#include "opentxs/core/NumList.hpp"
+#include "opentxs/core/NumberSet.hpp"
+#include "opentxs/core/String.hpp"
+
+using namespace opentxs;
+
+TEST(NumList, plain_output_round_trip)
+{
+    NumList numbers(std::set<int64_t>{1, 2, 3, 5, 9});
+    String output;
+
+    ASSERT_TRUE(numbers.Output(output));
+    ASSERT_STREQ("1,2,3,5,9", output.Get());
+
+    NumList parsed(output);
+    ASSERT_TRUE(parsed.Verify(numbers));
+}
+
+TEST(NumList, range_output_round_trip)
+{
+    NumList numbers(std::set<int64_t>{0, 1, 2, 5, 6, 9, 10, 11, 12});
+    String output;
+
+    ASSERT_TRUE(numbers.Output(output, true));
+    ASSERT_STREQ("0-2,5,6,9-12", output.Get());
+
+    NumList parsed(output);
+    ASSERT_TRUE(parsed.Verify(numbers));
+    ASSERT_EQ(9, parsed.Count());
+}
+
+TEST(NumList, empty_output)
+{
+    NumList numbers;
+    String output;
+
+    ASSERT_FALSE(numbers.Output(output, true));
+    ASSERT_FALSE(output.Exists());
+}
+
+TEST(NumList, parse_rejects_invalid_ranges)
+{
+    NumList numbers;
+
+    ASSERT_FALSE(numbers.Add(std::string("9-5")));
+    ASSERT_FALSE(numbers.Add(std::string("5-")));
+    ASSERT_FALSE(numbers.Add(std::string("5-6-7")));
+    ASSERT_EQ(0, numbers.Count());
+}
+
+TEST(NumList, parse_rejects_overflow)
+{
+    NumList numbers;
+
+    ASSERT_FALSE(numbers.Add(std::string("0-9223372036854775807")));
+    ASSERT_FALSE(numbers.Add(std::string("9223372036854775808")));
+    ASSERT_FALSE(numbers.Add(std::string("1-99999999999999999999")));
+    ASSERT_EQ(0, numbers.Count());
+
+    ASSERT_TRUE(numbers.Add(std::string("9223372036854775807")));
+    ASSERT_EQ(1, numbers.Count());
+}
+
+TEST(NumList, parse_limits_range_total)
+{
+    NumList numbers;
+
+    ASSERT_TRUE(numbers.Add(std::string("1-100000")));
+    ASSERT_EQ(100000, numbers.Count());
+
+    NumList tooMany;
+
+    ASSERT_FALSE(tooMany.Add(std::string("1-100001")));
+    ASSERT_FALSE(tooMany.Add(std::string("1-50000,100001-150001")));
+}
+
+TEST(NumList, range_output_stays_within_limit)
+{
+    NumberSet set;
+    set.insert(1, 150000);
+    set.insert(200000, 200002);
+    const NumList numbers(set);
+    String output;
+
+    ASSERT_TRUE(numbers.Output(output, true));
+
+    const std::string written(output.Get());
+
+    ASSERT_EQ(0, written.find("1-100000,100001,100002,"));
+    ASSERT_EQ(std::string::npos, written.find("200000-"));
+
+    NumList parsed(output);
+    ASSERT_TRUE(parsed.Verify(numbers));
+    ASSERT_EQ(150003, parsed.Count());
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <set>
+
+#include "opentxs/core/NumberSet.hpp"
+
+using namespace opentxs;
+
+TEST(NumberSet, default_accessors)
+{
+    NumberSet numbers;
+    ASSERT_TRUE(numbers.empty());
+    ASSERT_EQ(0, numbers.size());
+    ASSERT_TRUE(numbers.begin() == numbers.end());
+}
+
+TEST(NumberSet, insert_merges_adjacent_values)
+{
+    NumberSet numbers;
+    ASSERT_TRUE(numbers.insert(3));
+    ASSERT_TRUE(numbers.insert(1));
+    ASSERT_TRUE(numbers.insert(2));
+    ASSERT_FALSE(numbers.insert(2));
+    ASSERT_EQ(3, numbers.size());
+    ASSERT_EQ(1, numbers.ranges().size());
+    ASSERT_EQ(1, numbers.front());
+}
+
+TEST(NumberSet, insert_range_counts_new_values)
+{
+    NumberSet numbers;
+    ASSERT_EQ(10, numbers.insert(1, 10));
+    ASSERT_EQ(5, numbers.insert(20, 24));
+    ASSERT_EQ(10, numbers.insert(5, 25));
+    ASSERT_EQ(25, numbers.size());
+    ASSERT_EQ(1, numbers.ranges().size());
+    ASSERT_EQ(0, numbers.insert(2, 3));
+}
+
+TEST(NumberSet, erase_splits_range)
+{
+    NumberSet numbers;
+    numbers.insert(1, 10);
+    ASSERT_EQ(1, numbers.erase(5));
+    ASSERT_EQ(0, numbers.erase(5));
+    ASSERT_EQ(0, numbers.erase(11));
+    ASSERT_EQ(9, numbers.size());
+    ASSERT_EQ(2, numbers.ranges().size());
+    ASSERT_EQ(0, numbers.count(5));
+    ASSERT_EQ(1, numbers.count(4));
+    ASSERT_EQ(1, numbers.count(6));
+    ASSERT_EQ(1, numbers.erase(1));
+    ASSERT_EQ(2, numbers.front());
+}
+
+TEST(NumberSet, iterates_in_order)
+{
+    const std::set<NumberSet::value_type> input{9, 1, 2, 3, 7, 8, 15};
+    const NumberSet numbers(input);
+    const std::set<NumberSet::value_type> output(
+        numbers.begin(), numbers.end());
+    ASSERT_EQ(input, output);
+    ASSERT_EQ(3, numbers.ranges().size());
+}
+
+TEST(NumberSet, difference)
+{
+    NumberSet lhs;
+    lhs.insert(1, 20);
+    NumberSet rhs;
+    rhs.insert(5, 7);
+    rhs.insert(15, 30);
+
+    NumberSet expected;
+    expected.insert(1, 4);
+    expected.insert(8, 14);
+
+    ASSERT_TRUE(expected == lhs.difference(rhs));
+    ASSERT_TRUE(rhs.difference(rhs).empty());
+    ASSERT_EQ(10, rhs.difference(lhs).size());
+}
+
+TEST(NumberSet, includes_and_intersects)
+{
+    NumberSet lhs;
+    lhs.insert(1, 20);
+    NumberSet inside;
+    inside.insert(2, 4);
+    inside.insert(10);
+    NumberSet outside;
+    outside.insert(21, 30);
+
+    ASSERT_TRUE(lhs.includes(inside));
+    ASSERT_FALSE(inside.includes(lhs));
+    ASSERT_FALSE(lhs.includes(outside));
+    ASSERT_TRUE(lhs.intersects(inside));
+    ASSERT_FALSE(lhs.intersects(outside));
+
+    outside.insert(20);
+    ASSERT_TRUE(lhs.intersects(outside));
+    ASSERT_FALSE(lhs.includes(outside));
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <string>
+#include <utility>
 
 #include "gtest/gtest-message.h"
 #include "gtest/gtest-test-part.h"
@@ -62,3 +63,64 @@ TEST(OTData, compare_not_equal_to_other_different)
     OTData other("zzzz", 4);
     ASSERT_TRUE(one != other);
 }
+
+TEST(OTData, move_leaves_source_empty)
+{
+    OTData one("abcd", 4);
+    OTData other(std::move(one));
+    ASSERT_TRUE(one.empty());
+    ASSERT_TRUE(one.GetPointer() == 0);
+    ASSERT_TRUE(other == OTData("abcd", 4));
+}
+
+TEST(OTData, swap_inline_with_allocated)
+{
+    const std::string small(4, 'a');
+    const std::string large(100, 'b');
+    OTData one(small.data(), small.size());
+    OTData other(large.data(), large.size());
+    one.swap(other);
+    ASSERT_TRUE(one == OTData(large.data(), large.size()));
+    ASSERT_TRUE(other == OTData(small.data(), small.size()));
+    ASSERT_TRUE(other.GetPointer() != one.GetPointer());
+}
+
+TEST(OTData, concatenate_past_inline_size)
+{
+    OTData data;
+    std::string expected;
+
+    for (int i = 0; i < 20; ++i) {
+        const std::string chunk(5, static_cast<char>('a' + i));
+        data.Concatenate(chunk.data(), chunk.size());
+        expected += chunk;
+        ASSERT_TRUE(data == OTData(expected.data(), expected.size()));
+    }
+}
+
+TEST(OTData, secure_is_copied_and_kept)
+{
+    OTData secret("abcd", 4);
+    ASSERT_TRUE(secret.IsSecure());
+
+    OTData copy(secret);
+    ASSERT_TRUE(copy.IsSecure());
+
+    secret = OTData("zzzz", 4);
+    ASSERT_TRUE(secret.IsSecure());
+    secret.Release();
+    ASSERT_TRUE(secret.IsSecure());
+}
+
+TEST(OTData, plain_is_not_copied)
+{
+    OTData plain("abcd", 4);
+    plain.SetSecure(false);
+    ASSERT_FALSE(plain.IsSecure());
+
+    OTData copy(plain);
+    ASSERT_TRUE(copy.IsSecure());
+
+    plain = OTData("zzzz", 4);
+    ASSERT_TRUE(plain.IsSecure());
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest-message.h"
+#include "gtest/gtest-test-part.h"
+#include "opentxs/core/trade/OTOffer.hpp"
+#include "opentxs/core/trade/OTOrderBook.hpp"
+
+using namespace opentxs;
+
+namespace
+{
+
+std::unique_ptr<OTOffer> make_offer(bool selling, int64_t price,
+                                    int64_t transaction)
+{
+    std::unique_ptr<OTOffer> output(new OTOffer);
+    output->MakeOffer(selling, price, 100, 1, transaction);
+
+    return output;
+}
+
+std::vector<int64_t> transactions(const OTOrderBook& book)
+{
+    std::vector<int64_t> output;
+
+    for (auto& offer : book) { output.push_back(offer->GetTransactionNum()); }
+
+    return output;
+}
+
+} // namespace
+
+TEST(OTOrderBook, empty)
+{
+    OTOrderBook book(true);
+    ASSERT_TRUE(book.empty());
+    ASSERT_EQ(0u, book.size());
+    ASSERT_EQ(nullptr, book.Best());
+    ASSERT_EQ(0, book.BestPrice());
+    ASSERT_TRUE(book.begin() == book.end());
+}
+
+TEST(OTOrderBook, bids_highest_price_first_then_oldest)
+{
+    auto one = make_offer(false, 10, 1);
+    auto two = make_offer(false, 20, 2);
+    auto three = make_offer(false, 10, 3);
+    auto four = make_offer(false, 20, 4);
+    OTOrderBook book(true);
+    ASSERT_TRUE(book.Insert(*one));
+    ASSERT_TRUE(book.Insert(*two));
+    ASSERT_TRUE(book.Insert(*three));
+    ASSERT_TRUE(book.Insert(*four));
+    ASSERT_EQ(4u, book.size());
+    ASSERT_EQ(2u, book.Levels().size());
+    ASSERT_EQ(20, book.BestPrice());
+    ASSERT_EQ(two.get(), book.Best());
+    ASSERT_EQ((std::vector<int64_t>{2, 4, 1, 3}), transactions(book));
+}
+
+TEST(OTOrderBook, asks_lowest_price_first_then_oldest)
+{
+    auto one = make_offer(true, 10, 1);
+    auto two = make_offer(true, 20, 2);
+    auto three = make_offer(true, 10, 3);
+    OTOrderBook book(false);
+    ASSERT_TRUE(book.Insert(*one));
+    ASSERT_TRUE(book.Insert(*two));
+    ASSERT_TRUE(book.Insert(*three));
+    ASSERT_EQ(10, book.BestPrice());
+    ASSERT_EQ(one.get(), book.Best());
+    ASSERT_EQ((std::vector<int64_t>{1, 3, 2}), transactions(book));
+}
+
+TEST(OTOrderBook, duplicate_transaction_number)
+{
+    auto one = make_offer(true, 10, 1);
+    auto other = make_offer(true, 30, 1);
+    OTOrderBook book(false);
+    ASSERT_TRUE(book.Insert(*one));
+    ASSERT_FALSE(book.Insert(*other));
+    ASSERT_EQ(1u, book.size());
+    ASSERT_EQ(10, book.BestPrice());
+}
+
+TEST(OTOrderBook, erase)
+{
+    auto one = make_offer(true, 10, 1);
+    auto two = make_offer(true, 10, 2);
+    auto three = make_offer(true, 20, 3);
+    OTOrderBook book(false);
+    book.Insert(*one);
+    book.Insert(*two);
+    book.Insert(*three);
+    ASSERT_EQ(nullptr, book.Erase(4));
+    ASSERT_EQ(two.get(), book.Erase(2));
+    ASSERT_EQ(nullptr, book.Find(2));
+    ASSERT_EQ((std::vector<int64_t>{1, 3}), transactions(book));
+    ASSERT_EQ(one.get(), book.Erase(1));
+    ASSERT_EQ(1u, book.Levels().size());
+    ASSERT_EQ(20, book.BestPrice());
+    ASSERT_EQ(three.get(), book.Erase(3));
+    ASSERT_TRUE(book.empty());
+    ASSERT_TRUE(book.Levels().empty());
+}
+
+TEST(OTOrderBook, replace_keeps_place_in_line)
+{
+    auto one = make_offer(true, 10, 1);
+    auto two = make_offer(true, 10, 2);
+    auto updated = make_offer(true, 10, 1);
+    auto moved = make_offer(true, 15, 2);
+    OTOrderBook book(false);
+    book.Insert(*one);
+    book.Insert(*two);
+    ASSERT_EQ(nullptr, book.Replace(*moved));
+    ASSERT_EQ(two.get(), book.Find(2));
+    ASSERT_EQ(one.get(), book.Replace(*updated));
+    ASSERT_EQ(updated.get(), book.Best());
+    ASSERT_EQ((std::vector<int64_t>{1, 2}), transactions(book));
+}
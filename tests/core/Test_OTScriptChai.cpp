@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opentxs/core/script/OTParty.hpp"
+#include "opentxs/core/script/OTScript.hpp"
+#include "opentxs/core/script/OTScriptable.hpp"
+#include "opentxs/core/script/OTVariable.hpp"
+
+#ifdef OT_USE_SCRIPT_CHAI
+
+using namespace opentxs;
+
+namespace
+{
+
+// Gives the tests the interpreter which a scriptable reuses for every clause
+// it runs.
+class TestScriptable : public OTScriptable
+{
+public:
+    using OTScriptable::GetInterpreter;
+};
+
+class Test_OTScriptChai : public ::testing::Test
+{
+public:
+    TestScriptable scriptable_;
+
+    // Loads a contract into the shared interpreter the way
+    // OTScriptable::ExecuteCallback does: the code, then the parties, then
+    // the variables.
+    std::shared_ptr<OTScript> load(
+        const std::string& code,
+        const std::vector<OTParty*>& parties,
+        const std::vector<OTVariable*>& variables)
+    {
+        auto output = scriptable_.GetInterpreter("chai", code);
+
+        if (!output) { return output; }
+
+        for (auto& party : parties) {
+            output->AddParty(party->GetPartyName(), *party);
+        }
+
+        for (auto& variable : variables) {
+            variable->RegisterForExecution(*output);
+        }
+
+        return output;
+    }
+};
+
+}  // namespace
+
+TEST_F(Test_OTScriptChai, reuses_interpreter)
+{
+    auto first = load("1;", {}, {});
+    auto second = load("2;", {}, {});
+
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first.get(), second.get());
+}
+
+TEST_F(Test_OTScriptChai, writes_persist)
+{
+    OTVariable counter("counter", 1, OTVariable::Var_Persistent);
+    OTVariable memo("memo", std::string("paid"), OTVariable::Var_Important);
+    const std::string code = "counter = counter + 1; memo = memo + \"!\";";
+
+    ASSERT_TRUE(load(code, {}, {&counter, &memo})->ExecuteScript());
+    EXPECT_EQ(2, counter.GetValueInteger());
+    EXPECT_EQ("paid!", memo.GetValueString());
+
+    // The second run of the same code calls the function compiled by the
+    // first one.
+    ASSERT_TRUE(load(code, {}, {&counter, &memo})->ExecuteScript());
+    EXPECT_EQ(3, counter.GetValueInteger());
+    EXPECT_EQ("paid!!", memo.GetValueString());
+}
+
+TEST_F(Test_OTScriptChai, constants_are_read_only)
+{
+    OTVariable limit("limit", 10, OTVariable::Var_Constant);
+
+    EXPECT_FALSE(load("limit = 20;", {}, {&limit})->ExecuteScript());
+    EXPECT_EQ(10, limit.GetValueInteger());
+}
+
+TEST_F(Test_OTScriptChai, parties_do_not_leak)
+{
+    OTParty alice("alice", true, "alice_nym", "alice_agent");
+    OTParty bob("bob", true, "bob_nym", "bob_agent");
+    OTVariable result("result", std::string(""));
+
+    ASSERT_TRUE(load("alice", {&alice}, {})->ExecuteScript(&result));
+    EXPECT_EQ("alice", result.GetValueString());
+
+    EXPECT_FALSE(load("alice", {&bob}, {})->ExecuteScript(&result));
+
+    ASSERT_TRUE(load("bob", {&bob}, {})->ExecuteScript(&result));
+    EXPECT_EQ("bob", result.GetValueString());
+}
+
+TEST_F(Test_OTScriptChai, variables_do_not_leak)
+{
+    OTVariable firstCounter("counter", 1, OTVariable::Var_Persistent);
+    OTVariable limit("limit", 10, OTVariable::Var_Constant);
+    OTVariable secondCounter("counter", 5, OTVariable::Var_Persistent);
+    const std::string code = "counter = counter + limit;";
+
+    ASSERT_TRUE(load(code, {}, {&firstCounter, &limit})->ExecuteScript());
+    EXPECT_EQ(11, firstCounter.GetValueInteger());
+
+    // The second contract has no limit, and its counter is its own.
+    EXPECT_FALSE(load(code, {}, {&secondCounter})->ExecuteScript());
+    EXPECT_EQ(5, secondCounter.GetValueInteger());
+
+    ASSERT_TRUE(
+        load("counter = counter + 1;", {}, {&secondCounter})->ExecuteScript());
+    EXPECT_EQ(6, secondCounter.GetValueInteger());
+    EXPECT_EQ(11, firstCounter.GetValueInteger());
+}
+
+TEST_F(Test_OTScriptChai, locals_do_not_leak)
+{
+    OTVariable counter("counter", 0, OTVariable::Var_Persistent);
+    OTVariable result("result", 0);
+
+    ASSERT_TRUE(
+        load("var temp = 5; counter = temp;", {}, {&counter})->ExecuteScript());
+    EXPECT_EQ(5, counter.GetValueInteger());
+
+    EXPECT_FALSE(load("temp", {}, {})->ExecuteScript(&result));
+}
+
+#endif  // OT_USE_SCRIPT_CHAI
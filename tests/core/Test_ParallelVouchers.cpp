@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "opentxs/api/Executor.hpp"
+#include "opentxs/api/OT.hpp"
+#include "opentxs/core/crypto/NymParameters.hpp"
+#include "opentxs/core/crypto/OTAsymmetricKey.hpp"
+#include "opentxs/core/crypto/OTCallback.hpp"
+#include "opentxs/core/crypto/OTCaller.hpp"
+#include "opentxs/core/crypto/OTPassword.hpp"
+#include "opentxs/core/util/Common.hpp"
+#include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/core/Cheque.hpp"
+#include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Nym.hpp"
+#include "opentxs/core/String.hpp"
+
+using namespace opentxs;
+
+// PayDividendVisitor::Trigger() runs on several executor threads at once,
+// and each call issues a voucher and signs it with the one server nym. These
+// tests do the same, without a notary around them.
+namespace
+{
+
+class TestCallback : public OTCallback
+{
+public:
+    void runOne(const char*, OTPassword& theOutput) const override
+    {
+        theOutput.setPassword("test", 4);
+    }
+
+    void runTwo(const char*, OTPassword& theOutput) const override
+    {
+        theOutput.setPassword("test", 4);
+    }
+};
+
+class Test_ParallelVouchers : public ::testing::Test
+{
+public:
+    static std::string home_;
+    static TestCallback callback_;
+    static OTCaller caller_;
+    static std::unique_ptr<AppLoader> app_;
+    static std::unique_ptr<Nym> server_nym_;
+
+    static void SetUpTestCase()
+    {
+        char folder[] = "/tmp/ot_parallel_vouchers_XXXXXX";
+
+        ASSERT_NE(nullptr, ::mkdtemp(folder));
+        home_ = folder;
+        OTPaths::SetHomeFolder(String(folder));
+        caller_.setCallback(&callback_);
+        ASSERT_TRUE(OT_API_Set_PasswordCallback(caller_));
+        app_.reset(new AppLoader);
+        server_nym_.reset(new Nym(NymParameters(proto::CREDTYPE_LEGACY)));
+
+        ASSERT_TRUE(server_nym_->VerifyPseudonym());
+    }
+
+    static void TearDownTestCase()
+    {
+        server_nym_.reset();
+        app_.reset();
+
+        if (!home_.empty()) {
+            std::system(("rm -rf " + home_).c_str());
+        }
+    }
+
+    static Identifier ID(const std::string& seed)
+    {
+        Identifier output;
+        output.CalculateDigest(String(seed.c_str()));
+
+        return output;
+    }
+};
+
+std::string Test_ParallelVouchers::home_;
+TestCallback Test_ParallelVouchers::callback_;
+OTCaller Test_ParallelVouchers::caller_;
+std::unique_ptr<AppLoader> Test_ParallelVouchers::app_;
+std::unique_ptr<Nym> Test_ParallelVouchers::server_nym_;
+
+}  // namespace
+
+TEST_F(Test_ParallelVouchers, every_index_once)
+{
+    const std::size_t count = 10000;
+    std::vector<std::atomic<int>> visits(count);
+
+    for (auto& it : visits) { it.store(0); }
+
+    OT::App().Executor().Parallel(
+        count, [&](const std::size_t i) -> void { ++visits[i]; }, 8);
+
+    for (const auto& it : visits) { ASSERT_EQ(1, it.load()); }
+}
+
+TEST_F(Test_ParallelVouchers, nested_on_every_worker)
+{
+    auto& executor = OT::App().Executor();
+    const std::size_t outer = 4 * executor.Stats().workers_;
+    std::atomic<std::size_t> total{0};
+
+    // Every worker ends up waiting in an inner Parallel() call, which must
+    // still finish without any worker being free to help.
+    executor.Parallel(
+        outer,
+        [&](const std::size_t) -> void {
+            executor.Parallel(
+                100, [&](const std::size_t) -> void { ++total; }, 4);
+        },
+        outer);
+
+    ASSERT_EQ(outer * 100, total.load());
+}
+
+TEST_F(Test_ParallelVouchers, sign_with_one_nym)
+{
+    const std::size_t count = 64;
+    const Identifier notary = ID("notary");
+    const Identifier unit = ID("unit");
+    const Identifier voucherAccount = ID("voucher account");
+    const Identifier serverNymID(*server_nym_);
+    const String memo("dividend");
+    const time64_t validFrom = OTTimeGetCurrentTime();
+    const time64_t validTo = OTTimeAddTimeInterval(
+        validFrom, OTTimeGetSecondsFromTime(OT_TIME_SIX_MONTHS_IN_SECONDS));
+    std::vector<std::string> vouchers(count);
+    std::atomic<std::size_t> failures{0};
+
+    OT::App().Executor().Parallel(
+        count,
+        [&](const std::size_t i) -> void {
+            const Identifier recipient = ID("recipient " + std::to_string(i));
+            Cheque voucher(notary, unit);
+
+            if (!voucher.IssueCheque(
+                    100,
+                    i + 1,
+                    validFrom,
+                    validTo,
+                    voucherAccount,
+                    serverNymID,
+                    memo,
+                    &recipient)) {
+                ++failures;
+
+                return;
+            }
+
+            voucher.SetAsVoucher(serverNymID, voucherAccount);
+
+            if (!voucher.SignContract(*server_nym_) ||
+                !voucher.SaveContract()) {
+                ++failures;
+
+                return;
+            }
+
+            vouchers[i] = String(voucher).Get();
+        },
+        count);
+
+    ASSERT_EQ(0, failures.load());
+
+    std::set<std::int64_t> numbers;
+
+    for (const auto& serialized : vouchers) {
+        Cheque voucher;
+
+        ASSERT_TRUE(voucher.LoadContractFromString(String(serialized)));
+        EXPECT_TRUE(voucher.VerifySignature(*server_nym_));
+        EXPECT_EQ(100, voucher.GetAmount());
+        numbers.insert(voucher.GetTransactionNum());
+    }
+
+    ASSERT_EQ(count, numbers.size());
+}
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+
+#if OT_STORAGE_PACK
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "opentxs/storage/StorageConfig.hpp"
+#include "opentxs/storage/drivers/StoragePack.hpp"
+
+using namespace opentxs;
+
+namespace
+{
+
+// Record header: magic, key size, value size, checksum
+const std::size_t HEADER_SIZE = 16;
+
+class TestPack : public StoragePack
+{
+public:
+    TestPack(
+        const StorageConfig& config,
+        const Digest& hash,
+        const Random& random,
+        std::atomic<bool>& bucket)
+        : StoragePlugin_impl(config, hash, random, bucket)
+        , StoragePack(config, hash, random, bucket)
+    {
+    }
+};
+
+struct Test_StoragePack : public ::testing::Test
+{
+    StorageConfig config_;
+    Digest hash_;
+    Random random_;
+    std::atomic<bool> bucket_{false};
+    std::unique_ptr<TestPack> pack_;
+
+    Test_StoragePack()
+    {
+        char folder[] = "/tmp/ot_storage_pack_XXXXXX";
+
+        EXPECT_NE(nullptr, ::mkdtemp(folder));
+        config_.path_ = folder;
+        hash_ = [](const std::uint32_t, const std::string&, std::string&) {
+            return false;
+        };
+        random_ = []() { return std::string(); };
+        Open();
+    }
+
+    ~Test_StoragePack()
+    {
+        pack_.reset();
+
+        for (const auto& name : {std::string("a.pack"),
+                                 std::string("b.pack"),
+                                 std::string("root")}) {
+            std::remove((config_.path_ + "/" + name).c_str());
+        }
+
+        ::rmdir(config_.path_.c_str());
+    }
+
+    std::string Filename() const { return config_.path_ + "/a.pack"; }
+
+    void Open()
+    {
+        pack_.reset();
+        pack_.reset(new TestPack(config_, hash_, random_, bucket_));
+    }
+
+    std::size_t Size() const
+    {
+        struct stat info;
+
+        if (0 != ::stat(Filename().c_str(), &info)) { return 0; }
+
+        return info.st_size;
+    }
+
+    void Write(const std::size_t offset, const std::string& data) const
+    {
+        const int fd = ::open(Filename().c_str(), O_WRONLY);
+
+        ASSERT_NE(-1, fd);
+        ASSERT_EQ(
+            static_cast<ssize_t>(data.size()),
+            ::pwrite(fd, data.data(), data.size(), offset));
+        ::close(fd);
+    }
+};
+
+}  // namespace
+
+TEST_F(Test_StoragePack, reload)
+{
+    std::string value;
+
+    ASSERT_TRUE(pack_->Store("k1", "v1", false));
+    ASSERT_TRUE(pack_->Store("k2", "value2", false));
+    ASSERT_TRUE(pack_->Store("k3", "", true));
+    ASSERT_EQ(2 * (HEADER_SIZE + 2) + 2 + 6, Size());
+
+    Open();
+
+    ASSERT_TRUE(pack_->Load("k1", value, false));
+    ASSERT_EQ("v1", value);
+    ASSERT_TRUE(pack_->Load("k2", value, false));
+    ASSERT_EQ("value2", value);
+    ASSERT_TRUE(pack_->Load("k3", value, true));
+    ASSERT_EQ("", value);
+    ASSERT_FALSE(pack_->Load("k3", value, false));
+}
+
+TEST_F(Test_StoragePack, batch_is_readable_before_commit)
+{
+    std::string value;
+
+    ASSERT_TRUE(pack_->Begin());
+    ASSERT_TRUE(pack_->Store("k1", "v1", false));
+    ASSERT_EQ(0, Size());
+    ASSERT_TRUE(pack_->Load("k1", value, false));
+    ASSERT_EQ("v1", value);
+    ASSERT_TRUE(pack_->Commit());
+    ASSERT_EQ(HEADER_SIZE + 4, Size());
+
+    Open();
+
+    ASSERT_TRUE(pack_->Load("k1", value, false));
+    ASSERT_EQ("v1", value);
+}
+
+TEST_F(Test_StoragePack, discards_torn_record)
+{
+    std::string value;
+
+    ASSERT_TRUE(pack_->Store("k1", "v1", false));
+
+    pack_.reset();
+    const std::size_t size = Size();
+    // A header and part of the key
+    Write(size, std::string("OTPK\x02\0\0\0\x02\0\0\0\0\0\0\0k", 17));
+    Open();
+
+    ASSERT_EQ(size, Size());
+    ASSERT_TRUE(pack_->Load("k1", value, false));
+    ASSERT_EQ("v1", value);
+}
+
+TEST_F(Test_StoragePack, skips_damaged_record)
+{
+    std::string value;
+    const std::size_t record = HEADER_SIZE + 4;
+
+    ASSERT_TRUE(pack_->Store("k1", "v1", false));
+    ASSERT_TRUE(pack_->Store("k2", "v2", false));
+    ASSERT_TRUE(pack_->Store("k3", "v3", false));
+
+    pack_.reset();
+    // The value of the second record
+    Write(record + HEADER_SIZE + 2, "xx");
+    Open();
+
+    ASSERT_EQ(3 * record, Size());
+    ASSERT_TRUE(pack_->Load("k1", value, false));
+    ASSERT_EQ("v1", value);
+    ASSERT_FALSE(pack_->Load("k2", value, false));
+    ASSERT_TRUE(pack_->Load("k3", value, false));
+    ASSERT_EQ("v3", value);
+
+    ASSERT_TRUE(pack_->Store("k2", "v2", false));
+
+    Open();
+
+    ASSERT_TRUE(pack_->Load("k2", value, false));
+    ASSERT_EQ("v2", value);
+    ASSERT_TRUE(pack_->Load("k3", value, false));
+    ASSERT_EQ("v3", value);
+}
+
+TEST_F(Test_StoragePack, batch_belongs_to_one_thread)
+{
+    const std::size_t record = HEADER_SIZE + 4;
+
+    ASSERT_TRUE(pack_->Begin());
+
+    std::thread other([&]() { pack_->Store("k2", "v2", false); });
+    other.join();
+
+    ASSERT_EQ(record, Size());
+    ASSERT_TRUE(pack_->Store("k1", "v1", false));
+    ASSERT_EQ(record, Size());
+    ASSERT_TRUE(pack_->Commit());
+    ASSERT_EQ(2 * record, Size());
+}
+
+TEST_F(Test_StoragePack, rewrites_damaged_record)
+{
+    std::string value;
+
+    ASSERT_TRUE(pack_->Store("k1", "v1", false));
+    Write(HEADER_SIZE + 2, "xx");
+
+    ASSERT_FALSE(pack_->Load("k1", value, false));
+    ASSERT_TRUE(pack_->Store("k1", "v1", false));
+    ASSERT_TRUE(pack_->Load("k1", value, false));
+    ASSERT_EQ("v1", value);
+}
+
+TEST_F(Test_StoragePack, empty_bucket)
+{
+    std::string value;
+
+    ASSERT_TRUE(pack_->Store("k1", "v1", false));
+    ASSERT_TRUE(pack_->Store("k1", "v1", true));
+    ASSERT_TRUE(pack_->EmptyBucket(false));
+
+    ASSERT_EQ(0, Size());
+    ASSERT_FALSE(pack_->Load("k1", value, false));
+    ASSERT_TRUE(pack_->Load("k1", value, true));
+    ASSERT_EQ("v1", value);
+}
+#endif
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+
+#include "opentxs/core/String.hpp"
+
+using namespace opentxs;
+
+TEST(String, default_accessors)
+{
+    String string;
+    ASSERT_FALSE(string.Exists());
+    ASSERT_EQ(0, string.GetLength());
+    ASSERT_STREQ("", string.Get());
+    ASSERT_TRUE(string.IsSecure());
+}
+
+TEST(String, copy_short_and_long)
+{
+    const std::string small("otx5ai2fjSuUZVVxgYLxiY7oBdLdJjakJH2W");
+    const std::string large(1000, 'x');
+
+    String one(small);
+    String two(large);
+    String oneCopy(one);
+    String twoCopy(two);
+
+    ASSERT_STREQ(small.c_str(), oneCopy.Get());
+    ASSERT_STREQ(large.c_str(), twoCopy.Get());
+    ASSERT_TRUE(one.Get() != oneCopy.Get());
+}
+
+TEST(String, move_leaves_source_empty)
+{
+    String one("abcd");
+    String other(std::move(one));
+    ASSERT_FALSE(one.Exists());
+    ASSERT_STREQ("abcd", other.Get());
+    ASSERT_EQ(4, other.GetLength());
+}
+
+TEST(String, swap_inline_with_allocated)
+{
+    const std::string large(100, 'b');
+    String one("abcd");
+    String other(large);
+    one.swap(other);
+    ASSERT_STREQ(large.c_str(), one.Get());
+    ASSERT_STREQ("abcd", other.Get());
+}
+
+TEST(String, assign_and_modify)
+{
+    String string("abc");
+    string = String(std::string(60, 'd'));
+    ASSERT_EQ(60, string.GetLength());
+    string.Set("short");
+    ASSERT_STREQ("short", string.Get());
+    string.Concatenate("%s", " string");
+    ASSERT_STREQ("short string", string.Get());
+    string.ConvertToUpperCase();
+    ASSERT_STREQ("SHORT STRING", string.Get());
+}
+
+TEST(String, secure_is_copied_and_kept)
+{
+    String secret("password");
+    ASSERT_TRUE(secret.IsSecure());
+
+    String copy(secret);
+    ASSERT_TRUE(copy.IsSecure());
+
+    String plain;
+    plain.Set(secret);
+    ASSERT_TRUE(plain.IsSecure());
+
+    secret = String("other");
+    ASSERT_TRUE(secret.IsSecure());
+    ASSERT_STREQ("other", secret.Get());
+}
+
+TEST(String, plain_is_not_copied)
+{
+    String plain("notary");
+    plain.SetSecure(false);
+    ASSERT_FALSE(plain.IsSecure());
+
+    String copy(plain);
+    ASSERT_TRUE(copy.IsSecure());
+
+    plain = String("password");
+    ASSERT_TRUE(plain.IsSecure());
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <zlib.h>
+#include <string>
+
+#include "opentxs/core/String.hpp"
+#include "opentxs/network/WireFormat.hpp"
+
+using namespace opentxs;
+
+namespace
+{
+
+std::string deflate_string(const std::string& input)
+{
+    uLongf size = compressBound(input.size());
+    std::string output(size, '\0');
+
+    EXPECT_EQ(
+        Z_OK,
+        compress(
+            reinterpret_cast<Bytef*>(&output[0]),
+            &size,
+            reinterpret_cast<const Bytef*>(input.data()),
+            input.size()));
+    output.resize(size);
+
+    return output;
+}
+
+}  // namespace
+
+TEST(WireFormat, probe_and_header)
+{
+    ASSERT_TRUE(WireFormat::IsProbe(WireFormat::TAG));
+    ASSERT_FALSE(WireFormat::IsHeader(WireFormat::TAG));
+    ASSERT_TRUE(WireFormat::IsHeader(WireFormat::TAG + "r"));
+    ASSERT_FALSE(WireFormat::IsProbe(WireFormat::TAG + "r"));
+    ASSERT_FALSE(WireFormat::IsHeader(WireFormat::TAG + "rr"));
+    ASSERT_FALSE(WireFormat::IsHeader("OTWIRE2r"));
+    ASSERT_FALSE(WireFormat::IsHeader(""));
+    ASSERT_FALSE(WireFormat::IsProbe(""));
+}
+
+TEST(WireFormat, small_message_is_raw)
+{
+    const String message("<notaryMessage/>");
+    std::string header, payload;
+
+    ASSERT_TRUE(WireFormat::Encode(message, header, payload));
+    ASSERT_TRUE(WireFormat::IsHeader(header));
+    ASSERT_EQ(WireFormat::TAG + "r", header);
+    ASSERT_EQ(std::string(message.Get()), payload);
+
+    String decoded;
+    ASSERT_TRUE(WireFormat::Decode(header, payload, decoded));
+    ASSERT_STREQ(message.Get(), decoded.Get());
+}
+
+TEST(WireFormat, large_message_is_compressed)
+{
+    const std::string text(64 * 1024, 'x');
+    const String message(text);
+    std::string header, payload;
+
+    ASSERT_TRUE(WireFormat::Encode(message, header, payload));
+    ASSERT_EQ(WireFormat::TAG + "z", header);
+    ASSERT_GT(text.size(), payload.size());
+
+    String decoded;
+    ASSERT_TRUE(WireFormat::Decode(header, payload, decoded));
+    ASSERT_EQ(text, std::string(decoded.Get()));
+}
+
+TEST(WireFormat, decode_rejects_bad_input)
+{
+    String decoded;
+
+    ASSERT_FALSE(WireFormat::Decode(WireFormat::TAG, "payload", decoded));
+    ASSERT_FALSE(
+        WireFormat::Decode(WireFormat::TAG + "q", "payload", decoded));
+    ASSERT_FALSE(
+        WireFormat::Decode(WireFormat::TAG + "z", "not zlib", decoded));
+    ASSERT_FALSE(WireFormat::Decode(WireFormat::TAG + "r", "", decoded));
+
+    const std::string truncated =
+        deflate_string(std::string(4096, 'y')).substr(0, 8);
+    ASSERT_FALSE(
+        WireFormat::Decode(WireFormat::TAG + "z", truncated, decoded));
+}
+
+TEST(WireFormat, decode_rejects_oversized_payload)
+{
+    const std::string limit(WireFormat::MAX_MESSAGE_SIZE, 'a');
+    String decoded;
+
+    ASSERT_TRUE(WireFormat::Decode(WireFormat::TAG + "r", limit, decoded));
+    ASSERT_EQ(limit.size(), decoded.GetLength());
+    ASSERT_FALSE(
+        WireFormat::Decode(WireFormat::TAG + "r", limit + "a", decoded));
+
+    ASSERT_TRUE(WireFormat::Decode(
+        WireFormat::TAG + "z", deflate_string(limit), decoded));
+    ASSERT_EQ(limit.size(), decoded.GetLength());
+
+    // Well under a megabyte, which would inflate to 64 MB
+    const std::string bomb = deflate_string(std::string(64 * 1024 * 1024, 'a'));
+    ASSERT_GT(static_cast<std::size_t>(1024 * 1024), bomb.size());
+    ASSERT_FALSE(WireFormat::Decode(WireFormat::TAG + "z", bomb, decoded));
+}
+
+TEST(WireFormat, encode_rejects_oversized_message)
+{
+    const std::string limit(WireFormat::MAX_MESSAGE_SIZE, 'a');
+    std::string header, payload;
+
+    ASSERT_TRUE(WireFormat::Encode(String(limit), header, payload));
+    ASSERT_FALSE(WireFormat::Encode(String(limit + "a"), header, payload));
+}